@@ -206,6 +206,43 @@ function( ADD_SIMULATION_TEST )
 
 endfunction()
 
+# Named arguments
+# IDF_FILE <filename> IDF input file
+# EPW_FILE <filename> EPW weather file
+# ENVIRONMENT <VARIABLE=VALUE> environment variable that selects the alternate solution path
+# ENERGYPLUS_FLAGS <flags> additional command line flags for both runs
+#
+# Runs the design days of the input file with and without the environment variable set
+# and passes when both runs produce the same eso results.
+function( ADD_SIMULATION_COMPARISON_TEST )
+  set(options)
+  set(oneValueArgs IDF_FILE EPW_FILE ENVIRONMENT)
+  set(multiValueArgs ENERGYPLUS_FLAGS)
+  cmake_parse_arguments(ADD_SIM_TEST "${options}" "${oneValueArgs}" "${multiValueArgs}" ${ARGN} )
+
+  get_filename_component(IDF_NAME "${ADD_SIM_TEST_IDF_FILE}" NAME_WE)
+  set( ENERGYPLUS_FLAGS "${ADD_SIM_TEST_ENERGYPLUS_FLAGS} -D" )
+  string(REGEX REPLACE "=.*$" "" ENVIRONMENT_VARIABLE "${ADD_SIM_TEST_ENVIRONMENT}")
+  string(REGEX REPLACE "^[^=]*=" "" ENVIRONMENT_VALUE "${ADD_SIM_TEST_ENVIRONMENT}")
+
+  add_test(NAME "integration.${IDF_NAME}.${ENVIRONMENT_VARIABLE}" COMMAND ${CMAKE_COMMAND}
+    -DSOURCE_DIR=${CMAKE_SOURCE_DIR}
+    -DBINARY_DIR=${CMAKE_BINARY_DIR}
+    -DENERGYPLUS_EXE=$<TARGET_FILE:energyplus>
+    -DIDF_FILE=${ADD_SIM_TEST_IDF_FILE}
+    -DEPW_FILE=${ADD_SIM_TEST_EPW_FILE}
+    -DENVIRONMENT_VARIABLE=${ENVIRONMENT_VARIABLE}
+    -DENVIRONMENT_VALUE=${ENVIRONMENT_VALUE}
+    -DBUILD_FORTRAN=${BUILD_FORTRAN}
+    -DENERGYPLUS_FLAGS=${ENERGYPLUS_FLAGS}
+    -P ${CMAKE_SOURCE_DIR}/cmake/RunSimulationComparison.cmake
+  )
+
+  set_tests_properties("integration.${IDF_NAME}.${ENVIRONMENT_VARIABLE}" PROPERTIES PASS_REGULAR_EXPRESSION "Test Passed")
+  set_tests_properties("integration.${IDF_NAME}.${ENVIRONMENT_VARIABLE}" PROPERTIES FAIL_REGULAR_EXPRESSION "ERROR;FAIL;Test Failed")
+
+endfunction()
+
 macro( ADD_CXX_DEFINITIONS NEWFLAGS )
   SET(CMAKE_CXX_FLAGS "${CMAKE_CXX_FLAGS} ${NEWFLAGS}")
 endmacro()
@@ -0,0 +1,84 @@
+# These need to be defined by the caller
+# SOURCE_DIR
+# BINARY_DIR
+# ENERGYPLUS_EXE
+# IDF_FILE
+# EPW_FILE
+# ENVIRONMENT_VARIABLE
+# ENVIRONMENT_VALUE
+# BUILD_FORTRAN
+# ENERGYPLUS_FLAGS
+
+# Runs the design days of the same input file twice, once with the default solution path and once with
+# ENVIRONMENT_VARIABLE set to ENVIRONMENT_VALUE, and checks that the two eso files agree.
+# The first eso line carries the program version and run time stamp and is not compared.
+
+get_filename_component(IDF_NAME "${IDF_FILE}" NAME_WE)
+get_filename_component(EXE_PATH "${ENERGYPLUS_EXE}" PATH)
+
+# Create path variables
+set (IDF_PATH "${SOURCE_DIR}/testfiles/${IDF_FILE}")
+set (PRODUCT_PATH "${BINARY_DIR}/Products/")
+set (EXE_PATH "${EXE_PATH}/")
+set (EPW_PATH "${SOURCE_DIR}/weather/${EPW_FILE}")
+set (DEFAULT_DIR_PATH "${BINARY_DIR}/testfiles/${IDF_NAME}-${ENVIRONMENT_VARIABLE}/Default/")
+set (TOGGLED_DIR_PATH "${BINARY_DIR}/testfiles/${IDF_NAME}-${ENVIRONMENT_VARIABLE}/${ENVIRONMENT_VARIABLE}/")
+
+# Copy IDD to Executable directory if it is not already there
+execute_process(COMMAND ${CMAKE_COMMAND} -E copy_if_different "${PRODUCT_PATH}/Energy+.idd" "${EXE_PATH}")
+
+# Convert flags back to CMake list
+string(STRIP ${ENERGYPLUS_FLAGS} ENERGYPLUS_FLAGS)
+string(REPLACE " " ";" ENERGYPLUS_FLAGS_LIST ${ENERGYPLUS_FLAGS})
+
+list(FIND ENERGYPLUS_FLAGS_LIST -x EXPAND_RESULT)
+if( BUILD_FORTRAN AND "${EXPAND_RESULT}" GREATER -1 )
+  find_program(EXPANDOBJECTS_EXE ExpandObjects PATHS "${PRODUCT_PATH}"
+    NO_DEFAULT_PATH NO_CMAKE_ENVIRONMENT_PATH NO_CMAKE_PATH NO_SYSTEM_ENVIRONMENT_PATH NO_CMAKE_SYSTEM_PATH NO_CMAKE_FIND_ROOT_PATH)
+  # Move to executable directory
+  execute_process(COMMAND ${CMAKE_COMMAND} -E copy_if_different "${EXPANDOBJECTS_EXE}" "${EXE_PATH}")
+endif()
+
+foreach( RUN_DIR_PATH "${DEFAULT_DIR_PATH}" "${TOGGLED_DIR_PATH}" )
+  execute_process(COMMAND "${CMAKE_COMMAND}" -E remove_directory "${RUN_DIR_PATH}" )
+  execute_process(COMMAND "${CMAKE_COMMAND}" -E make_directory "${RUN_DIR_PATH}" )
+endforeach()
+
+# Make sure the default run does not pick the variable up from the calling environment
+unset(ENV{${ENVIRONMENT_VARIABLE}})
+execute_process(COMMAND "${ENERGYPLUS_EXE}" -w "${EPW_PATH}" -d "${DEFAULT_DIR_PATH}" ${ENERGYPLUS_FLAGS_LIST} "${IDF_PATH}"
+                WORKING_DIRECTORY "${DEFAULT_DIR_PATH}"
+                RESULT_VARIABLE DEFAULT_RESULT)
+
+set(ENV{${ENVIRONMENT_VARIABLE}} "${ENVIRONMENT_VALUE}")
+execute_process(COMMAND "${ENERGYPLUS_EXE}" -w "${EPW_PATH}" -d "${TOGGLED_DIR_PATH}" ${ENERGYPLUS_FLAGS_LIST} "${IDF_PATH}"
+                WORKING_DIRECTORY "${TOGGLED_DIR_PATH}"
+                RESULT_VARIABLE TOGGLED_RESULT)
+unset(ENV{${ENVIRONMENT_VARIABLE}})
+
+if( NOT DEFAULT_RESULT EQUAL 0 OR NOT TOGGLED_RESULT EQUAL 0 )
+  message("Simulation did not complete: default returned ${DEFAULT_RESULT}, ${ENVIRONMENT_VARIABLE}=${ENVIRONMENT_VALUE} returned ${TOGGLED_RESULT}")
+  message("Test Failed")
+  return()
+endif()
+
+file(STRINGS "${DEFAULT_DIR_PATH}/eplusout.eso" DEFAULT_ESO)
+file(STRINGS "${TOGGLED_DIR_PATH}/eplusout.eso" TOGGLED_ESO)
+list(LENGTH DEFAULT_ESO DEFAULT_LENGTH)
+list(LENGTH TOGGLED_ESO TOGGLED_LENGTH)
+
+if( NOT DEFAULT_LENGTH EQUAL TOGGLED_LENGTH OR DEFAULT_LENGTH EQUAL 0 )
+  message("eso line counts differ: default ${DEFAULT_LENGTH}, ${ENVIRONMENT_VARIABLE}=${ENVIRONMENT_VALUE} ${TOGGLED_LENGTH}")
+  message("Test Failed")
+  return()
+endif()
+
+list(REMOVE_AT DEFAULT_ESO 0)
+list(REMOVE_AT TOGGLED_ESO 0)
+
+if( "${DEFAULT_ESO}" STREQUAL "${TOGGLED_ESO}" )
+  message("Test Passed")
+else()
+  message("eso results differ between the default run and ${ENVIRONMENT_VARIABLE}=${ENVIRONMENT_VALUE}")
+  message("Test Failed")
+endif()
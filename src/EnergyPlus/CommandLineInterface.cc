@@ -1,3 +1,18 @@
+// C++ Headers
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <thread>
+#include <vector>
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
 // CLI Headers
 #include <ezOptionParser.hpp>
 
@@ -6,6 +21,7 @@
 
 // Project headers
 #include <CommandLineInterface.hh>
+#include <DataErrorTracking.hh>
 #include <DataGlobals.hh>
 #include <DataStringGlobals.hh>
 #include <DataSystemVariables.hh>
@@ -35,6 +51,200 @@ using namespace OutputProcessor;
 using namespace SolarShading;
 using namespace ez;
 
+bool batchMode(false);
+
+// Output file name suffixes of the selected suffix style
+static std::string normalSuffix;
+static std::string tableSuffix;
+static std::string mapSuffix;
+static std::string zszSuffix;
+static std::string sszSuffix;
+static std::string meterSuffix;
+static std::string sqliteSuffix;
+static std::string adsSuffix;
+static std::string screenSuffix;
+static std::string profSuffix;
+static std::string batchSuffix;
+
+// Output file name prefix, without the output directory
+static std::string outputPrefixName("eplus");
+
+std::vector<BatchJob> batchJobs;
+static int numBatchWorkers(1);
+static std::string batchSummaryFileName;
+
+void
+SetupOutputFileNames(std::string const & dirPathName)
+{
+	// Set the names of the input-dependent and output files from the current
+	// input and weather files, for output to dirPathName
+
+	std::string outputFilePrefix = dirPathName + outputPrefixName;
+
+	idfFileNameOnly = removeFileExtension(getFileName(inputIdfFileName));
+	idfDirPathName = getParentDirectoryPath(inputIdfFileName);
+
+	std::string weatherFilePathWithoutExtension = removeFileExtension(inputWeatherFileName);
+
+	// EnergyPlus files
+	outputAuditFileName = outputFilePrefix + normalSuffix + ".audit";
+	outputBndFileName = outputFilePrefix + normalSuffix + ".bnd";
+	outputDxfFileName = outputFilePrefix + normalSuffix + ".dxf";
+	outputEioFileName = outputFilePrefix + normalSuffix + ".eio";
+	outputEndFileName = outputFilePrefix + normalSuffix + ".end";
+	outputErrFileName = outputFilePrefix + normalSuffix + ".err";
+	outputEsoFileName = outputFilePrefix + normalSuffix + ".eso";
+	outputMtdFileName = outputFilePrefix + normalSuffix + ".mtd";
+	outputMddFileName = outputFilePrefix + normalSuffix + ".mdd";
+	outputMtrFileName = outputFilePrefix + normalSuffix + ".mtr";
+	outputRddFileName = outputFilePrefix + normalSuffix + ".rdd";
+	outputShdFileName = outputFilePrefix + normalSuffix + ".shd";
+	outputDfsFileName = outputFilePrefix + normalSuffix + ".dfs";
+	outputEddFileName = outputFilePrefix + normalSuffix + ".edd";
+	outputIperrFileName = outputFilePrefix + normalSuffix + ".iperr";
+	outputSlnFileName = outputFilePrefix + normalSuffix + ".sln";
+	outputSciFileName = outputFilePrefix + normalSuffix + ".sci";
+	outputWrlFileName = outputFilePrefix + normalSuffix + ".wrl";
+	outputSqlFileName = outputFilePrefix + normalSuffix + ".sql";
+	outputDbgFileName = outputFilePrefix + normalSuffix + ".dbg";
+	outputTblCsvFileName = outputFilePrefix + tableSuffix + ".csv";
+	outputTblHtmFileName = outputFilePrefix + tableSuffix + ".htm";
+	outputTblTabFileName = outputFilePrefix + tableSuffix + ".tab";
+	outputTblTxtFileName = outputFilePrefix + tableSuffix + ".txt";
+	outputTblXmlFileName = outputFilePrefix + tableSuffix + ".xml";
+	outputMapTabFileName = outputFilePrefix + mapSuffix + ".tab";
+	outputMapCsvFileName = outputFilePrefix + mapSuffix + ".csv";
+	outputMapTxtFileName = outputFilePrefix + mapSuffix + ".txt";
+	outputZszCsvFileName = outputFilePrefix + zszSuffix + ".csv";
+	outputZszTabFileName = outputFilePrefix + zszSuffix + ".tab";
+	outputZszTxtFileName = outputFilePrefix + zszSuffix + ".txt";
+	outputSszCsvFileName = outputFilePrefix + sszSuffix + ".csv";
+	outputSszTabFileName = outputFilePrefix + sszSuffix + ".tab";
+	outputSszTxtFileName = outputFilePrefix + sszSuffix + ".txt";
+	outputAdsFileName = outputFilePrefix + adsSuffix + ".out";
+	outputSqliteErrFileName = dirPathName + sqliteSuffix + ".err";
+	outputScreenCsvFileName = outputFilePrefix + screenSuffix + ".csv";
+	outputProfCsvFileName = outputFilePrefix + profSuffix + ".csv";
+	outputProfFoldedFileName = outputFilePrefix + profSuffix + ".folded";
+	outputDelightInFileName = "eplusout.delightin";
+	outputDelightOutFileName = "eplusout.delightout";
+	outputDelightEldmpFileName = "eplusout.delighteldmp";
+	outputDelightDfdmpFileName = "eplusout.delightdfdmp";
+	EnergyPlusIniFileName = "Energy+.ini";
+	inStatFileName = weatherFilePathWithoutExtension + ".stat";
+	TarcogIterationsFileName = "TarcogIterations.dbg";
+	eplusADSFileName = idfDirPathName+"eplusADS.inp";
+
+	// Readvars files
+	outputCsvFileName = outputFilePrefix + normalSuffix + ".csv";
+	outputMtrCsvFileName = outputFilePrefix + meterSuffix + ".csv";
+	outputRvauditFileName = outputFilePrefix + normalSuffix + ".rvaudit";
+}
+
+void
+OpenOutputDebugFile()
+{
+	int iostatus;
+
+	OutputFileDebug = GetNewUnitNumber();
+	{ IOFlags flags; flags.ACTION( "write" ); gio::open( OutputFileDebug, outputDbgFileName, flags ); iostatus = flags.ios(); }
+	if ( iostatus != 0 ) {
+		ShowFatalError( "EnergyPlus: Could not open output debug file: " + outputDbgFileName + "." );
+	}
+}
+
+void
+ReadBatchManifest(std::string const & manifestFileName, std::string const & dirPathName, bool weatherFileSet)
+{
+	// Read the jobs of a batch manifest. Each line lists an input file, and
+	// optionally a weather file and an output directory, separated by commas.
+	// Text after '!' or '#' is a comment. A blank weather file uses the weather
+	// file of the command line; a blank output directory is a directory named
+	// after the input file in the output directory of the command line.
+
+	std::ifstream manifest(manifestFileName);
+	if (!manifest) {
+		DisplayString("ERROR: Could not find batch manifest: " + getAbsolutePath(manifestFileName) + "." );
+		exit(EXIT_FAILURE);
+	}
+
+	std::string line;
+	int lineNum = 0;
+	bool errorsFound = false;
+	while (std::getline(manifest, line)) {
+		++lineNum;
+		std::string::size_type commentPosition = line.find_first_of("!#");
+		if (commentPosition != std::string::npos) line.erase(commentPosition);
+		strip(line);
+		if (line.empty()) continue;
+
+		std::vector<std::string> fields;
+		std::string::size_type fieldStart = 0;
+		while (true) {
+			std::string::size_type commaPosition = line.find(',', fieldStart);
+			std::string field = line.substr(fieldStart, commaPosition == std::string::npos ? std::string::npos : commaPosition - fieldStart);
+			strip(field);
+			if (field.size() >= 2 && field[0] == '"' && field[field.size()-1] == '"') field = field.substr(1, field.size() - 2);
+			fields.push_back(field);
+			if (commaPosition == std::string::npos) break;
+			fieldStart = commaPosition + 1;
+		}
+
+		std::string const lineLabel = manifestFileName + ", line " + std::to_string(lineNum);
+		if (fields.size() > 3 || fields[0].empty()) {
+			DisplayString("ERROR: Expected 'input-file[,weather-file[,output-directory]]' in batch manifest " + lineLabel + ".");
+			errorsFound = true;
+			continue;
+		}
+
+		std::string inputFileName = fields[0];
+		std::string weatherFileName = (fields.size() > 1) ? fields[1] : "";
+		std::string outputDirectory = (fields.size() > 2) ? fields[2] : "";
+		bool checkWeatherFile = weatherFileSet || !weatherFileName.empty();
+		if (weatherFileName.empty()) weatherFileName = inputWeatherFileName;
+		if (outputDirectory.empty()) outputDirectory = dirPathName + removeFileExtension(getFileName(inputFileName));
+		makeNativePath(inputFileName);
+		makeNativePath(weatherFileName);
+		makeNativePath(outputDirectory);
+
+		if (!fileExists(inputFileName)) {
+			DisplayString("ERROR: Could not find input data file: " + getAbsolutePath(inputFileName) + " (" + lineLabel + ")." );
+			errorsFound = true;
+			continue;
+		}
+		if (checkWeatherFile && !DDOnlySimulation && !fileExists(weatherFileName)) {
+			DisplayString("ERROR: Could not find weather file: " + getAbsolutePath(weatherFileName) + " (" + lineLabel + ")." );
+			errorsFound = true;
+			continue;
+		}
+
+		if(outputDirectory[outputDirectory.size()-1]!=pathChar){
+			outputDirectory+=pathChar;
+		}
+		makeDirectory(outputDirectory);
+
+		BatchJob job;
+		job.inputFileName = getAbsolutePath(inputFileName);
+		job.weatherFileName = getAbsolutePath(weatherFileName);
+		job.outputDirectory = getAbsolutePath(outputDirectory) + pathChar;
+		job.manifestLine = lineNum;
+
+		for (auto const & otherJob : batchJobs) {
+			if (otherJob.outputDirectory == job.outputDirectory) {
+				DisplayString("ERROR: Output directory " + job.outputDirectory + " is used by lines " + std::to_string(otherJob.manifestLine) + " and " + std::to_string(lineNum) + " of batch manifest " + manifestFileName + "." );
+				errorsFound = true;
+			}
+		}
+		batchJobs.push_back(job);
+	}
+
+	if (!errorsFound && batchJobs.empty()) {
+		DisplayString("ERROR: No jobs found in batch manifest: " + getAbsolutePath(manifestFileName) + "." );
+		errorsFound = true;
+	}
+	if (errorsFound) exit(EXIT_FAILURE);
+}
+
 int
 ProcessArgs(int argc, const char * argv[])
 {
@@ -85,6 +295,8 @@ ProcessArgs(int argc, const char * argv[])
 
 	opt.add("", 0, 0, 0, "Force annual simulation", "-a", "--annual");
 
+	opt.add("", 0, 1, 0, "Simulate the jobs listed in a batch manifest file, one\n   'input-file[,weather-file[,output-directory]]' per line", "-b", "--batch");
+
 	opt.add("", 0, 1, 0, "Output directory path (default: current directory)", "-d", "--output-directory");
 
 	opt.add("", 0, 0, 0, "Force design-day-only simulation", "-D", "--design-day");
@@ -93,6 +305,8 @@ ProcessArgs(int argc, const char * argv[])
 
 	opt.add("Energy+.idd", 0, 1, 0, "Input data dictionary path (default: Energy+.idd in executable directory)", "-i", "--idd");
 
+	opt.add("", 0, 1, 0, "Number of jobs of a batch run simulated at once (default: number of processors)", "-j", "--jobs");
+
 	opt.add("", 0, 0, 0, "Run EPMacro prior to simulation", "-m", "--epmacro");
 
 	opt.add("", 0, 1, 0, "Prefix for output file names (default: eplus)", "-p", "--output-prefix");
@@ -142,6 +356,8 @@ ProcessArgs(int argc, const char * argv[])
 
 	AnnualSimulation = opt.isSet("-a");
 
+	batchMode = opt.isSet("-b");
+
 	// Process standard arguments
 	if (opt.isSet("-h")) {
 		DisplayString(usage);
@@ -193,10 +409,11 @@ ProcessArgs(int argc, const char * argv[])
 		}
 	}
 
-	idfFileNameOnly = removeFileExtension(getFileName(inputIdfFileName));
-	idfDirPathName = getParentDirectoryPath(inputIdfFileName);
-
-	std::string weatherFilePathWithoutExtension = removeFileExtension(inputWeatherFileName);
+	if (batchMode && opt.lastArgs.size() == 1) {
+		DisplayString("ERROR: An input file cannot be specified with --batch. List the input files in the batch manifest.");
+		DisplayString(errorFollowUp);
+		exit(EXIT_FAILURE);
+	}
 
 	bool runExpandObjects(false);
 	bool runEPMacro(false);
@@ -216,15 +433,11 @@ ProcessArgs(int argc, const char * argv[])
 	}
 
 	// File naming scheme
-	std::string outputFilePrefix;
 	if(opt.isSet("-p")) {
-		std::string prefixOutName;
-		opt.get("-p")->getString(prefixOutName);
-		makeNativePath(prefixOutName);
-		outputFilePrefix = dirPathName + prefixOutName;
+		opt.get("-p")->getString(outputPrefixName);
+		makeNativePath(outputPrefixName);
 	}
-	else
-		outputFilePrefix = dirPathName + "eplus";
+	std::string outputFilePrefix = dirPathName + outputPrefixName;
 
 	std::string suffixType;
 	opt.get("-s")->getString(suffixType);
@@ -236,16 +449,6 @@ ProcessArgs(int argc, const char * argv[])
 	std::string outputExpidfFileName;
 	std::string outputExperrFileName;
 
-	std::string normalSuffix;
-	std::string tableSuffix;
-	std::string mapSuffix;
-	std::string zszSuffix;
-	std::string sszSuffix;
-	std::string meterSuffix;
-	std::string sqliteSuffix;
-	std::string adsSuffix;
-	std::string screenSuffix;
-
 	if (suffixType == "L" || suffixType == "l")	{
 
 		normalSuffix = "out";
@@ -257,6 +460,8 @@ ProcessArgs(int argc, const char * argv[])
 		sqliteSuffix = "sqlite";
 		adsSuffix = "ADS";
 		screenSuffix = "screen";
+		profSuffix = "prof";
+		batchSuffix = "batch";
 
 	}
 	else if (suffixType == "D" || suffixType == "d") {
@@ -270,6 +475,8 @@ ProcessArgs(int argc, const char * argv[])
 		sqliteSuffix = "-sqlite";
 		adsSuffix = "-ads";
 		screenSuffix = "-screen";
+		profSuffix = "-prof";
+		batchSuffix = "-batch";
 
 	}
 	else if (suffixType == "C" || suffixType == "c") {
@@ -283,6 +490,8 @@ ProcessArgs(int argc, const char * argv[])
 		sqliteSuffix = "Sqlite";
 		adsSuffix = "Ads";
 		screenSuffix = "Screen";
+		profSuffix = "Prof";
+		batchSuffix = "Batch";
 
 	}
 	else {
@@ -291,57 +500,7 @@ ProcessArgs(int argc, const char * argv[])
 		exit(EXIT_FAILURE);
 	}
 
-	// EnergyPlus files
-	outputAuditFileName = outputFilePrefix + normalSuffix + ".audit";
-	outputBndFileName = outputFilePrefix + normalSuffix + ".bnd";
-	outputDxfFileName = outputFilePrefix + normalSuffix + ".dxf";
-	outputEioFileName = outputFilePrefix + normalSuffix + ".eio";
-	outputEndFileName = outputFilePrefix + normalSuffix + ".end";
-	outputErrFileName = outputFilePrefix + normalSuffix + ".err";
-	outputEsoFileName = outputFilePrefix + normalSuffix + ".eso";
-	outputMtdFileName = outputFilePrefix + normalSuffix + ".mtd";
-	outputMddFileName = outputFilePrefix + normalSuffix + ".mdd";
-	outputMtrFileName = outputFilePrefix + normalSuffix + ".mtr";
-	outputRddFileName = outputFilePrefix + normalSuffix + ".rdd";
-	outputShdFileName = outputFilePrefix + normalSuffix + ".shd";
-	outputDfsFileName = outputFilePrefix + normalSuffix + ".dfs";
-	outputEddFileName = outputFilePrefix + normalSuffix + ".edd";
-	outputIperrFileName = outputFilePrefix + normalSuffix + ".iperr";
-	outputSlnFileName = outputFilePrefix + normalSuffix + ".sln";
-	outputSciFileName = outputFilePrefix + normalSuffix + ".sci";
-	outputWrlFileName = outputFilePrefix + normalSuffix + ".wrl";
-	outputSqlFileName = outputFilePrefix + normalSuffix + ".sql";
-	outputDbgFileName = outputFilePrefix + normalSuffix + ".dbg";
-	outputTblCsvFileName = outputFilePrefix + tableSuffix + ".csv";
-	outputTblHtmFileName = outputFilePrefix + tableSuffix + ".htm";
-	outputTblTabFileName = outputFilePrefix + tableSuffix + ".tab";
-	outputTblTxtFileName = outputFilePrefix + tableSuffix + ".txt";
-	outputTblXmlFileName = outputFilePrefix + tableSuffix + ".xml";
-	outputMapTabFileName = outputFilePrefix + mapSuffix + ".tab";
-	outputMapCsvFileName = outputFilePrefix + mapSuffix + ".csv";
-	outputMapTxtFileName = outputFilePrefix + mapSuffix + ".txt";
-	outputZszCsvFileName = outputFilePrefix + zszSuffix + ".csv";
-	outputZszTabFileName = outputFilePrefix + zszSuffix + ".tab";
-	outputZszTxtFileName = outputFilePrefix + zszSuffix + ".txt";
-	outputSszCsvFileName = outputFilePrefix + sszSuffix + ".csv";
-	outputSszTabFileName = outputFilePrefix + sszSuffix + ".tab";
-	outputSszTxtFileName = outputFilePrefix + sszSuffix + ".txt";
-	outputAdsFileName = outputFilePrefix + adsSuffix + ".out";
-	outputSqliteErrFileName = dirPathName + sqliteSuffix + ".err";
-	outputScreenCsvFileName = outputFilePrefix + screenSuffix + ".csv";
-	outputDelightInFileName = "eplusout.delightin";
-	outputDelightOutFileName = "eplusout.delightout";
-	outputDelightEldmpFileName = "eplusout.delighteldmp";
-	outputDelightDfdmpFileName = "eplusout.delightdfdmp";
-	EnergyPlusIniFileName = "Energy+.ini";
-	inStatFileName = weatherFilePathWithoutExtension + ".stat";
-	TarcogIterationsFileName = "TarcogIterations.dbg";
-	eplusADSFileName = idfDirPathName+"eplusADS.inp";
-
-	// Readvars files
-	outputCsvFileName = outputFilePrefix + normalSuffix + ".csv";
-	outputMtrCsvFileName = outputFilePrefix + meterSuffix + ".csv";
-	outputRvauditFileName = outputFilePrefix + normalSuffix + ".rvaudit";
+	SetupOutputFileNames(dirPathName);
 
 	// EPMacro files
 	outputEpmdetFileName = outputFilePrefix + normalSuffix + ".epmdet";
@@ -390,6 +549,13 @@ ProcessArgs(int argc, const char * argv[])
 		exit(EXIT_FAILURE);
 	}
 
+	// The preprocessors work on files in the current directory, which the jobs of a batch run would share
+	if (batchMode && (runEPMacro || runExpandObjects)) {
+		DisplayString("ERROR: Cannot run EPMacro or ExpandObjects with --batch. Preprocess the input files before the batch run.");
+		DisplayString(errorFollowUp);
+		exit(EXIT_FAILURE);
+	}
+
 	// Read path from INI file if it exists
 	bool EPlusINI;
 	int LFN; // Unit Number for reads
@@ -429,6 +595,29 @@ ProcessArgs(int argc, const char * argv[])
 		exit(EXIT_FAILURE);
 	}
 
+	if (batchMode) {
+		std::string manifestFileName;
+		opt.get("-b")->getString(manifestFileName);
+		makeNativePath(manifestFileName);
+		ReadBatchManifest(manifestFileName, dirPathName, opt.isSet("-w"));
+
+		if (opt.isSet("-j")) {
+			opt.get("-j")->getInt(numBatchWorkers);
+			if (numBatchWorkers < 1) {
+				DisplayString("ERROR: The number of batch jobs simulated at once must be a positive integer.");
+				DisplayString(errorFollowUp);
+				exit(EXIT_FAILURE);
+			}
+		}
+		else {
+			numBatchWorkers = std::max(1, int(std::thread::hardware_concurrency()));
+		}
+		batchSummaryFileName = outputFilePrefix + batchSuffix + ".csv";
+
+		// Each job opens its own debug file
+		return 0;
+	}
+
 	{ IOFlags flags; gio::inquire( inputIdfFileName, flags ); FileExists = flags.exists(); }
 	if ( ! FileExists ) {
 		DisplayString("ERROR: Could not find input data file: " + getAbsolutePath(inputIdfFileName) + "." );
@@ -445,11 +634,7 @@ ProcessArgs(int argc, const char * argv[])
 		}
 	}
 
-	OutputFileDebug = GetNewUnitNumber();
-	{ IOFlags flags; flags.ACTION( "write" ); gio::open( OutputFileDebug, outputDbgFileName, flags ); iostatus = flags.ios(); }
-	if ( iostatus != 0 ) {
-		ShowFatalError( "EnergyPlus: Could not open output debug file: " + outputDbgFileName + "." );
-	}
+	OpenOutputDebugFile();
 
 	// Preprocessors (These will likely move to a new file)
 	if(runEPMacro){
@@ -509,6 +694,206 @@ ProcessArgs(int argc, const char * argv[])
 	return 0;
 }
 
+int
+EndFileCount(std::string const & endMessage, std::string const & label)
+{
+	// Count in front of label in an end file message, e.g. "3 Warning;"
+	std::string::size_type labelPosition = endMessage.find(label);
+	if (labelPosition == std::string::npos || labelPosition == 0) return 0;
+	std::string::size_type countPosition = endMessage.find_last_of(' ', labelPosition - 1);
+	countPosition = (countPosition == std::string::npos) ? 0 : countPosition + 1;
+	return std::atoi(endMessage.substr(countPosition, labelPosition - countPosition).c_str());
+}
+
+std::string
+CSVField(std::string const & field)
+{
+	// Quote a field of the batch summary, doubling any quotes in it (RFC 4180)
+	std::string quoted = "\"";
+	for (char const c : field) {
+		if (c == '"') quoted += '"';
+		quoted += c;
+	}
+	return quoted + '"';
+}
+
+void
+StartBatchJob(BatchJob const & job)
+{
+#ifndef _WIN32
+	// Console output of the job goes to a file in its output directory
+	std::string const stdoutFileName = job.outputDirectory + outputPrefixName + normalSuffix + ".stdout";
+	int fd = open(stdoutFileName.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	if (fd >= 0) {
+		dup2(fd, STDOUT_FILENO);
+		dup2(fd, STDERR_FILENO);
+		close(fd);
+	}
+
+	// Files without a directory, e.g. DElight and ReadVarsESO files, stay with the job
+	if (chdir(job.outputDirectory.c_str()) != 0) {
+		DisplayString("ERROR: Could not change to output directory: " + job.outputDirectory + "." );
+		_exit(EXIT_FAILURE);
+	}
+
+	// The job counts its own errors; RunBatch closed the error file of the data
+	// dictionary processing before forking, so the job opens its own on first use
+	DataErrorTracking::TotalSevereErrors = 0;
+	DataErrorTracking::TotalWarningErrors = 0;
+	DataErrorTracking::TotalSevereErrorsDuringWarmup = 0;
+	DataErrorTracking::TotalWarningErrorsDuringWarmup = 0;
+	DataErrorTracking::TotalSevereErrorsDuringSizing = 0;
+	DataErrorTracking::TotalWarningErrorsDuringSizing = 0;
+	DataErrorTracking::LastSevereError.clear();
+
+	inputIdfFileName = job.inputFileName;
+	inputWeatherFileName = job.weatherFileName;
+	SetupOutputFileNames(job.outputDirectory);
+	OpenOutputDebugFile();
+#endif
+}
+
+void
+FinishBatchJob(BatchJob & job, std::string const & endFileName, int const status)
+{
+	// Set the result of a finished job from the first line of its end file and the
+	// exit status of its process, as returned by waitpid
+#ifndef _WIN32
+	job.message.clear();
+	std::ifstream endFile(endFileName);
+	if (endFile) std::getline(endFile, job.message);
+	strip(job.message);
+	job.numWarnings = EndFileCount(job.message, " Warning;");
+	job.numSevere = EndFileCount(job.message, " Severe Errors;");
+	job.succeeded = WIFEXITED(status) && WEXITSTATUS(status) == EXIT_SUCCESS && job.message.find("EnergyPlus Completed Successfully") == 0;
+	if (job.message.empty()) {
+		if (WIFSIGNALED(status)) {
+			job.message = "Terminated by signal " + std::to_string(WTERMSIG(status)) + ".";
+		}
+		else {
+			job.message = "Ended with exit status " + std::to_string(WEXITSTATUS(status)) + " without an end file.";
+		}
+	}
+#endif
+}
+
+void
+RunBatch()
+{
+	// The data dictionary is processed once; then a process is forked for each job,
+	// with at most numBatchWorkers jobs running at once, so the jobs share the IDD
+	// and the static initialization copy-on-write. A simulation ends its process,
+	// so each job gets a fresh process rather than a long lived worker. Only the
+	// process forked for a job returns, set up to simulate the job; this process
+	// reports progress, writes the batch summary and exits.
+
+#ifdef _WIN32
+	DisplayString("ERROR: --batch is not supported on this platform.");
+	exit(EXIT_FAILURE);
+#else
+	DisplayString( "EnergyPlus Starting Batch" );
+	DisplayString( VerString );
+
+	bool errorsInIDD = false;
+	ProcessDataDictionary(errorsInIDD);
+	if (errorsInIDD) {
+		DisplayString("ERROR: Errors found processing input data dictionary: " + getAbsolutePath(inputIddFileName) + "." );
+		exit(EXIT_FAILURE);
+	}
+	// Messages of the data dictionary stay in the error file of the batch; no job may
+	// inherit it open (or its buffered output)
+	CloseErrorMessageFile();
+
+	int const numJobs = batchJobs.size();
+	int const numWorkers = std::min(numBatchWorkers, numJobs);
+	std::string const numJobsString = std::to_string(numJobs);
+	DisplayString("Simulating " + numJobsString + " batch jobs, " + std::to_string(numWorkers) + " at once");
+
+	int nextJob = 0;
+	int numRunning = 0;
+	int numFinished = 0;
+	while (numFinished < numJobs) {
+		while (numRunning < numWorkers && nextJob < numJobs) {
+			BatchJob & job = batchJobs[nextJob];
+			std::string const jobLabel = "Batch job " + std::to_string(nextJob + 1) + "/" + numJobsString;
+			++nextJob;
+			removeFile(job.outputDirectory + outputPrefixName + normalSuffix + ".end");
+
+			// Anything still buffered would be written again by the job
+			std::cout.flush();
+			std::cerr.flush();
+			job.startTime = std::chrono::steady_clock::now();
+			pid_t pid = fork();
+			if (pid == 0) {
+				StartBatchJob(job);
+				return;
+			}
+			if (pid < 0) {
+				job.message = "Could not start a process for the job.";
+				++numFinished;
+				DisplayString(jobLabel + " failed: " + job.inputFileName + " -- " + job.message);
+				continue;
+			}
+			job.pid = pid;
+			++numRunning;
+			DisplayString(jobLabel + " started: " + job.inputFileName);
+		}
+		if (numRunning == 0) continue;
+
+		int status;
+		pid_t pid = waitpid(-1, &status, 0);
+		if (pid < 0) {
+			if (errno == EINTR) continue;
+			DisplayString("ERROR: Lost track of the batch job processes.");
+			exit(EXIT_FAILURE);
+		}
+		auto jobIterator = std::find_if(batchJobs.begin(), batchJobs.end(), [pid](BatchJob const & job){ return job.pid == pid; });
+		if (jobIterator == batchJobs.end()) continue;
+		BatchJob & job = *jobIterator;
+		--numRunning;
+		++numFinished;
+		job.elapsedSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - job.startTime).count();
+		FinishBatchJob(job, job.outputDirectory + outputPrefixName + normalSuffix + ".end", status);
+		std::string const jobLabel = "Batch job " + std::to_string(jobIterator - batchJobs.begin() + 1) + "/" + numJobsString;
+		DisplayString(jobLabel + (job.succeeded ? " completed: " : " failed: ") + job.inputFileName + " -- " + job.message);
+	}
+
+	// Batch summary
+	int numSucceeded = 0;
+	int totalWarnings = 0;
+	int totalSevere = 0;
+	std::ofstream summaryFile(batchSummaryFileName);
+	if (summaryFile) {
+		summaryFile << "Job,Manifest Line,Input File,Weather File,Output Directory,Result,Warnings,Severe Errors,Elapsed Time [s],Message\n";
+	}
+	for (int jobNum = 0; jobNum < numJobs; ++jobNum) {
+		BatchJob const & job = batchJobs[jobNum];
+		if (job.succeeded) ++numSucceeded;
+		totalWarnings += job.numWarnings;
+		totalSevere += job.numSevere;
+		if (summaryFile) {
+			summaryFile << jobNum + 1 << ',' << job.manifestLine << ',' << CSVField(job.inputFileName) << ',' << CSVField(job.weatherFileName) << ',' << CSVField(job.outputDirectory) << ','
+				<< (job.succeeded ? "Completed" : "Failed") << ',' << job.numWarnings << ',' << job.numSevere << ',' << job.elapsedSeconds << ',' << CSVField(job.message) << '\n';
+		}
+	}
+
+	DisplayString("Batch Summary: " + std::to_string(numSucceeded) + " of " + numJobsString + " jobs completed successfully; "
+		+ std::to_string(totalWarnings) + " Warning; " + std::to_string(totalSevere) + " Severe Errors.");
+	for (int jobNum = 0; jobNum < numJobs; ++jobNum) {
+		BatchJob const & job = batchJobs[jobNum];
+		if (!job.succeeded) DisplayString("  Failed: " + job.inputFileName + " (see " + job.outputDirectory + ")");
+	}
+	if (summaryFile) {
+		DisplayString("Batch summary written to " + batchSummaryFileName);
+	}
+	else {
+		DisplayString("ERROR: Could not write batch summary file: " + batchSummaryFileName + "." );
+	}
+
+	exit(numSucceeded == numJobs ? EXIT_SUCCESS : EXIT_FAILURE);
+#endif
+}
+
 void
 ReadINIFile(
 	int const UnitNumber, // Unit number of the opened INI file
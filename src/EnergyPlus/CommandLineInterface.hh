@@ -1,16 +1,69 @@
 #ifndef CommandLineInterface_hh_INCLUDED
 #define CommandLineInterface_hh_INCLUDED
 
+#include <chrono>
 #include <string>
+#include <vector>
 #include <EnergyPlusAPI.hh>
 namespace EnergyPlus{
 
 namespace CommandLineInterface {
 
+ // A simulation listed in a batch manifest
+ struct BatchJob
+ {
+ 	std::string inputFileName; // absolute path of the input file
+ 	std::string weatherFileName; // absolute path of the weather file
+ 	std::string outputDirectory; // absolute path of the output directory, with trailing path character
+ 	int manifestLine; // line of the job in the manifest
+ 	int pid; // process simulating the job, 0 if not started
+ 	bool succeeded; // true if the job completed successfully
+ 	int numWarnings; // warnings reported in the job's end file
+ 	int numSevere; // severe errors reported in the job's end file
+ 	double elapsedSeconds; // wall clock time of the job
+ 	std::string message; // end file message, or why the job did not finish
+ 	std::chrono::steady_clock::time_point startTime;
+
+ 	BatchJob() :
+ 		manifestLine(0),
+ 		pid(0),
+ 		succeeded(false),
+ 		numWarnings(0),
+ 		numSevere(0),
+ 		elapsedSeconds(0.0)
+ 	{}
+ };
+
+ // True if a batch manifest was given with --batch
+ extern bool batchMode;
+
+ // Jobs of the batch manifest, in manifest order
+ extern std::vector<BatchJob> batchJobs;
+
  // Process command line arguments
  int
  ENERGYPLUSLIB_API ProcessArgs( int argc, const char * argv[] );
 
+ // Read the jobs of a batch manifest into batchJobs; exits if the manifest has errors
+ void
+ ReadBatchManifest( std::string const & manifestFileName, std::string const & dirPathName, bool weatherFileSet );
+
+ // Count in front of label in an end file message, e.g. 3 for "3 Warning;"
+ int
+ EndFileCount( std::string const & endMessage, std::string const & label );
+
+ // Field of the batch summary in quotes, with any quotes in it doubled
+ std::string
+ CSVField( std::string const & field );
+
+ // Set the result of a finished batch job from its end file and its process exit status
+ void
+ FinishBatchJob( BatchJob & job, std::string const & endFileName, int const status );
+
+ // Simulate the jobs of the batch manifest; returns only in the process forked for a job
+ void
+ RunBatch();
+
  void
  ReadINIFile(
  	int const UnitNumber, // Unit number of the opened INI file
@@ -1,7 +1,15 @@
 // C++ Headers
 #include <cassert>
 #include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
 #include <string>
+#ifdef _WIN32
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/FArray.functions.hh>
@@ -14,6 +22,7 @@
 #include <DataGlobals.hh>
 #include <DataHeatBalance.hh>
 #include <DataPrecisionGlobals.hh>
+#include <DataSystemVariables.hh>
 #include <DisplayRoutines.hh>
 #include <General.hh>
 #include <UtilityRoutines.hh>
@@ -54,7 +63,11 @@ namespace ConductionTransferFunctionCalc {
 	// Wisconsin-Madison.
 
 	// OTHER NOTES:
-	// na
+	// When the CTFCacheFile environment variable names a file, the CTFs are
+	// kept in that file keyed by the inputs of the state space calculation,
+	// so later runs (of any model) skip the matrix work for constructions
+	// they share with earlier ones.  CTFCacheValidate recalculates cached
+	// CTFs and reports any that differ.
 
 	// Using/Aliasing
 	using namespace DataPrecisionGlobals;
@@ -72,6 +85,9 @@ namespace ConductionTransferFunctionCalc {
 	// when a two-dimensional solution has been requested for a construction
 	// with a heat source/sink.
 
+	std::string const CTFCacheFileTag( "EPCTFCACHE" ); // Leading characters of a CTF cache file
+	std::int32_t const CTFCacheFileVersion( 1 ); // Layout version of a CTF cache file
+
 	// DERIVED TYPE DEFINITIONS
 	// na
 
@@ -99,6 +115,9 @@ namespace ConductionTransferFunctionCalc {
 	FArray2D< Real64 > s0( 4, 3 ); // Coefficients for the current surface temperature terms
 	Real64 TinyLimit;
 	FArray2D< Real64 > IdenMatrix; // Identity Matrix
+	bool CTFCacheFileRead( false ); // TRUE once the CTF cache file has been read
+	bool CTFCacheChanged( false ); // TRUE if the CTF cache has records that are not in the cache file yet
+	std::map< std::string, CTFCacheRecord > CTFCacheRecords; // Cached CTFs, by construction properties
 
 	// SUBROUTINE SPECIFICATIONS FOR MODULE ConductionTransferFunctionCalc
 
@@ -106,6 +125,30 @@ namespace ConductionTransferFunctionCalc {
 
 	// Functions
 
+	void
+	clear_state()
+	{
+		AExp.deallocate();
+		AInv.deallocate();
+		AMat.deallocate();
+		BMat = 0.0;
+		CMat = 0.0;
+		DMat = 0.0;
+		e.deallocate();
+		Gamma1.deallocate();
+		Gamma2.deallocate();
+		NodeSource = 0;
+		NodeUserTemp = 0;
+		rcmax = 0;
+		s.deallocate();
+		s0 = 0.0;
+		TinyLimit = 0.0;
+		IdenMatrix.deallocate();
+		CTFCacheFileRead = false;
+		CTFCacheChanged = false;
+		CTFCacheRecords.clear();
+	}
+
 	void
 	InitConductionTransferFunctions()
 	{
@@ -167,6 +210,8 @@ namespace ConductionTransferFunctionCalc {
 		// Using/Aliasing
 		using namespace DataConversions;
 		using General::RoundSigDigits;
+		using DataSystemVariables::CTFCacheFile;
+		using DataSystemVariables::CTFCacheValidate;
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -263,11 +308,28 @@ namespace ConductionTransferFunctionCalc {
 		Real64 Alpha; // thermal diffusivity in m2/s, for local check of properties
 		Real64 DeltaTimestep; // zone timestep in seconds, for local check of properties
 		Real64 ThicknessThreshold; // min thickness consistent with other thermal properties, for local check
+		bool UseCTFCache; // Set if CTFs are looked up in and added to the CTF cache
+		std::string CTFCacheKeyValue; // Construction properties the cached CTFs are filed under
+		CTFCacheRecord CalculatedCTFs; // CTFs of the current construction, in cache record form
+		int NumCTFCacheHits; // Constructions whose CTFs were taken from the cache
+		int NumCTFCacheMisses; // Constructions whose CTFs were calculated and added to the cache
+		int NumCTFCacheMismatches; // Cached CTFs that did not match the recalculated CTFs
 
 		// FLOW:
 		// Subroutine initializations
 		TinyLimit = rTinyValue;
 		DoCTFErrorReport = false;
+		UseCTFCache = ! CTFCacheFile.empty();
+		NumCTFCacheHits = 0;
+		NumCTFCacheMisses = 0;
+		NumCTFCacheMismatches = 0;
+		if ( UseCTFCache && ! CTFCacheFileRead ) {
+			CTFCacheFileRead = true;
+			if ( ! ReadCTFCacheFile( CTFCacheFile ) ) {
+				ShowWarningError( "InitConductionTransferFunctions: Could not read CTF cache file=\"" + CTFCacheFile + "\"." );
+				ShowContinueError( "...The CTFs of all constructions will be calculated and the file will be rewritten." );
+			}
+		}
 
 		for ( ConstrNum = 1; ConstrNum <= TotConstructs; ++ConstrNum ) { // Begin construction loop ...
 
@@ -746,6 +808,19 @@ namespace ConductionTransferFunctionCalc {
 					s.allocate( rcmax, 4, 3 );
 					s = 0.0;
 
+					// Constructions with the same state space model as a cached one reuse its CTFs;
+					// in validation mode the CTFs are still calculated and compared below.
+					auto CachedCTFs( CTFCacheRecords.end() );
+					if ( UseCTFCache ) {
+						CTFCacheKeyValue = CTFCacheKey( ConstrNum, LayersInConstruct, rk, rho, cp, dx, Nodes, dyn );
+						CachedCTFs = CTFCacheRecords.find( CTFCacheKeyValue );
+						if ( CachedCTFs != CTFCacheRecords.end() && ! CTFCacheValidate ) {
+							RestoreCTFCacheRecord( CachedCTFs->second, ConstrNum );
+							++NumCTFCacheHits;
+							CTFConvrg = true;
+						}
+					}
+
 					while ( ! CTFConvrg ) { // Begin CTF calculation loop ...
 
 						BMat( 3 ) = 0.0;
@@ -1068,6 +1143,24 @@ namespace ConductionTransferFunctionCalc {
 
 					} // ... end of CTF calculation loop.
 
+					if ( UseCTFCache && Construct( ConstrNum ).CTFTimeStep < MaxAllowedTimeStep ) {
+						if ( CachedCTFs == CTFCacheRecords.end() ) {
+							SaveCTFCacheRecord( CTFCacheRecords[ CTFCacheKeyValue ], ConstrNum );
+							CTFCacheChanged = true;
+							++NumCTFCacheMisses;
+						} else if ( CTFCacheValidate ) {
+							SaveCTFCacheRecord( CalculatedCTFs, ConstrNum );
+							if ( ! SameCTFCacheRecord( CalculatedCTFs, CachedCTFs->second ) ) {
+								ShowWarningError( "InitConductionTransferFunctions: Cached CTFs do not match the calculated CTFs for Construction=\"" + Construct( ConstrNum ).Name + "\"." );
+								ShowContinueError( "...The calculated CTFs are used and replace the cached ones." );
+								CachedCTFs->second = CalculatedCTFs;
+								CTFCacheChanged = true;
+								++NumCTFCacheMismatches;
+							}
+							++NumCTFCacheHits;
+						}
+					}
+
 				} // ... end of IF block for non-reversed constructs.
 
 			} else { // Construct has only resistive layers (no thermal mass).
@@ -1173,6 +1266,21 @@ namespace ConductionTransferFunctionCalc {
 
 		} // ... end of construction loop.
 
+		if ( UseCTFCache ) {
+			if ( CTFCacheValidate ) {
+				DisplayString( "CTF cache: " + RoundSigDigits( NumCTFCacheHits ) + " cached constructions validated, " + RoundSigDigits( NumCTFCacheMismatches ) + " did not match, " + RoundSigDigits( NumCTFCacheMisses ) + " added" );
+			} else {
+				DisplayString( "CTF cache: " + RoundSigDigits( NumCTFCacheHits ) + " constructions reused, " + RoundSigDigits( NumCTFCacheMisses ) + " calculated and added" );
+			}
+			if ( CTFCacheChanged && ! ErrorsFound ) {
+				if ( WriteCTFCacheFile( CTFCacheFile ) ) {
+					CTFCacheChanged = false;
+				} else {
+					ShowWarningError( "InitConductionTransferFunctions: Could not write CTF cache file=\"" + CTFCacheFile + "\"." );
+				}
+			}
+		}
+
 		ReportCTFs( DoCTFErrorReport );
 
 		if ( ErrorsFound ) {
@@ -2178,6 +2286,251 @@ namespace ConductionTransferFunctionCalc {
 
 	}
 
+	std::string
+	CTFCacheKey(
+		int const ConstrNum, // Construction the CTFs are calculated for
+		int const LayersInConstruct, // Number of layers in the state space model
+		FArray1< Real64 > const & rk, // Thermal conductivity of each layer
+		FArray1< Real64 > const & rho, // Density of each layer
+		FArray1< Real64 > const & cp, // Specific heat of each layer
+		FArray1< Real64 > const & dx, // Node spacing in each layer
+		FArray1_int const & Nodes, // Number of nodes in each layer
+		Real64 const dyn // Node spacing perpendicular to the main direction of heat transfer
+	)
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns the key the CTFs of a construction are cached under.
+
+		// METHODOLOGY EMPLOYED:
+		// The key holds the exact bits of every input of the state space calculation: the
+		// solution dimensions, total, source/sink and user temperature nodes, the starting CTF
+		// time step and number of histories, the zone time step, and the conductivity,
+		// density, specific heat, node spacing and node count of each layer (in the units the
+		// calculation uses).  Constructions with equal keys get equal CTFs whatever their names.
+
+		std::vector< Real64 > Values;
+		Values.reserve( 10 + 5 * LayersInConstruct );
+		Values.push_back( double( MaxCTFTerms ) );
+		Values.push_back( double( Construct( ConstrNum ).SolutionDimensions ) );
+		Values.push_back( double( LayersInConstruct ) );
+		Values.push_back( double( rcmax ) );
+		Values.push_back( double( NodeSource ) );
+		Values.push_back( double( NodeUserTemp ) );
+		Values.push_back( double( Construct( ConstrNum ).NumHistories ) );
+		Values.push_back( Construct( ConstrNum ).CTFTimeStep );
+		Values.push_back( TimeStepZone );
+		Values.push_back( dyn );
+		for ( int Layer = 1; Layer <= LayersInConstruct; ++Layer ) {
+			Values.push_back( rk( Layer ) );
+			Values.push_back( rho( Layer ) );
+			Values.push_back( cp( Layer ) );
+			Values.push_back( dx( Layer ) );
+			Values.push_back( double( Nodes( Layer ) ) );
+		}
+
+		return std::string( reinterpret_cast< char const * >( Values.data() ), Values.size() * sizeof( Real64 ) );
+
+	}
+
+	void
+	SaveCTFCacheRecord(
+		CTFCacheRecord & Record,
+		int const ConstrNum // Construction the CTFs were calculated for
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Copies the CTFs just calculated for a construction (s0, s and e, still in the units
+		// of the state space calculation) and its CTF time step into Record.
+
+		int const NumCTFTerms( Construct( ConstrNum ).NumCTFTerms );
+
+		Record.NumCTFTerms = NumCTFTerms;
+		Record.NumHistories = Construct( ConstrNum ).NumHistories;
+		Record.CTFTimeStep = Construct( ConstrNum ).CTFTimeStep;
+		Record.Coefficients.clear();
+		Record.Coefficients.reserve( 12 * ( NumCTFTerms + 1 ) + NumCTFTerms );
+		for ( int i = 1; i <= 4; ++i ) {
+			for ( int j = 1; j <= 3; ++j ) {
+				Record.Coefficients.push_back( s0( i, j ) );
+			}
+		}
+		for ( int HistTerm = 1; HistTerm <= NumCTFTerms; ++HistTerm ) {
+			for ( int i = 1; i <= 4; ++i ) {
+				for ( int j = 1; j <= 3; ++j ) {
+					Record.Coefficients.push_back( s( HistTerm, i, j ) );
+				}
+			}
+			Record.Coefficients.push_back( e( HistTerm ) );
+		}
+
+	}
+
+	void
+	RestoreCTFCacheRecord(
+		CTFCacheRecord const & Record,
+		int const ConstrNum // Construction the CTFs are restored for
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Sets s0, s and e and the CTF time step of a construction from a cached record, as if
+		// the CTF calculation loop had just produced them.
+
+		std::vector< Real64 >::size_type Coef( 0u );
+
+		Construct( ConstrNum ).NumCTFTerms = Record.NumCTFTerms;
+		Construct( ConstrNum ).NumHistories = Record.NumHistories;
+		Construct( ConstrNum ).CTFTimeStep = Record.CTFTimeStep;
+		for ( int i = 1; i <= 4; ++i ) {
+			for ( int j = 1; j <= 3; ++j ) {
+				s0( i, j ) = Record.Coefficients[ Coef++ ];
+			}
+		}
+		for ( int HistTerm = 1; HistTerm <= Record.NumCTFTerms; ++HistTerm ) {
+			for ( int i = 1; i <= 4; ++i ) {
+				for ( int j = 1; j <= 3; ++j ) {
+					s( HistTerm, i, j ) = Record.Coefficients[ Coef++ ];
+				}
+			}
+			e( HistTerm ) = Record.Coefficients[ Coef++ ];
+		}
+
+	}
+
+	bool
+	SameCTFCacheRecord(
+		CTFCacheRecord const & Record1,
+		CTFCacheRecord const & Record2
+	)
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns true if two CTF records have the same time step and number of terms and
+		// coefficients that agree to within a small fraction of the largest coefficient.
+		// An exact comparison would flag caches written by a build with different rounding.
+
+		// FUNCTION PARAMETER DEFINITIONS:
+		Real64 const RelTolerance( 1.0e-8 ); // Allowed difference relative to the largest coefficient
+
+		if ( Record1.NumCTFTerms != Record2.NumCTFTerms ) return false;
+		if ( Record1.NumHistories != Record2.NumHistories ) return false;
+		if ( Record1.Coefficients.size() != Record2.Coefficients.size() ) return false;
+		if ( std::abs( Record1.CTFTimeStep - Record2.CTFTimeStep ) > RelTolerance * Record1.CTFTimeStep ) return false;
+
+		Real64 BiggestCoef( 0.0 );
+		for ( auto const Coef : Record1.Coefficients ) {
+			BiggestCoef = max( BiggestCoef, std::abs( Coef ) );
+		}
+		for ( std::vector< Real64 >::size_type Coef = 0u; Coef < Record1.Coefficients.size(); ++Coef ) {
+			if ( std::abs( Record1.Coefficients[ Coef ] - Record2.Coefficients[ Coef ] ) > RelTolerance * BiggestCoef ) return false;
+		}
+		return true;
+
+	}
+
+	bool
+	ReadCTFCacheFile( std::string const & FileName )
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Adds the records of the CTF cache file FileName (written by WriteCTFCacheFile) to
+		// CTFCacheRecords.  A missing file is an empty cache.  Returns false, leaving
+		// CTFCacheRecords unchanged, if the file is not a CTF cache file or is truncated.
+
+		std::ifstream File( FileName, std::ios::binary );
+		if ( ! File ) return true;
+
+		std::string Tag( CTFCacheFileTag.size(), ' ' );
+		std::int32_t Version( 0 );
+		std::uint32_t NumRecords( 0 );
+		if ( ! File.read( &Tag[ 0 ], Tag.size() ) || Tag != CTFCacheFileTag ) return false;
+		if ( ! File.read( reinterpret_cast< char * >( &Version ), sizeof( Version ) ) || Version != CTFCacheFileVersion ) return false;
+		if ( ! File.read( reinterpret_cast< char * >( &NumRecords ), sizeof( NumRecords ) ) ) return false;
+
+		std::map< std::string, CTFCacheRecord > Records;
+		for ( std::uint32_t RecNum = 0; RecNum < NumRecords; ++RecNum ) {
+			std::uint32_t KeyLength( 0 );
+			std::int32_t NumCTFTerms( 0 );
+			std::int32_t NumHistories( 0 );
+			if ( ! File.read( reinterpret_cast< char * >( &KeyLength ), sizeof( KeyLength ) ) ) return false;
+			std::string Key( KeyLength, ' ' );
+			if ( KeyLength > 0 && ! File.read( &Key[ 0 ], KeyLength ) ) return false;
+			CTFCacheRecord & Record( Records[ Key ] );
+			if ( ! File.read( reinterpret_cast< char * >( &NumCTFTerms ), sizeof( NumCTFTerms ) ) ) return false;
+			if ( ! File.read( reinterpret_cast< char * >( &NumHistories ), sizeof( NumHistories ) ) ) return false;
+			if ( ! File.read( reinterpret_cast< char * >( &Record.CTFTimeStep ), sizeof( Record.CTFTimeStep ) ) ) return false;
+			if ( NumCTFTerms < 0 || NumCTFTerms > MaxCTFTerms ) return false;
+			Record.NumCTFTerms = NumCTFTerms;
+			Record.NumHistories = NumHistories;
+			Record.Coefficients.resize( 12 * ( NumCTFTerms + 1 ) + NumCTFTerms );
+			if ( ! File.read( reinterpret_cast< char * >( Record.Coefficients.data() ), Record.Coefficients.size() * sizeof( Real64 ) ) ) return false;
+		}
+
+		for ( auto & Entry : Records ) {
+			CTFCacheRecords[ Entry.first ] = std::move( Entry.second );
+		}
+		return true;
+
+	}
+
+	bool
+	WriteCTFCacheFile( std::string const & FileName )
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Writes all CTF cache records to FileName.  Returns false if the file could not be written.
+
+		// METHODOLOGY EMPLOYED:
+		// Layout: tag, version, record count, then per record the key length and key, the
+		// number of CTF terms and histories, the CTF time step and the coefficients.  The file
+		// is written in native byte order and is meant to be shared by runs on the same machine.
+		// The records go to a temporary file, named after this process, in the same directory
+		// that is then renamed over FileName, so runs sharing the cache never read a partly
+		// written file.
+
+#ifdef _WIN32
+		std::string const TempFileName( FileName + '.' + std::to_string( _getpid() ) + ".tmp" );
+#else
+		std::string const TempFileName( FileName + '.' + std::to_string( getpid() ) + ".tmp" );
+#endif
+		std::ofstream File( TempFileName, std::ios::binary | std::ios::trunc );
+		if ( ! File ) return false;
+
+		std::uint32_t const NumRecords( CTFCacheRecords.size() );
+		File.write( CTFCacheFileTag.data(), CTFCacheFileTag.size() );
+		File.write( reinterpret_cast< char const * >( &CTFCacheFileVersion ), sizeof( CTFCacheFileVersion ) );
+		File.write( reinterpret_cast< char const * >( &NumRecords ), sizeof( NumRecords ) );
+		for ( auto const & Entry : CTFCacheRecords ) {
+			std::uint32_t const KeyLength( Entry.first.size() );
+			std::int32_t const NumCTFTerms( Entry.second.NumCTFTerms );
+			std::int32_t const NumHistories( Entry.second.NumHistories );
+			File.write( reinterpret_cast< char const * >( &KeyLength ), sizeof( KeyLength ) );
+			File.write( Entry.first.data(), KeyLength );
+			File.write( reinterpret_cast< char const * >( &NumCTFTerms ), sizeof( NumCTFTerms ) );
+			File.write( reinterpret_cast< char const * >( &NumHistories ), sizeof( NumHistories ) );
+			File.write( reinterpret_cast< char const * >( &Entry.second.CTFTimeStep ), sizeof( Entry.second.CTFTimeStep ) );
+			File.write( reinterpret_cast< char const * >( Entry.second.Coefficients.data() ), Entry.second.Coefficients.size() * sizeof( Real64 ) );
+		}
+		File.close();
+
+		if ( ! File ) {
+			std::remove( TempFileName.c_str() );
+			return false;
+		}
+		if ( std::rename( TempFileName.c_str(), FileName.c_str() ) != 0 ) {
+			// rename does not replace an existing file on Windows
+			std::remove( FileName.c_str() );
+			if ( std::rename( TempFileName.c_str(), FileName.c_str() ) != 0 ) {
+				std::remove( TempFileName.c_str() );
+				return false;
+			}
+		}
+		return true;
+
+	}
+
 	//     NOTICE
 
 	//     Copyright  1996-2014 The Board of Trustees of the University of Illinois
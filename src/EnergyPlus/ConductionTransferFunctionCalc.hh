@@ -1,6 +1,11 @@
 #ifndef ConductionTransferFunctionCalc_hh_INCLUDED
 #define ConductionTransferFunctionCalc_hh_INCLUDED
 
+// C++ Headers
+#include <map>
+#include <string>
+#include <vector>
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/FArray1D.hh>
 #include <ObjexxFCL/FArray2D.hh>
@@ -25,7 +30,23 @@ namespace ConductionTransferFunctionCalc {
 	// with a heat source/sink.
 
 	// DERIVED TYPE DEFINITIONS
-	// na
+
+	struct CTFCacheRecord
+	{
+		// Members
+		int NumCTFTerms; // Number of CTF history terms
+		int NumHistories; // Number of zone time steps in the CTF time step
+		Real64 CTFTimeStep; // Time step of the CTFs [hr]
+		std::vector< Real64 > Coefficients; // s0, then s and e for each history term
+
+		// Default Constructor
+		CTFCacheRecord() :
+			NumCTFTerms( 0 ),
+			NumHistories( 0 ),
+			CTFTimeStep( 0.0 )
+		{}
+
+	};
 
 	// INTERFACE BLOCK SPECIFICATIONS
 	// na
@@ -51,11 +72,17 @@ namespace ConductionTransferFunctionCalc {
 	extern FArray2D< Real64 > s0; // Coefficients for the current surface temperature terms
 	extern Real64 TinyLimit;
 	extern FArray2D< Real64 > IdenMatrix; // Identity Matrix
+	extern bool CTFCacheFileRead; // TRUE once the CTF cache file has been read
+	extern bool CTFCacheChanged; // TRUE if the CTF cache has records that are not in the cache file yet
+	extern std::map< std::string, CTFCacheRecord > CTFCacheRecords; // Cached CTFs, by construction properties
 
 	// SUBROUTINE SPECIFICATIONS FOR MODULE ConductionTransferFunctionCalc
 
 	// Functions
 
+	void
+	clear_state();
+
 	void
 	InitConductionTransferFunctions();
 
@@ -80,6 +107,42 @@ namespace ConductionTransferFunctionCalc {
 	void
 	ReportCTFs( bool const DoReportBecauseError );
 
+	std::string
+	CTFCacheKey(
+		int const ConstrNum, // Construction the CTFs are calculated for
+		int const LayersInConstruct, // Number of layers in the state space model
+		FArray1< Real64 > const & rk, // Thermal conductivity of each layer
+		FArray1< Real64 > const & rho, // Density of each layer
+		FArray1< Real64 > const & cp, // Specific heat of each layer
+		FArray1< Real64 > const & dx, // Node spacing in each layer
+		FArray1_int const & Nodes, // Number of nodes in each layer
+		Real64 const dyn // Node spacing perpendicular to the main direction of heat transfer
+	);
+
+	void
+	SaveCTFCacheRecord(
+		CTFCacheRecord & Record,
+		int const ConstrNum // Construction the CTFs were calculated for
+	);
+
+	void
+	RestoreCTFCacheRecord(
+		CTFCacheRecord const & Record,
+		int const ConstrNum // Construction the CTFs are restored for
+	);
+
+	bool
+	SameCTFCacheRecord(
+		CTFCacheRecord const & Record1,
+		CTFCacheRecord const & Record2
+	);
+
+	bool
+	ReadCTFCacheFile( std::string const & FileName );
+
+	bool
+	WriteCTFCacheFile( std::string const & FileName );
+
 	//     NOTICE
 
 	//     Copyright  1996-2014 The Board of Trustees of the University of Illinois
@@ -169,6 +169,19 @@ namespace CurveManager {
 
 	// Functions
 
+	void
+	clear_state()
+	{
+		NumCurves = 0;
+		GetCurvesInputFlag = true;
+		PerfCurve.deallocate();
+		PerfCurveTableData.deallocate();
+		TableData.deallocate();
+		TempTableData.deallocate();
+		Temp2TableData.deallocate();
+		TableLookup.deallocate();
+	}
+
 	void
 	ResetPerformanceCurveOutput()
 	{
@@ -304,6 +317,91 @@ namespace CurveManager {
 
 	}
 
+	void
+	CurveValueBatch(
+		int const CurveIndex, // index of curve in curve array
+		FArray1< Real64 > const & Var1, // 1st independent variable for each evaluation
+		FArray1< Real64 > & Result, // curve value for each evaluation
+		Optional< FArray1< Real64 > const > Var2 // 2nd independent variable for each evaluation
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Evaluates one curve or table over an array of independent variable values,
+		// e.g., for a component model that needs the curve at each of several speeds or stages.
+
+		// METHODOLOGY EMPLOYED:
+		// The first point goes through CurveValue so that curve validation, environment
+		// resets and reporting are handled as usual.  The remaining points are sent straight
+		// to the curve or table evaluator; the table bracket hints make consecutive lookups
+		// over ordered inputs cheap.  The curve report variables hold the last point evaluated.
+
+		// REFERENCES:
+		// na
+
+		// USE STATEMENTS:
+		// na
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS
+		// na
+
+		// DERIVED TYPE DEFINITIONS
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int Loop; // evaluation counter
+		int NumPoints; // number of evaluations
+
+		NumPoints = size( Var1 );
+		if ( NumPoints == 0 ) return;
+		if ( present( Var2 ) && isize( Var2() ) != NumPoints ) {
+			ShowFatalError( "CurveValueBatch: Independent variable arrays are not the same size for curve " + PerfCurve( CurveIndex ).Name );
+		}
+
+		if ( present( Var2 ) ) {
+			Result( Result.l() ) = CurveValue( CurveIndex, Var1( Var1.l() ), Var2()( Var2().l() ) );
+		} else {
+			Result( Result.l() ) = CurveValue( CurveIndex, Var1( Var1.l() ) );
+		}
+		if ( NumPoints == 1 ) return;
+
+		auto & Curve( PerfCurve( CurveIndex ) );
+		for ( Loop = 1; Loop < NumPoints; ++Loop ) {
+			Real64 const X1( Var1( Var1.l() + Loop ) );
+			Real64 Value;
+			if ( present( Var2 ) ) {
+				Real64 const X2( Var2()( Var2().l() + Loop ) );
+				if ( Curve.InterpolationType == EvaluateCurveToLimits ) {
+					Value = PerformanceCurveObject( CurveIndex, X1, X2 );
+				} else if ( Curve.InterpolationType == LinearInterpolationOfTable ) {
+					Value = PerformanceTableObject( CurveIndex, X1, X2 );
+				} else {
+					Value = TableLookupObject( CurveIndex, X1, X2 );
+				}
+				Curve.CurveInput2 = X2;
+			} else {
+				if ( Curve.InterpolationType == EvaluateCurveToLimits ) {
+					Value = PerformanceCurveObject( CurveIndex, X1 );
+				} else if ( Curve.InterpolationType == LinearInterpolationOfTable ) {
+					Value = PerformanceTableObject( CurveIndex, X1 );
+				} else {
+					Value = TableLookupObject( CurveIndex, X1 );
+				}
+			}
+			if ( Curve.EMSOverrideOn ) Value = Curve.EMSOverrideCurveValue;
+			Result( Result.l() + Loop ) = Value;
+			Curve.CurveOutput = Value;
+			Curve.CurveInput1 = X1;
+		}
+
+	}
+
 	void
 	GetCurveInput()
 	{
@@ -2450,6 +2548,69 @@ namespace CurveManager {
 			ShowFatalError( "GetCurveInput: Errors found in getting Curve Objects.  Preceding condition(s) cause termination." );
 		}
 
+		SetupTableLookupAxes();
+
+	}
+
+	void
+	SetupTableLookupAxes()
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Sets up the axis data used by PerformanceTableObject so that the table
+		// limits and the sort order of each independent variable are determined once
+		// at input time instead of on every table evaluation.
+
+		// METHODOLOGY EMPLOYED:
+		// The minimum and maximum of each axis are stored.  An axis whose values are in
+		// non-decreasing order is flagged so that the bracketing interval can be found by
+		// interval halving; other axes keep the original linear scan.
+
+		// REFERENCES:
+		// na
+
+		// USE STATEMENTS:
+		// na
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+		// na
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS
+		// na
+
+		// DERIVED TYPE DEFINITIONS
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int TableNum; // index to performance table data
+		int Loop; // axis value counter
+
+		for ( TableNum = 1; TableNum <= isize( PerfCurveTableData ); ++TableNum ) {
+			auto & Table( PerfCurveTableData( TableNum ) );
+			Table.X1LowPtr = 1;
+			Table.X2LowPtr = 1;
+			if ( Table.X1.allocated() && size( Table.X1 ) > 0 ) {
+				Table.X1Low = minval( Table.X1 );
+				Table.X1High = maxval( Table.X1 );
+				Table.X1Ascending = true;
+				for ( Loop = 2; Loop <= isize( Table.X1 ); ++Loop ) {
+					if ( Table.X1( Loop ) < Table.X1( Loop - 1 ) ) Table.X1Ascending = false;
+				}
+			}
+			if ( Table.X2.allocated() && size( Table.X2 ) > 0 ) {
+				Table.X2Low = minval( Table.X2 );
+				Table.X2High = maxval( Table.X2 );
+				Table.X2Ascending = true;
+				for ( Loop = 2; Loop <= isize( Table.X2 ); ++Loop ) {
+					if ( Table.X2( Loop ) < Table.X2( Loop - 1 ) ) Table.X2Ascending = false;
+				}
+			}
+		}
+
 	}
 
 	void
@@ -3662,6 +3823,84 @@ Label999: ;
 		return CurveValue;
 	}
 
+	int
+	FindTableLowPtr(
+		Real64 const V, // independent variable, strictly inside the axis range
+		FArray1D< Real64 > const & X, // axis values
+		bool const Ascending, // axis values are in non-decreasing order
+		int & LowPtrHint // low bracket index from the last lookup (updated)
+	)
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns the last index of the axis array whose value is less than or equal to V,
+		// which is the low side of the interpolation interval in PerformanceTableObject.
+
+		// METHODOLOGY EMPLOYED:
+		// For an axis in non-decreasing order the interval from the previous lookup is
+		// tried first (successive calls from a component usually land in the same or the
+		// next interval), then interval halving is used.  Axes that are not sorted keep the
+		// original linear scan so the results are unchanged.
+
+		// REFERENCES:
+		// na
+
+		// USE STATEMENTS:
+		// na
+
+		// Return value
+		int LowPtr( 0 );
+
+		// Locals
+		// FUNCTION ARGUMENT DEFINITIONS:
+
+		// FUNCTION PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS
+		// na
+
+		// DERIVED TYPE DEFINITIONS
+		// na
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		int const NumPoints( size( X ) );
+		int Loop; // axis value counter
+		int HighPtr; // upper limit of interval halving
+		int MidPtr; // mid point of interval halving
+
+		if ( ! Ascending ) {
+			for ( Loop = 1; Loop <= NumPoints; ++Loop ) {
+				if ( V >= X( Loop ) ) LowPtr = Loop;
+			}
+			return LowPtr;
+		}
+
+		// V is strictly between the first and last values, so the result is in [1,NumPoints-1]
+		if ( LowPtrHint >= 1 && LowPtrHint < NumPoints ) {
+			if ( X( LowPtrHint ) <= V && V < X( LowPtrHint + 1 ) ) return LowPtrHint;
+			if ( LowPtrHint + 2 <= NumPoints && X( LowPtrHint + 1 ) <= V && V < X( LowPtrHint + 2 ) ) {
+				++LowPtrHint;
+				return LowPtrHint;
+			}
+		}
+
+		LowPtr = 1;
+		HighPtr = NumPoints;
+		while ( HighPtr - LowPtr > 1 ) {
+			MidPtr = ( LowPtr + HighPtr ) / 2;
+			if ( X( MidPtr ) <= V ) {
+				LowPtr = MidPtr;
+			} else {
+				HighPtr = MidPtr;
+			}
+		}
+		LowPtrHint = LowPtr;
+
+		return LowPtr;
+
+	}
+
 	Real64
 	PerformanceTableObject(
 		int const CurveIndex, // index of curve in curve array
@@ -3726,8 +3965,6 @@ Label999: ;
 		Real64 X1ValLow;
 		Real64 X1ValHigh;
 		//INTEGER   :: MaxSizeArray
-		int X1Val;
-		int X2Val;
 		int TableIndex;
 
 		TableIndex = PerfCurve( CurveIndex ).TableIndex;
@@ -3749,8 +3986,8 @@ Label999: ;
 		{ auto const SELECT_CASE_var( TableLookup( TableIndex ).NumIndependentVars );
 		if ( SELECT_CASE_var == 1 ) {
 
-			TempX1Low = minval( PerfCurveTableData( TableIndex ).X1 );
-			TempX1High = maxval( PerfCurveTableData( TableIndex ).X1 );
+			TempX1Low = PerfCurveTableData( TableIndex ).X1Low;
+			TempX1High = PerfCurveTableData( TableIndex ).X1High;
 			if ( V1 <= TempX1Low ) {
 				TempX1LowPtr = 1;
 				TempX1HighPtr = 1;
@@ -3758,9 +3995,7 @@ Label999: ;
 				TempX1LowPtr = size( PerfCurveTableData( TableIndex ).X1 );
 				TempX1HighPtr = TempX1LowPtr;
 			} else {
-				for ( X1Val = 1; X1Val <= isize( PerfCurveTableData( TableIndex ).X1 ); ++X1Val ) {
-					if ( V1 >= PerfCurveTableData( TableIndex ).X1( X1Val ) ) TempX1LowPtr = X1Val;
-				}
+				TempX1LowPtr = FindTableLowPtr( V1, PerfCurveTableData( TableIndex ).X1, PerfCurveTableData( TableIndex ).X1Ascending, PerfCurveTableData( TableIndex ).X1LowPtr );
 				if ( V1 == PerfCurveTableData( TableIndex ).X1( TempX1LowPtr ) ) {
 					TempX1HighPtr = TempX1LowPtr;
 				} else {
@@ -3776,8 +4011,8 @@ Label999: ;
 
 		} else if ( SELECT_CASE_var == 2 ) {
 
-			TempX1Low = minval( PerfCurveTableData( TableIndex ).X1 );
-			TempX1High = maxval( PerfCurveTableData( TableIndex ).X1 );
+			TempX1Low = PerfCurveTableData( TableIndex ).X1Low;
+			TempX1High = PerfCurveTableData( TableIndex ).X1High;
 			if ( V1 <= TempX1Low ) {
 				TempX1LowPtr = 1;
 				TempX1HighPtr = 1;
@@ -3785,17 +4020,15 @@ Label999: ;
 				TempX1LowPtr = size( PerfCurveTableData( TableIndex ).X1 );
 				TempX1HighPtr = TempX1LowPtr;
 			} else {
-				for ( X1Val = 1; X1Val <= isize( PerfCurveTableData( TableIndex ).X1 ); ++X1Val ) {
-					if ( V1 >= PerfCurveTableData( TableIndex ).X1( X1Val ) ) TempX1LowPtr = X1Val;
-				}
+				TempX1LowPtr = FindTableLowPtr( V1, PerfCurveTableData( TableIndex ).X1, PerfCurveTableData( TableIndex ).X1Ascending, PerfCurveTableData( TableIndex ).X1LowPtr );
 				if ( V1 == PerfCurveTableData( TableIndex ).X1( TempX1LowPtr ) ) {
 					TempX1HighPtr = TempX1LowPtr;
 				} else {
 					TempX1HighPtr = TempX1LowPtr + 1;
 				}
 			}
-			TempX2Low = minval( PerfCurveTableData( TableIndex ).X2 );
-			TempX2High = maxval( PerfCurveTableData( TableIndex ).X2 );
+			TempX2Low = PerfCurveTableData( TableIndex ).X2Low;
+			TempX2High = PerfCurveTableData( TableIndex ).X2High;
 
 			if ( V2 <= TempX2Low ) {
 				TempX2LowPtr = 1;
@@ -3804,9 +4037,7 @@ Label999: ;
 				TempX2LowPtr = size( PerfCurveTableData( TableIndex ).X2 );
 				TempX2HighPtr = TempX2LowPtr;
 			} else {
-				for ( X2Val = 1; X2Val <= isize( PerfCurveTableData( TableIndex ).X2 ); ++X2Val ) {
-					if ( V2 >= PerfCurveTableData( TableIndex ).X2( X2Val ) ) TempX2LowPtr = X2Val;
-				}
+				TempX2LowPtr = FindTableLowPtr( V2, PerfCurveTableData( TableIndex ).X2, PerfCurveTableData( TableIndex ).X2Ascending, PerfCurveTableData( TableIndex ).X2LowPtr );
 				if ( V2 == PerfCurveTableData( TableIndex ).X2( TempX2LowPtr ) ) {
 					TempX2HighPtr = TempX2LowPtr;
 				} else {
@@ -3908,11 +4139,6 @@ Label999: ;
 		//REAL(r64), ALLOCATABLE, DIMENSION(:)     :: ONEDVALS
 		FArray2D< Real64 > TWODVALS;
 		FArray3D< Real64 > THREEDVALS;
-		FArray1D< Real64 > VALSX;
-		FArray1D< Real64 > VALSY;
-		FArray1D< Real64 > VALSV3;
-		FArray1D< Real64 > VALSV4;
-		FArray1D< Real64 > VALSV5;
 		//REAL(r64), ALLOCATABLE, DIMENSION(:,:,:) :: HPVAL
 		//REAL(r64), ALLOCATABLE, DIMENSION(:,:,:,:) :: HPVALS
 		//REAL(r64), ALLOCATABLE, DIMENSION(:,:,:,:,:) :: DVLTRN
@@ -4020,74 +4246,44 @@ Label999: ;
 			NX = TableLookup( TableIndex ).NumX1Vars;
 			NY = 1;
 			NUMPT = TableLookup( TableIndex ).InterpolationOrder;
-			VALSX.allocate( NX );
-			VALSX = TableLookup( TableIndex ).X1Var;
-			TableValue = DLAG( V1, VALSX( 1 ), VALSX, VALSX, TableLookup( TableIndex ).TableLookupZData( _, _, 1, 1, 1 ), NX, NY, NUMPT, IEXTX, IEXTY );
-			VALSX.deallocate();
+			TableValue = DLAG( V1, TableLookup( TableIndex ).X1Var( 1 ), TableLookup( TableIndex ).X1Var, TableLookup( TableIndex ).X1Var, TableLookup( TableIndex ).TableLookupZData( _, _, 1, 1, 1 ), NX, NY, NUMPT, IEXTX, IEXTY );
 		} else if ( SELECT_CASE_var == 2 ) {
 			NX = TableLookup( TableIndex ).NumX1Vars;
 			NY = TableLookup( TableIndex ).NumX2Vars;
 			NUMPT = TableLookup( TableIndex ).InterpolationOrder;
-			VALSX.allocate( NX );
-			VALSX = TableLookup( TableIndex ).X1Var;
-			VALSY.allocate( NY );
-			VALSY = TableLookup( TableIndex ).X2Var;
-			TableValue = DLAG( V1, V2, VALSX, VALSY, TableLookup( TableIndex ).TableLookupZData( _, _, 1, 1, 1 ), NX, NY, NUMPT, IEXTX, IEXTY );
-			VALSX.deallocate();
-			VALSY.deallocate();
+			TableValue = DLAG( V1, V2, TableLookup( TableIndex ).X1Var, TableLookup( TableIndex ).X2Var, TableLookup( TableIndex ).TableLookupZData( _, _, 1, 1, 1 ), NX, NY, NUMPT, IEXTX, IEXTY );
 		} else if ( SELECT_CASE_var == 3 ) {
 			NX = TableLookup( TableIndex ).NumX1Vars;
 			NY = TableLookup( TableIndex ).NumX2Vars;
 			NV3 = TableLookup( TableIndex ).NumX3Vars;
 			NUMPT = TableLookup( TableIndex ).InterpolationOrder;
-			VALSX.allocate( NX );
-			VALSX = TableLookup( TableIndex ).X1Var;
-			VALSY.allocate( NY );
-			VALSY = TableLookup( TableIndex ).X2Var;
-			VALSV3.allocate( NV3 );
-			VALSV3 = TableLookup( TableIndex ).X3Var;
 			TWODVALS.allocate( NV3, 1 );
 			// perform 2-D interpolation of X (V1) and Y (V2) and save in 2-D array
 			for ( IV3 = 1; IV3 <= NV3; ++IV3 ) {
-				TWODVALS( IV3, 1 ) = DLAG( V1, V2, VALSX, VALSY, TableLookup( TableIndex ).TableLookupZData( _, _, IV3, 1, 1 ), NX, NY, NUMPT, IEXTX, IEXTY );
+				TWODVALS( IV3, 1 ) = DLAG( V1, V2, TableLookup( TableIndex ).X1Var, TableLookup( TableIndex ).X2Var, TableLookup( TableIndex ).TableLookupZData( _, _, IV3, 1, 1 ), NX, NY, NUMPT, IEXTX, IEXTY );
 			}
 			if ( NV3 == 1 ) {
 				TableValue = TWODVALS( 1, 1 );
 			} else {
-				TableValue = DLAG( V3, 1.0, VALSV3, VALSV3, TWODVALS, NV3, 1, NUMPT, IEXTV3, IEXTV4 );
+				TableValue = DLAG( V3, 1.0, TableLookup( TableIndex ).X3Var, TableLookup( TableIndex ).X3Var, TWODVALS, NV3, 1, NUMPT, IEXTV3, IEXTV4 );
 			}
 			TWODVALS.deallocate();
-			VALSX.deallocate();
-			VALSY.deallocate();
-			VALSV3.deallocate();
 		} else if ( SELECT_CASE_var == 4 ) {
 			NX = TableLookup( TableIndex ).NumX1Vars;
 			NY = TableLookup( TableIndex ).NumX2Vars;
 			NV3 = TableLookup( TableIndex ).NumX3Vars;
 			NV4 = TableLookup( TableIndex ).NumX4Vars;
 			NUMPT = TableLookup( TableIndex ).InterpolationOrder;
-			VALSX.allocate( NX );
-			VALSX = TableLookup( TableIndex ).X1Var;
-			VALSY.allocate( NY );
-			VALSY = TableLookup( TableIndex ).X2Var;
-			VALSV3.allocate( NV3 );
-			VALSV3 = TableLookup( TableIndex ).X3Var;
-			VALSV4.allocate( NV4 );
-			VALSV4 = TableLookup( TableIndex ).X4Var;
 			TWODVALS.allocate( NV3, NV4 );
 			// perform 2-D interpolation of X (V1) and Y (V2) and save in 2-D array
 			for ( IV4 = 1; IV4 <= NV4; ++IV4 ) {
 				for ( IV3 = 1; IV3 <= NV3; ++IV3 ) {
-					TWODVALS( IV3, IV4 ) = DLAG( V1, V2, VALSX, VALSY, TableLookup( TableIndex ).TableLookupZData( _, _, IV3, IV4, 1 ), NX, NY, NUMPT, IEXTX, IEXTY );
+					TWODVALS( IV3, IV4 ) = DLAG( V1, V2, TableLookup( TableIndex ).X1Var, TableLookup( TableIndex ).X2Var, TableLookup( TableIndex ).TableLookupZData( _, _, IV3, IV4, 1 ), NX, NY, NUMPT, IEXTX, IEXTY );
 				}
 			}
 			// final interpolation of 2-D array in V3 and V4
-			TableValue = DLAG( V3, V4, VALSV3, VALSV4, TWODVALS, NV3, NV4, NUMPT, IEXTV3, IEXTV4 );
+			TableValue = DLAG( V3, V4, TableLookup( TableIndex ).X3Var, TableLookup( TableIndex ).X4Var, TWODVALS, NV3, NV4, NUMPT, IEXTV3, IEXTV4 );
 			TWODVALS.deallocate();
-			VALSX.deallocate();
-			VALSY.deallocate();
-			VALSV3.deallocate();
-			VALSV4.deallocate();
 		} else if ( SELECT_CASE_var == 5 ) {
 			NX = TableLookup( TableIndex ).NumX1Vars;
 			NY = TableLookup( TableIndex ).NumX2Vars;
@@ -4095,40 +4291,25 @@ Label999: ;
 			NV4 = TableLookup( TableIndex ).NumX4Vars;
 			NV5 = TableLookup( TableIndex ).NumX5Vars;
 			NUMPT = TableLookup( TableIndex ).InterpolationOrder;
-			VALSX.allocate( NX );
-			VALSX = TableLookup( TableIndex ).X1Var;
-			VALSY.allocate( NY );
-			VALSY = TableLookup( TableIndex ).X2Var;
-			VALSV3.allocate( NV3 );
-			VALSV3 = TableLookup( TableIndex ).X3Var;
-			VALSV4.allocate( NV4 );
-			VALSV4 = TableLookup( TableIndex ).X4Var;
-			VALSV5.allocate( NV5 );
-			VALSV5 = TableLookup( TableIndex ).X5Var;
 			THREEDVALS.allocate( NV3, NV4, NV5 );
 			for ( IV5 = 1; IV5 <= NV5; ++IV5 ) {
 				for ( IV4 = 1; IV4 <= NV4; ++IV4 ) {
 					for ( IV3 = 1; IV3 <= NV3; ++IV3 ) {
-						THREEDVALS( IV3, IV4, IV5 ) = DLAG( V1, V2, VALSX, VALSY, TableLookup( TableIndex ).TableLookupZData( _, _, IV3, IV4, IV5 ), NX, NY, NUMPT, IEXTX, IEXTY );
+						THREEDVALS( IV3, IV4, IV5 ) = DLAG( V1, V2, TableLookup( TableIndex ).X1Var, TableLookup( TableIndex ).X2Var, TableLookup( TableIndex ).TableLookupZData( _, _, IV3, IV4, IV5 ), NX, NY, NUMPT, IEXTX, IEXTY );
 					}
 				}
 			}
 			TWODVALS.allocate( NV5, 1 );
 			for ( IV5 = 1; IV5 <= NV5; ++IV5 ) {
-				TWODVALS( IV5, 1 ) = DLAG( V3, V4, VALSV3, VALSV4, THREEDVALS( _, _, IV5 ), NV3, NV4, NUMPT, IEXTX, IEXTY );
+				TWODVALS( IV5, 1 ) = DLAG( V3, V4, TableLookup( TableIndex ).X3Var, TableLookup( TableIndex ).X4Var, THREEDVALS( _, _, IV5 ), NV3, NV4, NUMPT, IEXTX, IEXTY );
 			}
 			if ( NV5 == 1 ) {
 				TableValue = TWODVALS( 1, 1 );
 			} else {
-				TableValue = DLAG( V5, 1.0, VALSV5, VALSV5, TWODVALS, NV5, 1, NUMPT, IEXTV5, IEXTV4 );
+				TableValue = DLAG( V5, 1.0, TableLookup( TableIndex ).X5Var, TableLookup( TableIndex ).X5Var, TWODVALS, NV5, 1, NUMPT, IEXTV5, IEXTV4 );
 			}
 			TWODVALS.deallocate();
 			THREEDVALS.deallocate();
-			VALSX.deallocate();
-			VALSY.deallocate();
-			VALSV3.deallocate();
-			VALSV4.deallocate();
-			VALSV5.deallocate();
 		} else {
 			TableValue = 0.0;
 			ShowSevereError( "Errors found in table output calculation for " + PerfCurve( CurveIndex ).Name );
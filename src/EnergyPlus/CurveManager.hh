@@ -258,9 +258,26 @@ namespace CurveManager {
 		FArray1D< Real64 > X1;
 		FArray1D< Real64 > X2;
 		FArray2D< Real64 > Y;
+		// axis data set up by SetupTableLookupAxes for PerformanceTableObject
+		Real64 X1Low; // minimum of X1
+		Real64 X1High; // maximum of X1
+		Real64 X2Low; // minimum of X2
+		Real64 X2High; // maximum of X2
+		bool X1Ascending; // X1 is in non-decreasing order (bracket found by interval halving)
+		bool X2Ascending; // X2 is in non-decreasing order (bracket found by interval halving)
+		int X1LowPtr; // low bracket index from the last lookup (search hint)
+		int X2LowPtr; // low bracket index from the last lookup (search hint)
 
 		// Default Constructor
-		PerfCurveTableDataStruct()
+		PerfCurveTableDataStruct() :
+			X1Low( 0.0 ),
+			X1High( 0.0 ),
+			X2Low( 0.0 ),
+			X2High( 0.0 ),
+			X1Ascending( false ),
+			X2Ascending( false ),
+			X1LowPtr( 1 ),
+			X2LowPtr( 1 )
 		{}
 
 		// Member Constructor
@@ -271,7 +288,15 @@ namespace CurveManager {
 		) :
 			X1( X1 ),
 			X2( X2 ),
-			Y( Y )
+			Y( Y ),
+			X1Low( 0.0 ),
+			X1High( 0.0 ),
+			X2Low( 0.0 ),
+			X2High( 0.0 ),
+			X1Ascending( false ),
+			X2Ascending( false ),
+			X1LowPtr( 1 ),
+			X2LowPtr( 1 )
 		{}
 
 	};
@@ -545,6 +570,9 @@ namespace CurveManager {
 
 	// Functions
 
+	void
+	clear_state();
+
 	void
 	ResetPerformanceCurveOutput();
 
@@ -558,9 +586,28 @@ namespace CurveManager {
 		Optional< Real64 const > Var5 = _ // 5th independent variable
 	);
 
+	void
+	CurveValueBatch(
+		int const CurveIndex, // index of curve in curve array
+		FArray1< Real64 > const & Var1, // 1st independent variable for each evaluation
+		FArray1< Real64 > & Result, // curve value for each evaluation
+		Optional< FArray1< Real64 > const > Var2 = _ // 2nd independent variable for each evaluation
+	);
+
 	void
 	GetCurveInput();
 
+	void
+	SetupTableLookupAxes();
+
+	int
+	FindTableLowPtr(
+		Real64 const V, // independent variable, strictly inside the axis range
+		FArray1D< Real64 > const & X, // axis values
+		bool const Ascending, // axis values are in non-decreasing order
+		int & LowPtrHint // low bracket index from the last lookup (updated)
+	);
+
 	void
 	InitCurveReporting();
 
@@ -59,6 +59,31 @@ namespace DataAirLoop {
 	FArray1D< OAControllerData > OAControllerInfo;
 	FArray1D< OutsideAirSysProps > OutsideAirSys;
 
+	// Functions
+
+	void
+	clear_state()
+	{
+		NumOASystems = 0;
+		LoopFanOperationMode = 0;
+		LoopSystemOnMassFlowrate = 0.0;
+		LoopSystemOffMassFlowrate = 0.0;
+		LoopOnOffFanPartLoadRatio = 0.0;
+		LoopHeatingCoilMaxRTF = 0.0;
+		LoopOnOffFanRTF = 0.0;
+		LoopDXCoilRTF = 0.0;
+		LoopCompCycRatio = 0.0;
+		AirLoopInputsFilled = false;
+		AirToZoneNodeInfo.deallocate();
+		AirToOANodeInfo.deallocate();
+		PriAirSysAvailMgr.deallocate();
+		AirLoopZoneInfo.deallocate();
+		AirLoopControlInfo.deallocate();
+		AirLoopFlow.deallocate();
+		OAControllerInfo.deallocate();
+		OutsideAirSys.deallocate();
+	}
+
 	//     NOTICE
 	//     Copyright  1996-2014 The Board of Trustees of the University of Illinois
 	//     and The Regents of the University of California through Ernest Orlando Lawrence
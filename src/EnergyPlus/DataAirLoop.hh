@@ -528,6 +528,11 @@ namespace DataAirLoop {
 	extern FArray1D< OAControllerData > OAControllerInfo;
 	extern FArray1D< OutsideAirSysProps > OutsideAirSys;
 
+	// Functions
+
+	void
+	clear_state();
+
 } // DataAirLoop
 
 } // EnergyPlus
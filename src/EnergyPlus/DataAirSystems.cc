@@ -56,6 +56,21 @@ namespace DataAirSystems {
 	FArray1D< ConnectAirSysSubComp > AirSysSubCompToPlant; // Connections between loops
 	FArray1D< ConnectAirSysSubSubComp > AirSysSubSubCompToPlant; // Connections between loops
 
+	// Functions
+
+	void
+	clear_state()
+	{
+		PrimaryAirSystem.deallocate();
+		DemandSideConnect.deallocate();
+		ZoneCompToPlant.deallocate();
+		ZoneSubCompToPlant.deallocate();
+		ZoneSubSubCompToPlant.deallocate();
+		AirSysCompToPlant.deallocate();
+		AirSysSubCompToPlant.deallocate();
+		AirSysSubSubCompToPlant.deallocate();
+	}
+
 	//     NOTICE
 	//     Copyright  1996-2014 The Board of Trustees of the University of Illinois
 	//     and The Regents of the University of California through Ernest Orlando Lawrence
@@ -832,6 +832,11 @@ namespace DataAirSystems {
 	extern FArray1D< ConnectAirSysSubComp > AirSysSubCompToPlant; // Connections between loops
 	extern FArray1D< ConnectAirSysSubSubComp > AirSysSubSubCompToPlant; // Connections between loops
 
+	// Functions
+
+	void
+	clear_state();
+
 } // DataAirSystems
 
 } // EnergyPlus
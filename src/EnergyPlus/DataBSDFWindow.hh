@@ -469,6 +469,8 @@ namespace DataBSDFWindow {
 		FArray1D< Real64 > IntegratedBkAbs; // Sum of all back layer absorptances (for each back direction)
 		FArray1D< Real64 > IntegratedBkRefl; // Integrated back layer reflectance (for each back direction)
 		FArray1D< Real64 > IntegratedBkTrans; // Integrated back layer transmittance (for each back direction)
+		FArray1D< Real64 > DirHemiTrans; // Directional-hemispherical front transmittance (for each incident direction)
+		FArray1D< Real64 > DirHemiBkRefl; // Directional-hemispherical back reflectance (for each back incident direction)
 
 		// Default Constructor
 		BSDFStateDescr() :
@@ -683,6 +685,25 @@ namespace DataBSDFWindow {
 
 	};
 
+	struct BSDFSparseMatrix
+	{
+		// Members
+		bool Compressed; // True if the matrix is held here instead of in its dense array
+		int NRows; // No. rows in matrix
+		int NCols; // No. columns in matrix
+		FArray1D_int ColStart; // Position of the first nonzero element of each column, then one past the last {NCols+1}
+		FArray1D_int RowIndex; // Row of each nonzero element
+		FArray1D< Real64 > Value; // Value of each nonzero element
+
+		// Default Constructor
+		BSDFSparseMatrix() :
+			Compressed( false ),
+			NRows( 0 ),
+			NCols( 0 )
+		{}
+
+	};
+
 	struct BSDFWindowInputStruct
 	{
 		// Members
@@ -703,14 +724,17 @@ namespace DataBSDFWindow {
 		int SolBkReflNrows; // No. rows in matrix
 		int SolBkReflNcols; // No. columns in matrix
 		FArray2D< Real64 > SolBkRefl; // Back optical reflectance matrix
+		BSDFSparseMatrix SolBkReflSparse; // Back optical reflectance matrix, if it is sparse
 		int VisFrtTransIndex; // pointer to matrix for Front visible transmittance matrix
 		int VisFrtTransNrows; // No. rows in matrix
 		int VisFrtTransNcols; // No. columns in matrix
 		FArray2D< Real64 > VisFrtTrans; // Front visible transmittance matrix
+		BSDFSparseMatrix VisFrtTransSparse; // Front visible transmittance matrix, if it is sparse
 		int VisBkReflIndex; // pointer to matrix for Back visible reflectance matrix
 		int VisBkReflNrows; // No. rows in matrix
 		int VisBkReflNcols; // No. columns in matrix
 		FArray2D< Real64 > VisBkRefl; // Back visible reflectance matrix
+		BSDFSparseMatrix VisBkReflSparse; // Back visible reflectance matrix, if it is sparse
 		//INTEGER   :: ThermalConstruction  !Pointer to location in Construct array of thermal construction for the state
 		// (to be implemented)
 		int NumLayers;
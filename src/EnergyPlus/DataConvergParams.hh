@@ -80,6 +80,8 @@ namespace DataConvergParams {
 	extern Real64 MinTimeStepTol; // = min allowable for ABS(1.-TimeStepSys/(MinTimeStepSys))
 	extern Real64 MaxZoneTempDiff; // 0.3 C = (1% OF 300 C) = max allowable difference between
 	//   zone air temp at Time=T and Time=T-1
+	extern Real64 MaxZoneTempLocalError; // max allowable difference between predicted
+	//   and corrected zone air temp within a system timestep when AdaptiveSystemTimestep is on
 	extern Real64 MinSysTimeRemaining; // = 1 second
 	extern int MaxIter; // maximum number of iterations allowed
 
@@ -181,6 +181,120 @@ namespace DataEnvironment {
 
 	// Functions
 
+	void
+	clear_state()
+	{
+		BeamSolarRad = 0.0;
+		EMSBeamSolarRadOverrideOn = false;
+		EMSBeamSolarRadOverrideValue = 0.0;
+		DayOfMonth = 0;
+		DayOfMonthTomorrow = 0;
+		DayOfWeek = 0;
+		DayOfWeekTomorrow = 0;
+		DayOfYear = 0;
+		DayOfYear_Schedule = 0;
+		DifSolarRad = 0.0;
+		EMSDifSolarRadOverrideOn = false;
+		EMSDifSolarRadOverrideValue = 0.0;
+		DSTIndicator = 0;
+		Elevation = 0.0;
+		EndMonthFlag = false;
+		GndReflectanceForDayltg = 0.0;
+		GndReflectance = 0.0;
+		GndSolarRad = 0.0;
+		GroundTemp = 0.0;
+		GroundTempKelvin = 0.0;
+		GroundTempFC = 0.0;
+		GroundTemp_Surface = 0.0;
+		GroundTemp_Deep = 0.0;
+		PubGroundTempSurfFlag = false;
+		HolidayIndex = 0;
+		HolidayIndexTomorrow = 0;
+		IsRain = false;
+		IsSnow = false;
+		Latitude = 0.0;
+		Longitude = 0.0;
+		Month = 0;
+		MonthTomorrow = 0;
+		OutBaroPress = 0.0;
+		OutDryBulbTemp = 0.0;
+		EMSOutDryBulbOverrideOn = false;
+		EMSOutDryBulbOverrideValue = 0.0;
+		OutHumRat = 0.0;
+		OutRelHum = 0.0;
+		OutRelHumValue = 0.0;
+		EMSOutRelHumOverrideOn = false;
+		EMSOutRelHumOverrideValue = 0.0;
+		OutEnthalpy = 0.0;
+		OutAirDensity = 0.0;
+		OutWetBulbTemp = 0.0;
+		OutDewPointTemp = 0.0;
+		EMSOutDewPointTempOverrideOn = false;
+		EMSOutDewPointTempOverrideValue = 0.0;
+		SkyTemp = 0.0;
+		SkyTempKelvin = 0.0;
+		LiquidPrecipitation = 0.0;
+		SunIsUp = false;
+		WindDir = 0.0;
+		EMSWindDirOverrideOn = false;
+		EMSWindDirOverrideValue = 0.0;
+		WindSpeed = 0.0;
+		EMSWindSpeedOverrideOn = false;
+		EMSWindSpeedOverrideValue = 0.0;
+		WaterMainsTemp = 0.0;
+		Year = 0;
+		YearTomorrow = 0;
+		CloudFraction = 0.0;
+		HISKF = 0.0;
+		HISUNF = 0.0;
+		HISUNFnorm = 0.0;
+		PDIRLW = 0.0;
+		PDIFLW = 0.0;
+		SkyClearness = 0.0;
+		SkyBrightness = 0.0;
+		StdBaroPress = 101325.0;
+		StdRhoAir = 0.0;
+		TimeZoneNumber = 0.0;
+		TimeZoneMeridian = 0.0;
+		EnvironmentName.clear();
+		WeatherFileLocationTitle.clear();
+		CurMnDyHr.clear();
+		CurMnDy.clear();
+		CurEnvirNum = 0;
+		TotDesDays = 0;
+		TotRunDesPersDays = 0;
+		CurrentOverallSimDay = 0;
+		TotalOverallSimDays = 0;
+		MaxNumberSimYears = 0;
+		RunPeriodStartDayOfWeek = 0;
+		CosSolarDeclinAngle = 0.0;
+		EquationOfTime = 0.0;
+		SinLatitude = 0.0;
+		CosLatitude = 0.0;
+		SinSolarDeclinAngle = 0.0;
+		TS1TimeOffset = -0.5;
+		WeatherFileWindModCoeff = 1.5863;
+		WeatherFileTempModCoeff = 0.0;
+		SiteWindExp = 0.22;
+		SiteWindBLHeight = 370.0;
+		SiteTempGradient = 0.0065;
+		GroundTempObjInput = false;
+		GroundTemp_SurfaceObjInput = false;
+		GroundTemp_DeepObjInput = false;
+		FCGroundTemps = false;
+		DisplayWeatherMissingDataWarnings = false;
+		IgnoreSolarRadiation = false;
+		IgnoreBeamRadiation = false;
+		IgnoreDiffuseRadiation = false;
+		PrintEnvrnStampWarmup = false;
+		PrintEnvrnStampWarmupPrinted = false;
+		RunPeriodEnvironment = false;
+		EnvironmentStartEnd.clear();
+		CurrentYearIsLeapYear = false;
+		PubGroundTempSurface = 0.0;
+		SOLCOS = 0.0;
+	}
+
 	Real64
 	OutDryBulbTempAt( Real64 const Z ) // Height above ground (m)
 	{
@@ -154,6 +154,9 @@ namespace DataEnvironment {
 
 	// Functions
 
+	void
+	clear_state();
+
 	Real64
 	OutDryBulbTempAt( Real64 const Z ); // Height above ground (m)
 
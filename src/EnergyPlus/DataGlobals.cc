@@ -101,6 +101,7 @@ namespace DataGlobals {
 	int const emsCallFromComponentGetInput( 15 ); // EMS called from end of get input for a component
 	int const emsCallFromUserDefinedComponentModel( 16 ); // EMS called from inside a custom user component model
 	int const emsCallFromUnitarySystemSizing( 17 ); // EMS called from unitary system compound component
+	int const NumEMSCallingPoints( 17 ); // count of EMS calling points, emsCallFrom* run 1..NumEMSCallingPoints
 
 	int const ScheduleAlwaysOn( -1 ); // Value when passed to schedule routines gives back 1.0 (on)
 
@@ -190,6 +191,89 @@ namespace DataGlobals {
 	void ( *fProgressPtr )( int const );
 	void ( *fMessagePtr )( std::string const & );
 
+	// Functions
+
+	void
+	clear_state()
+	{
+		runReadVars = false;
+		DDOnlySimulation = false;
+		AnnualSimulation = false;
+		BeginDayFlag = false;
+		BeginEnvrnFlag = false;
+		BeginHourFlag = false;
+		BeginSimFlag = false;
+		BeginFullSimFlag = false;
+		BeginTimeStepFlag = false;
+		DayOfSim = 0;
+		DayOfSimChr = "0";
+		EndEnvrnFlag = false;
+		EndDesignDayEnvrnsFlag = false;
+		EndDayFlag = false;
+		EndHourFlag = false;
+		PreviousHour = 0;
+		HourOfDay = 0;
+		WeightPreviousHour = 0.0;
+		WeightNow = 0.0;
+		NumOfDayInEnvrn = 0;
+		NumOfTimeStepInHour = 0;
+		NumOfZones = 0;
+		TimeStep = 0;
+		TimeStepZone = 0.0;
+		WarmupFlag = false;
+		OutputFileStandard = 0;
+		eso_stream = nullptr;
+		StdOutputRecordCount = 0;
+		OutputFileInits = 0;
+		OutputFileDebug = 0;
+		OutputFileZoneSizing = 0;
+		OutputFileSysSizing = 0;
+		OutputFileMeters = 0;
+		mtr_stream = nullptr;
+		StdMeterRecordCount = 0;
+		OutputFileBNDetails = 0;
+		ZoneSizingCalc = false;
+		SysSizingCalc = false;
+		DoZoneSizing = false;
+		DoSystemSizing = false;
+		DoPlantSizing = false;
+		DoDesDaySim = false;
+		DoWeathSim = false;
+		WeathSimReq = false;
+		KindOfSim = 0;
+		DoOutputReporting = false;
+		DoingSizing = false;
+		DoingInputProcessing = false;
+		DisplayAllWarnings = false;
+		DisplayExtraWarnings = false;
+		DisplayUnusedObjects = false;
+		DisplayUnusedSchedules = false;
+		DisplayAdvancedReportVariables = false;
+		DisplayZoneAirHeatBalanceOffBalance = false;
+		DisplayInputInAudit = false;
+		CreateMinimalSurfaceVariables = false;
+		CurrentTime = 0.0;
+		SimTimeSteps = 0;
+		MinutesPerTimeStep = 0;
+		TimeStepZoneSec = 0.0;
+		MetersHaveBeenInitialized = false;
+		KickOffSimulation = false;
+		KickOffSizing = false;
+		AnyEnergyManagementSystemInModel = false;
+		AnyPlantInModel = false;
+		CacheIPErrorFile = 0;
+		AnyIdealCondEntSetPointInModel = false;
+		RunOptCondEntTemp = false;
+		CompLoadReportIsReq = false;
+		isPulseZoneSizing = false;
+		OutputFileZonePulse = 0;
+		doLoadComponentPulseNow = false;
+		ShowDecayCurvesInEIO = false;
+		AnySlabsInModel = false;
+		AnyBasementsInModel = false;
+		Progress = 0;
+	}
+
 	//     NOTICE
 	//     Copyright © 1996-2014 The Board of Trustees of the University of Illinois
 	//     and The Regents of the University of California through Ernest Orlando Lawrence
@@ -76,6 +76,7 @@ namespace DataGlobals {
 	extern int const emsCallFromComponentGetInput; // EMS called from end of get input for a component
 	extern int const emsCallFromUserDefinedComponentModel; // EMS called from inside a custom user component model
 	extern int const emsCallFromUnitarySystemSizing; // EMS called from unitary system compound component
+	extern int const NumEMSCallingPoints; // count of EMS calling points, emsCallFrom* run 1..NumEMSCallingPoints
 
 	extern int const ScheduleAlwaysOn; // Value when passed to schedule routines gives back 1.0 (on)
 
@@ -165,6 +166,11 @@ namespace DataGlobals {
 	extern void ( *fProgressPtr )( int const );
 	extern void ( *fMessagePtr )( std::string const & );
 
+	// Functions
+
+	void
+	clear_state();
+
 } // DataGlobals
 
 } // EnergyPlus
@@ -457,6 +457,11 @@ namespace DataHVACGlobals {
 	extern OptStartDataType OptStartData; // For optimum start
 	extern FArray1D< ComponentSetPtData > CompSetPtEquip;
 
+	// Functions
+
+	void
+	clear_state();
+
 } // DataHVACGlobals
 
 } // EnergyPlus
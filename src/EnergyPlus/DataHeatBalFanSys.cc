@@ -190,6 +190,122 @@ namespace DataHeatBalFanSys {
 	// Object Data
 	FArray1D< ZoneComfortControlsFangerData > ZoneComfortControlsFanger;
 
+	// Functions
+
+	void
+	clear_state()
+	{
+		SumConvHTRadSys.deallocate();
+		SumLatentHTRadSys.deallocate();
+		SumConvPool.deallocate();
+		SumLatentPool.deallocate();
+		QHTRadSysToPerson.deallocate();
+		QHWBaseboardToPerson.deallocate();
+		QSteamBaseboardToPerson.deallocate();
+		QElecBaseboardToPerson.deallocate();
+		ZTAV.deallocate();
+		MAT.deallocate();
+		TempTstatAir.deallocate();
+		ZT.deallocate();
+		XMAT.deallocate();
+		XM2T.deallocate();
+		XM3T.deallocate();
+		XM4T.deallocate();
+		DSXMAT.deallocate();
+		DSXM2T.deallocate();
+		DSXM3T.deallocate();
+		DSXM4T.deallocate();
+		XMPT.deallocate();
+		ZTAVComf.deallocate();
+		ZoneAirHumRatAvgComf.deallocate();
+		ZoneAirHumRatAvg.deallocate();
+		ZoneAirHumRat.deallocate();
+		WZoneTimeMinus1.deallocate();
+		WZoneTimeMinus2.deallocate();
+		WZoneTimeMinus3.deallocate();
+		WZoneTimeMinus4.deallocate();
+		DSWZoneTimeMinus1.deallocate();
+		DSWZoneTimeMinus2.deallocate();
+		DSWZoneTimeMinus3.deallocate();
+		DSWZoneTimeMinus4.deallocate();
+		WZoneTimeMinusP.deallocate();
+		ZoneAirHumRatTemp.deallocate();
+		WZoneTimeMinus1Temp.deallocate();
+		WZoneTimeMinus2Temp.deallocate();
+		WZoneTimeMinus3Temp.deallocate();
+		ZoneAirHumRatOld.deallocate();
+		MCPI.deallocate();
+		MCPTI.deallocate();
+		MCPV.deallocate();
+		MCPTV.deallocate();
+		MCPM.deallocate();
+		MCPTM.deallocate();
+		MCPE.deallocate();
+		EAMFL.deallocate();
+		MCPTE.deallocate();
+		MCPC.deallocate();
+		CTMFL.deallocate();
+		MCPTC.deallocate();
+		ThermChimAMFL.deallocate();
+		MCPTThermChim.deallocate();
+		MCPThermChim.deallocate();
+		ZoneLatentGain.deallocate();
+		OAMFL.deallocate();
+		VAMFL.deallocate();
+		NonAirSystemResponse.deallocate();
+		SysDepZoneLoads.deallocate();
+		SysDepZoneLoadsLagged.deallocate();
+		MDotCPOA.deallocate();
+		MDotOA.deallocate();
+		MixingMassFlowZone.deallocate();
+		MixingMassFlowXHumRat.deallocate();
+		ZoneMassBalanceFlag.deallocate();
+		ZoneInfiltrationFlag.deallocate();
+		ZoneMassBalanceRepVarFlag.deallocate();
+		ZoneReOrder.deallocate();
+		QRadSysSource.deallocate();
+		TCondFDSourceNode.deallocate();
+		QPVSysSource.deallocate();
+		CTFTsrcConstPart.deallocate();
+		QHTRadSysSurf.deallocate();
+		QHWBaseboardSurf.deallocate();
+		QSteamBaseboardSurf.deallocate();
+		QElecBaseboardSurf.deallocate();
+		QPoolSurfNumerator.deallocate();
+		PoolHeatTransCoefs.deallocate();
+		RadSysTiHBConstCoef.deallocate();
+		RadSysTiHBToutCoef.deallocate();
+		RadSysTiHBQsrcCoef.deallocate();
+		RadSysToHBConstCoef.deallocate();
+		RadSysToHBTinCoef.deallocate();
+		RadSysToHBQsrcCoef.deallocate();
+		SumHmAW.deallocate();
+		SumHmARa.deallocate();
+		SumHmARaW.deallocate();
+		TempZoneThermostatSetPoint.deallocate();
+		ZoneThermostatSetPointHi.deallocate();
+		ZoneThermostatSetPointLo.deallocate();
+		LoadCorrectionFactor.deallocate();
+		CrossMixingFlag.deallocate();
+		AIRRAT.deallocate();
+		ZTM1.deallocate();
+		ZTM2.deallocate();
+		ZTM3.deallocate();
+		ZoneTMX.deallocate();
+		ZoneTM2.deallocate();
+		ZoneT1.deallocate();
+		ZoneWMX.deallocate();
+		ZoneWM2.deallocate();
+		ZoneW1.deallocate();
+		ZoneVolCapMultpSens = 0.0;
+		ZoneVolCapMultpMoist = 0.0;
+		ZoneVolCapMultpCO2 = 0.0;
+		ZoneVolCapMultpGenContam = 0.0;
+		TempControlType.deallocate();
+		ComfortControlType.deallocate();
+		ZoneComfortControlsFanger.deallocate();
+	}
+
 	//     NOTICE
 	//     Copyright © 1996-2014 The Board of Trustees of the University of Illinois
 	//     and The Regents of the University of California through Ernest Orlando Lawrence
@@ -219,6 +219,11 @@ namespace DataHeatBalFanSys {
 	// Object Data
 	extern FArray1D< ZoneComfortControlsFangerData > ZoneComfortControlsFanger;
 
+	// Functions
+
+	void
+	clear_state();
+
 } // DataHeatBalFanSys
 
 } // EnergyPlus
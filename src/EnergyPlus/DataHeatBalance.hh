@@ -302,6 +302,8 @@ namespace DataHeatBalance {
 
 	extern int NumOfZoneLists; // Total number of zone lists
 	extern int NumOfZoneGroups; // Total number of zone groups
+	extern int NumZoneCouplingGroups; // Number of groups of zones coupled through interzone surfaces
+	extern FArray1D_int ZoneCouplingGroupNum; // Coupling group each zone belongs to
 	extern int NumPeopleStatements; // Number of People objects in input - possibly global assignments
 	extern int NumLightsStatements; // Number of Lights objects in input - possibly global assignments
 	extern int NumZoneElectricStatements; // Number of ZoneElectric objects in input - possibly global assignments
@@ -5698,6 +5700,9 @@ namespace DataHeatBalance {
 
 	// Functions
 
+	void
+	clear_state();
+
 	void
 	CheckAndSetConstructionProperties(
 		int const ConstrNum, // Construction number to be set/checked
@@ -88,6 +88,20 @@ namespace DataLoopNode {
 	FArray1D< MoreNodeData > MoreNodeInfo;
 	FArray1D< MarkedNodeData > MarkedNode;
 
+	// Functions
+
+	void
+	clear_state()
+	{
+		NumOfNodes = 0;
+		NumofSplitters = 0;
+		NumofMixers = 0;
+		NodeID.deallocate();
+		Node.deallocate();
+		MoreNodeInfo.deallocate();
+		MarkedNode.deallocate();
+	}
+
 	//     NOTICE
 	//     Copyright  1996-2014 The Board of Trustees of the University of Illinois
 	//     and The Regents of the University of California through Ernest Orlando Lawrence
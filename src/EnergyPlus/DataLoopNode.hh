@@ -308,6 +308,11 @@ namespace DataLoopNode {
 	extern FArray1D< MoreNodeData > MoreNodeInfo;
 	extern FArray1D< MarkedNodeData > MarkedNode;
 
+	// Functions
+
+	void
+	clear_state();
+
 } // DataLoopNode
 
 } // EnergyPlus
@@ -323,12 +323,14 @@ namespace DataPlant {
 	Real64 EconLoadMet( 0.0 ); // Load met by Economizer
 	int TotNumLoops( 0 ); // number of plant and condenser loops
 	int TotNumHalfLoops( 0 ); // number of half loops (2 * TotNumLoops)
+	int NumPlantLoopGroups( 0 ); // number of groups of interconnected plant and condenser loops
 	bool PlantSizeNotComplete( true );
 	bool PlantSizesOkayToFinalize( false ); // true if plant sizing is finishing and can save results
 	bool AnyEMSPlantOpSchemesInModel( false );
 
 	FArray1D_int EconBranchNum; // Branch num on which economizer is placed
 	FArray1D_int EconCompNum; // Component num of economizer in the economizer branch
+	FArray1D_int PlantLoopGroupNum; // loop group each plant or condenser loop belongs to
 
 	FArray1D_bool CheckLoopEcon; // Flag for initializations
 	FArray1D_bool EconOn; // Flag specifying if economizer is ON
@@ -372,6 +374,40 @@ namespace DataPlant {
 
 	// Functions
 
+	void
+	clear_state()
+	{
+		NumPipes = 0;
+		NumPlantPipes = 0;
+		NumCondPipes = 0;
+		EconLoadMet = 0.0;
+		TotNumLoops = 0;
+		TotNumHalfLoops = 0;
+		NumPlantLoopGroups = 0;
+		PlantSizeNotComplete = true;
+		PlantSizesOkayToFinalize = false;
+		AnyEMSPlantOpSchemesInModel = false;
+		EconBranchNum.deallocate();
+		EconCompNum.deallocate();
+		PlantLoopGroupNum.deallocate();
+		CheckLoopEcon.deallocate();
+		EconOn.deallocate();
+		SimSupplySide.deallocate();
+		SimDemandSide.deallocate();
+		LoadChangeDownStream.deallocate();
+		PlantManageSubIterations = 0;
+		PlantManageHalfLoopCalls = 0;
+		Pipe.deallocate();
+		PlantLoop.deallocate();
+		PlantAvailMgr.deallocate();
+		PlantReport.deallocate();
+		VentRepPlantSupplySide.deallocate();
+		VentRepPlantDemandSide.deallocate();
+		VentRepCondSupplySide.deallocate();
+		VentRepCondDemandSide.deallocate();
+		PlantCallingOrderInfo.deallocate();
+	}
+
 	void
 	ScanPlantLoopsForObject(
 		std::string const & CompName,
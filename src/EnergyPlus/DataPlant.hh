@@ -336,12 +336,14 @@ namespace DataPlant {
 	extern Real64 EconLoadMet; // Load met by Economizer
 	extern int TotNumLoops; // number of plant and condenser loops
 	extern int TotNumHalfLoops; // number of half loops (2 * TotNumLoops)
+	extern int NumPlantLoopGroups; // number of groups of interconnected plant and condenser loops
 	extern bool PlantSizeNotComplete;
 	extern bool PlantSizesOkayToFinalize; // true if plant sizing is finishing and can save results
 	extern bool AnyEMSPlantOpSchemesInModel;
 
 	extern FArray1D_int EconBranchNum; // Branch num on which economizer is placed
 	extern FArray1D_int EconCompNum; // Component num of economizer in the economizer branch
+	extern FArray1D_int PlantLoopGroupNum; // loop group each plant or condenser loop belongs to
 
 	extern FArray1D_bool CheckLoopEcon; // Flag for initializations
 	extern FArray1D_bool EconOn; // Flag specifying if economizer is ON
@@ -2302,6 +2304,9 @@ namespace DataPlant {
 
 	// Functions
 
+	void
+	clear_state();
+
 	void
 	ScanPlantLoopsForObject(
 		std::string const & CompName,
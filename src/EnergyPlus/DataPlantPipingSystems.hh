@@ -3,6 +3,7 @@
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/FArray1D.hh>
+#include <ObjexxFCL/FArray2D.hh>
 #include <ObjexxFCL/FArray3D.hh>
 
 // EnergyPlus Headers
@@ -1279,6 +1280,29 @@ namespace DataPlantPipingSystems {
 
 	};
 
+	struct FieldCellOperator // Seven-point conduction operator over the field cells of a domain, stored flat
+	{
+		// Members
+		int NumCells; // Number of field cells (general field, slab and insulation cells)
+		FArray1D_int Cell; // Linear index of each field cell in the domain cells array
+		FArray2D_int Neighbor; // (6,NumCells) Field cell number of the neighbor in each direction, 0 if not a field cell
+		FArray2D_int NeighborCell; // (6,NumCells) Linear index of the neighbor in each direction, -1 at the domain edge
+		FArray2D< Real64 > Conductance; // (6,NumCells) Inverse of the resistance to the neighbor in each direction
+		FArray1D< Real64 > Diagonal; // Operator diagonal: inverse Beta plus the neighbor conductances
+		FArray1D< Real64 > RHS; // Cell history plus the conduction from neighbors that are not field cells
+		FArray1D< Real64 > Temperature; // Field cell temperatures being solved for
+		FArray1D< Real64 > Residual;
+		FArray1D< Real64 > Search; // Conjugate gradient search direction
+		FArray1D< Real64 > Product; // Operator applied to the search direction
+		FArray1D< Real64 > Preconditioned; // Residual scaled by the diagonal
+
+		// Default Constructor
+		FieldCellOperator() :
+			NumCells( 0 )
+		{}
+
+	};
+
 	struct FullDomainStructureInfo
 	{
 		// Members
@@ -1362,6 +1386,8 @@ namespace DataPlantPipingSystems {
 
 		// Main 3D cells array
 		FArray3D< CartesianCell > Cells;
+		// Field cell operator for the conjugate gradient solve
+		FieldCellOperator FieldCells;
 
 		// Default Constructor
 		FullDomainStructureInfo() :
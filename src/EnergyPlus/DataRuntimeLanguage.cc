@@ -200,6 +200,7 @@ namespace DataRuntimeLanguage {
 	FArray1D< InternalVarsAvailableType > EMSInternalVarsAvailable; // internal data that could be used
 	FArray1D< InternalVarsUsedType > EMSInternalVarsUsed; // internal data that are used
 	FArray1D< EMSProgramCallManagementType > EMSProgramCallManager; // program calling managers
+	FArray1D< EMSCallingPointType > EMSCallingPoint; // dispatch table by calling point, see parameters emsCallFrom*
 	ErlValueType Null( 0, 0.0, "", 0, 0, false, 0, "" ); // special "null" Erl variable value instance
 	ErlValueType False( 0, 0.0, "", 0, 0, false, 0, "" ); // special "false" Erl variable value instance
 	ErlValueType True( 0, 0.0, "", 0, 0, false, 0, "" ); // special "True" Erl variable value instance, gets reset
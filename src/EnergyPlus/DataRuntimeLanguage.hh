@@ -420,6 +420,40 @@ namespace DataRuntimeLanguage {
 
 	};
 
+	struct EMSCallingPointType
+	{
+		// Members
+		// dispatch table entry for one EMS calling point, built from the program calling managers
+		int NumErlPrograms; // count of Erl programs run at this calling point, in calling manager order
+		FArray1D_int ErlProgramARR; // list of integer pointers to Erl programs run at this calling point
+		int NumSensors; // count of EMS sensors that need to be refreshed at this calling point
+		FArray1D_int SensorARR; // list of integer pointers to Sensor refreshed at this calling point
+		bool SkipCall; // true if ManageEMS has nothing to do at this calling point
+
+		// Default Constructor
+		EMSCallingPointType() :
+			NumErlPrograms( 0 ),
+			NumSensors( 0 ),
+			SkipCall( false )
+		{}
+
+		// Member Constructor
+		EMSCallingPointType(
+			int const NumErlPrograms, // count of Erl programs run at this calling point, in calling manager order
+			FArray1_int const & ErlProgramARR, // list of integer pointers to Erl programs run at this calling point
+			int const NumSensors, // count of EMS sensors that need to be refreshed at this calling point
+			FArray1_int const & SensorARR, // list of integer pointers to Sensor refreshed at this calling point
+			bool const SkipCall // true if ManageEMS has nothing to do at this calling point
+		) :
+			NumErlPrograms( NumErlPrograms ),
+			ErlProgramARR( ErlProgramARR ),
+			NumSensors( NumSensors ),
+			SensorARR( SensorARR ),
+			SkipCall( SkipCall )
+		{}
+
+	};
+
 	struct ErlValueType
 	{
 		// Members
@@ -533,6 +567,50 @@ namespace DataRuntimeLanguage {
 
 	};
 
+	struct ErlCodeType
+	{
+		// Members
+		// nested structure inside ErlStack that holds the compiled form of program instructions
+		int Code; // type of operation, e.g. CodeEvaluate, CodeSet, CodeIf
+		int Operator; // operator or built-in function evaluated by CodeEvaluate
+		int Result; // register receiving an evaluated value, or Erl variable receiving a SET
+		int Operand1; // register (> 0) or negated Erl variable index (< 0)
+		int Operand2; // register (> 0) or negated Erl variable index (< 0)
+		int Argument; // code to jump to, or index to an expression or stack
+		int InstructionNum; // program instruction the code belongs to, for trace output
+
+		// Default Constructor
+		ErlCodeType() :
+			Code( 0 ),
+			Operator( 0 ),
+			Result( 0 ),
+			Operand1( 0 ),
+			Operand2( 0 ),
+			Argument( 0 ),
+			InstructionNum( 0 )
+		{}
+
+		// Member Constructor
+		ErlCodeType(
+			int const Code, // type of operation, e.g. CodeEvaluate, CodeSet, CodeIf
+			int const Operator, // operator or built-in function evaluated by CodeEvaluate
+			int const Result, // register receiving an evaluated value, or Erl variable receiving a SET
+			int const Operand1, // register (> 0) or negated Erl variable index (< 0)
+			int const Operand2, // register (> 0) or negated Erl variable index (< 0)
+			int const Argument, // code to jump to, or index to an expression or stack
+			int const InstructionNum // program instruction the code belongs to, for trace output
+		) :
+			Code( Code ),
+			Operator( Operator ),
+			Result( Result ),
+			Operand1( Operand1 ),
+			Operand2( Operand2 ),
+			Argument( Argument ),
+			InstructionNum( InstructionNum )
+		{}
+
+	};
+
 	struct ErlStackType // Stores Erl programs in a stack of statements/instructions
 	{
 		// Members
@@ -543,12 +621,21 @@ namespace DataRuntimeLanguage {
 		FArray1D< InstructionType > Instruction; // structure array of program instructions
 		int NumErrors; // count of errors during stack parsing
 		FArray1D_string Error; // array of error messages from stack parsing
+		bool Compiled; // true if the instructions have been compiled into Code
+		int NumCodes; // count of compiled codes in stack
+		FArray1D< ErlCodeType > Code; // compiled form of the program instructions
+		int NumRegisters; // count of numeric registers used by the compiled codes
+		FArray1D< Real64 > Register; // register values, constants are loaded when compiled
+		FArray1D_int RegisterType; // value type held in each register, eg. ValueNumber
 
 		// Default Constructor
 		ErlStackType() :
 			NumLines( 0 ),
 			NumInstructions( 0 ),
-			NumErrors( 0 )
+			NumErrors( 0 ),
+			Compiled( false ),
+			NumCodes( 0 ),
+			NumRegisters( 0 )
 		{}
 
 		// Member Constructor
@@ -559,7 +646,13 @@ namespace DataRuntimeLanguage {
 			int const NumInstructions, // count of program instructions in stack
 			FArray1< InstructionType > const & Instruction, // structure array of program instructions
 			int const NumErrors, // count of errors during stack parsing
-			FArray1_string const & Error // array of error messages from stack parsing
+			FArray1_string const & Error, // array of error messages from stack parsing
+			bool const Compiled, // true if the instructions have been compiled into Code
+			int const NumCodes, // count of compiled codes in stack
+			FArray1< ErlCodeType > const & Code, // compiled form of the program instructions
+			int const NumRegisters, // count of numeric registers used by the compiled codes
+			FArray1< Real64 > const & Register, // register values, constants are loaded when compiled
+			FArray1_int const & RegisterType // value type held in each register, eg. ValueNumber
 		) :
 			Name( Name ),
 			NumLines( NumLines ),
@@ -567,7 +660,13 @@ namespace DataRuntimeLanguage {
 			NumInstructions( NumInstructions ),
 			Instruction( Instruction ),
 			NumErrors( NumErrors ),
-			Error( Error )
+			Error( Error ),
+			Compiled( Compiled ),
+			NumCodes( NumCodes ),
+			Code( Code ),
+			NumRegisters( NumRegisters ),
+			Register( Register ),
+			RegisterType( RegisterType )
 		{}
 
 	};
@@ -672,6 +771,7 @@ namespace DataRuntimeLanguage {
 	extern FArray1D< InternalVarsAvailableType > EMSInternalVarsAvailable; // internal data that could be used
 	extern FArray1D< InternalVarsUsedType > EMSInternalVarsUsed; // internal data that are used
 	extern FArray1D< EMSProgramCallManagementType > EMSProgramCallManager; // program calling managers
+	extern FArray1D< EMSCallingPointType > EMSCallingPoint; // dispatch table by calling point, see parameters emsCallFrom*
 	extern ErlValueType Null; // special "null" Erl variable value instance
 	extern ErlValueType False; // special "false" Erl variable value instance
 	extern ErlValueType True; // special "True" Erl variable value instance, gets reset
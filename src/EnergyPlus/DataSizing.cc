@@ -183,6 +183,7 @@ namespace DataSizing {
 	bool ZoneCoolingOnlyFan( false ); // TRUE if a ZoneHVAC DX cooling coil is only coil in parent
 	bool ZoneHeatingOnlyFan( false ); // TRUE if zone unit only does heating and contains a fam (such as Unit Heater)
 	bool ZoneSizingRunDone( false ); // True if a zone sizing run has been successfully completed.
+	bool DeferFinalZoneSizing( false ); // True if days are merged into CalcFinalZoneSizing after the sizing periods
 	bool DataErrorsFound( false ); // used for simulation termination when errors are found
 	Real64 AutoVsHardSizingThreshold( 0.1 ); // criteria threshold used to determine if user hard size and autosize disagree 10%
 	Real64 AutoVsHardSizingDeltaTempThreshold( 1.5 ); // temperature criteria threshold for autosize versus hard size [C]
@@ -246,6 +247,116 @@ namespace DataSizing {
 	FArray1D< CompDesWaterFlowData > CompDesWaterFlow; // array to store components' design water flow
 	FArray1D< ZoneHVACSizingData > ZoneHVACSizing; // Input data for zone HVAC sizing
 
+	// Functions
+
+	void
+	clear_state()
+	{
+		NumOARequirements = 0;
+		NumZoneAirDistribution = 0;
+		NumZoneSizingInput = 0;
+		NumSysSizInput = 0;
+		NumPltSizInput = 0;
+		CurSysNum = 0;
+		CurOASysNum = 0;
+		CurZoneEqNum = 0;
+		CurBranchNum = 0;
+		CurDuctType = 0;
+		CurLoopNum = 0;
+		CurCondLoopNum = 0;
+		CurEnvirNumSimDay = 0;
+		CurOverallSimDay = 0;
+		NumTimeStepsInAvg = 0;
+		SaveNumPlantComps = 0;
+		DataTotCapCurveIndex = 0;
+		DataPltSizCoolNum = 0;
+		DataPltSizHeatNum = 0;
+		DataWaterLoopNum = 0;
+		DataCoilNum = 0;
+		DataFanOpMode = 0;
+		DataCoilIsSuppHeater = false;
+		DataIsDXCoil = false;
+		DataAutosizable = true;
+		DataEMSOverrideON = false;
+		DataScalableSizingON = false;
+		DataScalableCapSizingON = false;
+		DataSysScalableFlowSizingON = false;
+		DataSysScalableCapSizingON = false;
+		SysSizingRunDone = false;
+		TermUnitSingDuct = false;
+		TermUnitPIU = false;
+		TermUnitIU = false;
+		ZoneEqFanCoil = false;
+		ZoneEqUnitHeater = false;
+		ZoneEqUnitVent = false;
+		ZoneEqVentedSlab = false;
+		ZoneEqDXCoil = false;
+		ZoneCoolingOnlyFan = false;
+		ZoneHeatingOnlyFan = false;
+		ZoneSizingRunDone = false;
+		DeferFinalZoneSizing = false;
+		DataErrorsFound = false;
+		AutoVsHardSizingThreshold = 0.1;
+		AutoVsHardSizingDeltaTempThreshold = 1.5;
+		DataDesInletWaterTemp = 0.0;
+		DataDesInletAirHumRat = 0.0;
+		DataDesInletAirTemp = 0.0;
+		DataDesOutletAirTemp = 0.0;
+		DataDesOutletAirHumRat = 0.0;
+		DataCoolCoilCap = 0.0;
+		DataFlowUsedForSizing = 0.0;
+		DataAirFlowUsedForSizing = 0.0;
+		DataWaterFlowUsedForSizing = 0.0;
+		DataCapacityUsedForSizing = 0.0;
+		DataDesignCoilCapacity = 0.0;
+		DataHeatSizeRatio = 1.0;
+		DataEMSOverride = 0.0;
+		DataBypassFrac = 0.0;
+		DataFracOfAutosizedCoolingAirflow = 1.0;
+		DataFracOfAutosizedHeatingAirflow = 1.0;
+		DataFlowPerCoolingCapacity = 0.0;
+		DataFlowPerHeatingCapacity = 0.0;
+		DataFracOfAutosizedCoolingCapacity = 1.0;
+		DataFracOfAutosizedHeatingCapacity = 1.0;
+		DataAutosizedCoolingCapacity = 0.0;
+		DataAutosizedHeatingCapacity = 0.0;
+		DataConstantUsedForSizing = 0.0;
+		DataFractionUsedForSizing = 0.0;
+		DataZoneNumber = 0;
+		NumZoneHVACSizing = 0;
+		DXCoolCap = 0.0;
+		GlobalHeatSizingFactor = 0.0;
+		GlobalCoolSizingFactor = 0.0;
+		SuppHeatCap = 0.0;
+		UnitaryHeatCap = 0.0;
+		ZoneSizThermSetPtHi.deallocate();
+		ZoneSizThermSetPtLo.deallocate();
+		CoolPeakDateHrMin.deallocate();
+		HeatPeakDateHrMin.deallocate();
+		SizingFileColSep = char();
+		OARequirements.deallocate();
+		ZoneAirDistribution.deallocate();
+		ZoneSizingInput.deallocate();
+		ZoneSizing.deallocate();
+		FinalZoneSizing.deallocate();
+		CalcZoneSizing.deallocate();
+		CalcFinalZoneSizing.deallocate();
+		TermUnitFinalZoneSizing.deallocate();
+		SysSizInput.deallocate();
+		SysSizing.deallocate();
+		FinalSysSizing.deallocate();
+		CalcSysSizing.deallocate();
+		SysSizPeakDDNum.deallocate();
+		TermUnitSizing.deallocate();
+		ZoneEqSizing.deallocate();
+		UnitarySysEqSizing.deallocate();
+		OASysEqSizing.deallocate();
+		PlantSizData.deallocate();
+		DesDayWeath.deallocate();
+		CompDesWaterFlow.deallocate();
+		ZoneHVACSizing.deallocate();
+	}
+
 	//     NOTICE
 	//     Copyright  1996-2014 The Board of Trustees of the University of Illinois
 	//     and The Regents of the University of California through Ernest Orlando Lawrence
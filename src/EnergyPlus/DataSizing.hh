@@ -168,6 +168,7 @@ namespace DataSizing {
 	extern bool ZoneHeatingOnlyFan; // TRUE if zone unit only does heating and contains a fam (such as Unit Heater)
 	extern bool SysSizingRunDone; // True if a system sizing run is successfully completed.
 	extern bool ZoneSizingRunDone; // True if a zone sizing run has been successfully completed.
+	extern bool DeferFinalZoneSizing; // True if days are merged into CalcFinalZoneSizing after the sizing periods
 	extern bool DataErrorsFound; // used for simulation termination when errors are found
 	extern bool DataAutosizable; // TRUE if component is autosizable
 	extern bool DataEMSOverrideON; // boolean determines if user relies on EMS to override autosizing
@@ -1963,6 +1964,11 @@ namespace DataSizing {
 	extern FArray1D< SysSizPeakDDNumData > SysSizPeakDDNum; // data array for peak des day indices
 	extern FArray1D< ZoneHVACSizingData > ZoneHVACSizing; // Input data for zone HVAC sizing
 
+	// Functions
+
+	void
+	clear_state();
+
 } // DataSizing
 
 } // EnergyPlus
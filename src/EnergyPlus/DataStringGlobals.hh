@@ -57,6 +57,8 @@ namespace DataStringGlobals {
 	extern std::string outputSszTabFileName;
 	extern std::string outputSszTxtFileName;
 	extern std::string outputScreenCsvFileName;
+	extern std::string outputProfCsvFileName;
+	extern std::string outputProfFoldedFileName;
 	extern std::string outputSqlFileName;
 	extern std::string outputSqliteErrFileName;
 	extern std::string EnergyPlusIniFileName;
@@ -114,6 +114,8 @@ namespace DataStringGlobals {
 	std::string outputSszTabFileName("eplusssz.tab");
 	std::string outputSszTxtFileName("eplusssz.txt");
 	std::string outputScreenCsvFileName("eplusscreen.csv");
+	std::string outputProfCsvFileName("eplusprof.csv");
+	std::string outputProfFoldedFileName("eplusprof.folded");
 	std::string outputSqlFileName("eplusout.sql");
 	std::string outputSqliteErrFileName("eplussqlite.err");
 	std::string EnergyPlusIniFileName;
@@ -2532,6 +2532,9 @@ namespace DataSurfaces {
 
 	// Functions
 
+	void
+	clear_state();
+
 	std::string
 	cSurfaceClass( int const ClassNo );
 
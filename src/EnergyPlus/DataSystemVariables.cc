@@ -78,6 +78,24 @@ namespace DataSystemVariables {
 	std::string const cInputPath2( "input_path" ); // RunEplus.bat setting.  Full path
 	std::string const cProgramPath( "program_path" );
 	std::string const cTimingFlag( "TimingFlag" );
+	std::string const cFluidPropertyBinarySearch( "FluidPropertyBinarySearch" );
+	std::string const cPlantLoopGroupSolve( "PlantLoopGroupSolve" );
+	std::string const cHVACProfiling( "HVACProfiling" );
+	std::string const cWarmupSnapshotSave( "WarmupSnapshotSave" );
+	std::string const cWarmupSnapshotLoad( "WarmupSnapshotLoad" );
+	std::string const cAdaptiveSystemTimestep( "AdaptiveSystemTimestep" );
+	std::string const cZoneCouplingGroupSolve( "ZoneCouplingGroupSolve" );
+	std::string const cCTFCacheFile( "CTFCacheFile" );
+	std::string const cCTFCacheValidate( "CTFCacheValidate" );
+	std::string const cCondFDDirectSolve( "CondFDDirectSolve" );
+	std::string const cParallelCondFDHAMT( "ParallelCondFDHAMT" );
+	std::string const cPipingSystemsPCGSolve( "PipingSystemsPCGSolve" );
+	std::string const cGroundHXMultiLevelAggregation( "GroundHXMultiLevelAggregation" );
+	std::string const cWindowGasPropertyTables( "WindowGasPropertyTables" );
+	std::string const cStratifiedTankImplicitSolve( "StratifiedTankImplicitSolve" );
+	std::string const cTabularAggregationPlan( "TabularAggregationPlan" );
+	std::string const cLoadComponentDecayFromCTF( "LoadComponentDecayFromCTF" );
+	std::string const cDesignDaySizingWorkers( "DesignDaySizingWorkers" );
 	std::string const TrackAirLoopEnvVar( "TRACK_AIRLOOP" ); // To generate a file with runtime statistics
 	// for each controller on each air loop
 	std::string const TraceAirLoopEnvVar( "TRACE_AIRLOOP" ); // To generate a trace file with the converged
@@ -120,6 +138,24 @@ namespace DataSystemVariables {
 	int MinReportFrequency( -2 ); // Frequency var turned into integer during get report var input.
 	bool SortedIDD( true ); // after processing, use sorted IDD to obtain Defs, etc.
 	bool lMinimalShadowing( false ); // TRUE if MinimalShadowing is to override Solar Distribution flag
+	bool FluidPropertyBinarySearch( false ); // TRUE if fluid property tables are searched instead of using index grids
+	bool PlantLoopGroupSolve( false ); // TRUE if each group of interconnected plant loops is iterated to convergence on its own
+	bool HVACProfiling( false ); // TRUE if HVAC subsystem and component timings are collected and written at the end of the run
+	std::string WarmupSnapshotSaveFile; // File the warmed-up thermal state of each environment is written to
+	std::string WarmupSnapshotLoadFile; // File a previously saved warmed-up thermal state is read from
+	bool AdaptiveSystemTimestep( false ); // TRUE if system timesteps are sized from the zone air temperature local error estimate
+	bool ZoneCouplingGroupSolve( false ); // TRUE if each group of coupled zones iterates its inside surface heat balance on its own
+	std::string CTFCacheFile; // File the conduction transfer functions of the constructions are cached in
+	bool CTFCacheValidate( false ); // TRUE if cached conduction transfer functions are recalculated and compared
+	bool CondFDDirectSolve( false ); // TRUE if fully implicit CondFD surfaces are solved directly instead of by Gauss-Seidel sweeps
+	bool ParallelCondFDHAMT( false ); // TRUE if the CondFD and HAMT surfaces are solved concurrently (needs an OpenMP build)
+	bool PipingSystemsPCGSolve( false ); // TRUE if the ground domain field cells are solved by conjugate gradients instead of point iteration
+	bool GroundHXMultiLevelAggregation( false ); // TRUE if vertical ground heat exchanger load histories are superposed in multi-level blocks
+	bool WindowGasPropertyTables( false ); // TRUE if window gap gas mixture properties are interpolated from temperature tables
+	bool StratifiedTankImplicitSolve( false ); // TRUE if stratified tank nodes are solved implicitly over long sub time steps
+	bool TabularAggregationPlan( false ); // TRUE if the monthly, binned and BEPS reports are gathered by a precompiled aggregation plan
+	bool LoadComponentDecayFromCTF( false ); // TRUE if the load component decay curves are computed from the CTFs instead of a pulse zone sizing run
+	int DesignDaySizingWorkers( 1 ); // Number of processes the zone sizing periods are shared among
 	std::string TempFullFileName;
 	std::string envinputpath1;
 	std::string envinputpath2;
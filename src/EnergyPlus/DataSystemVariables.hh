@@ -47,6 +47,24 @@ namespace DataSystemVariables {
 	extern std::string const cInputPath2; // RunEplus.bat setting.  Full path
 	extern std::string const cProgramPath;
 	extern std::string const cTimingFlag;
+	extern std::string const cFluidPropertyBinarySearch;
+	extern std::string const cPlantLoopGroupSolve;
+	extern std::string const cHVACProfiling;
+	extern std::string const cWarmupSnapshotSave;
+	extern std::string const cWarmupSnapshotLoad;
+	extern std::string const cAdaptiveSystemTimestep;
+	extern std::string const cZoneCouplingGroupSolve;
+	extern std::string const cCTFCacheFile;
+	extern std::string const cCTFCacheValidate;
+	extern std::string const cCondFDDirectSolve;
+	extern std::string const cParallelCondFDHAMT;
+	extern std::string const cPipingSystemsPCGSolve;
+	extern std::string const cGroundHXMultiLevelAggregation;
+	extern std::string const cWindowGasPropertyTables;
+	extern std::string const cStratifiedTankImplicitSolve;
+	extern std::string const cTabularAggregationPlan;
+	extern std::string const cLoadComponentDecayFromCTF;
+	extern std::string const cDesignDaySizingWorkers;
 	extern std::string const TrackAirLoopEnvVar; // To generate a file with runtime statistics
 	// for each controller on each air loop
 	extern std::string const TraceAirLoopEnvVar; // To generate a trace file with the converged
@@ -89,6 +107,24 @@ namespace DataSystemVariables {
 	extern int MinReportFrequency; // Frequency var turned into integer during get report var input.
 	extern bool SortedIDD; // after processing, use sorted IDD to obtain Defs, etc.
 	extern bool lMinimalShadowing; // TRUE if MinimalShadowing is to override Solar Distribution flag
+	extern bool FluidPropertyBinarySearch; // TRUE if fluid property tables are searched instead of using index grids
+	extern bool PlantLoopGroupSolve; // TRUE if each group of interconnected plant loops is iterated to convergence on its own
+	extern bool HVACProfiling; // TRUE if HVAC subsystem and component timings are collected and written at the end of the run
+	extern std::string WarmupSnapshotSaveFile; // File the warmed-up thermal state of each environment is written to
+	extern std::string WarmupSnapshotLoadFile; // File a previously saved warmed-up thermal state is read from
+	extern bool AdaptiveSystemTimestep; // TRUE if system timesteps are sized from the zone air temperature local error estimate
+	extern bool ZoneCouplingGroupSolve; // TRUE if each group of coupled zones iterates its inside surface heat balance on its own
+	extern std::string CTFCacheFile; // File the conduction transfer functions of the constructions are cached in
+	extern bool CTFCacheValidate; // TRUE if cached conduction transfer functions are recalculated and compared
+	extern bool CondFDDirectSolve; // TRUE if fully implicit CondFD surfaces are solved directly instead of by Gauss-Seidel sweeps
+	extern bool ParallelCondFDHAMT; // TRUE if the CondFD and HAMT surfaces are solved concurrently (needs an OpenMP build)
+	extern bool PipingSystemsPCGSolve; // TRUE if the ground domain field cells are solved by conjugate gradients instead of point iteration
+	extern bool GroundHXMultiLevelAggregation; // TRUE if vertical ground heat exchanger load histories are superposed in multi-level blocks
+	extern bool WindowGasPropertyTables; // TRUE if window gap gas mixture properties are interpolated from temperature tables
+	extern bool StratifiedTankImplicitSolve; // TRUE if stratified tank nodes are solved implicitly over long sub time steps
+	extern bool TabularAggregationPlan; // TRUE if the monthly, binned and BEPS reports are gathered by a precompiled aggregation plan
+	extern bool LoadComponentDecayFromCTF; // TRUE if the load component decay curves are computed from the CTFs instead of a pulse zone sizing run
+	extern int DesignDaySizingWorkers; // Number of processes the zone sizing periods are shared among
 	extern std::string TempFullFileName;
 	extern std::string envinputpath1;
 	extern std::string envinputpath2;
@@ -1,3 +1,8 @@
+// C++ Headers
+#include <chrono>
+#include <cmath>
+#include <string>
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/FArray.functions.hh>
 #include <ObjexxFCL/gio.hh>
@@ -8,7 +13,9 @@
 #include <DataTimings.hh>
 #include <DataErrorTracking.hh>
 #include <DataPrecisionGlobals.hh>
+#include <DataStringGlobals.hh>
 #include <DataSystemVariables.hh>
+#include <DisplayRoutines.hh>
 #include <General.hh>
 #include <UtilityRoutines.hh>
 #include <Timer.h>
@@ -43,6 +50,7 @@ namespace DataTimings {
 	using namespace DataPrecisionGlobals;
 	using DataSystemVariables::tabchar;
 	using DataSystemVariables::DeveloperFlag;
+	using DataSystemVariables::HVACProfiling;
 
 	// Data
 	// -only module should be available to other modules and routines.
@@ -71,6 +79,8 @@ namespace DataTimings {
 	bool lprocessingInputTiming( false );
 	bool lmanageSimulationTiming( false );
 	bool lcloseoutReportingTiming( false );
+	int NumHVACProfileNodes( 0 ); // number of entries used in the HVAC profile tree
+	int CurHVACProfileNode( 0 ); // profile tree entry that is currently being timed
 
 	// Following for calls to routines
 #ifdef EP_Count_Calls
@@ -94,9 +104,50 @@ namespace DataTimings {
 
 	// Object Data
 	FArray1D< timings > Timing;
+	FArray1D< HVACProfileData > HVACProfile;
 
 	// Functions
 
+	void
+	clear_state()
+	{
+		NumTimingElements = 0;
+		MaxTimingElements = 0;
+		dailyWeatherTime = 0.0;
+		dailyExteriorEnergyUseTime = 0.0;
+		dailyHeatBalanceTime = 0.0;
+		hbdailyInit = 0.0;
+		hbdailyOutSurf = 0.0;
+		hbdailyInSurf = 0.0;
+		hbdailyHVAC = 0.0;
+		hbdailyRep = 0.0;
+		lprocessingInputTiming = false;
+		lmanageSimulationTiming = false;
+		lcloseoutReportingTiming = false;
+		NumHVACProfileNodes = 0;
+		CurHVACProfileNode = 0;
+#ifdef EP_Count_Calls
+		NumShadow_Calls = 0;
+		NumShadowAtTS_Calls = 0;
+		NumClipPoly_Calls = 0;
+		NumInitSolar_Calls = 0;
+		NumAnisoSky_Calls = 0;
+		NumDetPolyOverlap_Calls = 0;
+		NumCalcPerSolBeam_Calls = 0;
+		NumDetShadowCombs_Calls = 0;
+		NumIntSolarDist_Calls = 0;
+		NumIntRadExchange_Calls = 0;
+		NumIntRadExchangeZ_Calls = 0;
+		NumIntRadExchangeMain_Calls = 0;
+		NumIntRadExchangeOSurf_Calls = 0;
+		NumIntRadExchangeISurf_Calls = 0;
+		NumMaxInsideSurfIterations = 0;
+		NumCalcScriptF_Calls = 0;
+#endif
+		Timing.deallocate();
+		HVACProfile.deallocate();
+	}
+
 	void
 	epStartTime( std::string const & ctimingElementstring )
 	{
@@ -567,6 +618,203 @@ namespace DataTimings {
 
 	}
 
+	void
+	epStartHVACProfile( std::string const & Name )
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Start timing an HVAC subsystem, controller or component when HVAC profiling
+		// is requested (ref: epStopHVACProfile, epWriteHVACProfile).
+
+		// METHODOLOGY EMPLOYED:
+		// The entries form a call tree: an entry is found (or added) by name among the
+		// children of the entry that is currently being timed, and then becomes the
+		// current entry.  Entry 1 is an unnamed root.
+
+		// REFERENCES:
+		// na
+
+		// USE STATEMENTS:
+		// na
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		int const ProfileBlockSize( 250 ); // number of entries added each time the tree runs out of space
+
+		// INTERFACE BLOCK SPECIFICATIONS:
+		// na
+
+		// DERIVED TYPE DEFINITIONS:
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int Node; // profile tree entry for this name under the current entry
+
+		if ( ! HVACProfiling ) return;
+
+		if ( NumHVACProfileNodes == 0 ) {
+			HVACProfile.allocate( ProfileBlockSize );
+			NumHVACProfileNodes = 1;
+			CurHVACProfileNode = 1;
+		}
+
+		auto const found( HVACProfile( CurHVACProfileNode ).Children.find( Name ) );
+		if ( found != HVACProfile( CurHVACProfileNode ).Children.end() ) {
+			Node = found->second;
+		} else {
+			if ( NumHVACProfileNodes == isize( HVACProfile ) ) {
+				HVACProfile.redimension( NumHVACProfileNodes + ProfileBlockSize );
+			}
+			Node = ++NumHVACProfileNodes;
+			HVACProfile( Node ).Name = Name;
+			HVACProfile( Node ).Parent = CurHVACProfileNode;
+			HVACProfile( CurHVACProfileNode ).Children[ Name ] = Node;
+		}
+
+		++HVACProfile( Node ).Calls;
+		HVACProfile( Node ).StartTime = epHVACProfileClock();
+		CurHVACProfileNode = Node;
+
+	}
+
+	void
+	epStopHVACProfile( Optional_int_const Iterations ) // iterations needed by this call, if any
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Stop timing the current HVAC profile entry (ref: epStartHVACProfile) and return
+		// to its caller.  Iteration counts passed in are kept as convergence diagnostics.
+
+		// METHODOLOGY EMPLOYED:
+		// na
+
+		// REFERENCES:
+		// na
+
+		// USE STATEMENTS:
+		// na
+
+		if ( ! HVACProfiling || CurHVACProfileNode <= 1 ) return;
+
+		auto & thisNode( HVACProfile( CurHVACProfileNode ) );
+		thisNode.TimeSum += epHVACProfileClock() - thisNode.StartTime;
+		if ( present( Iterations ) ) {
+			thisNode.Iterations += Iterations;
+			thisNode.MaxIterations = max( thisNode.MaxIterations, int( Iterations ) );
+		}
+		CurHVACProfileNode = thisNode.Parent;
+
+	}
+
+	void
+	epWriteHVACProfile()
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Write the HVAC profile tree collected by epStartHVACProfile/epStopHVACProfile.
+
+		// METHODOLOGY EMPLOYED:
+		// The csv file has one row per call path with the calls, iterations, total time and
+		// self time (total time less the time of the callees).  The folded file has one
+		// "path self-time-in-microseconds" line per call path, with the path separated by
+		// semicolons, which is the input format of the common flame graph tools.
+		// Parents are always added before their children, so one forward pass builds the paths.
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		using DataStringGlobals::outputProfCsvFileName;
+		using DataStringGlobals::outputProfFoldedFileName;
+		using General::RoundSigDigits;
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		static gio::Fmt fmtA( "(A)" );
+
+		// INTERFACE BLOCK SPECIFICATIONS:
+		// na
+
+		// DERIVED TYPE DEFINITIONS:
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int Node;
+		int CsvUnit;
+		int FoldedUnit;
+		int write_stat;
+		FArray1D_string Path; // semicolon separated call path of each entry
+		FArray1D< Real64 > SelfTime; // time of each entry less the time of its callees {s}
+
+		if ( ! HVACProfiling || NumHVACProfileNodes <= 1 ) return;
+
+		Path.allocate( NumHVACProfileNodes );
+		SelfTime.allocate( NumHVACProfileNodes );
+		SelfTime = 0.0;
+		for ( Node = 2; Node <= NumHVACProfileNodes; ++Node ) {
+			auto const & thisNode( HVACProfile( Node ) );
+			if ( thisNode.Parent > 1 ) {
+				Path( Node ) = Path( thisNode.Parent ) + ';' + thisNode.Name;
+				SelfTime( thisNode.Parent ) -= thisNode.TimeSum;
+			} else {
+				Path( Node ) = thisNode.Name;
+			}
+			SelfTime( Node ) += thisNode.TimeSum;
+		}
+
+		CsvUnit = GetNewUnitNumber();
+		{ IOFlags flags; flags.ACTION( "write" ); gio::open( CsvUnit, outputProfCsvFileName, flags ); write_stat = flags.ios(); }
+		if ( write_stat != 0 ) {
+			DisplayString( "epWriteHVACProfile: Could not open file " + outputProfCsvFileName + " for output (write)." );
+			return;
+		}
+		gio::write( CsvUnit, fmtA ) << "Call Path,Calls,Iterations,Maximum Iterations,Time {s},Self Time {s}";
+		for ( Node = 2; Node <= NumHVACProfileNodes; ++Node ) {
+			auto const & thisNode( HVACProfile( Node ) );
+			gio::write( CsvUnit, fmtA ) << Path( Node ) + ',' + RoundSigDigits( thisNode.Calls ) + ',' + RoundSigDigits( thisNode.Iterations ) + ',' + RoundSigDigits( thisNode.MaxIterations ) + ',' + RoundSigDigits( thisNode.TimeSum, 6 ) + ',' + RoundSigDigits( SelfTime( Node ), 6 );
+		}
+		gio::close( CsvUnit );
+
+		FoldedUnit = GetNewUnitNumber();
+		{ IOFlags flags; flags.ACTION( "write" ); gio::open( FoldedUnit, outputProfFoldedFileName, flags ); write_stat = flags.ios(); }
+		if ( write_stat != 0 ) {
+			DisplayString( "epWriteHVACProfile: Could not open file " + outputProfFoldedFileName + " for output (write)." );
+			return;
+		}
+		for ( Node = 2; Node <= NumHVACProfileNodes; ++Node ) {
+			long long const SelfMicroseconds( std::llround( SelfTime( Node ) * 1.0e6 ) );
+			if ( SelfMicroseconds <= 0 ) continue;
+			gio::write( FoldedUnit, fmtA ) << Path( Node ) + ' ' + std::to_string( SelfMicroseconds );
+		}
+		gio::close( FoldedUnit );
+
+	}
+
+	Real64
+	epHVACProfileClock()
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Wall clock for the HVAC profiler.  epElapsedTime only resolves milliseconds, which
+		// is longer than most single component calls take.
+
+		// METHODOLOGY EMPLOYED:
+		// Seconds since an arbitrary epoch from the monotonic steady clock.
+
+		// REFERENCES:
+		// na
+
+		// USE STATEMENTS:
+		// na
+
+		return std::chrono::duration< Real64 >( std::chrono::steady_clock::now().time_since_epoch() ).count();
+
+	}
+
 	//     NOTICE
 
 	//     Copyright  1996-2014 The Board of Trustees of the University of Illinois
@@ -1,6 +1,9 @@
 #ifndef DataTimings_hh_INCLUDED
 #define DataTimings_hh_INCLUDED
 
+// C++ Headers
+#include <map>
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/FArray1D.hh>
 #include <ObjexxFCL/Optional.hh>
@@ -43,6 +46,8 @@ namespace DataTimings {
 	extern bool lprocessingInputTiming;
 	extern bool lmanageSimulationTiming;
 	extern bool lcloseoutReportingTiming;
+	extern int NumHVACProfileNodes; // number of entries used in the HVAC profile tree
+	extern int CurHVACProfileNode; // profile tree entry that is currently being timed
 
 	// Following for calls to routines
 #ifdef EP_Count_Calls
@@ -96,11 +101,60 @@ namespace DataTimings {
 
 	};
 
+	struct HVACProfileData
+	{
+		// Members
+		std::string Name; // name of the subsystem, controller or component
+		int Parent; // profile tree entry of the caller
+		int Calls; // number of times this entry was started
+		int Iterations; // sum of iterations reported when this entry was stopped
+		int MaxIterations; // largest number of iterations reported for a single call
+		Real64 StartTime; // time at the last start {s}
+		Real64 TimeSum; // total time including callees {s}
+		std::map< std::string, int > Children; // profile tree entries of the callees, by name
+
+		// Default Constructor
+		HVACProfileData() :
+			Parent( 0 ),
+			Calls( 0 ),
+			Iterations( 0 ),
+			MaxIterations( 0 ),
+			StartTime( 0.0 ),
+			TimeSum( 0.0 )
+		{}
+
+		// Member Constructor
+		HVACProfileData(
+			std::string const & Name,
+			int const Parent,
+			int const Calls,
+			int const Iterations,
+			int const MaxIterations,
+			Real64 const StartTime,
+			Real64 const TimeSum,
+			std::map< std::string, int > const & Children
+		) :
+			Name( Name ),
+			Parent( Parent ),
+			Calls( Calls ),
+			Iterations( Iterations ),
+			MaxIterations( MaxIterations ),
+			StartTime( StartTime ),
+			TimeSum( TimeSum ),
+			Children( Children )
+		{}
+
+	};
+
 	// Object Data
 	extern FArray1D< timings > Timing;
+	extern FArray1D< HVACProfileData > HVACProfile;
 
 	// Functions
 
+	void
+	clear_state();
+
 	void
 	epStartTime( std::string const & ctimingElementstring );
 
@@ -126,6 +180,18 @@ namespace DataTimings {
 	Real64
 	epElapsedTime();
 
+	void
+	epStartHVACProfile( std::string const & Name );
+
+	void
+	epStopHVACProfile( Optional_int_const Iterations = _ ); // iterations needed by this call, if any
+
+	void
+	epWriteHVACProfile();
+
+	Real64
+	epHVACProfileClock();
+
 	//     NOTICE
 
 	//     Copyright  1996-2014 The Board of Trustees of the University of Illinois
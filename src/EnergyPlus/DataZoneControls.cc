@@ -62,6 +62,33 @@ namespace DataZoneControls {
 	FArray1D< TStatObject > StagedTStatObjects;
 	FArray1D< ZoneStagedControls > StageControlledZone;
 
+	// Functions
+
+	void
+	clear_state()
+	{
+		NumTempControlledZones = 0;
+		NumHumidityControlZones = 0;
+		NumComfortControlledZones = 0;
+		NumTStatStatements = 0;
+		NumComfortTStatStatements = 0;
+		NumOpTempControlledZones = 0;
+		NumTempAndHumidityControlledZones = 0;
+		AnyOpTempControl = false;
+		AnyZoneTempAndHumidityControl = false;
+		StageZoneLogic.deallocate();
+		OccRoomTSetPointHeat.deallocate();
+		OccRoomTSetPointCool.deallocate();
+		GetZoneAirStatsInputFlag = true;
+		HumidityControlZone.deallocate();
+		TempControlledZone.deallocate();
+		ComfortControlledZone.deallocate();
+		TStatObjects.deallocate();
+		ComfortTStatObjects.deallocate();
+		StagedTStatObjects.deallocate();
+		StageControlledZone.deallocate();
+	}
+
 	//     NOTICE
 	//     Copyright  1996-2014 The Board of Trustees of the University of Illinois
 	//     and The Regents of the University of California through Ernest Orlando Lawrence
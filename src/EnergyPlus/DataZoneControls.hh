@@ -531,6 +531,11 @@ namespace DataZoneControls {
 	extern FArray1D< TStatObject > StagedTStatObjects;
 	extern FArray1D< ZoneStagedControls > StageControlledZone;
 
+	// Functions
+
+	void
+	clear_state();
+
 	//     NOTICE
 	//     Copyright  1996-2014 The Board of Trustees of the University of Illinois
 	//     and The Regents of the University of California through Ernest Orlando Lawrence
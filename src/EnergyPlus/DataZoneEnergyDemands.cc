@@ -34,6 +34,18 @@ namespace DataZoneEnergyDemands {
 	FArray1D< ZoneSystemDemandData > ZoneSysEnergyDemand;
 	FArray1D< ZoneSystemMoistureDemand > ZoneSysMoistureDemand;
 
+	// Functions
+
+	void
+	clear_state()
+	{
+		DeadBandOrSetback.deallocate();
+		Setback.deallocate();
+		CurDeadBandOrSetback.deallocate();
+		ZoneSysEnergyDemand.deallocate();
+		ZoneSysMoistureDemand.deallocate();
+	}
+
 	//     NOTICE
 	//     Copyright  1996-2014 The Board of Trustees of the University of Illinois
 	//     and The Regents of the University of California through Ernest Orlando Lawrence
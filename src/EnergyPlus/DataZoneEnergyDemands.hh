@@ -146,6 +146,11 @@ namespace DataZoneEnergyDemands {
 	extern FArray1D< ZoneSystemDemandData > ZoneSysEnergyDemand;
 	extern FArray1D< ZoneSystemMoistureDemand > ZoneSysMoistureDemand;
 
+	// Functions
+
+	void
+	clear_state();
+
 } // DataZoneEnergyDemands
 
 } // EnergyPlus
@@ -850,6 +850,9 @@ namespace DataZoneEquipment {
 
 	// Functions
 
+	void
+	clear_state();
+
 	void
 	GetZoneEquipmentData();
 
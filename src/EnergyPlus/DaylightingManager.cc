@@ -8119,6 +8119,7 @@ namespace DaylightingManager {
 
 		int iIncElem; // incoming direction counter
 		int iBackElem; // outgoing direction counter
+		int iTrans; // position of the transmittance in the compressed matrix
 
 		Real64 LambdaInc; // current lambda value for incoming direction
 		//REAL(r64) :: LambdaTrn  ! current lambda value for incoming direction
@@ -8166,17 +8167,34 @@ namespace DaylightingManager {
 		FFSUTot = 0.0;
 		FFSUdiskTot = 0.0;
 		// now calculate flux into each outgoing direction by integrating over all incoming directions
+		auto const & VisFrtTransSparse( Construct( iConst ).BSDFInput.VisFrtTransSparse );
 		for ( iBackElem = 1; iBackElem <= NTrnBasis; ++iBackElem ) {
-			for ( iIncElem = 1; iIncElem <= NIncBasis; ++iIncElem ) {
-				LambdaInc = ComplexWind( IWin ).Geom( CurCplxFenState ).Inc.Lamda( iIncElem );
-				dirTrans = Construct( iConst ).BSDFInput.VisFrtTrans( iIncElem, iBackElem );
+			if ( VisFrtTransSparse.Compressed ) {
+				// only the incoming directions with nonzero transmittance into this outgoing direction
+				for ( iTrans = VisFrtTransSparse.ColStart( iBackElem ); iTrans < VisFrtTransSparse.ColStart( iBackElem + 1 ); ++iTrans ) {
+					iIncElem = VisFrtTransSparse.RowIndex( iTrans );
+					LambdaInc = ComplexWind( IWin ).Geom( CurCplxFenState ).Inc.Lamda( iIncElem );
+					dirTrans = VisFrtTransSparse.Value( iTrans );
+
+					for ( iSky = 1; iSky <= 4; ++iSky ) {
+						FLSK( iBackElem, iSky ) += dirTrans * LambdaInc * ElementLuminanceSky( iIncElem, iSky );
+					}
 
-				for ( iSky = 1; iSky <= 4; ++iSky ) {
-					FLSK( iBackElem, iSky ) += dirTrans * LambdaInc * ElementLuminanceSky( iIncElem, iSky );
+					FLSU( iBackElem ) += dirTrans * LambdaInc * ElementLuminanceSun( iIncElem );
+					FLSUdisk( iBackElem ) += dirTrans * LambdaInc * ElementLuminanceSunDisk( iIncElem );
 				}
+			} else {
+				for ( iIncElem = 1; iIncElem <= NIncBasis; ++iIncElem ) {
+					LambdaInc = ComplexWind( IWin ).Geom( CurCplxFenState ).Inc.Lamda( iIncElem );
+					dirTrans = Construct( iConst ).BSDFInput.VisFrtTrans( iIncElem, iBackElem );
+
+					for ( iSky = 1; iSky <= 4; ++iSky ) {
+						FLSK( iBackElem, iSky ) += dirTrans * LambdaInc * ElementLuminanceSky( iIncElem, iSky );
+					}
 
-				FLSU( iBackElem ) += dirTrans * LambdaInc * ElementLuminanceSun( iIncElem );
-				FLSUdisk( iBackElem ) += dirTrans * LambdaInc * ElementLuminanceSunDisk( iIncElem );
+					FLSU( iBackElem ) += dirTrans * LambdaInc * ElementLuminanceSun( iIncElem );
+					FLSUdisk( iBackElem ) += dirTrans * LambdaInc * ElementLuminanceSunDisk( iIncElem );
+				}
 			}
 
 			for ( iSky = 1; iSky <= 4; ++iSky ) {
@@ -8239,6 +8257,7 @@ namespace DaylightingManager {
 		// REFERENCES:
 
 		// USE STATEMENTS:
+		using WindowComplexManager::BSDFMatrixElement;
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -8306,7 +8325,11 @@ namespace DaylightingManager {
 
 		for ( iIncElem = 1; iIncElem <= NIncBasis; ++iIncElem ) {
 			// LambdaInc = ComplexWind(IWin)%Geom(CurCplxFenState)%Inc%Lamda(iIncElem)
-			dirTrans = Construct( iConst ).BSDFInput.VisFrtTrans( iIncElem, RefPointIndex );
+			if ( Construct( iConst ).BSDFInput.VisFrtTransSparse.Compressed ) {
+				dirTrans = BSDFMatrixElement( Construct( iConst ).BSDFInput.VisFrtTransSparse, iIncElem, RefPointIndex );
+			} else {
+				dirTrans = Construct( iConst ).BSDFInput.VisFrtTrans( iIncElem, RefPointIndex );
+			}
 
 			for ( iSky = 1; iSky <= 4; ++iSky ) {
 				WinLumSK( iSky ) += dirTrans * ElementLuminanceSky( iIncElem, iSky );
@@ -8373,6 +8396,7 @@ namespace DaylightingManager {
 		// REFERENCES:
 
 		// USE STATEMENTS:
+		using WindowComplexManager::BSDFMatrixElement;
 
 		// Argument array dimensioning
 
@@ -8444,7 +8468,11 @@ namespace DaylightingManager {
 
 				if ( PosFac != 0.0 ) {
 					if ( SolBmIndex > 0 ) {
-						dirTrans = Construct( iConst ).BSDFInput.VisFrtTrans( SolBmIndex, iTrnElem );
+						if ( Construct( iConst ).BSDFInput.VisFrtTransSparse.Compressed ) {
+							dirTrans = BSDFMatrixElement( Construct( iConst ).BSDFInput.VisFrtTransSparse, SolBmIndex, iTrnElem );
+						} else {
+							dirTrans = Construct( iConst ).BSDFInput.VisFrtTrans( SolBmIndex, iTrnElem );
+						}
 					} else {
 						dirTrans = 0.0;
 					}
@@ -73,6 +73,7 @@ namespace EMSManager {
 	bool GetEMSUserInput( true ); // Flag to prevent input from being read multiple times
 	bool ZoneThermostatActuatorsHaveBeenSetup( false );
 	bool FinishProcessingUserInput( true ); // Flag to indicate still need to process input
+	bool EMSCallingPointsSetup( false ); // Flag to indicate the calling point dispatch table has been built
 
 	// SUBROUTINE SPECIFICATIONS:
 
@@ -278,6 +279,11 @@ namespace EMSManager {
 		// FLOW:
 		if ( ! AnyEnergyManagementSystemInModel ) return; // quick return if nothing to do
 
+		// calling points with no programs, and nothing else to refresh, reduce to this single branch
+		if ( EMSCallingPointsSetup ) {
+			if ( EMSCallingPoint( iCalledFrom ).SkipCall && ! BeginEnvrnFlag ) return;
+		}
+
 		if ( iCalledFrom == emsCallFromBeginNewEvironment ) BeginEnvrnInitializeRuntimeLanguage();
 
 		InitEMS( iCalledFrom );
@@ -289,7 +295,12 @@ namespace EMSManager {
 
 		// Run the Erl programs depending on calling point.
 		AnyProgramRan = false;
-		if ( iCalledFrom != emsCallFromUserDefinedComponentModel ) {
+		if ( EMSCallingPointsSetup && ( iCalledFrom != emsCallFromUserDefinedComponentModel ) ) {
+			for ( ErlProgramNum = 1; ErlProgramNum <= EMSCallingPoint( iCalledFrom ).NumErlPrograms; ++ErlProgramNum ) {
+				EvaluateStack( EMSCallingPoint( iCalledFrom ).ErlProgramARR( ErlProgramNum ) );
+				AnyProgramRan = true;
+			}
+		} else if ( iCalledFrom != emsCallFromUserDefinedComponentModel ) {
 			for ( ProgramManagerNum = 1; ProgramManagerNum <= NumProgramCallManagers; ++ProgramManagerNum ) {
 
 				if ( EMSProgramCallManager( ProgramManagerNum ).CallingPoint == iCalledFrom ) {
@@ -383,6 +394,7 @@ namespace EMSManager {
 		using DataGlobals::emsCallFromZoneSizing;
 		using DataGlobals::emsCallFromSystemSizing;
 		using DataGlobals::emsCallFromUserDefinedComponentModel;
+		using DataGlobals::emsCallFromExternalInterface;
 		using RuntimeLanguageProcessor::InitializeRuntimeLanguage;
 		using RuntimeLanguageProcessor::SetErlValueNumber;
 		using ScheduleManager::GetCurrentScheduleValue;
@@ -404,7 +416,10 @@ namespace EMSManager {
 
 		int InternalVarUsedNum; // local index and loop
 		int InternVarAvailNum; // local index
-		int SensorNum; // local loop and index
+		int SensorLoop; // local loop
+		int SensorNum; // local index
+		int NumSensorsToUpdate; // count of sensors refreshed for this calling point
+		bool UseCallingPointSensors; // true if only the sensors listed for this calling point are refreshed
 		int ErlVariableNum; // local index
 		Real64 tmpReal; // temporary local integer
 
@@ -433,6 +448,12 @@ namespace EMSManager {
 			FinishProcessingUserInput = false;
 		}
 
+		// once all programs and sensors are known, build the dispatch table used by ManageEMS
+		if ( ! FinishProcessingUserInput && ! EMSCallingPointsSetup ) {
+			SetupEMSCallingPoints();
+			EMSCallingPointsSetup = true;
+		}
+
 		InitializeRuntimeLanguage();
 
 		if ( ( BeginEnvrnFlag ) || ( iCalledFrom == emsCallFromZoneSizing ) || ( iCalledFrom == emsCallFromSystemSizing ) || ( iCalledFrom == emsCallFromUserDefinedComponentModel ) ) {
@@ -464,18 +485,202 @@ namespace EMSManager {
 
 		}
 
-		// Update sensors with current data
-		for ( SensorNum = 1; SensorNum <= NumSensors; ++SensorNum ) {
+		// Update sensors with current data, only the number of the value changes
+		// user defined components and the external interface may read any sensor, so they refresh them all
+		UseCallingPointSensors = EMSCallingPointsSetup && ( iCalledFrom != emsCallFromUserDefinedComponentModel ) && ( iCalledFrom != emsCallFromExternalInterface );
+		if ( UseCallingPointSensors ) {
+			NumSensorsToUpdate = EMSCallingPoint( iCalledFrom ).NumSensors;
+		} else {
+			NumSensorsToUpdate = NumSensors;
+		}
+		for ( SensorLoop = 1; SensorLoop <= NumSensorsToUpdate; ++SensorLoop ) {
+			if ( UseCallingPointSensors ) {
+				SensorNum = EMSCallingPoint( iCalledFrom ).SensorARR( SensorLoop );
+			} else {
+				SensorNum = SensorLoop;
+			}
 			ErlVariableNum = Sensor( SensorNum ).VariableNum;
 			if ( ( ErlVariableNum > 0 ) && ( Sensor( SensorNum ).Index > 0 ) ) {
 				if ( Sensor( SensorNum ).SchedNum == 0 ) { // not a schedule so get from output processor
 
-					ErlVariable( ErlVariableNum ).Value = SetErlValueNumber( GetInternalVariableValue( Sensor( SensorNum ).Type, Sensor( SensorNum ).Index ), ErlVariable( ErlVariableNum ).Value );
+					ErlVariable( ErlVariableNum ).Value.Number = GetInternalVariableValue( Sensor( SensorNum ).Type, Sensor( SensorNum ).Index );
 				} else { // schedule so use schedule service
 
-					ErlVariable( ErlVariableNum ).Value = SetErlValueNumber( GetCurrentScheduleValue( Sensor( SensorNum ).SchedNum ), ErlVariable( ErlVariableNum ).Value );
+					ErlVariable( ErlVariableNum ).Value.Number = GetCurrentScheduleValue( Sensor( SensorNum ).SchedNum );
+				}
+			}
+		}
+
+	}
+
+	void
+	SetupEMSCallingPoints()
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// build the dispatch table used by ManageEMS so each calling point only runs its own programs
+		// and only refreshes the sensors those programs read
+
+		// METHODOLOGY EMPLOYED:
+		// programs are listed in the order of the calling managers, as in the original scan.
+		// The Erl variables read by each program are found by walking its instructions and expressions,
+		// following RUN into subroutines.  Sensors behind custom output variables and trend variables are
+		// refreshed at every calling point that is not skipped.  A calling point is skipped when it has
+		// no programs and its call does not also set up input, reset the language, or refresh internal data.
+
+		// Using/Aliasing
+		using DataGlobals::NumEMSCallingPoints;
+		using DataGlobals::emsCallFromZoneSizing;
+		using DataGlobals::emsCallFromSystemSizing;
+		using DataGlobals::emsCallFromBeginNewEvironment;
+		using DataGlobals::emsCallFromSetupSimulation;
+		using DataGlobals::emsCallFromExternalInterface;
+		using DataGlobals::emsCallFromUserDefinedComponentModel;
+		using RuntimeLanguageProcessor::RuntimeReportVar;
+
+		// Locals
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int CallingPointNum; // local loop
+		int ProgramManagerNum; // local loop
+		int ErlProgramNum; // local loop
+		int SensorNum; // local loop
+		int Loop; // local loop
+		int VariableNum; // local index
+		bool TrendOnSensor; // true if a trend variable logs a sensor, which then has to be kept current everywhere
+		FArray1D_bool AlwaysRefresh( NumErlVariables, false ); // Erl variables read outside of the programs
+		FArray1D_bool VariableRead( NumErlVariables ); // Erl variables read by the programs at a calling point
+		FArray1D_bool StackVisited( NumErlStacks ); // stacks already scanned for a calling point
+
+		// FLOW:
+		TrendOnSensor = false;
+		for ( Loop = 1; Loop <= RuntimeReportVar.isize(); ++Loop ) {
+			VariableNum = RuntimeReportVar( Loop ).VariableNum;
+			if ( VariableNum > 0 ) AlwaysRefresh( VariableNum ) = true;
+		}
+		for ( Loop = 1; Loop <= NumErlTrendVariables; ++Loop ) {
+			VariableNum = TrendVariable( Loop ).ErlVariablePointer;
+			if ( VariableNum > 0 ) AlwaysRefresh( VariableNum ) = true;
+		}
+		for ( SensorNum = 1; SensorNum <= NumSensors; ++SensorNum ) {
+			VariableNum = Sensor( SensorNum ).VariableNum;
+			if ( VariableNum <= 0 ) continue;
+			for ( Loop = 1; Loop <= NumErlTrendVariables; ++Loop ) {
+				if ( TrendVariable( Loop ).ErlVariablePointer == VariableNum ) TrendOnSensor = true;
+			}
+		}
+
+		EMSCallingPoint.allocate( NumEMSCallingPoints );
+		for ( CallingPointNum = 1; CallingPointNum <= NumEMSCallingPoints; ++CallingPointNum ) {
+			auto & thisCallingPoint( EMSCallingPoint( CallingPointNum ) );
+			VariableRead = false;
+			StackVisited = false;
+
+			thisCallingPoint.NumErlPrograms = 0;
+			for ( ProgramManagerNum = 1; ProgramManagerNum <= NumProgramCallManagers; ++ProgramManagerNum ) {
+				if ( EMSProgramCallManager( ProgramManagerNum ).CallingPoint != CallingPointNum ) continue;
+				thisCallingPoint.NumErlPrograms += EMSProgramCallManager( ProgramManagerNum ).NumErlPrograms;
+			}
+			thisCallingPoint.ErlProgramARR.allocate( thisCallingPoint.NumErlPrograms );
+			Loop = 0;
+			for ( ProgramManagerNum = 1; ProgramManagerNum <= NumProgramCallManagers; ++ProgramManagerNum ) {
+				if ( EMSProgramCallManager( ProgramManagerNum ).CallingPoint != CallingPointNum ) continue;
+				for ( ErlProgramNum = 1; ErlProgramNum <= EMSProgramCallManager( ProgramManagerNum ).NumErlPrograms; ++ErlProgramNum ) {
+					++Loop;
+					thisCallingPoint.ErlProgramARR( Loop ) = EMSProgramCallManager( ProgramManagerNum ).ErlProgramARR( ErlProgramNum );
+					MarkErlStackReads( thisCallingPoint.ErlProgramARR( Loop ), VariableRead, StackVisited );
 				}
 			}
+
+			thisCallingPoint.NumSensors = 0;
+			thisCallingPoint.SensorARR.allocate( NumSensors );
+			for ( SensorNum = 1; SensorNum <= NumSensors; ++SensorNum ) {
+				VariableNum = Sensor( SensorNum ).VariableNum;
+				if ( VariableNum <= 0 ) continue;
+				if ( ! VariableRead( VariableNum ) && ! AlwaysRefresh( VariableNum ) ) continue;
+				++thisCallingPoint.NumSensors;
+				thisCallingPoint.SensorARR( thisCallingPoint.NumSensors ) = SensorNum;
+			}
+
+			if ( ( CallingPointNum == emsCallFromSetupSimulation ) || ( CallingPointNum == emsCallFromBeginNewEvironment ) || ( CallingPointNum == emsCallFromZoneSizing ) || ( CallingPointNum == emsCallFromSystemSizing ) || ( CallingPointNum == emsCallFromExternalInterface ) || ( CallingPointNum == emsCallFromUserDefinedComponentModel ) ) {
+				thisCallingPoint.SkipCall = false;
+			} else {
+				thisCallingPoint.SkipCall = ( thisCallingPoint.NumErlPrograms == 0 ) && ! TrendOnSensor;
+			}
+		}
+
+	}
+
+	void
+	MarkErlStackReads(
+		int const StackNum, // Erl program or subroutine to scan
+		FArray1D_bool & VariableRead, // set true for each Erl variable read by the stack
+		FArray1D_bool & StackVisited // stacks already scanned, guards against recursive RUN
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// flag the Erl variables read anywhere in a program, including the subroutines it runs
+
+		// METHODOLOGY EMPLOYED:
+		// the left hand side of SET is a write and is not flagged.  Instruction arguments follow EvaluateStack.
+
+		// Using/Aliasing
+		using RuntimeLanguageProcessor::KeywordReturn;
+		using RuntimeLanguageProcessor::KeywordSet;
+		using RuntimeLanguageProcessor::KeywordRun;
+		using RuntimeLanguageProcessor::KeywordIf;
+		using RuntimeLanguageProcessor::KeywordElse;
+		using RuntimeLanguageProcessor::KeywordWhile;
+		using RuntimeLanguageProcessor::KeywordEndWhile;
+
+		// Locals
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int InstructionNum; // local loop
+
+		// FLOW:
+		if ( ( StackNum <= 0 ) || ( StackNum > NumErlStacks ) ) return;
+		if ( StackVisited( StackNum ) ) return;
+		StackVisited( StackNum ) = true;
+
+		for ( InstructionNum = 1; InstructionNum <= ErlStack( StackNum ).NumInstructions; ++InstructionNum ) {
+			auto const & thisInstruction( ErlStack( StackNum ).Instruction( InstructionNum ) );
+			{ auto const SELECT_CASE_var( thisInstruction.Keyword );
+
+			if ( SELECT_CASE_var == KeywordSet ) {
+				MarkErlExpressionReads( thisInstruction.Argument2, VariableRead );
+			} else if ( SELECT_CASE_var == KeywordRun ) {
+				MarkErlStackReads( thisInstruction.Argument1, VariableRead, StackVisited );
+			} else if ( ( SELECT_CASE_var == KeywordReturn ) || ( SELECT_CASE_var == KeywordIf ) || ( SELECT_CASE_var == KeywordElse ) || ( SELECT_CASE_var == KeywordWhile ) || ( SELECT_CASE_var == KeywordEndWhile ) ) {
+				MarkErlExpressionReads( thisInstruction.Argument1, VariableRead );
+			}}
+		}
+
+	}
+
+	void
+	MarkErlExpressionReads(
+		int const ExpressionNum, // Erl expression to scan
+		FArray1D_bool & VariableRead // set true for each Erl variable read by the expression
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// flag the Erl variables used as operands anywhere in an expression tree
+
+		// Locals
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int OperandNum; // local loop
+
+		// FLOW:
+		if ( ( ExpressionNum <= 0 ) || ( ExpressionNum > NumExpressions ) ) return;
+
+		for ( OperandNum = 1; OperandNum <= ErlExpression( ExpressionNum ).NumOperands; ++OperandNum ) {
+			auto const & thisOperand( ErlExpression( ExpressionNum ).Operand( OperandNum ) );
+			if ( thisOperand.Type == ValueVariable ) {
+				if ( thisOperand.Variable > 0 ) VariableRead( thisOperand.Variable ) = true;
+			} else if ( thisOperand.Type == ValueExpression ) {
+				MarkErlExpressionReads( thisOperand.Expression, VariableRead );
+			}
 		}
 
 	}
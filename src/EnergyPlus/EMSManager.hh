@@ -2,6 +2,7 @@
 #define EMSManager_hh_INCLUDED
 
 // ObjexxFCL Headers
+#include <ObjexxFCL/FArray1D.hh>
 #include <ObjexxFCL/Optional.hh>
 
 // EnergyPlus Headers
@@ -33,6 +34,7 @@ namespace EMSManager {
 	extern bool GetEMSUserInput; // Flag to prevent input from being read multiple times
 	extern bool ZoneThermostatActuatorsHaveBeenSetup;
 	extern bool FinishProcessingUserInput; // Flag to indicate still need to process input
+	extern bool EMSCallingPointsSetup; // Flag to indicate the calling point dispatch table has been built
 
 	// SUBROUTINE SPECIFICATIONS:
 
@@ -52,6 +54,22 @@ namespace EMSManager {
 	void
 	InitEMS( int const iCalledFrom ); // indicates where subroutine was called from, parameters in DataGlobals.
 
+	void
+	SetupEMSCallingPoints();
+
+	void
+	MarkErlStackReads(
+		int const StackNum, // Erl program or subroutine to scan
+		FArray1D_bool & VariableRead, // set true for each Erl variable read by the stack
+		FArray1D_bool & StackVisited // stacks already scanned, guards against recursive RUN
+	);
+
+	void
+	MarkErlExpressionReads(
+		int const ExpressionNum, // Erl expression to scan
+		FArray1D_bool & VariableRead // set true for each Erl variable read by the expression
+	);
+
 	void
 	ReportEMS();
 
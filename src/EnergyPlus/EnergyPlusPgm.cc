@@ -4,6 +4,7 @@
 
 // C++ Headers
 #include <iostream>
+#include <stdexcept>
 #ifndef NDEBUG
 #ifdef __unix__
 #include <cfenv>
@@ -34,6 +35,7 @@
 #include <Psychrometrics.hh>
 #include <ScheduleManager.hh>
 #include <SimulationManager.hh>
+#include <StateManagement.hh>
 #include <UtilityRoutines.hh>
 
 #ifdef _WIN32
@@ -261,6 +263,8 @@ EnergyPlusPgm( std::string const & filepath )
 
 	// PROGRAM LOCAL VARIABLE DECLARATIONS:
 	static std::string cEnvValue;
+	static gio::Fmt const fmtLD( "*" );
+	int ios; // IO status of reading an integer environment variable
 
 	//                           INITIALIZE VARIABLES
 	Time_Start = epElapsedTime();
@@ -341,6 +345,63 @@ EnergyPlusPgm( std::string const & filepath )
 	get_environment_variable( cTimingFlag, cEnvValue );
 	if ( ! cEnvValue.empty() ) TimingFlag = env_var_on( cEnvValue ); // Yes or True
 
+	get_environment_variable( cFluidPropertyBinarySearch, cEnvValue );
+	if ( ! cEnvValue.empty() ) FluidPropertyBinarySearch = env_var_on( cEnvValue ); // Yes or True
+
+	get_environment_variable( cPlantLoopGroupSolve, cEnvValue );
+	if ( ! cEnvValue.empty() ) PlantLoopGroupSolve = env_var_on( cEnvValue ); // Yes or True
+
+	get_environment_variable( cHVACProfiling, cEnvValue );
+	if ( ! cEnvValue.empty() ) HVACProfiling = env_var_on( cEnvValue ); // Yes or True
+
+	get_environment_variable( cWarmupSnapshotSave, cEnvValue );
+	if ( ! cEnvValue.empty() ) WarmupSnapshotSaveFile = cEnvValue; // file name
+
+	get_environment_variable( cWarmupSnapshotLoad, cEnvValue );
+	if ( ! cEnvValue.empty() ) WarmupSnapshotLoadFile = cEnvValue; // file name
+
+	get_environment_variable( cAdaptiveSystemTimestep, cEnvValue );
+	if ( ! cEnvValue.empty() ) AdaptiveSystemTimestep = env_var_on( cEnvValue ); // Yes or True
+
+	get_environment_variable( cZoneCouplingGroupSolve, cEnvValue );
+	if ( ! cEnvValue.empty() ) ZoneCouplingGroupSolve = env_var_on( cEnvValue ); // Yes or True
+
+	get_environment_variable( cCTFCacheFile, cEnvValue );
+	if ( ! cEnvValue.empty() ) CTFCacheFile = cEnvValue; // file name
+
+	get_environment_variable( cCTFCacheValidate, cEnvValue );
+	if ( ! cEnvValue.empty() ) CTFCacheValidate = env_var_on( cEnvValue ); // Yes or True
+
+	get_environment_variable( cCondFDDirectSolve, cEnvValue );
+	if ( ! cEnvValue.empty() ) CondFDDirectSolve = env_var_on( cEnvValue ); // Yes or True
+
+	get_environment_variable( cParallelCondFDHAMT, cEnvValue );
+	if ( ! cEnvValue.empty() ) ParallelCondFDHAMT = env_var_on( cEnvValue ); // Yes or True
+
+	get_environment_variable( cPipingSystemsPCGSolve, cEnvValue );
+	if ( ! cEnvValue.empty() ) PipingSystemsPCGSolve = env_var_on( cEnvValue ); // Yes or True
+
+	get_environment_variable( cGroundHXMultiLevelAggregation, cEnvValue );
+	if ( ! cEnvValue.empty() ) GroundHXMultiLevelAggregation = env_var_on( cEnvValue ); // Yes or True
+
+	get_environment_variable( cWindowGasPropertyTables, cEnvValue );
+	if ( ! cEnvValue.empty() ) WindowGasPropertyTables = env_var_on( cEnvValue ); // Yes or True
+
+	get_environment_variable( cStratifiedTankImplicitSolve, cEnvValue );
+	if ( ! cEnvValue.empty() ) StratifiedTankImplicitSolve = env_var_on( cEnvValue ); // Yes or True
+
+	get_environment_variable( cTabularAggregationPlan, cEnvValue );
+	if ( ! cEnvValue.empty() ) TabularAggregationPlan = env_var_on( cEnvValue ); // Yes or True
+
+	get_environment_variable( cLoadComponentDecayFromCTF, cEnvValue );
+	if ( ! cEnvValue.empty() ) LoadComponentDecayFromCTF = env_var_on( cEnvValue ); // Yes or True
+
+	get_environment_variable( cDesignDaySizingWorkers, cEnvValue );
+	if ( ! cEnvValue.empty() ) {
+		{ IOFlags flags; gio::read( cEnvValue, fmtLD, flags ) >> DesignDaySizingWorkers; ios = flags.ios(); }
+		if ( ios != 0 || DesignDaySizingWorkers < 1 ) DesignDaySizingWorkers = 1;
+	}
+
 	// Initialize env flags for air loop simulation debugging
 	get_environment_variable( TrackAirLoopEnvVar, cEnvValue );
 	if ( ! cEnvValue.empty() ) TrackAirLoopEnvFlag = env_var_on( cEnvValue ); // Yes or True
@@ -375,6 +436,9 @@ EnergyPlusPgm( std::string const & filepath )
 
 	TestAllPaths = true;
 
+	// a batch run processes the IDD once here; only the process forked for each job returns, set up for that job
+	if ( CommandLineInterface::batchMode ) CommandLineInterface::RunBatch();
+
 	DisplayString( "EnergyPlus Starting" );
 	DisplayString( VerString );
 
@@ -454,6 +518,28 @@ EnergyPlusPgm( std::string const & filepath )
 	EndEnergyPlus();
 }
 
+void
+EnergyPlusPgmRunAgain( std::string const & filepath )
+{
+	// Runs EnergyPlus again in this process after an earlier run, restoring the state of every
+	// module first.  Until every module can restore its state (see modulesNotCleared) a second
+	// run would silently start from the state the earlier run left behind, so this throws
+	// instead of running.
+
+	// Using/Aliasing
+	using namespace EnergyPlus;
+
+	std::string const NotCleared( modulesNotCleared() );
+	if ( ! NotCleared.empty() ) {
+		std::string const Message( "EnergyPlus Library: Cannot run again in this process; the state of these modules cannot be cleared: " + NotCleared );
+		DisplayString( Message );
+		throw std::runtime_error( Message );
+	}
+
+	clearAllStates();
+	EnergyPlusPgm( filepath );
+}
+
 void StoreProgressCallback( void(*f)( int const ) )
 {
 	using namespace EnergyPlus::DataGlobals;
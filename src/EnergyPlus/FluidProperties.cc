@@ -12,6 +12,7 @@
 // EnergyPlus Headers
 #include <FluidProperties.hh>
 #include <DataPrecisionGlobals.hh>
+#include <DataSystemVariables.hh>
 #include <General.hh>
 #include <InputProcessor.hh>
 #include <UtilityRoutines.hh>
@@ -85,6 +86,7 @@ namespace FluidProperties {
 	int const PropyleneGlycolIndex( -1 );
 	int const iRefrig( 1 );
 	int const iGlycol( 1 );
+	int const MaxIndexGridCells( 1000 ); // Upper limit on cells in a property table index grid
 
 	// DERIVED TYPE DEFINITIONS
 
@@ -175,6 +177,28 @@ namespace FluidProperties {
 
 	// Functions
 
+	void
+	clear_state()
+	{
+		GetInput = true;
+		NumOfRefrigerants = 0;
+		NumOfGlycols = 0;
+		DebugReportGlycols = false;
+		DebugReportRefrigerants = false;
+		GlycolErrorLimitTest = 1;
+		RefrigerantErrorLimitTest = 1;
+		RefrigUsed.deallocate();
+		GlycolUsed.deallocate();
+		FluidIndex_Water = 0;
+		FluidIndex_EthyleneGlycol = 0;
+		FluidIndex_PropoleneGlycol = 0;
+		RefrigData.deallocate();
+		RefrigErrorTracking.deallocate();
+		GlyRawData.deallocate();
+		GlycolData.deallocate();
+		GlycolErrorTracking.deallocate();
+	}
+
 	void
 	GetFluidPropertiesData()
 	{
@@ -1877,6 +1901,8 @@ namespace FluidProperties {
 
 		if ( ! ErrorsFound ) InitializeRefrigerantLimits( ErrorsFound ); // Initialize the limits for the refrigerants
 
+		if ( ! ErrorsFound ) InitializeFluidPropertyIndexGrids(); // Set up constant-time table lookups
+
 		FluidTemps.deallocate();
 
 		Alphas.deallocate();
@@ -3464,7 +3490,7 @@ namespace FluidProperties {
 		auto const & refrig( RefrigData( RefrigNum ) );
 
 		// determine array indices for
-		LoTempIndex = FindArrayIndex( Temperature, refrig.PsTemps, refrig.PsLowTempIndex, refrig.PsHighTempIndex );
+		LoTempIndex = FindArrayIndex( Temperature, refrig.PsTemps, refrig.PsTempGrid );
 		HiTempIndex = LoTempIndex + 1;
 
 		// check for out of data bounds problems
@@ -3579,7 +3605,7 @@ namespace FluidProperties {
 		auto const & refrig( RefrigData( RefrigNum ) );
 
 		// get the array indices
-		LoPresIndex = FindArrayIndex( Pressure, refrig.PsValues, refrig.PsLowPresIndex, refrig.PsHighPresIndex );
+		LoPresIndex = FindArrayIndex( Pressure, refrig.PsValues, refrig.PsPresGrid );
 		HiPresIndex = LoPresIndex + 1;
 
 		// check for out of data bounds problems
@@ -3692,7 +3718,7 @@ namespace FluidProperties {
 		auto const & refrig( RefrigData( RefrigNum ) );
 
 		// Apply linear interpolation function
-		return GetInterpolatedSatProp( Temperature, refrig.HTemps, refrig.HfValues, refrig.HfgValues, Quality, CalledFrom, refrig.HfLowTempIndex, refrig.HfHighTempIndex );
+		return GetInterpolatedSatProp( Temperature, refrig.HTemps, refrig.HfValues, refrig.HfgValues, Quality, CalledFrom, refrig.HTempGrid );
 
 	}
 
@@ -3791,7 +3817,7 @@ namespace FluidProperties {
 
 		ErrorFlag = false;
 
-		LoTempIndex = FindArrayIndex( Temperature, refrig.RhoTemps, refrig.RhofLowTempIndex, refrig.RhofHighTempIndex );
+		LoTempIndex = FindArrayIndex( Temperature, refrig.RhoTemps, refrig.RhoTempGrid );
 		HiTempIndex = LoTempIndex + 1;
 
 		//Error check to make sure the temperature is not out of bounds
@@ -3924,7 +3950,7 @@ namespace FluidProperties {
 		auto const & refrig( RefrigData( RefrigNum ) );
 
 		// Apply linear interpolation function
-		ReturnValue = GetInterpolatedSatProp( Temperature, refrig.CpTemps, refrig.CpfValues, refrig.CpfgValues, Quality, CalledFrom, refrig.CpfLowTempIndex, refrig.CpfHighTempIndex );
+		ReturnValue = GetInterpolatedSatProp( Temperature, refrig.CpTemps, refrig.CpfValues, refrig.CpfgValues, Quality, CalledFrom, refrig.CpTempGrid );
 
 		return ReturnValue;
 
@@ -4045,8 +4071,8 @@ namespace FluidProperties {
 		}
 		auto const & refrig( RefrigData( RefrigNum ) );
 
-		TempIndex = FindArrayIndex( Temperature, refrig.SHTemps, 1, refrig.NumSuperTempPts );
-		LoPressIndex = FindArrayIndex( Pressure, refrig.SHPress, 1, refrig.NumSuperPressPts );
+		TempIndex = FindArrayIndex( Temperature, refrig.SHTemps, refrig.SHTempGrid );
+		LoPressIndex = FindArrayIndex( Pressure, refrig.SHPress, refrig.SHPressGrid );
 
 		// check temperature data range and attempt to cap if necessary
 		if ( ( TempIndex > 0 ) && ( TempIndex < refrig.NumSuperTempPts ) ) { // in range
@@ -4295,7 +4321,7 @@ namespace FluidProperties {
 		}
 		auto const & refrig( RefrigData( RefrigNum ) );
 
-		LoTempIndex = FindArrayIndex( Temperature, refrig.SHTemps, 1, refrig.NumSuperTempPts );
+		LoTempIndex = FindArrayIndex( Temperature, refrig.SHTemps, refrig.SHTempGrid );
 		HiTempIndex = LoTempIndex + 1;
 
 		// check temperature data range and attempt to cap if necessary
@@ -4565,7 +4591,7 @@ namespace FluidProperties {
 		auto const & Refrig( RefrigData( RefrigNum ) ); // Shorthand name
 
 		// check temperature data range and attempt to cap if necessary
-		TempIndex = FindArrayIndex( Temperature, Refrig.SHTemps, 1, Refrig.NumSuperTempPts );
+		TempIndex = FindArrayIndex( Temperature, Refrig.SHTemps, Refrig.SHTempGrid );
 		if ( ( TempIndex > 0 ) && ( TempIndex < Refrig.NumSuperTempPts ) ) { // in range
 			HiTempIndex = TempIndex + 1;
 			TempInterpRatio = ( Temperature - Refrig.SHTemps( TempIndex ) ) / ( Refrig.SHTemps( HiTempIndex ) - Refrig.SHTemps( TempIndex ) );
@@ -4585,7 +4611,7 @@ namespace FluidProperties {
 		}
 
 		// check pressure data range and attempt to cap if necessary
-		LoPressIndex = FindArrayIndex( Pressure, Refrig.SHPress, 1, Refrig.NumSuperPressPts );
+		LoPressIndex = FindArrayIndex( Pressure, Refrig.SHPress, Refrig.SHPressGrid );
 		if ( ( LoPressIndex > 0 ) && ( LoPressIndex < Refrig.NumSuperPressPts ) ) { // in range
 			HiPressIndex = LoPressIndex + 1;
 			Real64 const SHPress_Lo( Refrig.SHPress( LoPressIndex ) );
@@ -4807,12 +4833,11 @@ namespace FluidProperties {
 			//}
 			//assert( std::is_sorted( glycol_CpTemps.begin(), glycol_CpTemps.end() ) ); // Sorted temperature array is assumed: Enable if/when arrays have begin()/end()
 			assert( glycol_CpTemps.size() <= static_cast< std::size_t >( std::numeric_limits< int >::max() ) ); // Array indexes are int now so this is future protection
-			int beg( 1 ), mid, end( glycol_CpTemps.isize() ); // 1-based indexing
-			assert( end > 0 );
-			while ( beg + 1 < end ) {
-				mid = ( ( beg + end ) >> 1 ); // bit shifting is faster than /2
-				( Temperature > glycol_CpTemps( mid ) ? beg : end ) = mid;
-			} // Invariant: glycol_CpTemps[beg] <= Temperature <= glycol_CpTemps[end]
+			assert( glycol_CpTemps.isize() > 0 );
+			// Index grid spans 1:NumCpTempPts so the bracket matches the former full-array binary search
+			int const beg( FindArrayIndex( Temperature, glycol_CpTemps, glycol_data.CpTempGrid ) ); // 1-based indexing
+			int const end( min( beg + 1, glycol_CpTemps.isize() ) );
+			// Invariant: glycol_CpTemps[beg] <= Temperature <= glycol_CpTemps[end]
 			return GetInterpValue_fast( Temperature, glycol_CpTemps( beg ), glycol_CpTemps( end ), glycol_CpValues( beg ), glycol_CpValues( end ) );
 		}
 
@@ -4868,7 +4893,6 @@ namespace FluidProperties {
 		// na
 
 		// FUNCTION LOCAL VARIABLE DECLARATIONS:
-		int Loop; // DO loop counter
 		static int HighTempLimitErr( 0 );
 		static int HighTempLimitIndex( 0 );
 		static int LowTempLimitErr( 0 );
@@ -4915,12 +4939,13 @@ namespace FluidProperties {
 			HighErrorThisTime = true;
 			ReturnValue = GlycolData( GlycolIndex ).RhoValues( GlycolData( GlycolIndex ).RhoHighTempIndex );
 		} else { // Temperature somewhere between the lowest and highest value
-			ReturnValue = GlycolData( GlycolIndex ).RhoValues( GlycolData( GlycolIndex ).RhoLowTempIndex );
+			auto const & glycol_data( GlycolData( GlycolIndex ) );
 			// bracket is temp > low, <= high (for interpolation
-			for ( Loop = GlycolData( GlycolIndex ).RhoLowTempIndex + 1; Loop <= GlycolData( GlycolIndex ).RhoHighTempIndex; ++Loop ) {
-				if ( Temperature > GlycolData( GlycolIndex ).RhoTemps( Loop ) ) continue;
-				ReturnValue = GetInterpValue( Temperature, GlycolData( GlycolIndex ).RhoTemps( Loop - 1 ), GlycolData( GlycolIndex ).RhoTemps( Loop ), GlycolData( GlycolIndex ).RhoValues( Loop - 1 ), GlycolData( GlycolIndex ).RhoValues( Loop ) );
-				break; // DO loop
+			int const LoTempIndex( FindArrayIndex( Temperature, glycol_data.RhoTemps, glycol_data.RhoTempGrid ) );
+			if ( LoTempIndex < glycol_data.RhoHighTempIndex ) {
+				ReturnValue = GetInterpValue( Temperature, glycol_data.RhoTemps( LoTempIndex ), glycol_data.RhoTemps( LoTempIndex + 1 ), glycol_data.RhoValues( LoTempIndex ), glycol_data.RhoValues( LoTempIndex + 1 ) );
+			} else {
+				ReturnValue = glycol_data.RhoValues( glycol_data.RhoLowTempIndex );
 			}
 		}
 
@@ -5011,7 +5036,6 @@ namespace FluidProperties {
 		// na
 
 		// FUNCTION LOCAL VARIABLE DECLARATIONS:
-		int Loop; // DO loop counter
 		static int HighTempLimitErr( 0 );
 		static int LowTempLimitErr( 0 );
 		static int HighTempLimitIndex( 0 );
@@ -5058,12 +5082,13 @@ namespace FluidProperties {
 			HighErrorThisTime = true;
 			ReturnValue = GlycolData( GlycolIndex ).CondValues( GlycolData( GlycolIndex ).CondHighTempIndex );
 		} else { // Temperature somewhere between the lowest and highest value
-			ReturnValue = GlycolData( GlycolIndex ).CondValues( GlycolData( GlycolIndex ).CondLowTempIndex );
+			auto const & glycol_data( GlycolData( GlycolIndex ) );
 			// bracket is temp > low, <= high (for interpolation
-			for ( Loop = GlycolData( GlycolIndex ).CondLowTempIndex + 1; Loop <= GlycolData( GlycolIndex ).CondHighTempIndex; ++Loop ) {
-				if ( Temperature > GlycolData( GlycolIndex ).CondTemps( Loop ) ) continue;
-				ReturnValue = GetInterpValue( Temperature, GlycolData( GlycolIndex ).CondTemps( Loop - 1 ), GlycolData( GlycolIndex ).CondTemps( Loop ), GlycolData( GlycolIndex ).CondValues( Loop - 1 ), GlycolData( GlycolIndex ).CondValues( Loop ) );
-				break; // DO loop
+			int const LoTempIndex( FindArrayIndex( Temperature, glycol_data.CondTemps, glycol_data.CondTempGrid ) );
+			if ( LoTempIndex < glycol_data.CondHighTempIndex ) {
+				ReturnValue = GetInterpValue( Temperature, glycol_data.CondTemps( LoTempIndex ), glycol_data.CondTemps( LoTempIndex + 1 ), glycol_data.CondValues( LoTempIndex ), glycol_data.CondValues( LoTempIndex + 1 ) );
+			} else {
+				ReturnValue = glycol_data.CondValues( glycol_data.CondLowTempIndex );
 			}
 		}
 
@@ -5154,7 +5179,6 @@ namespace FluidProperties {
 		// na
 
 		// FUNCTION LOCAL VARIABLE DECLARATIONS:
-		int Loop; // DO loop counter
 		static int HighTempLimitErr( 0 );
 		static int HighTempLimitIndex( 0 );
 		static int LowTempLimitErr( 0 );
@@ -5201,12 +5225,13 @@ namespace FluidProperties {
 			HighErrorThisTime = true;
 			ReturnValue = GlycolData( GlycolIndex ).ViscValues( GlycolData( GlycolIndex ).ViscHighTempIndex );
 		} else { // Temperature somewhere between the lowest and highest value
-			ReturnValue = GlycolData( GlycolIndex ).ViscValues( GlycolData( GlycolIndex ).ViscLowTempIndex );
+			auto const & glycol_data( GlycolData( GlycolIndex ) );
 			// bracket is temp > low, <= high (for interpolation
-			for ( Loop = GlycolData( GlycolIndex ).ViscLowTempIndex + 1; Loop <= GlycolData( GlycolIndex ).ViscHighTempIndex; ++Loop ) {
-				if ( Temperature > GlycolData( GlycolIndex ).ViscTemps( Loop ) ) continue;
-				ReturnValue = GetInterpValue( Temperature, GlycolData( GlycolIndex ).ViscTemps( Loop - 1 ), GlycolData( GlycolIndex ).ViscTemps( Loop ), GlycolData( GlycolIndex ).ViscValues( Loop - 1 ), GlycolData( GlycolIndex ).ViscValues( Loop ) );
-				break; // DO loop
+			int const LoTempIndex( FindArrayIndex( Temperature, glycol_data.ViscTemps, glycol_data.ViscTempGrid ) );
+			if ( LoTempIndex < glycol_data.ViscHighTempIndex ) {
+				ReturnValue = GetInterpValue( Temperature, glycol_data.ViscTemps( LoTempIndex ), glycol_data.ViscTemps( LoTempIndex + 1 ), glycol_data.ViscValues( LoTempIndex ), glycol_data.ViscValues( LoTempIndex + 1 ) );
+			} else {
+				ReturnValue = glycol_data.ViscValues( glycol_data.ViscLowTempIndex );
 			}
 		}
 
@@ -5335,7 +5360,7 @@ namespace FluidProperties {
 		}
 		auto const & refrig( RefrigData( RefrigNum ) );
 
-		LoTempIndex = FindArrayIndex( Temperature, refrig.HTemps, refrig.HfLowTempIndex, refrig.HfHighTempIndex );
+		LoTempIndex = FindArrayIndex( Temperature, refrig.HTemps, refrig.HTempGrid );
 		HiTempIndex = LoTempIndex + 1;
 
 		// check on the data bounds and adjust indices to give clamped return value
@@ -5677,6 +5702,134 @@ namespace FluidProperties {
 		}
 	}
 
+	int
+	FindArrayIndex(
+		Real64 const Value, // Value to be placed/found within the array of values
+		FArray1D< Real64 > const & Array, // Array of values in ascending order
+		FluidPropsIndexGrid const & Grid // Index grid built over Array (carries the valid bounds)
+	)
+	{
+		// PURPOSE OF THIS FUNCTION:
+		// Same result as FindArrayIndex( Value, Array, LowBound, UpperBound ) but in
+		// constant time using an index grid set up by InitializeIndexGrid.
+
+		// METHODOLOGY EMPLOYED:
+		// The uniform cell containing Value gives the low bracket index at the cell
+		// start.  That index is stepped down (guards against round off in the cell
+		// calculation) and then up until Array( Index ) < Value <= Array( Index + 1 ),
+		// which is exactly the bracket the interval halving search returns.  For
+		// tables with near-uniform spacing the stepping is at most one point.
+		// When the grid is empty the interval halving search is used.
+
+		int const LowBound( Grid.LowBound );
+		int const UpperBound( Grid.UpperBound );
+		int const NumCells( Grid.CellLoIndex.isize() );
+		if ( NumCells == 0 ) return FindArrayIndex( Value, Array, LowBound, UpperBound );
+
+		if ( Value < Array( LowBound ) ) return 0;
+		if ( Value > Array( UpperBound ) ) return UpperBound;
+
+		int Cell( static_cast< int >( ( Value - Grid.LowValue ) * Grid.CellsPerUnit ) + 1 );
+		if ( Cell > NumCells ) Cell = NumCells;
+		if ( Cell < 1 ) Cell = 1;
+		int Index( Grid.CellLoIndex( Cell ) );
+		while ( Index > LowBound && Array( Index ) >= Value ) --Index;
+		while ( Index + 1 < UpperBound && Array( Index + 1 ) < Value ) ++Index;
+		return Index;
+	}
+
+	//*****************************************************************************
+
+	void
+	InitializeIndexGrid(
+		FluidPropsIndexGrid & Grid, // Index grid to set up
+		FArray1D< Real64 > const & Array, // Array of values in ascending order
+		int const LowBound, // Valid values lower bound
+		int const UpperBound // Valid values upper bound
+	)
+	{
+		// PURPOSE OF THIS SUBROUTINE:
+		// Sets up the uniform index grid used by FindArrayIndex( Value, Array, Grid ).
+
+		// METHODOLOGY EMPLOYED:
+		// The cell width is the smallest point spacing in the valid range so that most
+		// cells span at most one table interval, limited to MaxIndexGridCells.  Tables
+		// that are not strictly ascending (or have a single valid point) get no cells
+		// and fall back to interval halving.
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		Real64 MinSpacing; // Smallest spacing between valid table points
+		int NumCells; // Number of grid cells
+		int Index; // Low bracket index being tracked across cells
+
+		Grid.LowBound = LowBound;
+		Grid.UpperBound = UpperBound;
+		Grid.LowValue = 0.0;
+		Grid.CellsPerUnit = 0.0;
+		Grid.CellLoIndex.deallocate();
+
+		if ( DataSystemVariables::FluidPropertyBinarySearch ) return;
+		if ( LowBound < Array.l() || UpperBound > Array.u() || UpperBound <= LowBound ) return;
+
+		MinSpacing = Array( UpperBound ) - Array( LowBound );
+		for ( Index = LowBound; Index < UpperBound; ++Index ) {
+			Real64 const Spacing( Array( Index + 1 ) - Array( Index ) );
+			if ( Spacing <= 0.0 ) return; // Not strictly ascending: keep interval halving
+			MinSpacing = min( MinSpacing, Spacing );
+		}
+
+		Real64 const Span( Array( UpperBound ) - Array( LowBound ) );
+		NumCells = max( UpperBound - LowBound, min( MaxIndexGridCells, static_cast< int >( std::ceil( Span / MinSpacing ) ) ) );
+
+		Grid.LowValue = Array( LowBound );
+		Grid.CellsPerUnit = NumCells / Span;
+		Grid.CellLoIndex.allocate( NumCells );
+
+		// Largest index in [LowBound,UpperBound-1] with Array( Index ) < cell start, else LowBound
+		Index = LowBound;
+		for ( int Cell = 1; Cell <= NumCells; ++Cell ) {
+			Real64 const CellStart( Grid.LowValue + ( Cell - 1 ) / Grid.CellsPerUnit );
+			while ( Index + 1 < UpperBound && Array( Index + 1 ) < CellStart ) ++Index;
+			Grid.CellLoIndex( Cell ) = Index;
+		}
+	}
+
+	//*****************************************************************************
+
+	void
+	InitializeFluidPropertyIndexGrids()
+	{
+		// PURPOSE OF THIS SUBROUTINE:
+		// Builds the index grids for every glycol and refrigerant property table once the
+		// valid data limits are known, so that property lookups in the simulation do not
+		// search the temperature and pressure point arrays.
+
+		// METHODOLOGY EMPLOYED:
+		// Grid bounds match the bounds each Get* routine passes to FindArrayIndex, so the
+		// interpolation results are identical to the table search.  Setting the
+		// FluidPropertyBinarySearch environment variable leaves the grids empty for
+		// validation against the original search.
+
+		for ( int GlycolNum = 1; GlycolNum <= NumOfGlycols; ++GlycolNum ) {
+			auto & glycol( GlycolData( GlycolNum ) );
+			if ( glycol.CpDataPresent ) InitializeIndexGrid( glycol.CpTempGrid, glycol.CpTemps, 1, glycol.NumCpTempPts );
+			if ( glycol.RhoDataPresent ) InitializeIndexGrid( glycol.RhoTempGrid, glycol.RhoTemps, glycol.RhoLowTempIndex, glycol.RhoHighTempIndex );
+			if ( glycol.CondDataPresent ) InitializeIndexGrid( glycol.CondTempGrid, glycol.CondTemps, glycol.CondLowTempIndex, glycol.CondHighTempIndex );
+			if ( glycol.ViscDataPresent ) InitializeIndexGrid( glycol.ViscTempGrid, glycol.ViscTemps, glycol.ViscLowTempIndex, glycol.ViscHighTempIndex );
+		}
+
+		for ( int RefrigNum = 1; RefrigNum <= NumOfRefrigerants; ++RefrigNum ) {
+			auto & refrig( RefrigData( RefrigNum ) );
+			InitializeIndexGrid( refrig.PsTempGrid, refrig.PsTemps, refrig.PsLowTempIndex, refrig.PsHighTempIndex );
+			InitializeIndexGrid( refrig.PsPresGrid, refrig.PsValues, refrig.PsLowPresIndex, refrig.PsHighPresIndex );
+			InitializeIndexGrid( refrig.HTempGrid, refrig.HTemps, refrig.HfLowTempIndex, refrig.HfHighTempIndex );
+			InitializeIndexGrid( refrig.CpTempGrid, refrig.CpTemps, refrig.CpfLowTempIndex, refrig.CpfHighTempIndex );
+			InitializeIndexGrid( refrig.RhoTempGrid, refrig.RhoTemps, refrig.RhofLowTempIndex, refrig.RhofHighTempIndex );
+			InitializeIndexGrid( refrig.SHTempGrid, refrig.SHTemps, 1, refrig.NumSuperTempPts );
+			InitializeIndexGrid( refrig.SHPressGrid, refrig.SHPress, 1, refrig.NumSuperPressPts );
+		}
+	}
+
 	//*****************************************************************************
 
 	Real64
@@ -5687,8 +5840,7 @@ namespace FluidProperties {
 		FArray1D< Real64 > const & VapProp, // Array of saturatedvapour properties
 		Real64 const Quality, // Quality
 		std::string const & CalledFrom, // routine this function was called from (error messages)
-		int const LowBound, // Valid values lower bound (set by calling program)
-		int const UpperBound // Valid values upper bound (set by calling program)
+		FluidPropsIndexGrid const & TempGrid // Index grid over PropTemps (carries the valid bounds)
 	)
 	{
 
@@ -5740,7 +5892,9 @@ namespace FluidProperties {
 		static int TempRangeErrCount( 0 ); // cumulative error counter
 		static int TempRangeErrIndex( 0 );
 
-		int const LoTempIndex = FindArrayIndex( Temperature, PropTemps, LowBound, UpperBound );  // array index for temp above input temp
+		int const LowBound( TempGrid.LowBound ); // Valid values lower bound
+		int const UpperBound( TempGrid.UpperBound ); // Valid values upper bound
+		int const LoTempIndex = FindArrayIndex( Temperature, PropTemps, TempGrid );  // array index for temp above input temp
 
 		if ( LoTempIndex == 0 ) {
 			ReturnValue = LiqProp( LowBound ) + Quality * ( VapProp( LowBound ) - LiqProp( LowBound ) );
@@ -40,6 +40,7 @@ namespace FluidProperties {
 	extern int const PropyleneGlycolIndex;
 	extern int const iRefrig;
 	extern int const iGlycol;
+	extern int const MaxIndexGridCells; // Upper limit on cells in a property table index grid
 
 	// DERIVED TYPE DEFINITIONS
 
@@ -64,6 +65,28 @@ namespace FluidProperties {
 
 	// Types
 
+	struct FluidPropsIndexGrid
+	{
+		// Uniform grid over the abscissa of a property table: each cell stores the low
+		// bracket index at the cell start so lookups need no search.  An empty grid
+		// (no cells) means the plain binary search in FindArrayIndex is used.
+		// Members
+		int LowBound; // Lowest valid index in the property table
+		int UpperBound; // Highest valid index in the property table
+		Real64 LowValue; // Table abscissa at LowBound
+		Real64 CellsPerUnit; // Inverse of the uniform cell width
+		FArray1D_int CellLoIndex; // Low bracket index at the start of each cell
+
+		// Default Constructor
+		FluidPropsIndexGrid() :
+			LowBound( 0 ),
+			UpperBound( 0 ),
+			LowValue( 0.0 ),
+			CellsPerUnit( 0.0 )
+		{}
+
+	};
+
 	struct FluidPropsRefrigerantData
 	{
 		// Members
@@ -121,6 +144,13 @@ namespace FluidProperties {
 		FArray1D< Real64 > SHPress; // Pressures for superheated gas
 		FArray2D< Real64 > HshValues; // Enthalpy of superheated gas at HshTemps, HshPress
 		FArray2D< Real64 > RhoshValues; // Density of superheated gas at HshTemps, HshPress
+		FluidPropsIndexGrid PsTempGrid; // Index grid for PsTemps (PsLowTempIndex:PsHighTempIndex)
+		FluidPropsIndexGrid PsPresGrid; // Index grid for PsValues (PsLowPresIndex:PsHighPresIndex)
+		FluidPropsIndexGrid HTempGrid; // Index grid for HTemps (HfLowTempIndex:HfHighTempIndex)
+		FluidPropsIndexGrid CpTempGrid; // Index grid for CpTemps (CpfLowTempIndex:CpfHighTempIndex)
+		FluidPropsIndexGrid RhoTempGrid; // Index grid for RhoTemps (RhofLowTempIndex:RhofHighTempIndex)
+		FluidPropsIndexGrid SHTempGrid; // Index grid for SHTemps (1:NumSuperTempPts)
+		FluidPropsIndexGrid SHPressGrid; // Index grid for SHPress (1:NumSuperPressPts)
 
 		// Default Constructor
 		FluidPropsRefrigerantData() :
@@ -422,6 +452,10 @@ namespace FluidProperties {
 		int ViscHighTempIndex; // High Temperature Max Index for Visc (>0.0)
 		FArray1D< Real64 > ViscTemps; // Temperatures for viscosity of glycol
 		FArray1D< Real64 > ViscValues; // viscosity values (mPa-s)
+		FluidPropsIndexGrid CpTempGrid; // Index grid for CpTemps (1:NumCpTempPts)
+		FluidPropsIndexGrid RhoTempGrid; // Index grid for RhoTemps (RhoLowTempIndex:RhoHighTempIndex)
+		FluidPropsIndexGrid CondTempGrid; // Index grid for CondTemps (CondLowTempIndex:CondHighTempIndex)
+		FluidPropsIndexGrid ViscTempGrid; // Index grid for ViscTemps (ViscLowTempIndex:ViscHighTempIndex)
 
 		// Default Constructor
 		FluidPropsGlycolData() :
@@ -737,6 +771,9 @@ namespace FluidProperties {
 
 	// Functions
 
+	void
+	clear_state();
+
 	void
 	GetFluidPropertiesData();
 
@@ -1025,6 +1062,24 @@ namespace FluidProperties {
 		FArray1D< Real64 > const & Array // Array of values in ascending order
 	);
 
+	int
+	FindArrayIndex(
+		Real64 const Value, // Value to be placed/found within the array of values
+		FArray1D< Real64 > const & Array, // Array of values in ascending order
+		FluidPropsIndexGrid const & Grid // Index grid built over Array (carries the valid bounds)
+	);
+
+	void
+	InitializeIndexGrid(
+		FluidPropsIndexGrid & Grid, // Index grid to set up
+		FArray1D< Real64 > const & Array, // Array of values in ascending order
+		int const LowBound, // Valid values lower bound
+		int const UpperBound // Valid values upper bound
+	);
+
+	void
+	InitializeFluidPropertyIndexGrids();
+
 	//*****************************************************************************
 
 	Real64
@@ -1035,8 +1090,7 @@ namespace FluidProperties {
 		FArray1D< Real64 > const & VapProp, // Array of saturatedvapour properties
 		Real64 const Quality, // Quality
 		std::string const & CalledFrom, // routine this function was called from (error messages)
-		int const LowBound, // Valid values lower bound (set by calling program)
-		int const UpperBound // Valid values upper bound (set by calling program)
+		FluidPropsIndexGrid const & TempGrid // Index grid over PropTemps (carries the valid bounds)
 	);
 
 	//*****************************************************************************
@@ -14,6 +14,7 @@
 #include <DataLoopNode.hh>
 #include <DataPlant.hh>
 #include <DataPrecisionGlobals.hh>
+#include <DataSystemVariables.hh>
 #include <FluidProperties.hh>
 #include <General.hh>
 #include <InputProcessor.hh>
@@ -79,6 +80,7 @@ namespace GroundHeatExchangers {
 	Real64 const HrsPerDay( 24.0 ); // Number of hours in a day
 	Real64 const HrsPerMonth( 730.0 ); // Number of hours in month
 	int const MaxTSinHr( 60 ); // Max number of time step in a hour
+	int const NumAggCellsPerLevel( 12 ); // Load blocks of each width in the multi-level aggregation
 
 	// MODULE VARIABLE DECLARATIONS:
 	int NumVerticalGlhes( 0 );
@@ -239,6 +241,7 @@ namespace GroundHeatExchangers {
 
 		// Using/Aliasing
 		using DataPlant::PlantLoop;
+		using DataSystemVariables::GroundHXMultiLevelAggregation;
 		using FluidProperties::GetSpecificHeatGlycol;
 		using FluidProperties::GetDensityGlycol;
 
@@ -328,7 +331,9 @@ namespace GroundHeatExchangers {
 			PrevTimeSteps = 0.0;
 			for ( I = 1; I <= NumVerticalGlhes; ++I ) {
 				VerticalGlhe( I ).QnHr = 0.0;
+				VerticalGlhe( I ).QnHrSum = 0.0;
 				VerticalGlhe( I ).QnMonthlyAgg = 0.0;
+				VerticalGlhe( I ).QnMonthlySumMonth = 0;
 				VerticalGlhe( I ).QnSubHr = 0.0;
 				VerticalGlhe( I ).LastHourN = 1;
 			}
@@ -430,21 +435,25 @@ namespace GroundHeatExchangers {
 
 				HourlyLimit = int( CurrentSimTime );
 				SumQnHourly = 0.0;
-				HOURLY_LOOP: for ( I = SubAGG + 1; I <= HourlyLimit; ++I ) {
-					if ( I == HourlyLimit ) {
-						XI = std::log( CurrentSimTime / ( TimeSS_Factor ) );
+				if ( GroundHXMultiLevelAggregation ) {
+					SumQnHourly = SumAggregatedLoads( GlheNum, VerticalGlhe( GlheNum ).QnHrSum, SubAGG + 1, HourlyLimit, 0.0, CurrentSimTime - int( CurrentSimTime ), 1.0, TimeSS_Factor ) / K_Ground_Factor;
+				} else {
+					HOURLY_LOOP: for ( I = SubAGG + 1; I <= HourlyLimit; ++I ) {
+						if ( I == HourlyLimit ) {
+							XI = std::log( CurrentSimTime / ( TimeSS_Factor ) );
+							INTERP( GlheNum, XI, GfuncVal );
+							RQHour = GfuncVal / ( K_Ground_Factor );
+							SumQnHourly += VerticalGlhe( GlheNum ).QnHr( I ) * RQHour;
+							goto HOURLY_LOOP_exit;
+						}
+						XI = std::log( ( CurrentSimTime - int( CurrentSimTime ) + I ) / ( TimeSS_Factor ) );
 						INTERP( GlheNum, XI, GfuncVal );
 						RQHour = GfuncVal / ( K_Ground_Factor );
-						SumQnHourly += VerticalGlhe( GlheNum ).QnHr( I ) * RQHour;
-						goto HOURLY_LOOP_exit;
+						SumQnHourly += ( VerticalGlhe( GlheNum ).QnHr( I ) - VerticalGlhe( GlheNum ).QnHr( I + 1 ) ) * RQHour;
+						HOURLY_LOOP_loop: ;
 					}
-					XI = std::log( ( CurrentSimTime - int( CurrentSimTime ) + I ) / ( TimeSS_Factor ) );
-					INTERP( GlheNum, XI, GfuncVal );
-					RQHour = GfuncVal / ( K_Ground_Factor );
-					SumQnHourly += ( VerticalGlhe( GlheNum ).QnHr( I ) - VerticalGlhe( GlheNum ).QnHr( I + 1 ) ) * RQHour;
-					HOURLY_LOOP_loop: ;
+					HOURLY_LOOP_exit: ;
 				}
-				HOURLY_LOOP_exit: ;
 
 				// Find the total Sum of the Temperature difference due to all load blocks
 				SumTotal = SumQnSubHourly + SumQnHourly;
@@ -481,40 +490,56 @@ namespace GroundHeatExchangers {
 
 				//monthly superposition
 				SumQnMonthly = 0.0;
-				SUMMONTHLY: for ( I = 1; I <= CurrentMonth; ++I ) {
-					if ( I == 1 ) {
-						XI = std::log( CurrentSimTime / ( TimeSS_Factor ) );
+				if ( GroundHXMultiLevelAggregation ) {
+					// Sum the monthly loads from the most recent month once for each month superposed
+					if ( VerticalGlhe( GlheNum ).QnMonthlySumMonth != CurrentMonth ) {
+						VerticalGlhe( GlheNum ).QnMonthlySum( 0 ) = 0.0;
+						for ( I = 1; I <= CurrentMonth; ++I ) {
+							VerticalGlhe( GlheNum ).QnMonthlySum( I ) = VerticalGlhe( GlheNum ).QnMonthlySum( I - 1 ) + VerticalGlhe( GlheNum ).QnMonthlyAgg( CurrentMonth - I + 1 );
+						}
+						VerticalGlhe( GlheNum ).QnMonthlySumMonth = CurrentMonth;
+					}
+					SumQnMonthly = SumAggregatedLoads( GlheNum, VerticalGlhe( GlheNum ).QnMonthlySum, 1, CurrentMonth, 0.0, CurrentSimTime - CurrentMonth * HrsPerMonth, HrsPerMonth, TimeSS_Factor ) / K_Ground_Factor;
+				} else {
+					SUMMONTHLY: for ( I = 1; I <= CurrentMonth; ++I ) {
+						if ( I == 1 ) {
+							XI = std::log( CurrentSimTime / ( TimeSS_Factor ) );
+							INTERP( GlheNum, XI, GfuncVal );
+							RQMonth = GfuncVal / ( K_Ground_Factor );
+							SumQnMonthly += VerticalGlhe( GlheNum ).QnMonthlyAgg( I ) * RQMonth;
+							goto SUMMONTHLY_loop;
+						}
+						XI = std::log( ( CurrentSimTime - ( I - 1 ) * HrsPerMonth ) / ( TimeSS_Factor ) );
 						INTERP( GlheNum, XI, GfuncVal );
 						RQMonth = GfuncVal / ( K_Ground_Factor );
-						SumQnMonthly += VerticalGlhe( GlheNum ).QnMonthlyAgg( I ) * RQMonth;
-						goto SUMMONTHLY_loop;
+						SumQnMonthly += ( VerticalGlhe( GlheNum ).QnMonthlyAgg( I ) - VerticalGlhe( GlheNum ).QnMonthlyAgg( I - 1 ) ) * RQMonth;
+						SUMMONTHLY_loop: ;
 					}
-					XI = std::log( ( CurrentSimTime - ( I - 1 ) * HrsPerMonth ) / ( TimeSS_Factor ) );
-					INTERP( GlheNum, XI, GfuncVal );
-					RQMonth = GfuncVal / ( K_Ground_Factor );
-					SumQnMonthly += ( VerticalGlhe( GlheNum ).QnMonthlyAgg( I ) - VerticalGlhe( GlheNum ).QnMonthlyAgg( I - 1 ) ) * RQMonth;
-					SUMMONTHLY_loop: ;
+					SUMMONTHLY_exit: ;
 				}
-				SUMMONTHLY_exit: ;
 
 				// Hourly Supr position
 				HourlyLimit = int( CurrentSimTime - CurrentMonth * HrsPerMonth );
 				SumQnHourly = 0.0;
-				HOURLYLOOP: for ( I = 1 + SubAGG; I <= HourlyLimit; ++I ) {
-					if ( I == HourlyLimit ) {
+				if ( GroundHXMultiLevelAggregation ) {
+					SumQnHourly = SumAggregatedLoads( GlheNum, VerticalGlhe( GlheNum ).QnHrSum, SubAGG + 1, HourlyLimit, VerticalGlhe( GlheNum ).QnMonthlyAgg( CurrentMonth ), CurrentSimTime - int( CurrentSimTime ), 1.0, TimeSS_Factor ) / K_Ground_Factor;
+				} else {
+					HOURLYLOOP: for ( I = 1 + SubAGG; I <= HourlyLimit; ++I ) {
+						if ( I == HourlyLimit ) {
+							XI = std::log( ( CurrentSimTime - int( CurrentSimTime ) + I ) / ( TimeSS_Factor ) );
+							INTERP( GlheNum, XI, GfuncVal );
+							RQHour = GfuncVal / ( K_Ground_Factor );
+							SumQnHourly += ( VerticalGlhe( GlheNum ).QnHr( I ) - VerticalGlhe( GlheNum ).QnMonthlyAgg( CurrentMonth ) ) * RQHour;
+							goto HOURLYLOOP_exit;
+						}
 						XI = std::log( ( CurrentSimTime - int( CurrentSimTime ) + I ) / ( TimeSS_Factor ) );
 						INTERP( GlheNum, XI, GfuncVal );
 						RQHour = GfuncVal / ( K_Ground_Factor );
-						SumQnHourly += ( VerticalGlhe( GlheNum ).QnHr( I ) - VerticalGlhe( GlheNum ).QnMonthlyAgg( CurrentMonth ) ) * RQHour;
-						goto HOURLYLOOP_exit;
+						SumQnHourly += ( VerticalGlhe( GlheNum ).QnHr( I ) - VerticalGlhe( GlheNum ).QnHr( I + 1 ) ) * RQHour;
+						HOURLYLOOP_loop: ;
 					}
-					XI = std::log( ( CurrentSimTime - int( CurrentSimTime ) + I ) / ( TimeSS_Factor ) );
-					INTERP( GlheNum, XI, GfuncVal );
-					RQHour = GfuncVal / ( K_Ground_Factor );
-					SumQnHourly += ( VerticalGlhe( GlheNum ).QnHr( I ) - VerticalGlhe( GlheNum ).QnHr( I + 1 ) ) * RQHour;
-					HOURLYLOOP_loop: ;
+					HOURLYLOOP_exit: ;
 				}
-				HOURLYLOOP_exit: ;
 
 				// Subhourly Superposition
 				SubHourlyLimit = N - VerticalGlhe( GlheNum ).LastHourN( SubAGG + 1 );
@@ -599,8 +624,8 @@ namespace GroundHeatExchangers {
 		// Yavuzturk, C., J.D. Spitler. 1999. 'A Short Time Step Response Factor Model
 		//   for Vertical Ground Loop Heat Exchangers. ASHRAE Transactions. 105(2): 475-485.
 
-		// USE STATEMENTS:
-		// na
+		// Using/Aliasing
+		using DataSystemVariables::GroundHXMultiLevelAggregation;
 
 		// Locals
 		//LOCAL VARIABLES
@@ -637,6 +662,11 @@ namespace GroundHeatExchangers {
 			SumQnHr /= std::abs( PrevTimeSteps( 1 ) - PrevTimeSteps( J ) );
 			VerticalGlhe( GlheNum ).QnHr = eoshift( VerticalGlhe( GlheNum ).QnHr, -1, SumQnHr );
 			VerticalGlhe( GlheNum ).LastHourN = eoshift( VerticalGlhe( GlheNum ).LastHourN, -1, N );
+			if ( GroundHXMultiLevelAggregation ) {
+				for ( J = 1; J <= VerticalGlhe( GlheNum ).QnHr.isize(); ++J ) {
+					VerticalGlhe( GlheNum ).QnHrSum( J ) = VerticalGlhe( GlheNum ).QnHrSum( J - 1 ) + VerticalGlhe( GlheNum ).QnHr( J );
+				}
+			}
 		}
 
 		//CHECK IF A MONTH PASSES...
@@ -657,6 +687,80 @@ namespace GroundHeatExchangers {
 
 	//******************************************************************************
 
+	Real64
+	SumAggregatedLoads(
+		int const GlheNum, // Ground loop heat exchanger ID number
+		FArray1< Real64 > const & QnSum, // Running sums of the load history, most recent first
+		int const First, // Most recent load history entry to superpose
+		int const Last, // Oldest load history entry to superpose
+		Real64 const QnPrior, // Load before the oldest entry
+		Real64 const TimeBase, // Elapsed time at the end of load history entry 0 [hr]
+		Real64 const TimeStride, // Duration of one load history entry [hr]
+		Real64 const TimeSS_Factor // Steady state time factor [hr]
+	)
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Superposes the g-function response to load history entries First to Last,
+		// returning the sum of the load steps times the g-function at each step.
+
+		// METHODOLOGY EMPLOYED:
+		// Multi-level load aggregation. Entry J began J * TimeStride hours before TimeBase
+		// and QnSum( J ) is the sum of entries 1 to J. Working back from the most recent
+		// entry the history is split into blocks, NumAggCellsPerLevel blocks of one entry,
+		// then NumAggCellsPerLevel of two entries, four, and so on. Each block is applied
+		// as its average load, so the number of g-function evaluations grows only with
+		// the logarithm of the history length.
+
+		// REFERENCES:
+		// Claesson, J., S. Javed. 2012. 'A Load-Aggregation Method to Calculate Extraction
+		//   Temperatures of Borehole Heat Exchangers.' ASHRAE Transactions. 118(1): 530-539.
+
+		// USE STATEMENTS:
+		// na
+
+		// Return value
+		Real64 SumQn; // Sum of load steps times g-function values
+
+		// Locals
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		int BlockFirst; // Most recent entry in the block
+		int BlockLast; // Oldest entry in the block
+		int BlockWidth; // Entries per block at the current level
+		int NumBlocks; // Blocks taken so far
+		Real64 QnBlock; // Average load over the block
+		Real64 QnNewer; // Average load over the next more recent block
+		Real64 TimeNewer; // Elapsed time at the start of the next more recent block [hr]
+		Real64 GfuncVal;
+
+		SumQn = 0.0;
+		if ( Last < First ) return SumQn;
+
+		BlockWidth = 1;
+		NumBlocks = 0;
+		QnNewer = 0.0;
+		TimeNewer = 0.0;
+		for ( BlockFirst = First; BlockFirst <= Last; BlockFirst = BlockLast + 1 ) {
+			BlockLast = min( BlockFirst + BlockWidth - 1, Last );
+			QnBlock = ( QnSum( BlockLast ) - QnSum( BlockFirst - 1 ) ) / ( BlockLast - BlockFirst + 1 );
+			if ( BlockFirst > First ) {
+				INTERP( GlheNum, std::log( TimeNewer / TimeSS_Factor ), GfuncVal );
+				SumQn += ( QnNewer - QnBlock ) * GfuncVal;
+			}
+			QnNewer = QnBlock;
+			TimeNewer = TimeBase + BlockLast * TimeStride;
+			++NumBlocks;
+			if ( mod( NumBlocks, NumAggCellsPerLevel ) == 0 ) BlockWidth *= 2;
+		}
+		INTERP( GlheNum, std::log( TimeNewer / TimeSS_Factor ), GfuncVal );
+		SumQn += ( QnNewer - QnPrior ) * GfuncVal;
+
+		return SumQn;
+
+	}
+
+	//******************************************************************************
+
 	void
 	GetGroundheatExchangerInput()
 	{
@@ -795,7 +899,9 @@ namespace GroundHeatExchangers {
 			VerticalGlhe( GlheNum ).LNTTS.dimension( VerticalGlhe( GlheNum ).NPairs, 0.0 );
 			VerticalGlhe( GlheNum ).GFNC.dimension( VerticalGlhe( GlheNum ).NPairs, 0.0 );
 			VerticalGlhe( GlheNum ).QnMonthlyAgg.dimension( VerticalGlhe( GlheNum ).MaxSimYears * 12, 0.0 );
+			VerticalGlhe( GlheNum ).QnMonthlySum.dimension( {0,VerticalGlhe( GlheNum ).MaxSimYears * 12}, 0.0 );
 			VerticalGlhe( GlheNum ).QnHr.dimension( 730 + VerticalGlhe( GlheNum ).AGG + VerticalGlhe( GlheNum ).SubAGG, 0.0 );
+			VerticalGlhe( GlheNum ).QnHrSum.dimension( {0,730 + VerticalGlhe( GlheNum ).AGG + VerticalGlhe( GlheNum ).SubAGG}, 0.0 );
 			VerticalGlhe( GlheNum ).QnSubHr.dimension( ( VerticalGlhe( GlheNum ).SubAGG + 1 ) * MaxTSinHr + 1, 0.0 );
 			VerticalGlhe( GlheNum ).LastHourN.dimension( VerticalGlhe( GlheNum ).SubAGG + 1, 0 );
 
@@ -811,6 +917,7 @@ namespace GroundHeatExchangers {
 				VerticalGlhe( GlheNum ).GFNC( PairNum ) = rNumericArgs( IndexNum + 1 );
 				IndexNum += 2;
 			}
+			SetupGFunctionTable( GlheNum );
 			//Check for Errors
 			if ( ErrorsFound ) {
 				ShowFatalError( "Errors found in processing input for " + cCurrentModuleObject );
@@ -971,6 +1078,61 @@ namespace GroundHeatExchangers {
 
 	//******************************************************************************
 
+	void
+	SetupGFunctionTable( int const GlheNum ) // Ground loop heat exchanger ID number
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Builds the lookup table INTERP uses to find the g-function pair below a value of
+		// LN(t/TimeSS), and the g-function correction for the borehole radius to length ratio.
+
+		// METHODOLOGY EMPLOYED:
+		// The range of the Lntts pairs is split into uniform intervals, several per pair,
+		// and the table holds the last pair at or below the start of each interval. A
+		// lookup is then an index calculation followed by a short forward search.
+
+		// REFERENCES:
+		// na
+
+		// USE STATEMENTS:
+		// na
+
+		// Locals
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		int const IntervalsPerPair( 4 );
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int NumPairs;
+		int NumIntervals;
+		int IntervalNum;
+		int PairNum;
+		Real64 IntervalStart; // Value of LN(t/TimeSS) at the start of the interval
+
+		NumPairs = VerticalGlhe( GlheNum ).NPairs;
+		NumIntervals = max( IntervalsPerPair * ( NumPairs - 1 ), 1 );
+		VerticalGlhe( GlheNum ).LNTTSTablePair.dimension( NumIntervals, 1 );
+		VerticalGlhe( GlheNum ).LNTTSTableStep = 1.0;
+		if ( NumPairs > 1 && VerticalGlhe( GlheNum ).LNTTS( NumPairs ) > VerticalGlhe( GlheNum ).LNTTS( 1 ) ) {
+			VerticalGlhe( GlheNum ).LNTTSTableStep = ( VerticalGlhe( GlheNum ).LNTTS( NumPairs ) - VerticalGlhe( GlheNum ).LNTTS( 1 ) ) / NumIntervals;
+			PairNum = 1;
+			for ( IntervalNum = 1; IntervalNum <= NumIntervals; ++IntervalNum ) {
+				IntervalStart = VerticalGlhe( GlheNum ).LNTTS( 1 ) + ( IntervalNum - 1 ) * VerticalGlhe( GlheNum ).LNTTSTableStep;
+				while ( PairNum < NumPairs - 1 && VerticalGlhe( GlheNum ).LNTTS( PairNum + 1 ) <= IntervalStart ) ++PairNum;
+				VerticalGlhe( GlheNum ).LNTTSTablePair( IntervalNum ) = PairNum;
+			}
+		}
+
+		// If the ratio of borehole radius to active length is not the reference ratio
+		// then a correction factor for the g-function must be used.
+		VerticalGlhe( GlheNum ).GFNCCorrection = 0.0;
+		if ( VerticalGlhe( GlheNum ).BoreholeRadius / VerticalGlhe( GlheNum ).BoreholeLength != VerticalGlhe( GlheNum ).gReferenceRatio ) {
+			VerticalGlhe( GlheNum ).GFNCCorrection = std::log( VerticalGlhe( GlheNum ).BoreholeRadius / ( VerticalGlhe( GlheNum ).BoreholeLength * VerticalGlhe( GlheNum ).gReferenceRatio ) );
+		}
+
+	}
+
+	//******************************************************************************
+
 	void
 	INTERP(
 		int const GlheNum, // Ground loop heat exchanger ID number
@@ -991,6 +1153,9 @@ namespace GroundHeatExchangers {
 		//    known value of the natural log of (T/Ts)
 
 		// METHODOLOGY EMPLOYED:
+		// Linear interpolation between the g-function pairs. The pair below LnTTsVal is
+		// looked up in the uniform interval table built by SetupGFunctionTable rather than
+		// by binary search, and the radius to length correction is precomputed there.
 
 		//  REFERENCE:          Thermal Analysis of Heat Extraction
 		//                      Boreholes.  Per Eskilson, Dept. of
@@ -1013,19 +1178,9 @@ namespace GroundHeatExchangers {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		int NumPairs;
-		Real64 RATIO;
-		Real64 ReferenceRatio;
-
-		//Binary Search Algorithms Variables
-		// REFERENCE      :  DATA STRUCTURES AND ALGORITHM ANALYSIS IN C BY MARK ALLEN WEISS
-		int Mid;
-		int Low;
-		int High;
-		bool Found;
+		int Mid; // Pair at or below LnTTsVal
 
 		NumPairs = VerticalGlhe( GlheNum ).NPairs;
-		RATIO = VerticalGlhe( GlheNum ).BoreholeRadius / VerticalGlhe( GlheNum ).BoreholeLength;
-		ReferenceRatio = VerticalGlhe( GlheNum ).gReferenceRatio;
 
 		// The following IF loop determines the g-function for the case
 		// when LnTTsVal is less than the first element of the LnTTs array.
@@ -1034,15 +1189,8 @@ namespace GroundHeatExchangers {
 		if ( LnTTsVal <= VerticalGlhe( GlheNum ).LNTTS( 1 ) ) {
 			GfuncVal = ( ( LnTTsVal - VerticalGlhe( GlheNum ).LNTTS( 1 ) ) / ( VerticalGlhe( GlheNum ).LNTTS( 2 ) - VerticalGlhe( GlheNum ).LNTTS( 1 ) ) ) * ( VerticalGlhe( GlheNum ).GFNC( 2 ) - VerticalGlhe( GlheNum ).GFNC( 1 ) ) + VerticalGlhe( GlheNum ).GFNC( 1 );
 
-			// The following IF statement determines the condition of the ratio
-			// between the borehole radius and the active borehole length.
-			// If RATIO does not equal 0.0005 then a correction factor for
-			// the g-function must be used.
-
-			if ( RATIO != ReferenceRatio ) {
-				GfuncVal -= std::log( VerticalGlhe( GlheNum ).BoreholeRadius / ( VerticalGlhe( GlheNum ).BoreholeLength * ReferenceRatio ) );
-			}
-
+			// Apply correction factor if necessary
+			GfuncVal -= VerticalGlhe( GlheNum ).GFNCCorrection;
 			return;
 		}
 
@@ -1054,60 +1202,22 @@ namespace GroundHeatExchangers {
 			GfuncVal = ( ( LnTTsVal - VerticalGlhe( GlheNum ).LNTTS( NumPairs ) ) / ( VerticalGlhe( GlheNum ).LNTTS( NumPairs - 1 ) - VerticalGlhe( GlheNum ).LNTTS( NumPairs ) ) ) * ( VerticalGlhe( GlheNum ).GFNC( NumPairs - 1 ) - VerticalGlhe( GlheNum ).GFNC( NumPairs ) ) + VerticalGlhe( GlheNum ).GFNC( NumPairs );
 
 			// Apply correction factor if necessary
-			if ( RATIO != ReferenceRatio ) {
-				GfuncVal -= std::log( VerticalGlhe( GlheNum ).BoreholeRadius / ( VerticalGlhe( GlheNum ).BoreholeLength * ReferenceRatio ) );
-			}
-
+			GfuncVal -= VerticalGlhe( GlheNum ).GFNCCorrection;
 			return;
 		}
 
-		// The following DO loop is for the case when LnTTsVal falls within
-		// the first and last elements of the LnTTs array, or is identically
-		// equal to one of the LnTTs elements.  In this case the g-function
-		// must be found by interpolation.
-		// USING BINARY SEARCH TO FIND THE ELEMENET
-		Found = false;
-		Low = 1;
-		High = NumPairs;
-		LOOP: while ( Low <= High ) {
-			Mid = ( Low + High ) / 2;
-			if ( VerticalGlhe( GlheNum ).LNTTS( Mid ) < LnTTsVal ) {
-				Low = Mid + 1;
-			} else {
-				if ( VerticalGlhe( GlheNum ).LNTTS( Mid ) > LnTTsVal ) {
-					High = Mid - 1;
-				} else {
-					Found = true;
-					goto LOOP_exit;
-				}
-			}
-			LOOP_loop: ;
-		}
-		LOOP_exit: ;
-		//LnTTsVal is identical to one of the LnTTS array elements return
-		//the GfuncVal after applying the correction
-		if ( Found ) {
-			GfuncVal = VerticalGlhe( GlheNum ).GFNC( Mid );
-			// Apply correction factor if necessary
-			if ( RATIO != ReferenceRatio ) {
-				GfuncVal -= std::log( VerticalGlhe( GlheNum ).BoreholeRadius / ( VerticalGlhe( GlheNum ).BoreholeLength * ReferenceRatio ) );
-			}
-			return;
-		}
+		// LnTTsVal falls within the first and last elements of the LnTTs array, or
+		// is identically equal to one of them. Find the pairs either side of it from
+		// the interval table and interpolate.
+		Mid = VerticalGlhe( GlheNum ).LNTTSTablePair( min( int( ( LnTTsVal - VerticalGlhe( GlheNum ).LNTTS( 1 ) ) / VerticalGlhe( GlheNum ).LNTTSTableStep ) + 1, VerticalGlhe( GlheNum ).LNTTSTablePair.isize() ) );
+		while ( Mid > 1 && VerticalGlhe( GlheNum ).LNTTS( Mid ) >= LnTTsVal ) --Mid;
+		while ( VerticalGlhe( GlheNum ).LNTTS( Mid + 1 ) < LnTTsVal ) ++Mid;
+		++Mid;
 
-		//LnTTsVal is in between any of the two LnTTS array elements find the
-		// gfunction value by interplation and apply the correction and return
-		if ( ! Found ) {
-			if ( VerticalGlhe( GlheNum ).LNTTS( Mid ) < LnTTsVal ) ++Mid;
+		GfuncVal = ( ( LnTTsVal - VerticalGlhe( GlheNum ).LNTTS( Mid ) ) / ( VerticalGlhe( GlheNum ).LNTTS( Mid - 1 ) - VerticalGlhe( GlheNum ).LNTTS( Mid ) ) ) * ( VerticalGlhe( GlheNum ).GFNC( Mid - 1 ) - VerticalGlhe( GlheNum ).GFNC( Mid ) ) + VerticalGlhe( GlheNum ).GFNC( Mid );
 
-			GfuncVal = ( ( LnTTsVal - VerticalGlhe( GlheNum ).LNTTS( Mid ) ) / ( VerticalGlhe( GlheNum ).LNTTS( Mid - 1 ) - VerticalGlhe( GlheNum ).LNTTS( Mid ) ) ) * ( VerticalGlhe( GlheNum ).GFNC( Mid - 1 ) - VerticalGlhe( GlheNum ).GFNC( Mid ) ) + VerticalGlhe( GlheNum ).GFNC( Mid );
-
-			// Apply correction factor if necessary
-			if ( RATIO != ReferenceRatio ) {
-				GfuncVal -= std::log( VerticalGlhe( GlheNum ).BoreholeRadius / ( VerticalGlhe( GlheNum ).BoreholeLength * ReferenceRatio ) );
-			}
-			return;
-		}
+		// Apply correction factor if necessary
+		GfuncVal -= VerticalGlhe( GlheNum ).GFNCCorrection;
 	}
 
 	//******************************************************************************
@@ -1197,7 +1307,9 @@ namespace GroundHeatExchangers {
 			// zero out all history arrays
 
 			VerticalGlhe( GlheNum ).QnHr = 0.0;
+			VerticalGlhe( GlheNum ).QnHrSum = 0.0;
 			VerticalGlhe( GlheNum ).QnMonthlyAgg = 0.0;
+			VerticalGlhe( GlheNum ).QnMonthlySumMonth = 0;
 			VerticalGlhe( GlheNum ).QnSubHr = 0.0;
 			VerticalGlhe( GlheNum ).LastHourN = 0;
 			PrevTimeSteps = 0.0;
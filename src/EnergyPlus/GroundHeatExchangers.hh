@@ -21,6 +21,7 @@ namespace GroundHeatExchangers {
 	extern Real64 const HrsPerDay; // Number of hours in a day
 	extern Real64 const HrsPerMonth; // Number of hours in month
 	extern int const MaxTSinHr; // Max number of time step in a hour
+	extern int const NumAggCellsPerLevel; // Load blocks of each width in the multi-level aggregation
 
 	// MODULE VARIABLE DECLARATIONS:
 	extern int NumVerticalGlhes;
@@ -79,6 +80,12 @@ namespace GroundHeatExchangers {
 		// by the total active length of bore holes  [W/m]
 		FArray1D< Real64 > LNTTS; // natural log of Non Dimensional Time Ln(t/ts)
 		FArray1D< Real64 > GFNC; // G-function ( Non Dimensional temperature response factors)
+		FArray1D_int LNTTSTablePair; // Last Lntts pair at or below the start of each uniform Ln(t/ts) interval
+		Real64 LNTTSTableStep; // Width of the uniform Ln(t/ts) intervals
+		Real64 GFNCCorrection; // G-function correction for the borehole radius to length ratio
+		FArray1D< Real64 > QnHrSum; // Running sums of QnHr from the most recent hour (multi-level aggregation)
+		FArray1D< Real64 > QnMonthlySum; // Running sums of QnMonthlyAgg from the most recent month (multi-level aggregation)
+		int QnMonthlySumMonth; // Month up to which QnMonthlySum is summed
 		int AGG; // Minimum Hourly Histroy required
 		int SubAGG; // Minimum subhourly History
 		FArray1D_int LastHourN; // Stores the Previous hour's N for past hours
@@ -111,6 +118,9 @@ namespace GroundHeatExchangers {
 			PipeThick( 0.0 ),
 			gReferenceRatio( 0.0 ),
 			NPairs( 0 ),
+			LNTTSTableStep( 0.0 ),
+			GFNCCorrection( 0.0 ),
+			QnMonthlySumMonth( 0 ),
 			AGG( 0 ),
 			SubAGG( 0 ),
 			LoopNum( 0 ),
@@ -181,6 +191,9 @@ namespace GroundHeatExchangers {
 			QnSubHr( QnSubHr ),
 			LNTTS( LNTTS ),
 			GFNC( GFNC ),
+			LNTTSTableStep( 0.0 ),
+			GFNCCorrection( 0.0 ),
+			QnMonthlySumMonth( 0 ),
 			AGG( AGG ),
 			SubAGG( SubAGG ),
 			LastHourN( LastHourN ),
@@ -259,6 +272,20 @@ namespace GroundHeatExchangers {
 
 	//******************************************************************************
 
+	Real64
+	SumAggregatedLoads(
+		int const GlheNum, // Ground loop heat exchanger ID number
+		FArray1< Real64 > const & QnSum, // Running sums of the load history, most recent first
+		int const First, // Most recent load history entry to superpose
+		int const Last, // Oldest load history entry to superpose
+		Real64 const QnPrior, // Load before the oldest entry
+		Real64 const TimeBase, // Elapsed time at the end of load history entry 0 [hr]
+		Real64 const TimeStride, // Duration of one load history entry [hr]
+		Real64 const TimeSS_Factor // Steady state time factor [hr]
+	);
+
+	//******************************************************************************
+
 	void
 	GetGroundheatExchangerInput();
 
@@ -272,6 +299,11 @@ namespace GroundHeatExchangers {
 
 	//******************************************************************************
 
+	void
+	SetupGFunctionTable( int const GlheNum ); // Ground loop heat exchanger ID number
+
+	//******************************************************************************
+
 	void
 	INTERP(
 		int const GlheNum, // Ground loop heat exchanger ID number
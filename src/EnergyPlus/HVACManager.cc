@@ -29,6 +29,7 @@
 #include <DataRoomAirModel.hh>
 #include <DataSurfaces.hh>
 #include <DataSystemVariables.hh>
+#include <DataTimings.hh>
 #include <DataZoneEquipment.hh>
 #include <DemandManager.hh>
 #include <DisplayRoutines.hh>
@@ -142,6 +143,7 @@ namespace HVACManager {
 
 	int HVACManageIteration( 0 ); // counts iterations to enforce maximum iteration limit
 	int RepIterAir( 0 );
+	Real64 RepSysTimeStep( 0.0 ); // length of the system timestep for reporting [min]
 
 	//FArray1D_bool CrossMixingReportFlag; // TRUE when Cross Mixing is active based on controls
 	//FArray1D_bool MixingReportFlag; // TRUE when Mixing is active based on controls
@@ -179,8 +181,11 @@ namespace HVACManager {
 		// Using/Aliasing
 		using DataConvergParams::MinTimeStepSys; // =0.0166667     != 1 minute | 0.3 C = (1% OF 300 C) =max allowable diff between ZoneAirTemp at Time=T & T-1
 		using DataConvergParams::MaxZoneTempDiff;
+		using DataConvergParams::MaxZoneTempLocalError;
+		using DataSystemVariables::AdaptiveSystemTimestep;
 
 		using ZoneTempPredictorCorrector::ManageZoneAirUpdates;
+		using ZoneTempPredictorCorrector::ZoneTempLocalError;
 		using ZoneTempPredictorCorrector::DetectOscillatingZoneTemp;
 
 		using NodeInputManager::CalcMoreNodeInfo;
@@ -258,6 +263,7 @@ namespace HVACManager {
 		static int ZTempTrendsNumSysSteps( 0 );
 		static int SysTimestepLoop( 0 );
 		bool DummyLogical;
+		bool ShortenTimeStep; // true if the zone timestep is to be divided into shorter system timesteps
 
 		// Formats
 		static gio::Fmt Format_10( "('node #   Temp   MassMinAv  MassMaxAv TempSP      MassFlow       MassMin       ','MassMax        MassSP    Press        Enthal     HumRat Fluid Type')" );
@@ -358,10 +364,19 @@ namespace HVACManager {
 		ManageZoneAirUpdates( iCorrectStep, ZoneTempChange, ShortenTimeStepSys, UseZoneTimeStepHistory, PriorTimeStep );
 		if ( Contaminant.SimulateContaminants ) ManageZoneContaminanUpdates( iCorrectStep, ShortenTimeStepSys, UseZoneTimeStepHistory, PriorTimeStep );
 
-		if ( ZoneTempChange > MaxZoneTempDiff && ! KickOffSimulation ) {
-			//determine value of adaptive system time step
+		if ( AdaptiveSystemTimestep ) {
+			// size the system timestep from the predictor/corrector difference of the zone air temperatures; zones
+			// that behave as predicted keep the full zone timestep however fast they drift
+			ZTempTrendsNumSysSteps = AdaptiveNumOfSysTimeSteps( ZoneTempLocalError, MaxZoneTempLocalError, LimitNumSysSteps );
+			ShortenTimeStep = ( ZTempTrendsNumSysSteps > 1 && ! KickOffSimulation );
+		} else {
+			ShortenTimeStep = ( ZoneTempChange > MaxZoneTempDiff && ! KickOffSimulation );
 			// model how many system timesteps we want in zone timestep
-			ZTempTrendsNumSysSteps = int( ZoneTempChange / MaxZoneTempDiff + 1.0 ); // add 1 for truncation
+			if ( ShortenTimeStep ) ZTempTrendsNumSysSteps = int( ZoneTempChange / MaxZoneTempDiff + 1.0 ); // add 1 for truncation
+		}
+
+		if ( ShortenTimeStep ) {
+			//determine value of adaptive system time step
 			NumOfSysTimeSteps = min( ZTempTrendsNumSysSteps, LimitNumSysSteps );
 			//then determine timestep length for even distribution, protect div by zero
 			if ( NumOfSysTimeSteps > 0 ) TimeStepSys = TimeStepZone / NumOfSysTimeSteps;
@@ -413,6 +428,7 @@ namespace HVACManager {
 			}
 
 			FracTimeStepZone = TimeStepSys / TimeStepZone;
+			RepSysTimeStep = TimeStepSys * 60.0;
 
 			for ( ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum ) {
 				ZTAV( ZoneNum ) += ZT( ZoneNum ) * FracTimeStepZone;
@@ -540,6 +556,28 @@ namespace HVACManager {
 
 	}
 
+	int
+	AdaptiveNumOfSysTimeSteps(
+		Real64 const LocalError, // Largest zone air temperature local error estimate of the last step [deltaC]
+		Real64 const MaxLocalError, // Allowed local error [deltaC]
+		int const MaxNumSysSteps // Most system timesteps allowed in a zone timestep
+	)
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Number of system timesteps for the next zone timestep when AdaptiveSystemTimestep is on.
+
+		// METHODOLOGY EMPLOYED:
+		// The local error is the difference between the predicted and corrected zone air temperatures, which grows
+		// about linearly with the timestep while the loads or the system response change.  The zone timestep is split
+		// so each system timestep stays within MaxLocalError, bounded by MaxNumSysSteps; one step (the full zone
+		// timestep) is used again as soon as the error is within the tolerance.
+
+		if ( LocalError <= MaxLocalError || MaxLocalError <= 0.0 ) return 1;
+		return max( 1, int( min( LocalError / MaxLocalError + 1.0, Real64( MaxNumSysSteps ) ) ) ); // add 1 for truncation
+
+	}
+
 	void
 	SimHVAC()
 	{
@@ -581,6 +619,8 @@ namespace HVACManager {
 		using PlantManager::ManagePlantLoops;
 		using PlantManager::SetupInitialPlantCallingOrder;
 		using PlantManager::SetupBranchControlTypes;
+		using ZoneTempPredictorCorrector::ZoneTempLocalError;
+		using DataSystemVariables::AdaptiveSystemTimestep;
 		using PlantManager::ReInitPlantLoopsAtFirstHVACIteration;
 		using PlantManager::InitOneTimePlantSizingInfo;
 		using PlantCondLoopOperation::SetupPlantEMSActuators;
@@ -601,6 +641,8 @@ namespace HVACManager {
 		using PlantUtilities::CheckForRunawayPlantTemps;
 		using PlantUtilities::AnyPlantSplitterMixerLacksContinuity;
 		using DataGlobals::AnyPlantInModel;
+		using DataTimings::epStartHVACProfile;
+		using DataTimings::epStopHVACProfile;
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -611,6 +653,7 @@ namespace HVACManager {
 		bool const NotPlantLoop( false );
 		bool const SimWithPlantFlowUnlocked( false );
 		bool const SimWithPlantFlowLocked( true );
+		static std::string const ProfileSimHVAC( "SimHVAC" ); // HVAC profile entry name
 
 		// INTERFACE BLOCK SPECIFICATIONS:
 		// na
@@ -685,6 +728,10 @@ namespace HVACManager {
 		if ( ! IterSetup ) {
 			SetupOutputVariable( "HVAC System Solver Iteration Count []", HVACManageIteration, "HVAC", "Sum", "SimHVAC" );
 			SetupOutputVariable( "Air System Solver Iteration Count []", RepIterAir, "HVAC", "Sum", "SimHVAC" );
+			if ( AdaptiveSystemTimestep ) {
+				SetupOutputVariable( "HVAC System Timestep [min]", RepSysTimeStep, "HVAC", "Average", "SimHVAC" );
+				SetupOutputVariable( "HVAC System Zone Air Temperature Local Error Estimate [deltaC]", ZoneTempLocalError, "HVAC", "Average", "SimHVAC" );
+			}
 			ManageSetPoints(); //need to call this before getting plant loop data so setpoint checks can complete okay
 			GetPlantLoopData();
 			GetPlantInput();
@@ -719,6 +766,8 @@ namespace HVACManager {
 		// rates that might have been set by the set point and availability
 		// managers.
 
+		epStartHVACProfile( ProfileSimHVAC );
+
 		ResetHVACControl();
 
 		// Before the HVAC simulation, call ManageSetPoints to set all the HVAC
@@ -805,6 +854,8 @@ namespace HVACManager {
 			}
 		}
 
+		epStopHVACProfile( HVACManageIteration );
+
 		//DSU  Test plant loop for errors
 		for ( LoopNum = 1; LoopNum <= TotNumLoops; ++LoopNum ) {
 			for ( LoopSide = DemandSide; LoopSide <= SupplySide; ++LoopSide ) {
@@ -1454,6 +1505,8 @@ namespace HVACManager {
 		using DataPlant::FlowUnlocked;
 		using DataPlant::FlowLocked;
 		using DataPlant::AnyPlantLoopSidesNeedSim;
+		using DataTimings::epStartHVACProfile;
+		using DataTimings::epStopHVACProfile;
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -1463,6 +1516,11 @@ namespace HVACManager {
 		int const MaxAir( 5 ); // Iteration Max for Air Simulation Iterations
 		int const MaxPlant( 3 ); // Iteration Max for Plant Simulation Iteration
 		int const MaxCond( 3 ); // Iteration Max for Plant Simulation Iteration
+		static std::string const ProfileManageAirLoops( "ManageAirLoops" ); // HVAC profile entry names
+		static std::string const ProfileManageZoneEquipment( "ManageZoneEquipment" );
+		static std::string const ProfileManageNonZoneEquipment( "ManageNonZoneEquipment" );
+		static std::string const ProfileManageElectricLoadCenters( "ManageElectricLoadCenters" );
+		static std::string const ProfileManagePlantLoops( "ManagePlantLoops" );
 
 		// INTERFACE BLOCK SPECIFICATIONS:
 		// na
@@ -1496,7 +1554,9 @@ namespace HVACManager {
 			// determination of which zones are connected to which air loops.
 			// This call of ManageZoneEquipment does nothing except force the
 			// zone equipment data to be read in.
+			epStartHVACProfile( ProfileManageZoneEquipment );
 			ManageZoneEquipment( FirstHVACIteration, SimZoneEquipment, SimAirLoops );
+			epStopHVACProfile();
 			MyEnvrnFlag = false;
 		}
 		if ( ! BeginEnvrnFlag ) {
@@ -1509,22 +1569,34 @@ namespace HVACManager {
 			if ( SimulateAirflowNetwork > AirflowNetworkControlSimple ) {
 				ManageAirflowNetworkBalance( FirstHVACIteration );
 			}
+			epStartHVACProfile( ProfileManageAirLoops );
 			ManageAirLoops( FirstHVACIteration, SimAirLoops, SimZoneEquipment );
+			epStopHVACProfile();
 			AirLoopInputsFilled = true; // all air loop inputs have been read in
 			SimAirLoops = true; //Need to make sure that SimAirLoop is simulated at min twice to calculate PLR in some air loop equipment
 			AirLoopsSimOnce = true; // air loops simulated once for this environment
 			ResetTerminalUnitFlowLimits();
 			FlowMaxAvailAlreadyReset = true;
+			epStartHVACProfile( ProfileManageZoneEquipment );
 			ManageZoneEquipment( FirstHVACIteration, SimZoneEquipment, SimAirLoops );
+			epStopHVACProfile();
 			SimZoneEquipment = true; //needs to be simulated at least twice for flow resolution to propagate to this routine
+			epStartHVACProfile( ProfileManageNonZoneEquipment );
 			ManageNonZoneEquipment( FirstHVACIteration, SimNonZoneEquipment );
+			epStopHVACProfile();
 
+			epStartHVACProfile( ProfileManageElectricLoadCenters );
 			ManageElectricLoadCenters( FirstHVACIteration, SimElecCircuits, false );
+			epStopHVACProfile();
 
+			epStartHVACProfile( ProfileManagePlantLoops );
 			ManagePlantLoops( FirstHVACIteration, SimAirLoops, SimZoneEquipment, SimNonZoneEquipment, SimPlantLoops, SimElecCircuits );
+			epStopHVACProfile();
 
 			AskForPlantCheckOnAbort = true; // need to make a first pass through plant calcs before this check make sense
+			epStartHVACProfile( ProfileManageElectricLoadCenters );
 			ManageElectricLoadCenters( FirstHVACIteration, SimElecCircuits, false );
+			epStopHVACProfile();
 		} else {
 			FlowResolutionNeeded = false;
 			while ( ( SimAirLoops || SimZoneEquipment ) && ( IterAir <= MaxAir ) ) {
@@ -1535,7 +1607,9 @@ namespace HVACManager {
 					ManageAirflowNetworkBalance( FirstHVACIteration, IterAir, ResimulateAirZone );
 				}
 				if ( SimAirLoops ) {
+					epStartHVACProfile( ProfileManageAirLoops );
 					ManageAirLoops( FirstHVACIteration, SimAirLoops, SimZoneEquipment );
+					epStopHVACProfile();
 					SimElecCircuits = true; //If this was simulated there are possible electric changes that need to be simulated
 				}
 
@@ -1551,7 +1625,9 @@ namespace HVACManager {
 						ResolveAirLoopFlowLimits();
 						FlowResolutionNeeded = false;
 					}
+					epStartHVACProfile( ProfileManageZoneEquipment );
 					ManageZoneEquipment( FirstHVACIteration, SimZoneEquipment, SimAirLoops );
+					epStopHVACProfile();
 					SimElecCircuits = true; // If this was simulated there are possible electric changes that need to be simulated
 
 				}
@@ -1577,12 +1653,16 @@ namespace HVACManager {
 			ResolveLockoutFlags( SimAirLoops );
 
 			if ( SimNonZoneEquipment ) {
+				epStartHVACProfile( ProfileManageNonZoneEquipment );
 				ManageNonZoneEquipment( FirstHVACIteration, SimNonZoneEquipment );
+				epStopHVACProfile();
 				SimElecCircuits = true; // If this was simulated there are possible electric changes that need to be simulated
 			}
 
 			if ( SimElecCircuits ) {
+				epStartHVACProfile( ProfileManageElectricLoadCenters );
 				ManageElectricLoadCenters( FirstHVACIteration, SimElecCircuits, false );
+				epStopHVACProfile();
 			}
 
 			if ( ! SimPlantLoops ) {
@@ -1594,11 +1674,15 @@ namespace HVACManager {
 			}
 
 			if ( SimPlantLoops ) {
+				epStartHVACProfile( ProfileManagePlantLoops );
 				ManagePlantLoops( FirstHVACIteration, SimAirLoops, SimZoneEquipment, SimNonZoneEquipment, SimPlantLoops, SimElecCircuits );
+				epStopHVACProfile();
 			}
 
 			if ( SimElecCircuits ) {
+				epStartHVACProfile( ProfileManageElectricLoadCenters );
 				ManageElectricLoadCenters( FirstHVACIteration, SimElecCircuits, false );
+				epStopHVACProfile();
 			}
 
 		}
@@ -28,6 +28,13 @@ namespace HVACManager {
 	void
 	ManageHVAC();
 
+	int
+	AdaptiveNumOfSysTimeSteps(
+		Real64 const LocalError, // Largest zone air temperature local error estimate of the last step [deltaC]
+		Real64 const MaxLocalError, // Allowed local error [deltaC]
+		int const MaxNumSysSteps // Most system timesteps allowed in a zone timestep
+	);
+
 	void
 	SimHVAC();
 
@@ -20,6 +20,7 @@
 #include <DataMoistureBalance.hh>
 #include <DataPrecisionGlobals.hh>
 #include <DataSurfaces.hh>
+#include <DataSystemVariables.hh>
 #include <General.hh>
 #include <HeatBalanceMovableInsulation.hh>
 #include <InputProcessor.hh>
@@ -1055,6 +1056,7 @@ namespace HeatBalFiniteDiffManager {
 //		using General::RoundSigDigits;
 		using DataHeatBalance::CondFDRelaxFactor;
 //		using DataGlobals::KickOffSimulation;
+		using DataSystemVariables::CondFDDirectSolve;
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -1070,12 +1072,9 @@ namespace HeatBalFiniteDiffManager {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 
-		static Real64 MaxDelTemp( 0.0 );
-
 		int const ConstrNum( Surface( Surf ).Construction );
 
 		int const TotNodes( ConstructFD( ConstrNum ).TotNodes );
-		int const TotLayers( Construct( ConstrNum ).TotLayers );
 
 		TempSurfInTmp = 0.0;
 		TempSurfOutTmp = 0.0;
@@ -1084,19 +1083,9 @@ namespace HeatBalFiniteDiffManager {
 
 		// Aliases
 		auto & surfaceFD( SurfaceFD( Surf ) );
-		auto const & T( surfaceFD.T );
-		auto & TOld( surfaceFD.TOld );
-		auto & TT( surfaceFD.TT );
-		auto const & Rhov( surfaceFD.Rhov );
-		auto & RhovOld( surfaceFD.RhovOld );
-		auto & RhoT( surfaceFD.RhoT );
-		auto const & TD( surfaceFD.TD );
 		auto & TDT( surfaceFD.TDT );
 		auto & TDTLast( surfaceFD.TDTLast );
-		auto & TDOld( surfaceFD.TDOld );
 		auto & TDreport( surfaceFD.TDreport );
-		auto & RH( surfaceFD.RH );
-		auto & RHreport( surfaceFD.RHreport );
 		auto & EnthOld( surfaceFD.EnthOld );
 		auto & EnthNew( surfaceFD.EnthNew );
 		auto & EnthLast( surfaceFD.EnthLast );
@@ -1107,82 +1096,63 @@ namespace HeatBalFiniteDiffManager {
 		int RoughIndexMovInsul; // roughness  Movable insulation
 		Real64 AbsExt; // exterior absorptivity  movable insulation
 		EvalOutsideMovableInsulation( Surf, HMovInsul, RoughIndexMovInsul, AbsExt );
+		bool const DirectSolve( CondFDDirectSolve && DirectSolveApplies( Surf, HMovInsul ) ); // tridiagonal solve instead of Gauss-Seidel sweeps
 		// Start stepping through the slab with time.
 		for ( int J = 1, J_end = nint( TimeStepZoneSec / Delt ); J <= J_end; ++J ) { //PT testing higher time steps
 
 			int GSiter; // iteration counter for implicit repeat calculation
-			for ( GSiter = 1; GSiter <= MaxGSiter; ++GSiter ) { //  Iterate implicit equations
-				TDTLast = TDT; // Save last iteration's TDT (New temperature) values
-				EnthLast = EnthNew; // Last iterations new enthalpy value
-
-				// Original loop version
-				int i( 1 ); //  Node counter
-				for ( int Lay = 1; Lay <= TotLayers; ++Lay ) { // Begin layer loop ...
-
-					// For the exterior surface node with a convective boundary condition
-					if ( ( i == 1 ) && ( Lay == 1 ) ) {
-						ExteriorBCEqns( Delt, i, Lay, Surf, T, TT, Rhov, RhoT, RH, TD, TDT, EnthOld, EnthNew, TotNodes, HMovInsul );
-					}
-
-					// For the Layer Interior nodes.  Arrive here after exterior surface node or interface node
-
-					if ( TotNodes != 1 ) {
-						for ( int ctr = 2, ctr_end = ConstructFD( ConstrNum ).NodeNumPoint( Lay ); ctr <= ctr_end; ++ctr ) {
-							++i;
-							InteriorNodeEqns( Delt, i, Lay, Surf, T, TT, Rhov, RhoT, RH, TD, TDT, EnthOld, EnthNew );
-						}
-					}
-
-					if ( ( Lay < TotLayers ) && ( TotNodes != 1 ) ) { // Interface equations for 2 capactive materials
-						++i;
-						IntInterfaceNodeEqns( Delt, i, Lay, Surf, T, TT, Rhov, RhoT, RH, TD, TDT, EnthOld, EnthNew, GSiter );
-					} else if ( Lay == TotLayers ) { // For the Interior surface node with a convective boundary condition
-						++i;
-						InteriorBCEqns( Delt, i, Lay, Surf, T, TT, Rhov, RhoT, RH, TD, TDT, EnthOld, EnthNew, TDreport );
+			if ( DirectSolve ) {
+				GSiter = CalcNodeTempsDirect( Delt, Surf );
+				// One pass of the node equations at the solution sets the boundary fluxes, enthalpies and source node temperatures
+				CalcNodeHeatBalances( Delt, Surf, GSiter, HMovInsul );
+			} else {
+				for ( GSiter = 1; GSiter <= MaxGSiter; ++GSiter ) { //  Iterate implicit equations
+					TDTLast = TDT; // Save last iteration's TDT (New temperature) values
+					EnthLast = EnthNew; // Last iterations new enthalpy value
+
+					CalcNodeHeatBalances( Delt, Surf, GSiter, HMovInsul );
+
+					// Apply Relaxation factor for stability, use current (TDT) and previous (TDTLast) iteration temperature values
+					// to obtain the actual temperature that is going to be used for next iteration. This would mostly happen with PCM
+					//Tuned Function call to eliminate array temporaries and multiple relaxation passes
+					if ( GSiter > 15 ) {
+						relax_array( TDT, TDTLast, 0.9875 );
+					} else if ( GSiter > 10 ) {
+						relax_array( TDT, TDTLast, 0.875 );
+					} else if ( GSiter > 5 ) {
+						relax_array( TDT, TDTLast, 0.5 );
 					}
 
-				} // layer loop
-
-				// Apply Relaxation factor for stability, use current (TDT) and previous (TDTLast) iteration temperature values
-				// to obtain the actual temperature that is going to be used for next iteration. This would mostly happen with PCM
-				//Tuned Function call to eliminate array temporaries and multiple relaxation passes
-				if ( GSiter > 15 ) {
-					relax_array( TDT, TDTLast, 0.9875 );
-				} else if ( GSiter > 10 ) {
-					relax_array( TDT, TDTLast, 0.875 );
-				} else if ( GSiter > 5 ) {
-					relax_array( TDT, TDTLast, 0.5 );
-				}
-
-				// the following could blow up when all the node temps sum to less than 1.0.  seems poorly formulated for temperature in C.
-				//PT delete one zero and decrese number of minimum iterations, from 3 (which actually requires 4 iterations) to 2.
-
-				if ( ( GSiter > 2 ) && ( std::abs( sum_array_diff( TDT, TDTLast ) / sum( TDT ) ) < 0.00001 ) ) break;
-				//SurfaceFD(Surf)%GSloopCounter = Gsiter  !PT moved out of GSloop so it can actually count all iterations
-
-				//feb2012 the following could blow up when all the node temps sum to less than 1.0.  seems poorly formulated for temperature in C.
-				//feb2012      IF (Gsiter .gt. 3  .and.ABS(SUM(SurfaceFD(Surf)%TDT-SurfaceFD(Surf)%TDTLast)/SUM(SurfaceFD(Surf)%TDT)) < 0.000001d0 )  EXIT
-				//feb2012      SurfaceFD(Surf)%GSloopCounter = Gsiter
-				//      IF ((GSiter == MaxGSiter) .AND. (SolutionAlgo /= UseCondFDSimple)) THEN ! didn't ever converge
-				//        IF (.NOT. WarmupFlag .AND. (.NOT. KickOffSimulation)) THEN
-				//          ErrCount=ErrCount+1
-				//          ErrorSignal = ABS(SUM(SurfaceFD(Surf)%TDT-SurfaceFD(Surf)%TDTLast)/SUM(SurfaceFD(Surf)%TDT))
-				//          IF (ErrCount < 10) THEN
-				//            CALL ShowWarningError('ConductionFiniteDifference inner iteration loop did not converge for surface named ='// &
-				//                          TRIM(Surface(Surf)%Name) // &
-				//                          ', with error signal ='//TRIM(RoundSigDigits(ErrorSignal, 8)) // &
-				//                          ' vs criteria of 0.000001')
-				//            CALL ShowContinueErrorTimeStamp(' ')
-				//          ELSE
-				//            CALL ShowRecurringWarningErrorAtEnd('ConductionFiniteDifference convergence problem continues for surface named ='// &
-				//                                                TRIM(Surface(Surf)%Name) , &
-				//                                               SurfaceFD(Surf)%GSloopErrorCount,ReportMaxOf=ErrorSignal,ReportMinOf=ErrorSignal,  &
-				//                                               ReportMaxUnits='[ ]',ReportMinUnits='[ ]')
-				//          ENDIF
-				//        ENDIF
-				//      ENDIF
-
-			} // End of Gauss Seidell iteration loop
+					// the following could blow up when all the node temps sum to less than 1.0.  seems poorly formulated for temperature in C.
+					//PT delete one zero and decrese number of minimum iterations, from 3 (which actually requires 4 iterations) to 2.
+
+					if ( ( GSiter > 2 ) && ( std::abs( sum_array_diff( TDT, TDTLast ) / sum( TDT ) ) < 0.00001 ) ) break;
+					//SurfaceFD(Surf)%GSloopCounter = Gsiter  !PT moved out of GSloop so it can actually count all iterations
+
+					//feb2012 the following could blow up when all the node temps sum to less than 1.0.  seems poorly formulated for temperature in C.
+					//feb2012      IF (Gsiter .gt. 3  .and.ABS(SUM(SurfaceFD(Surf)%TDT-SurfaceFD(Surf)%TDTLast)/SUM(SurfaceFD(Surf)%TDT)) < 0.000001d0 )  EXIT
+					//feb2012      SurfaceFD(Surf)%GSloopCounter = Gsiter
+					//      IF ((GSiter == MaxGSiter) .AND. (SolutionAlgo /= UseCondFDSimple)) THEN ! didn't ever converge
+					//        IF (.NOT. WarmupFlag .AND. (.NOT. KickOffSimulation)) THEN
+					//          ErrCount=ErrCount+1
+					//          ErrorSignal = ABS(SUM(SurfaceFD(Surf)%TDT-SurfaceFD(Surf)%TDTLast)/SUM(SurfaceFD(Surf)%TDT))
+					//          IF (ErrCount < 10) THEN
+					//            CALL ShowWarningError('ConductionFiniteDifference inner iteration loop did not converge for surface named ='// &
+					//                          TRIM(Surface(Surf)%Name) // &
+					//                          ', with error signal ='//TRIM(RoundSigDigits(ErrorSignal, 8)) // &
+					//                          ' vs criteria of 0.000001')
+					//            CALL ShowContinueErrorTimeStamp(' ')
+					//          ELSE
+					//            CALL ShowRecurringWarningErrorAtEnd('ConductionFiniteDifference convergence problem continues for surface named ='// &
+					//                                                TRIM(Surface(Surf)%Name) , &
+					//                                               SurfaceFD(Surf)%GSloopErrorCount,ReportMaxOf=ErrorSignal,ReportMinOf=ErrorSignal,  &
+					//                                               ReportMaxUnits='[ ]',ReportMinUnits='[ ]')
+					//          ENDIF
+					//        ENDIF
+					//      ENDIF
+
+				} // End of Gauss Seidell iteration loop
+			}
 
 			GSloopCounter = GSiter; // outputs GSloop iterations, useful for pinpointing stability issues with condFD
 			if ( CondFDRelaxFactor != 1.0 ) {
@@ -1199,7 +1169,7 @@ namespace HeatBalFiniteDiffManager {
 		RhoVaporSurfIn( Surf ) = 0.0;
 
 		// Determine largest change in node temps
-		MaxDelTemp = 0.0;
+		Real64 MaxDelTemp( 0.0 );
 		for ( int NodeNum = 1; NodeNum <= TotNodes + 1; ++NodeNum ) { // need to consider all nodes
 			MaxDelTemp = max( std::abs( TDT( NodeNum ) - TDreport( NodeNum ) ), MaxDelTemp );
 		}
@@ -1210,6 +1180,402 @@ namespace HeatBalFiniteDiffManager {
 
 	}
 
+	void
+	CalcNodeHeatBalances(
+		int const Delt, // Time Increment
+		int const Surf, // Surface number
+		int const GSiter, // Iteration number of Gauss Seidell iteration
+		Real64 const HMovInsul // Conductance of movable(transparent) insulation.
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Makes one pass of the node equations through the construction of a surface,
+		// from the outside face node to the inside face node.
+
+		// METHODOLOGY EMPLOYED:
+		// Gauss-Seidel: each node equation is solved with the latest temperatures of its neighbours.
+
+		int const ConstrNum( Surface( Surf ).Construction );
+		int const TotNodes( ConstructFD( ConstrNum ).TotNodes );
+		int const TotLayers( Construct( ConstrNum ).TotLayers );
+
+		// Aliases
+		auto & surfaceFD( SurfaceFD( Surf ) );
+		auto const & T( surfaceFD.T );
+		auto & TT( surfaceFD.TT );
+		auto const & Rhov( surfaceFD.Rhov );
+		auto & RhoT( surfaceFD.RhoT );
+		auto const & TD( surfaceFD.TD );
+		auto & TDT( surfaceFD.TDT );
+		auto & TDreport( surfaceFD.TDreport );
+		auto & RH( surfaceFD.RH );
+		auto & EnthOld( surfaceFD.EnthOld );
+		auto & EnthNew( surfaceFD.EnthNew );
+
+		int i( 1 ); //  Node counter
+		for ( int Lay = 1; Lay <= TotLayers; ++Lay ) { // Begin layer loop ...
+
+			// For the exterior surface node with a convective boundary condition
+			if ( ( i == 1 ) && ( Lay == 1 ) ) {
+				ExteriorBCEqns( Delt, i, Lay, Surf, T, TT, Rhov, RhoT, RH, TD, TDT, EnthOld, EnthNew, TotNodes, HMovInsul );
+			}
+
+			// For the Layer Interior nodes.  Arrive here after exterior surface node or interface node
+
+			if ( TotNodes != 1 ) {
+				for ( int ctr = 2, ctr_end = ConstructFD( ConstrNum ).NodeNumPoint( Lay ); ctr <= ctr_end; ++ctr ) {
+					++i;
+					InteriorNodeEqns( Delt, i, Lay, Surf, T, TT, Rhov, RhoT, RH, TD, TDT, EnthOld, EnthNew );
+				}
+			}
+
+			if ( ( Lay < TotLayers ) && ( TotNodes != 1 ) ) { // Interface equations for 2 capactive materials
+				++i;
+				IntInterfaceNodeEqns( Delt, i, Lay, Surf, T, TT, Rhov, RhoT, RH, TD, TDT, EnthOld, EnthNew, GSiter );
+			} else if ( Lay == TotLayers ) { // For the Interior surface node with a convective boundary condition
+				++i;
+				InteriorBCEqns( Delt, i, Lay, Surf, T, TT, Rhov, RhoT, RH, TD, TDT, EnthOld, EnthNew, TDreport );
+			}
+
+		} // layer loop
+
+	}
+
+	bool
+	DirectSolveApplies(
+		int const Surf, // Surface number
+		Real64 const HMovInsul // Conductance of movable(transparent) insulation.
+	)
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns true if the node temperatures of a surface can be found with CalcNodeTempsDirect.
+
+		// METHODOLOGY EMPLOYED:
+		// The fully implicit node equations of a surface form a tridiagonal system as long as the
+		// outside face is not coupled to another surface's inside face (interzone and adiabatic
+		// partitions) and there is no movable insulation on the outside.
+
+		auto const & surface( Surface( Surf ) );
+		return ( CondFDSchemeType == FullyImplicitFirstOrder ) && ( surface.HeatTransferAlgorithm == HeatTransferModel_CondFD ) && ( surface.ExtBoundCond <= 0 ) && ( HMovInsul <= 0.0 );
+
+	}
+
+	Real64
+	NodeConductivity(
+		int const MatLay, // Material number
+		Real64 const Temp, // Temperature at which the conductivity is evaluated
+		bool & VariableProps // Set to true if the conductivity depends on temperature
+	)
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Thermal conductivity of a CondFD material, as used in the node equations.
+
+		auto const & mat( Material( MatLay ) );
+		auto const & matFD( MaterialFD( MatLay ) );
+		auto const & matFD_TempCond( matFD.TempCond );
+		assert( matFD_TempCond.u1() >= 3 );
+		auto const lTC( matFD_TempCond.index( 1, 2 ) );
+		if ( matFD_TempCond[ lTC ] + matFD_TempCond[ lTC+1 ] + matFD_TempCond[ lTC+2 ] >= 0.0 ) { // Multiple Linear Segment Function
+			VariableProps = true;
+			return terpld( matFD_TempCond, Temp, 1, 2 ); // 1: Temperature, 2: Thermal conductivity
+		} else if ( matFD.tk1 != 0.0 ) { // linear coefficient (normally zero)
+			VariableProps = true;
+			return mat.Conductivity + matFD.tk1 * ( Temp - 20.0 );
+		} else {
+			return mat.Conductivity; // 20C base conductivity
+		}
+
+	}
+
+	Real64
+	NodeSpecHeat(
+		int const MatLay, // Material number
+		Real64 const TD_i, // Node temperature at the start of the time step
+		Real64 const TDT_i, // Node temperature at the end of the time step
+		bool & VariableProps // Set to true if the material is a phase change material
+	)
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Specific heat of a CondFD material over a time step, as used in the node equations.
+
+		// METHODOLOGY EMPLOYED:
+		// For phase change materials the enthalpy change over the time step divided by the
+		// temperature change, but not less than the specific heat from input.
+
+		auto const & mat( Material( MatLay ) );
+		auto const & matFD_TempEnth( MaterialFD( MatLay ).TempEnth );
+		assert( matFD_TempEnth.u1() >= 3 );
+		auto const lTE( matFD_TempEnth.index( 1, 2 ) );
+		Real64 const Cpo( mat.SpecHeat ); // Specific heat from idf
+		if ( matFD_TempEnth[ lTE ] + matFD_TempEnth[ lTE+1 ] + matFD_TempEnth[ lTE+2 ] >= 0.0 ) { // Phase change material: Use TempEnth data
+			VariableProps = true;
+			Real64 const EnthOld( terpld( matFD_TempEnth, TD_i, 1, 2 ) ); // 1: Temperature, 2: Enthalpy
+			Real64 const EnthNew( terpld( matFD_TempEnth, TDT_i, 1, 2 ) ); // 1: Temperature, 2: Enthalpy
+			if ( ( std::abs( EnthNew - EnthOld ) > smalldiff ) && ( std::abs( TDT_i - TD_i ) > smalldiff ) ) {
+				return max( Cpo, ( EnthNew - EnthOld ) / ( TDT_i - TD_i ) );
+			}
+		}
+		return Cpo;
+
+	}
+
+	int
+	CalcNodeTempsDirect(
+		int const Delt, // Time Increment
+		int const Surf // Surface number
+	)
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Finds the node temperatures of a surface at the end of a CondFD time step for the fully implicit
+		// scheme, and returns the number of iterations used.
+
+		// METHODOLOGY EMPLOYED:
+		// Each fully implicit node equation only involves the node and its two neighbours, so the node
+		// equations form a tridiagonal system that is solved directly with SolveTridiagonal. The
+		// conductivities and the phase change specific heats are evaluated at the latest temperatures
+		// and the system is solved again until the temperatures settle. Constructions without
+		// temperature dependent properties need a single solve.
+		// The coefficients are those of ExteriorBCEqns, InteriorNodeEqns, IntInterfaceNodeEqns and
+		// InteriorBCEqns for surfaces accepted by DirectSolveApplies.
+
+		// Using/Aliasing
+		using DataSurfaces::OtherSideCondModeledExt;
+		using DataSurfaces::OSCM;
+		using General::RoundSigDigits;
+
+		// Locals
+		// FUNCTION PARAMETER DEFINITIONS:
+		Real64 const TempTolerance( 1.0e-4 ); // Largest node temperature change between solves for convergence [C]
+		Real64 const IterDampConst( 5.0 ); // Damping constant for inside surface temperature iterations, as in InteriorBCEqns
+
+		auto const & surface( Surface( Surf ) );
+		int const ConstrNum( surface.Construction );
+		auto const & construct( Construct( ConstrNum ) );
+		auto const & constructFD( ConstructFD( ConstrNum ) );
+		int const TotNodes( constructFD.TotNodes );
+		int const TotLayers( construct.TotLayers );
+		int const N( TotNodes + 1 );
+
+		// The coefficients are kept with the surface so that surfaces can be solved concurrently
+		auto & surfaceFD( SurfaceFD( Surf ) );
+		if ( surfaceFD.CoefA.isize() != N ) {
+			surfaceFD.CoefA.allocate( N );
+			surfaceFD.CoefB.allocate( N );
+			surfaceFD.CoefC.allocate( N );
+			surfaceFD.CoefD.allocate( N );
+		}
+		auto & A( surfaceFD.CoefA );
+		auto & B( surfaceFD.CoefB );
+		auto & C( surfaceFD.CoefC );
+		auto & D( surfaceFD.CoefD );
+		auto const & TD( surfaceFD.TD );
+		auto & TDT( surfaceFD.TDT );
+		auto const & TDreport( surfaceFD.TDreport );
+
+		// Boundary conditions
+		bool const FixedOutsideTemp( surface.ExtBoundCond == Ground || IsRain );
+		Real64 Tsky;
+		Real64 QRadSWOutFD; // Short wave radiation absorbed on outside of opaque surface
+		if ( surface.ExtBoundCond == OtherSideCondModeledExt ) {
+			Tsky = OSCM( surface.OSCMPtr ).TRad;
+			QRadSWOutFD = 0.0; // eliminate incident shortwave on underlying surface
+		} else {
+			Tsky = SkyTemp;
+			QRadSWOutFD = QRadSWOutAbs( Surf );
+		}
+		Real64 const hconvo( HConvExtFD( Surf ) );
+		Real64 const hrad( HAirFD( Surf ) );
+		Real64 const hsky( HSkyFD( Surf ) );
+		Real64 const hgnd( HGrndFD( Surf ) );
+		Real64 const Toa( TempOutsideAirFD( Surf ) );
+		Real64 const Tgnd( TempOutsideAirFD( Surf ) );
+		Real64 const hout( hconvo + hgnd + hrad + hsky );
+		Real64 const QOut( QRadSWOutFD + hgnd * Tgnd + ( hconvo + hrad ) * Toa + hsky * Tsky );
+		Real64 const hconvi( HConvInFD( Surf ) );
+		Real64 const Tia( MAT( surface.Zone ) );
+		Real64 const QIn( NetLWRadToSurf( Surf ) + QHTRadSysSurf( Surf ) + QHWBaseboardSurf( Surf ) + QSteamBaseboardSurf( Surf ) + QElecBaseboardSurf( Surf ) + QRadSWInAbs( Surf ) + QRadThermInAbs( Surf ) + hconvi * Tia );
+
+		int Iter;
+		Real64 MaxDelTemp( 0.0 ); // Largest node temperature change from the last solve
+		for ( Iter = 1; Iter <= MaxGSiter; ++Iter ) {
+			bool VariableProps( false ); // True if any coefficient depends on the node temperatures
+
+			int i( 1 ); //  Node counter, in the order of CalcNodeHeatBalances
+			for ( int Lay = 1; Lay <= TotLayers; ++Lay ) {
+				int const MatLay( construct.LayerPoint( Lay ) );
+				auto const & mat( Material( MatLay ) );
+				bool const RLayerPresent( mat.ROnly || mat.Group == 1 );
+				Real64 const RhoS( mat.Density );
+				Real64 const DelX( constructFD.DelX( Lay ) );
+
+				if ( ( i == 1 ) && ( Lay == 1 ) ) { // Outside face node
+					A( i ) = 0.0;
+					if ( FixedOutsideTemp ) {
+						B( i ) = 1.0;
+						C( i ) = 0.0;
+						D( i ) = Toa;
+					} else if ( RLayerPresent ) {
+						Real64 const Rlayer( mat.Resistance );
+						B( i ) = 1.0 + hout * Rlayer;
+						C( i ) = -1.0;
+						D( i ) = QOut * Rlayer;
+					} else {
+						Real64 const kt( NodeConductivity( MatLay, ( TDT( i ) + TDT( i + 1 ) ) / 2.0, VariableProps ) );
+						Real64 const Cp( NodeSpecHeat( MatLay, TD( i ), TDT( i ), VariableProps ) );
+						Real64 const Two_Delt_DelX( 2.0 * Delt * DelX );
+						Real64 const Two_Delt_kt( 2.0 * Delt * kt );
+						Real64 const Cp_DelX2_RhoS( Cp * pow_2( DelX ) * RhoS );
+						B( i ) = Two_Delt_DelX * hout + Two_Delt_kt + Cp_DelX2_RhoS;
+						C( i ) = -Two_Delt_kt;
+						D( i ) = Two_Delt_DelX * QOut + Cp_DelX2_RhoS * TD( i );
+					}
+				}
+
+				if ( TotNodes != 1 ) { // Layer interior nodes
+					for ( int ctr = 2, ctr_end = constructFD.NodeNumPoint( Lay ); ctr <= ctr_end; ++ctr ) {
+						++i;
+						Real64 const ktA1( NodeConductivity( MatLay, ( TDT( i ) + TDT( i + 1 ) ) / 2.0, VariableProps ) );
+						Real64 const ktA2( NodeConductivity( MatLay, ( TDT( i - 1 ) + TDT( i ) ) / 2.0, VariableProps ) );
+						Real64 const Cp( NodeSpecHeat( MatLay, TD( i ), TDT( i ), VariableProps ) );
+						Real64 const Cp_DelX_RhoS_Delt( Cp * DelX * RhoS / Delt );
+						A( i ) = -ktA2 / DelX;
+						B( i ) = ( ktA1 + ktA2 ) / DelX + Cp_DelX_RhoS_Delt;
+						C( i ) = -ktA1 / DelX;
+						D( i ) = Cp_DelX_RhoS_Delt * TD( i );
+					}
+				}
+
+				if ( ( Lay < TotLayers ) && ( TotNodes != 1 ) ) { // Interface node
+					++i;
+					int const MatLay2( construct.LayerPoint( Lay + 1 ) );
+					auto const & mat2( Material( MatLay2 ) );
+					bool const RLayer2Present( mat2.ROnly || mat2.Group == 1 );
+					Real64 const Rlayer( mat.Resistance );
+					Real64 const Rlayer2( mat2.Resistance );
+					Real64 const QSSFlux( ( surface.Area > 0.0 ) && ( construct.SourceSinkPresent && Lay == construct.SourceAfterLayer ) ? ( QRadSysSource( Surf ) + QPVSysSource( Surf ) ) / surface.Area : 0.0 ); // Source/Sink flux value at a layer interface
+					Real64 const Delt_Delx1( Delt * DelX );
+					Real64 const Delx2( constructFD.DelX( Lay + 1 ) );
+					Real64 const Delt_Delx2( Delt * Delx2 );
+					if ( RLayerPresent && RLayer2Present ) {
+						A( i ) = -Rlayer2;
+						B( i ) = Rlayer + Rlayer2;
+						C( i ) = -Rlayer;
+						D( i ) = 0.0;
+					} else if ( RLayerPresent ) {
+						Real64 const kt2( NodeConductivity( MatLay2, ( TDT( i ) + TDT( i + 1 ) ) / 2.0, VariableProps ) );
+						Real64 const Cp2( NodeSpecHeat( MatLay2, TD( i ), TDT( i ), VariableProps ) );
+						Real64 const Cp2_fac( Cp2 * pow_2( Delx2 ) * mat2.Density * Rlayer );
+						Real64 const Two_Delt_kt2_Rlayer( 2.0 * Delt * kt2 * Rlayer );
+						A( i ) = -2.0 * Delt_Delx2;
+						B( i ) = 2.0 * Delt_Delx2 + Two_Delt_kt2_Rlayer + Cp2_fac;
+						C( i ) = -Two_Delt_kt2_Rlayer;
+						D( i ) = 2.0 * Delt_Delx2 * QSSFlux * Rlayer + Cp2_fac * TD( i );
+					} else if ( RLayer2Present ) {
+						Real64 const kt1( NodeConductivity( MatLay, ( TDT( i ) + TDT( i - 1 ) ) / 2.0, VariableProps ) );
+						Real64 const Cp1( NodeSpecHeat( MatLay, TD( i ), TDT( i ), VariableProps ) );
+						Real64 const Cp1_fac( Cp1 * pow_2( DelX ) * RhoS * Rlayer2 );
+						Real64 const Two_Delt_kt1_Rlayer2( 2.0 * Delt * kt1 * Rlayer2 );
+						A( i ) = -Two_Delt_kt1_Rlayer2;
+						B( i ) = 2.0 * Delt_Delx1 + Two_Delt_kt1_Rlayer2 + Cp1_fac;
+						C( i ) = -2.0 * Delt_Delx1;
+						D( i ) = 2.0 * Delt_Delx1 * QSSFlux * Rlayer2 + Cp1_fac * TD( i );
+					} else {
+						Real64 const kt1( NodeConductivity( MatLay, ( TDT( i ) + TDT( i - 1 ) ) / 2.0, VariableProps ) );
+						Real64 const kt2( NodeConductivity( MatLay2, ( TDT( i ) + TDT( i + 1 ) ) / 2.0, VariableProps ) );
+						Real64 const Cp1( NodeSpecHeat( MatLay, TD( i ), TDT( i ), VariableProps ) );
+						Real64 const Cp2( NodeSpecHeat( MatLay2, TD( i ), TDT( i ), VariableProps ) );
+						Real64 const Cp_fac( Cp1 * pow_2( DelX ) * Delx2 * RhoS + Cp2 * DelX * pow_2( Delx2 ) * mat2.Density );
+						Real64 const Two_Delt_Delx2_kt1( 2.0 * Delt_Delx2 * kt1 );
+						Real64 const Two_Delt_Delx1_kt2( 2.0 * Delt_Delx1 * kt2 );
+						A( i ) = -Two_Delt_Delx2_kt1;
+						B( i ) = Two_Delt_Delx2_kt1 + Two_Delt_Delx1_kt2 + Cp_fac;
+						C( i ) = -Two_Delt_Delx1_kt2;
+						D( i ) = 2.0 * Delt_Delx1 * Delx2 * QSSFlux + Cp_fac * TD( i );
+					}
+				} else if ( Lay == TotLayers ) { // Inside face node
+					++i;
+					C( i ) = 0.0;
+					if ( RLayerPresent ) {
+						Real64 const Rlayer( mat.Resistance );
+						A( i ) = -1.0;
+						B( i ) = 1.0 + ( hconvi + IterDampConst ) * Rlayer;
+						D( i ) = ( QIn + TDreport( i ) * IterDampConst ) * Rlayer;
+					} else {
+						Real64 const kt( NodeConductivity( MatLay, ( TDT( i ) + TDT( i - 1 ) ) / 2.0, VariableProps ) );
+						Real64 const Cp( NodeSpecHeat( MatLay, TD( i ), TDT( i ), VariableProps ) );
+						Real64 const Two_Delt_DelX( 2.0 * Delt * DelX );
+						Real64 const Two_Delt_kt( 2.0 * Delt * kt );
+						Real64 const Cp_DelX2_RhoS( Cp * pow_2( DelX ) * RhoS );
+						A( i ) = -Two_Delt_kt;
+						B( i ) = Two_Delt_DelX * hconvi + Two_Delt_kt + Cp_DelX2_RhoS;
+						D( i ) = Two_Delt_DelX * QIn + Cp_DelX2_RhoS * TD( i );
+					}
+				}
+			} // layer loop
+
+			SolveTridiagonal( N, A, B, C, D );
+
+			MaxDelTemp = 0.0;
+			for ( i = 1; i <= N; ++i ) {
+				Real64 const TDT_i( min( max( D( i ), MinSurfaceTempLimit ), MaxSurfaceTempLimit ) );
+				MaxDelTemp = max( std::abs( TDT_i - TDT( i ) ), MaxDelTemp );
+				TDT( i ) = TDT_i;
+			}
+			if ( ! VariableProps || ( MaxDelTemp < TempTolerance ) ) break;
+		}
+
+		if ( Iter > MaxGSiter && ! WarmupFlag ) { // the temperature dependent properties did not settle
+#ifdef _OPENMP
+#pragma omp critical (ShowErrors)
+#endif
+			{
+				if ( surfaceFD.GSloopErrorCount == 0 ) {
+					ShowWarningMessage( "ConductionFiniteDifference node temperatures did not converge in " + RoundSigDigits( MaxGSiter ) + " iterations for surface=\"" + surface.Name + "\", largest node temperature change=" + RoundSigDigits( MaxDelTemp, 5 ) + " C" );
+					ShowContinueErrorTimeStamp( "" );
+				}
+				ShowRecurringWarningErrorAtEnd( "ConductionFiniteDifference node temperature convergence problem continues for surface=\"" + surface.Name + "\"", surfaceFD.GSloopErrorCount, MaxDelTemp, MaxDelTemp, _, "deltaC", "deltaC" );
+			}
+		}
+
+		return min( Iter, MaxGSiter );
+
+	}
+
+	void
+	SolveTridiagonal(
+		int const N, // Number of equations
+		FArray1< Real64 > const & A, // Sub-diagonal coefficients, A(1) is not used
+		FArray1< Real64 > const & B, // Diagonal coefficients
+		FArray1< Real64 > & C, // Super-diagonal coefficients, C(N) is not used; overwritten
+		FArray1< Real64 > & D // Right hand sides; returns the solution
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Solves the tridiagonal system A(i)*X(i-1) + B(i)*X(i) + C(i)*X(i+1) = D(i), i = 1..N.
+
+		// METHODOLOGY EMPLOYED:
+		// Thomas algorithm: forward elimination followed by back substitution. No pivoting,
+		// which is safe for the diagonally dominant systems of the CondFD node equations.
+
+		C( 1 ) /= B( 1 );
+		D( 1 ) /= B( 1 );
+		for ( int i = 2; i <= N; ++i ) {
+			Real64 const Denom( B( i ) - A( i ) * C( i - 1 ) );
+			C( i ) /= Denom;
+			D( i ) = ( D( i ) - A( i ) * D( i - 1 ) ) / Denom;
+		}
+		for ( int i = N - 1; i >= 1; --i ) {
+			D( i ) -= C( i ) * D( i + 1 );
+		}
+
+	}
+
 	void
 	ReportFiniteDiffInits()
 	{
@@ -1562,18 +1928,9 @@ namespace HeatBalFiniteDiffManager {
 				} else { // Regular or phase change material layer
 
 					// Set Thermal Conductivity. Can be constant, simple linear temp dep or multiple linear segment temp function dep.
-					auto const & matFD_TempCond( matFD.TempCond );
-					assert( matFD_TempCond.u1() >= 3 );
-					auto const lTC( matFD_TempCond.index( 1, 2 ) );
-					Real64 kt;
-					if ( matFD_TempCond[ lTC ] + matFD_TempCond[ lTC+1 ] + matFD_TempCond[ lTC+2 ] >= 0.0 ) { // Multiple Linear Segment Function
-						// Use average temp of surface and first node for k
-						kt = terpld( matFD_TempCond, ( TDT_i + TDT_p ) / 2.0, 1, 2 ); // 1: Temperature, 2: Thermal conductivity
-					} else {
-						kt = mat.Conductivity; // 20C base conductivity
-						Real64 const kt1( matFD.tk1 ); // linear coefficient (normally zero)
-						if ( kt1 != 0.0 ) kt =+ kt1 * ( ( TDT_i + TDT_p ) / 2.0 - 20.0 );
-					}
+					// Use average temp of surface and first node for k, evaluated as for the interior nodes
+					bool VariableProps( false ); // Not needed at the boundary
+					Real64 const kt( NodeConductivity( MatLay, ( TDT_i + TDT_p ) / 2.0, VariableProps ) );
 
 					// Check for phase change material
 					auto const TD_i( TD( i ) );
@@ -2181,18 +2538,9 @@ namespace HeatBalFiniteDiffManager {
 				auto const TDT_m( TDT( i - 1 ) );
 
 				// Set Thermal Conductivity. Can be constant, simple linear temp dep or multiple linear segment temp function dep.
-				auto const & matFD_TempCond( matFD.TempCond );
-				assert( matFD_TempCond.u1() >= 3 );
-				auto const lTC( matFD_TempCond.index( 1, 2 ) );
-				Real64 kt;
-				if ( matFD_TempCond[ lTC ] + matFD_TempCond[ lTC+1 ] + matFD_TempCond[ lTC+2 ] >= 0.0 ) { // Multiple Linear Segment Function
-					// Use average of surface and first node temp for determining k
-					kt = terpld( matFD_TempCond, ( TDT_i + TDT_m ) / 2.0, 1, 2 ); // 1: Temperature, 2: Thermal conductivity
-				} else {
-					kt = mat.Conductivity; // 20C base conductivity
-					Real64 const kt1( matFD.tk1 ); // linear coefficient (normally zero)
-					if ( kt1 != 0.0 ) kt =+ kt1 * ( ( TDT_i + TDT_m ) / 2.0 - 20.0 );
-				}
+				// Use average of surface and first node temp for determining k, evaluated as for the interior nodes
+				bool VariableProps( false ); // Not needed at the boundary
+				Real64 const kt( NodeConductivity( MatLay, ( TDT_i + TDT_m ) / 2.0, VariableProps ) );
 
 				auto const TD_i( TD( i ) );
 				Real64 const Cpo( mat.SpecHeat );
@@ -143,6 +143,10 @@ namespace HeatBalFiniteDiffManager {
 		FArray1D< Real64 > EnthOld; // Current node enthalpy
 		FArray1D< Real64 > EnthNew; // Node enthalpy at new time
 		FArray1D< Real64 > EnthLast;
+		FArray1D< Real64 > CoefA; // Direct solve: coefficient of the temperature of the node before
+		FArray1D< Real64 > CoefB; // Direct solve: coefficient of the node temperature
+		FArray1D< Real64 > CoefC; // Direct solve: coefficient of the temperature of the node after
+		FArray1D< Real64 > CoefD; // Direct solve: right hand side, then solution
 		int GSloopCounter; // count of inner loop iterations
 		int GSloopErrorCount; // recurring error counter
 		Real64 MaxNodeDelTemp; // largest change in node temps after calc
@@ -280,6 +284,50 @@ namespace HeatBalFiniteDiffManager {
 		Real64 & TempSurfOutTmp // Outside Surface Temperature of each Heat Transfer Surface
 	);
 
+	void
+	CalcNodeHeatBalances(
+		int const Delt, // Time Increment
+		int const Surf, // Surface number
+		int const GSiter, // Iteration number of Gauss Seidell iteration
+		Real64 const HMovInsul // Conductance of movable(transparent) insulation.
+	);
+
+	bool
+	DirectSolveApplies(
+		int const Surf, // Surface number
+		Real64 const HMovInsul // Conductance of movable(transparent) insulation.
+	);
+
+	Real64
+	NodeConductivity(
+		int const MatLay, // Material number
+		Real64 const Temp, // Temperature at which the conductivity is evaluated
+		bool & VariableProps // Set to true if the conductivity depends on temperature
+	);
+
+	Real64
+	NodeSpecHeat(
+		int const MatLay, // Material number
+		Real64 const TD_i, // Node temperature at the start of the time step
+		Real64 const TDT_i, // Node temperature at the end of the time step
+		bool & VariableProps // Set to true if the material is a phase change material
+	);
+
+	int
+	CalcNodeTempsDirect(
+		int const Delt, // Time Increment
+		int const Surf // Surface number
+	);
+
+	void
+	SolveTridiagonal(
+		int const N, // Number of equations
+		FArray1< Real64 > const & A, // Sub-diagonal coefficients, A(1) is not used
+		FArray1< Real64 > const & B, // Diagonal coefficients
+		FArray1< Real64 > & C, // Super-diagonal coefficients, C(N) is not used; overwritten
+		FArray1< Real64 > & D // Right hand sides; returns the solution
+	);
+
 	// Beginning of Reporting subroutines
 	// *****************************************************************************
 
@@ -1251,11 +1251,16 @@ namespace HeatBalanceHAMTManager {
 				}
 				if ( std::abs( qvp ) > qvplim ) {
 					if ( ! WarmupFlag ) {
-						++qvpErrCount;
-						if ( qvpErrCount < 16 ) {
-							ShowWarningError( "HeatAndMoistureTransfer: Large Latent Heat for Surface " + Surface( sid ).Name );
-						} else {
-							ShowRecurringWarningErrorAtEnd( "HeatAndMoistureTransfer: Large Latent Heat Errors ", qvpErrReport );
+#ifdef _OPENMP
+#pragma omp critical (ShowErrors)
+#endif
+						{
+							++qvpErrCount;
+							if ( qvpErrCount < 16 ) {
+								ShowWarningError( "HeatAndMoistureTransfer: Large Latent Heat for Surface " + Surface( sid ).Name );
+							} else {
+								ShowRecurringWarningErrorAtEnd( "HeatAndMoistureTransfer: Large Latent Heat Errors ", qvpErrReport );
+							}
 						}
 					}
 					qvp = 0.0;
@@ -1266,38 +1271,50 @@ namespace HeatBalanceHAMTManager {
 			}
 
 			//Check for silly temperatures
-			tempmax = maxval( cells.tempp1() );
-			tempmin = minval( cells.tempp1() );
-			if ( tempmax > MaxSurfaceTempLimit ) {
-				if ( ! WarmupFlag ) {
-					if ( Surface( sid ).HighTempErrCount == 0 ) {
-						ShowSevereMessage( "HAMT: Temperature (high) out of bounds (" + RoundSigDigits( tempmax, 2 ) + ") for surface=" + Surface( sid ).Name );
-						ShowContinueErrorTimeStamp( "" );
-					}
-					ShowRecurringWarningErrorAtEnd( "HAMT: Temperature Temperature (high) out of bounds; Surface=" + Surface( sid ).Name, Surface( sid ).HighTempErrCount, tempmax, tempmax, _, "C", "C" );
-				}
-			}
-			if ( tempmax > MaxSurfaceTempLimitBeforeFatal ) {
-				if ( ! WarmupFlag ) {
-					ShowSevereError( "HAMT: HAMT: Temperature (high) out of bounds ( " + RoundSigDigits( tempmax, 2 ) + ") for surface=" + Surface( sid ).Name );
-					ShowContinueErrorTimeStamp( "" );
-					ShowFatalError( "Program terminates due to preceding condition." );
-				}
+			// Only this surface's cells are checked, so that surfaces can be solved concurrently
+			tempmax = cells( firstcell( sid ) ).tempp1;
+			tempmin = cells( firstcell( sid ) ).tempp1;
+			for ( cid = firstcell( sid ) + 1; cid <= lastcell( sid ); ++cid ) {
+				tempmax = max( tempmax, cells( cid ).tempp1 );
+				tempmin = min( tempmin, cells( cid ).tempp1 );
 			}
-			if ( tempmin < MinSurfaceTempLimit ) {
-				if ( ! WarmupFlag ) {
-					if ( Surface( sid ).HighTempErrCount == 0 ) {
-						ShowSevereMessage( "HAMT: Temperature (low) out of bounds (" + RoundSigDigits( tempmin, 2 ) + ") for surface=" + Surface( sid ).Name );
-						ShowContinueErrorTimeStamp( "" );
+			if ( ( tempmax > MaxSurfaceTempLimit || tempmin < MinSurfaceTempLimit ) && ! WarmupFlag ) {
+#ifdef _OPENMP
+#pragma omp critical (ShowErrors)
+#endif
+				{
+					if ( tempmax > MaxSurfaceTempLimit ) {
+						if ( ! WarmupFlag ) {
+							if ( Surface( sid ).HighTempErrCount == 0 ) {
+								ShowSevereMessage( "HAMT: Temperature (high) out of bounds (" + RoundSigDigits( tempmax, 2 ) + ") for surface=" + Surface( sid ).Name );
+								ShowContinueErrorTimeStamp( "" );
+							}
+							ShowRecurringWarningErrorAtEnd( "HAMT: Temperature Temperature (high) out of bounds; Surface=" + Surface( sid ).Name, Surface( sid ).HighTempErrCount, tempmax, tempmax, _, "C", "C" );
+						}
+					}
+					if ( tempmax > MaxSurfaceTempLimitBeforeFatal ) {
+						if ( ! WarmupFlag ) {
+							ShowSevereError( "HAMT: HAMT: Temperature (high) out of bounds ( " + RoundSigDigits( tempmax, 2 ) + ") for surface=" + Surface( sid ).Name );
+							ShowContinueErrorTimeStamp( "" );
+							ShowFatalError( "Program terminates due to preceding condition." );
+						}
+					}
+					if ( tempmin < MinSurfaceTempLimit ) {
+						if ( ! WarmupFlag ) {
+							if ( Surface( sid ).HighTempErrCount == 0 ) {
+								ShowSevereMessage( "HAMT: Temperature (low) out of bounds (" + RoundSigDigits( tempmin, 2 ) + ") for surface=" + Surface( sid ).Name );
+								ShowContinueErrorTimeStamp( "" );
+							}
+							ShowRecurringWarningErrorAtEnd( "HAMT: Temperature Temperature (high) out of bounds; Surface=" + Surface( sid ).Name, Surface( sid ).HighTempErrCount, tempmin, tempmin, _, "C", "C" );
+						}
+					}
+					if ( tempmin < MinSurfaceTempLimitBeforeFatal ) {
+						if ( ! WarmupFlag ) {
+							ShowSevereError( "HAMT: HAMT: Temperature (low) out of bounds ( " + RoundSigDigits( tempmin, 2 ) + ") for surface=" + Surface( sid ).Name );
+							ShowContinueErrorTimeStamp( "" );
+							ShowFatalError( "Program terminates due to preceding condition." );
+						}
 					}
-					ShowRecurringWarningErrorAtEnd( "HAMT: Temperature Temperature (high) out of bounds; Surface=" + Surface( sid ).Name, Surface( sid ).HighTempErrCount, tempmin, tempmin, _, "C", "C" );
-				}
-			}
-			if ( tempmin < MinSurfaceTempLimitBeforeFatal ) {
-				if ( ! WarmupFlag ) {
-					ShowSevereError( "HAMT: HAMT: Temperature (low) out of bounds ( " + RoundSigDigits( tempmin, 2 ) + ") for surface=" + Surface( sid ).Name );
-					ShowContinueErrorTimeStamp( "" );
-					ShowFatalError( "Program terminates due to preceding condition." );
 				}
 			}
 
@@ -1364,9 +1381,14 @@ namespace HeatBalanceHAMTManager {
 				if ( denominator != 0.0 ) {
 					cells( cid ).rhp1 = ( phiorsum + vporsum + ( wcap * cells( cid ).rh ) / deltat ) / denominator;
 				} else {
-					ShowSevereError( "CalcHeatBalHAMT: demoninator in calculating RH is zero.  Check material properties for accuracy." );
-					ShowContinueError( "...Problem occurs in Material=\"" + Material( cells( cid ).matid ).Name + "\"." );
-					ShowFatalError( "Program terminates due to preceding condition." );
+#ifdef _OPENMP
+#pragma omp critical (ShowErrors)
+#endif
+					{
+						ShowSevereError( "CalcHeatBalHAMT: demoninator in calculating RH is zero.  Check material properties for accuracy." );
+						ShowContinueError( "...Problem occurs in Material=\"" + Material( cells( cid ).matid ).Name + "\"." );
+						ShowFatalError( "Program terminates due to preceding condition." );
+					}
 				}
 
 				if ( cells( cid ).rhp1 > rhmax ) {
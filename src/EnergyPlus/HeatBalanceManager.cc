@@ -47,6 +47,7 @@
 #include <SolarShading.hh>
 #include <SurfaceGeometry.hh>
 #include <UtilityRoutines.hh>
+#include <WarmupSnapshot.hh>
 #include <WindowComplexManager.hh>
 #include <WindowEquivalentLayer.hh>
 #include <WindowManager.hh>
@@ -123,7 +124,11 @@ namespace HeatBalanceManager {
 	using DataContaminantBalance::OutdoorGC;
 	using ScheduleManager::GetCurrentScheduleValue;
 	using WindowComplexManager::CalculateBasisLength;
+	using WindowComplexManager::CompressBSDFMatrix;
 	using DataWindowEquivalentLayer::TotWinEquivLayerConstructs;
+	using WarmupSnapshot::InitWarmupSnapshot;
+	using WarmupSnapshot::SaveWarmupSnapshot;
+	using WarmupSnapshot::WarmupStateRestored;
 
 	// Data
 	// MODULE PARAMETER DEFINITIONS
@@ -268,6 +273,7 @@ namespace HeatBalanceManager {
 
 			CheckWarmupConvergence();
 			if ( ! WarmupFlag ) {
+				SaveWarmupSnapshot(); // Keep the warmed-up state if a snapshot file was requested
 				DayOfSim = 0; // Reset DayOfSim if Warmup converged
 				DayOfSimChr = "0";
 
@@ -4426,6 +4432,8 @@ namespace HeatBalanceManager {
 			SurfaceWindow.ThetaFace() = 296.15;
 			SurfaceWindow.EffInsSurfTemp() = 23.0;
 
+			InitWarmupSnapshot(); // Start from a saved warmup state if one was requested and matches the model
+
 		}
 
 		if ( TotStormWin > 0 ) {
@@ -4858,8 +4866,9 @@ namespace HeatBalanceManager {
 			}
 
 			// Set warmup flag to true depending on value of ConvergenceChecksFailed (true=fail)
-			// and minimum number of warmup days
-			if ( ! ConvergenceChecksFailed && DayOfSim >= MinNumberOfWarmupDays ) {
+			// and minimum number of warmup days.  An environment started from a saved warmup
+			// state only has to show it is still converged.
+			if ( ! ConvergenceChecksFailed && ( DayOfSim >= MinNumberOfWarmupDays || WarmupStateRestored ) ) {
 				WarmupFlag = false;
 			} else if ( ! ConvergenceChecksFailed && DayOfSim < MinNumberOfWarmupDays ) {
 				WarmupFlag = true;
@@ -7629,6 +7638,7 @@ Label1000: ;
 					ShowContinueError( "Solar back reflectance Matrix:TwoDimension = \"" + locAlphaArgs( 7 ) + "\" is missing from the input file." );
 				} else {
 					Get2DMatrix( Construct( ConstrNum ).BSDFInput.SolBkReflIndex, Construct( ConstrNum ).BSDFInput.SolBkRefl );
+					CompressBSDFMatrix( Construct( ConstrNum ).BSDFInput.SolBkRefl, Construct( ConstrNum ).BSDFInput.SolBkReflSparse );
 				}
 
 				// *******************************************************************************
@@ -7658,6 +7668,7 @@ Label1000: ;
 					ShowContinueError( "Visible front transmittance Matrix:TwoDimension = \"" + locAlphaArgs( 8 ) + "\" is missing from the input file." );
 				} else {
 					Get2DMatrix( Construct( ConstrNum ).BSDFInput.VisFrtTransIndex, Construct( ConstrNum ).BSDFInput.VisFrtTrans );
+					CompressBSDFMatrix( Construct( ConstrNum ).BSDFInput.VisFrtTrans, Construct( ConstrNum ).BSDFInput.VisFrtTransSparse );
 				}
 
 				// *******************************************************************************
@@ -7687,6 +7698,7 @@ Label1000: ;
 					ShowContinueError( "Visble back reflectance Matrix:TwoDimension = \"" + locAlphaArgs( 9 ) + "\" is missing from the input file." );
 				} else {
 					Get2DMatrix( Construct( ConstrNum ).BSDFInput.VisBkReflIndex, Construct( ConstrNum ).BSDFInput.VisBkRefl );
+					CompressBSDFMatrix( Construct( ConstrNum ).BSDFInput.VisBkRefl, Construct( ConstrNum ).BSDFInput.VisBkReflSparse );
 				}
 
 				//ALLOCATE(Construct(ConstrNum)%BSDFInput%Layer(NumOfOpticalLayers))
@@ -7831,6 +7843,7 @@ Label1000: ;
 					for ( I = 1; I <= NBasis; ++I ) {
 						Construct( ConstrNum ).BSDFInput.SolBkRefl( I, I ) = BSDFTempMtrx( 1, I );
 					}
+					CompressBSDFMatrix( Construct( ConstrNum ).BSDFInput.SolBkRefl, Construct( ConstrNum ).BSDFInput.SolBkReflSparse );
 				}
 
 				// *******************************************************************************
@@ -7864,6 +7877,7 @@ Label1000: ;
 					for ( I = 1; I <= NBasis; ++I ) {
 						Construct( ConstrNum ).BSDFInput.VisFrtTrans( I, I ) = BSDFTempMtrx( 1, I );
 					}
+					CompressBSDFMatrix( Construct( ConstrNum ).BSDFInput.VisFrtTrans, Construct( ConstrNum ).BSDFInput.VisFrtTransSparse );
 				}
 
 				// *******************************************************************************
@@ -7897,6 +7911,7 @@ Label1000: ;
 					for ( I = 1; I <= NBasis; ++I ) {
 						Construct( ConstrNum ).BSDFInput.VisBkRefl( I, I ) = BSDFTempMtrx( 1, I );
 					}
+					CompressBSDFMatrix( Construct( ConstrNum ).BSDFInput.VisBkRefl, Construct( ConstrNum ).BSDFInput.VisBkReflSparse );
 				}
 
 				//determine number of layers
@@ -67,6 +67,7 @@
 #include <SwimmingPool.hh>
 #include <ThermalComfort.hh>
 #include <UtilityRoutines.hh>
+#include <WarmupSnapshot.hh>
 #include <WindowEquivalentLayer.hh>
 #include <WindowManager.hh>
 
@@ -292,6 +293,7 @@ namespace HeatBalanceSurfaceManager {
 		using HeatBalFiniteDiffManager::InitHeatBalFiniteDiff;
 		using DataSystemVariables::GoodIOStatValue;
 		using DataGlobals::AnyEnergyManagementSystemInModel;
+		using WarmupSnapshot::RestoreSurfaceHistories;
 		// RJH DElight Modification Begin
 		using namespace DElightManagerF;
 		// RJH DElight Modification End
@@ -385,6 +387,7 @@ namespace HeatBalanceSurfaceManager {
 		// Do the Begin Simulation initializations
 		if ( BeginSimFlag ) {
 			AllocateSurfaceHeatBalArrays(); // Allocate the Module Arrays before any inits take place
+			SetupZoneCouplingGroups();
 			InterZoneWindow = any( Zone.HasInterZoneWindow() );
 			IsZoneDV.dimension( NumOfZones, false );
 			IsZoneCV.dimension( NumOfZones, false );
@@ -395,6 +398,7 @@ namespace HeatBalanceSurfaceManager {
 		if ( BeginEnvrnFlag ) {
 			if ( firstTime ) DisplayString( "Initializing Temperature and Flux Histories" );
 			InitThermalAndFluxHistories(); // Set initial temperature and flux histories
+			RestoreSurfaceHistories(); // Replace them with a saved warmup state, if one applies
 		}
 
 		// There are no daily initializations done in this portion of the surface heat balance
@@ -3630,6 +3634,125 @@ namespace HeatBalanceSurfaceManager {
 
 	}
 
+	void
+	SetupZoneCouplingGroups()
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Finds the groups of zones that are coupled to each other through interzone
+		// surfaces and reports how the building breaks up into these groups.
+
+		// METHODOLOGY EMPLOYED:
+		// Each heat transfer surface whose other side is a surface in another zone links
+		// the two zones.  The links are followed until every zone has a group number;
+		// the inside surface heat balances of zones in different groups do not interact
+		// and may be iterated independently.  Groups are numbered in zone order.  The
+		// groups are only reported when they are used or advanced output is requested.
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		using General::RoundSigDigits;
+		using DataSystemVariables::ZoneCouplingGroupSolve;
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+		// na
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		static gio::Fmt Format_720( "('! <Zone Coupling Groups>, Number of Groups, Number of Zones, Largest Group [Zones], Single Zone Groups, Interzone Surface Pairs')" );
+		static gio::Fmt Format_721( "('Zone Coupling Groups, ',A,', ',A,', ',A,', ',A,', ',A)" );
+		static gio::Fmt Format_722( "('! <Zone Coupling Group>, Group Number, Number of Zones, First Zone Name')" );
+		static gio::Fmt Format_723( "('Zone Coupling Group, ',A,', ',A,', ',A)" );
+
+		// INTERFACE BLOCK SPECIFICATIONS:
+		// na
+
+		// DERIVED TYPE DEFINITIONS:
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int ZoneNum;
+		int SurfNum;
+		int OtherSurfNum; // Surface on the other side of an interzone surface
+		int OtherZoneNum;
+		int GroupNum;
+		int NumInterzonePairs; // Interzone surface pairs joining two different zones
+		int NumSingleZoneGroups;
+		int LargestGroup;
+		bool GroupChanged; // true while group numbers are still being merged
+		FArray1D_int GroupNumZones; // Number of zones in each group
+		FArray1D_int GroupFirstZone; // Lowest zone number in each group
+
+		NumZoneCouplingGroups = 0;
+		if ( NumOfZones <= 0 ) return;
+
+		ZoneCouplingGroupNum.allocate( NumOfZones );
+		for ( ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum ) {
+			ZoneCouplingGroupNum( ZoneNum ) = ZoneNum;
+		}
+
+		// coupled zones take the lowest zone number in their group as the group label
+		GroupChanged = true;
+		while ( GroupChanged ) {
+			GroupChanged = false;
+			for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+				auto const & surface( Surface( SurfNum ) );
+				if ( ! surface.HeatTransSurf ) continue;
+				OtherSurfNum = surface.ExtBoundCond;
+				if ( OtherSurfNum <= 0 || OtherSurfNum == SurfNum ) continue;
+				ZoneNum = surface.Zone;
+				OtherZoneNum = Surface( OtherSurfNum ).Zone;
+				if ( ZoneNum <= 0 || OtherZoneNum <= 0 || ZoneNum == OtherZoneNum ) continue;
+				if ( ZoneCouplingGroupNum( OtherZoneNum ) < ZoneCouplingGroupNum( ZoneNum ) ) {
+					ZoneCouplingGroupNum( ZoneNum ) = ZoneCouplingGroupNum( OtherZoneNum );
+					GroupChanged = true;
+				} else if ( ZoneCouplingGroupNum( ZoneNum ) < ZoneCouplingGroupNum( OtherZoneNum ) ) {
+					ZoneCouplingGroupNum( OtherZoneNum ) = ZoneCouplingGroupNum( ZoneNum );
+					GroupChanged = true;
+				}
+			}
+		}
+
+		// renumber the group labels 1 to NumZoneCouplingGroups
+		for ( ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum ) {
+			if ( ZoneCouplingGroupNum( ZoneNum ) == ZoneNum ) {
+				++NumZoneCouplingGroups;
+				ZoneCouplingGroupNum( ZoneNum ) = NumZoneCouplingGroups;
+			} else {
+				ZoneCouplingGroupNum( ZoneNum ) = ZoneCouplingGroupNum( ZoneCouplingGroupNum( ZoneNum ) );
+			}
+		}
+
+		if ( ! ZoneCouplingGroupSolve && ! DisplayAdvancedReportVariables ) return;
+
+		NumInterzonePairs = 0;
+		for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+			OtherSurfNum = Surface( SurfNum ).ExtBoundCond;
+			if ( ! Surface( SurfNum ).HeatTransSurf || OtherSurfNum <= SurfNum ) continue;
+			if ( Surface( SurfNum ).Zone > 0 && Surface( OtherSurfNum ).Zone > 0 && Surface( SurfNum ).Zone != Surface( OtherSurfNum ).Zone ) ++NumInterzonePairs;
+		}
+
+		GroupNumZones.dimension( NumZoneCouplingGroups, 0 );
+		GroupFirstZone.dimension( NumZoneCouplingGroups, 0 );
+		for ( ZoneNum = NumOfZones; ZoneNum >= 1; --ZoneNum ) {
+			GroupNum = ZoneCouplingGroupNum( ZoneNum );
+			++GroupNumZones( GroupNum );
+			GroupFirstZone( GroupNum ) = ZoneNum;
+		}
+		LargestGroup = maxval( GroupNumZones );
+		NumSingleZoneGroups = count( GroupNumZones == 1 );
+
+		gio::write( OutputFileInits, Format_720 );
+		gio::write( OutputFileInits, Format_721 ) << RoundSigDigits( NumZoneCouplingGroups ) << RoundSigDigits( NumOfZones ) << RoundSigDigits( LargestGroup ) << RoundSigDigits( NumSingleZoneGroups ) << RoundSigDigits( NumInterzonePairs );
+		gio::write( OutputFileInits, Format_722 );
+		for ( GroupNum = 1; GroupNum <= NumZoneCouplingGroups; ++GroupNum ) {
+			gio::write( OutputFileInits, Format_723 ) << RoundSigDigits( GroupNum ) << RoundSigDigits( GroupNumZones( GroupNum ) ) << Zone( GroupFirstZone( GroupNum ) ).Name;
+		}
+
+	}
+
 	// End Initialization Section of the Module
 	//******************************************************************************
 
@@ -4844,6 +4967,8 @@ CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate ) // if passed in
 	using namespace DataTimings;
 	using WindowEquivalentLayer::EQLWindowOutsideEffectiveEmiss;
 	using SwimmingPool::SimSwimmingPool;
+	using DataSystemVariables::ZoneCouplingGroupSolve;
+	using DataSystemVariables::ParallelCondFDHAMT;
 
 	// Locals
 	// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -4915,6 +5040,12 @@ CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate ) // if passed in
 	int OtherSideZoneNum; // Zone Number index for other side of an interzone partition HAMT
 	static int WarmupSurfTemp;
 	static int TimeStepInDay( 0 ); // time step number
+	Real64 SurfDelTemp; // Change in an opaque surface temperature from one iteration to the next
+	static FArray1D_bool GroupConverged; // .TRUE. once a zone coupling group has converged
+	static FArray1D< Real64 > GroupMaxDelTemp; // Maximum change in surface temperature within each zone coupling group
+	static FArray1D_bool SolveFDHAMTAhead; // .TRUE. for CondFD and HAMT surfaces that may be solved concurrently
+	static FArray1D< Real64 > TempSurfOutFDHAMT; // Outside face temperatures of the surfaces solved concurrently
+	static std::vector< int > SurfFDHAMT; // Surfaces solved concurrently in the current iteration
 
 	// FLOW:
 	if ( firstTime ) {
@@ -4928,6 +5059,21 @@ CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate ) // if passed in
 		if ( DisplayAdvancedReportVariables ) {
 			SetupOutputVariable( "Surface Inside Face Heat Balance Calculation Iteration Count []", InsideSurfIterations, "ZONE", "Sum", "Simulation" );
 		}
+		// CondFD and HAMT surfaces only touch their own node and cell state, except interzone CondFD surfaces
+		// (which update the other side) and surfaces with movable insulation, so the rest may be solved concurrently
+		SolveFDHAMTAhead.dimension( TotSurfaces, false );
+		TempSurfOutFDHAMT.dimension( TotSurfaces, 0.0 );
+		for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+			auto const & surface( Surface( SurfNum ) );
+			if ( ! surface.HeatTransSurf || surface.Zone == 0 ) continue;
+			if ( surface.Class == SurfaceClass_Window || surface.Class == SurfaceClass_TDD_Dome ) continue;
+			if ( surface.MaterialMovInsulInt > 0 || surface.MaterialMovInsulExt > 0 ) continue;
+			if ( surface.HeatTransferAlgorithm == HeatTransferModel_HAMT ) {
+				SolveFDHAMTAhead( SurfNum ) = true;
+			} else if ( surface.HeatTransferAlgorithm == HeatTransferModel_CondFD ) {
+				SolveFDHAMTAhead( SurfNum ) = ( surface.ExtBoundCond <= 0 || surface.ExtBoundCond == SurfNum );
+			}
+		}
 	}
 	if ( BeginEnvrnFlag && MyEnvrnFlag ) {
 		TempInsOld = 23.0;
@@ -5057,12 +5203,33 @@ CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate ) // if passed in
 	}
 
 	bool const useCondFDHTalg( any_eq( HeatTransferAlgosUsed, UseCondFD ) );
+
+	// Groups of zones that are not coupled through interzone surfaces may stop iterating once they converge
+	bool const GroupSolve( ZoneCouplingGroupSolve && ! PartialResimulate && NumZoneCouplingGroups > 1 );
+	if ( GroupSolve ) {
+		if ( GroupConverged.size() != static_cast< FArray1D_bool::size_type >( NumZoneCouplingGroups ) ) {
+			GroupConverged.dimension( NumZoneCouplingGroups );
+			GroupMaxDelTemp.dimension( NumZoneCouplingGroups );
+		}
+		GroupConverged = false;
+	}
+
+	// The first call reads the CondFD and HAMT input, so it is always serial
+	bool const ParallelFDHAMT( ParallelCondFDHAMT && ! firstTime );
+
 	Converged = false;
 	while ( ! Converged ) { // Start of main inside heat balance DO loop...
 
 		TempInsOld = TempSurfIn; // Keep track of last iteration's temperature values
 
-		CalcInteriorRadExchange( TempSurfIn, InsideSurfIterations, NetLWRadToSurf, ZoneToResimulate, Inside ); // Update the radiation balance
+		if ( GroupSolve && InsideSurfIterations > 0 && any( GroupConverged ) ) { // Update the radiation balance of unconverged groups only
+			for ( int iZone = 1; iZone <= NumOfZones; ++iZone ) {
+				if ( GroupConverged( ZoneCouplingGroupNum( iZone ) ) ) continue;
+				CalcInteriorRadExchange( TempSurfIn, InsideSurfIterations, NetLWRadToSurf, iZone, Inside );
+			}
+		} else {
+			CalcInteriorRadExchange( TempSurfIn, InsideSurfIterations, NetLWRadToSurf, ZoneToResimulate, Inside ); // Update the radiation balance
+		}
 
 		// Every 30 iterations, recalculate the inside convection coefficients in case
 		// there has been a significant drift in the surface temperatures predicted.
@@ -5072,6 +5239,39 @@ CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate ) // if passed in
 		// times before the iteration limit is hit.
 		if ( ( InsideSurfIterations > 0 ) && ( mod( InsideSurfIterations, ItersReevalConvCoeff ) == 0 ) ) {
 			InitInteriorConvectionCoeffs( TempSurfIn, ZoneToResimulate );
+			if ( GroupSolve ) GroupConverged = false; // All surfaces see the new coefficients
+		}
+
+		if ( ParallelFDHAMT ) { // Solve the independent CondFD and HAMT surfaces concurrently ahead of the surface loop
+			SurfFDHAMT.clear();
+			for ( std::vector< int >::size_type iSurfToResimulate = 0u; iSurfToResimulate < nSurfToResimulate; ++iSurfToResimulate ) {
+				SurfNum = SurfToResimulate[ iSurfToResimulate ];
+				if ( ! SolveFDHAMTAhead( SurfNum ) ) continue;
+				ZoneNum = Surface( SurfNum ).Zone;
+				if ( GroupSolve && GroupConverged( ZoneCouplingGroupNum( ZoneNum ) ) ) continue;
+				Real64 const MAT_zone( MAT( ZoneNum ) );
+				Real64 const ZoneAirHumRat_zone( max( ZoneAirHumRat( ZoneNum ), 1.0e-5 ) );
+				HConvInFD( SurfNum ) = HConvIn( SurfNum );
+				RhoVaporAirIn( SurfNum ) = min( PsyRhovFnTdbWPb_fast( MAT_zone, ZoneAirHumRat_zone, OutBaroPress ), PsyRhovFnTdbRh( MAT_zone, 1.0, HBSurfManInsideSurf ) );
+				HMassConvInFD( SurfNum ) = HConvIn( SurfNum ) / ( ( PsyRhoAirFnPbTdbW_fast( OutBaroPress, MAT_zone, ZoneAirHumRat_zone ) + RhoVaporAirIn( SurfNum ) ) * PsyCpAirFnWTdb_fast( ZoneAirHumRat_zone, MAT_zone ) );
+				if ( Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_HAMT && Surface( SurfNum ).ExtBoundCond > 0 && Surface( SurfNum ).ExtBoundCond != SurfNum ) {
+					// HAMT get the correct other side zone zone air temperature --
+					TempOutsideAirFD( SurfNum ) = MAT( Surface( Surface( SurfNum ).ExtBoundCond ).Zone );
+				}
+				SurfFDHAMT.push_back( SurfNum );
+			}
+			int const nSurfFDHAMT( SurfFDHAMT.size() );
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+			for ( int iSurfFDHAMT = 0; iSurfFDHAMT < nSurfFDHAMT; ++iSurfFDHAMT ) {
+				int const SurfNumFDHAMT( SurfFDHAMT[ iSurfFDHAMT ] );
+				if ( Surface( SurfNumFDHAMT ).HeatTransferAlgorithm == HeatTransferModel_HAMT ) {
+					ManageHeatBalHAMT( SurfNumFDHAMT, TempSurfInTmp( SurfNumFDHAMT ), TempSurfOutFDHAMT( SurfNumFDHAMT ) );
+				} else {
+					ManageHeatBalFiniteDiff( SurfNumFDHAMT, TempSurfInTmp( SurfNumFDHAMT ), TempSurfOutFDHAMT( SurfNumFDHAMT ) );
+				}
+			}
 		}
 
 		for ( std::vector< int >::size_type iSurfToResimulate = 0u; iSurfToResimulate < nSurfToResimulate; ++iSurfToResimulate ) { // Perform a heat balance on all of the relevant inside surfaces...
@@ -5080,6 +5280,7 @@ CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate ) // if passed in
 			if ( ! surface.HeatTransSurf ) continue; // Skip non-heat transfer surfaces
 			if ( surface.Class == SurfaceClass_TDD_Dome ) continue; // Skip TDD:DOME objects.  Inside temp is handled by TDD:DIFFUSER.
 			if ( ( ZoneNum = surface.Zone ) == 0 ) continue; // Skip non-heat transfer surfaces
+			if ( GroupSolve && GroupConverged( ZoneCouplingGroupNum( ZoneNum ) ) ) continue; // Skip surfaces of converged groups
 
 			Real64 & TH11( TH( SurfNum, 1, 1 )  );
 			Real64 & TH12( TH( SurfNum, 1, 2 )  );
@@ -5093,9 +5294,12 @@ CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate ) // if passed in
 			// Calculate the inside surface moisture quantities
 			// calculate the inside surface moisture transfer conditions
 			// check for saturation conditions of air
+			bool const SolvedAhead( ParallelFDHAMT && SolveFDHAMTAhead( SurfNum ) ); // CondFD or HAMT surface already solved above
 			Real64 const HConvIn_surf( HConvInFD( SurfNum ) = HConvIn( SurfNum ) );
-			RhoVaporAirIn( SurfNum ) = min( PsyRhovFnTdbWPb_fast( MAT_zone, ZoneAirHumRat_zone, OutBaroPress ), PsyRhovFnTdbRh( MAT_zone, 1.0, HBSurfManInsideSurf ) );
-			HMassConvInFD( SurfNum ) = HConvIn_surf / ( ( PsyRhoAirFnPbTdbW_fast( OutBaroPress, MAT_zone, ZoneAirHumRat_zone ) + RhoVaporAirIn( SurfNum ) ) * PsyCpAirFnWTdb_fast( ZoneAirHumRat_zone, MAT_zone ) );
+			if ( ! SolvedAhead ) { // HAMT may have replaced the mass transfer coefficient
+				RhoVaporAirIn( SurfNum ) = min( PsyRhovFnTdbWPb_fast( MAT_zone, ZoneAirHumRat_zone, OutBaroPress ), PsyRhovFnTdbRh( MAT_zone, 1.0, HBSurfManInsideSurf ) );
+				HMassConvInFD( SurfNum ) = HConvIn_surf / ( ( PsyRhoAirFnPbTdbW_fast( OutBaroPress, MAT_zone, ZoneAirHumRat_zone ) + RhoVaporAirIn( SurfNum ) ) * PsyCpAirFnWTdb_fast( ZoneAirHumRat_zone, MAT_zone ) );
+			}
 
 			// Perform heat balance on the inside face of the surface ...
 			// The following are possibilities here:
@@ -5150,9 +5354,13 @@ CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate ) // if passed in
 
 				} else if ( surface.HeatTransferAlgorithm == HeatTransferModel_CondFD || surface.HeatTransferAlgorithm == HeatTransferModel_HAMT ) {
 
-					if ( surface.HeatTransferAlgorithm == HeatTransferModel_HAMT ) ManageHeatBalHAMT( SurfNum, TempSurfInTmp( SurfNum ), TempSurfOutTmp ); //HAMT
+					if ( SolvedAhead ) {
+						TempSurfOutTmp = TempSurfOutFDHAMT( SurfNum );
+					} else {
+						if ( surface.HeatTransferAlgorithm == HeatTransferModel_HAMT ) ManageHeatBalHAMT( SurfNum, TempSurfInTmp( SurfNum ), TempSurfOutTmp ); //HAMT
 
-					if ( surface.HeatTransferAlgorithm == HeatTransferModel_CondFD ) ManageHeatBalFiniteDiff( SurfNum, TempSurfInTmp( SurfNum ), TempSurfOutTmp );
+						if ( surface.HeatTransferAlgorithm == HeatTransferModel_CondFD ) ManageHeatBalFiniteDiff( SurfNum, TempSurfInTmp( SurfNum ), TempSurfOutTmp );
+					}
 
 					TH11 = TempSurfOutTmp;
 
@@ -5220,7 +5428,9 @@ CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate ) // if passed in
 
 						} else if ( surface.HeatTransferAlgorithm == HeatTransferModel_CondFD || surface.HeatTransferAlgorithm == HeatTransferModel_HAMT ) {
 
-							if ( surface.HeatTransferAlgorithm == HeatTransferModel_HAMT ) {
+							if ( SolvedAhead ) {
+								TempSurfOutTmp = TempSurfOutFDHAMT( SurfNum );
+							} else if ( surface.HeatTransferAlgorithm == HeatTransferModel_HAMT ) {
 								if ( surface.ExtBoundCond > 0 ) {
 									// HAMT get the correct other side zone zone air temperature --
 									OtherSideSurfNum = surface.ExtBoundCond;
@@ -5229,10 +5439,10 @@ CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate ) // if passed in
 									TempOutsideAirFD( SurfNum ) = MAT( OtherSideZoneNum );
 								}
 								ManageHeatBalHAMT( SurfNum, TempSurfInTmp( SurfNum ), TempSurfOutTmp );
+							} else if ( surface.HeatTransferAlgorithm == HeatTransferModel_CondFD ) {
+								ManageHeatBalFiniteDiff( SurfNum, TempSurfInTmp( SurfNum ), TempSurfOutTmp );
 							}
 
-							if ( surface.HeatTransferAlgorithm == HeatTransferModel_CondFD ) ManageHeatBalFiniteDiff( SurfNum, TempSurfInTmp( SurfNum ), TempSurfOutTmp );
-
 							TH11 = TempSurfOutTmp;
 
 						}
@@ -5536,6 +5746,7 @@ CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate ) // if passed in
 			// not be the surface itself (which is just a simple partition)
 			int const surfExtBoundCond( Surface( SurfNum ).ExtBoundCond );
 			if ( ( surfExtBoundCond > 0 ) && ( surfExtBoundCond != SurfNum ) ) {
+				if ( GroupSolve && GroupConverged( ZoneCouplingGroupNum( Surface( SurfNum ).Zone ) ) ) continue;
 				// Set the outside surface temperature to the inside surface temperature
 				// of the interzone pair and reassign the reporting variable.  By going
 				// through all of the surfaces, this should pick up the other side as well
@@ -5548,18 +5759,23 @@ CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate ) // if passed in
 
 		// Convergence check
 		MaxDelTemp = 0.0;
+		if ( GroupSolve ) GroupMaxDelTemp = 0.0;
 		for ( std::vector< int >::size_type iSurfToResimulate = 0u; iSurfToResimulate < nSurfToResimulate; ++iSurfToResimulate ) { // Loop through all relevant surfaces to check for convergence...
 			SurfNum = SurfToResimulate[ iSurfToResimulate ];
 
 			if ( ! Surface( SurfNum ).HeatTransSurf ) continue; // Skip non-heat transfer surfaces
+			ZoneNum = Surface( SurfNum ).Zone;
+			if ( GroupSolve && GroupConverged( ZoneCouplingGroupNum( ZoneNum ) ) ) continue;
 
 			ConstrNum = Surface( SurfNum ).Construction;
 			if ( Construct( ConstrNum ).TransDiff <= 0.0 ) { // Opaque surface
-				MaxDelTemp = max( std::abs( TempSurfIn( SurfNum ) - TempInsOld( SurfNum ) ), MaxDelTemp );
+				SurfDelTemp = std::abs( TempSurfIn( SurfNum ) - TempInsOld( SurfNum ) );
 				if ( Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_CondFD ) {
 					// also check all internal nodes as well as surface faces
-					MaxDelTemp = max( MaxDelTemp, SurfaceFD( SurfNum ).MaxNodeDelTemp );
+					SurfDelTemp = max( SurfDelTemp, SurfaceFD( SurfNum ).MaxNodeDelTemp );
 				}
+				MaxDelTemp = max( MaxDelTemp, SurfDelTemp );
+				if ( GroupSolve ) GroupMaxDelTemp( ZoneCouplingGroupNum( ZoneNum ) ) = max( GroupMaxDelTemp( ZoneCouplingGroupNum( ZoneNum ) ), SurfDelTemp );
 			}
 
 		} // ...end of loop to check for convergence
@@ -5593,6 +5809,13 @@ CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate ) // if passed in
 
 		if ( InsideSurfIterations < MinIterations ) Converged = false;
 
+		// Groups that have settled keep their surface temperatures for the rest of this call
+		if ( GroupSolve && ! Converged && InsideSurfIterations >= MinIterations ) {
+			for ( int GroupNum = 1; GroupNum <= NumZoneCouplingGroups; ++GroupNum ) {
+				if ( GroupMaxDelTemp( GroupNum ) <= ( useCondFDHTalg ? MaxAllowedDelTempCondFD : MaxAllowedDelTemp ) ) GroupConverged( GroupNum ) = true;
+			}
+		}
+
 		if ( InsideSurfIterations > MaxIterations ) {
 			if ( ! WarmupFlag ) {
 				++ErrCount;
@@ -6039,11 +6262,15 @@ GatherComponentLoadsSurfAbsFact()
 	using DataSizing::CurOverallSimDay;
 	using DataHeatBalance::TMULT;
 	using DataHeatBalance::ITABSF;
+	using DataHeatBalance::HConvIn;
+	using DataHeatBalSurface::TempSurfIn;
 	using DataSurfaces::TotSurfaces;
 	using DataSurfaces::Surface;
 	using DataSurfaces::SurfaceClass_TDD_Dome;
 	using OutputReportTabular::ITABSFseq;
 	using OutputReportTabular::TMULTseq;
+	using OutputReportTabular::HConvInAtPulse;
+	using OutputReportTabular::TempSurfInAtPulse;
 
 	// Locals
 	// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -6073,6 +6300,11 @@ GatherComponentLoadsSurfAbsFact()
 			if ( ! Surface( jSurf ).HeatTransSurf || iZone == 0 ) continue; // Skip non-heat transfer surfaces
 			if ( Surface( jSurf ).Class == SurfaceClass_TDD_Dome ) continue; // Skip tubular daylighting device domes
 			ITABSFseq( jSurf, TimeStepInDay, CurOverallSimDay ) = ITABSF( jSurf );
+			// the conditions the decay curves are linearized about when they are computed from the CTFs
+			if ( HourOfDay == 10 && TimeStep == 1 ) { // time step of the pulse of the zone sizing run
+				HConvInAtPulse( jSurf, CurOverallSimDay ) = HConvIn( jSurf );
+				TempSurfInAtPulse( jSurf, CurOverallSimDay ) = TempSurfIn( jSurf );
+			}
 		}
 	}
 }
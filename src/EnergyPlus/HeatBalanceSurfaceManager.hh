@@ -76,6 +76,9 @@ namespace HeatBalanceSurfaceManager {
 	void
 	InitEMSControlledConstructions();
 
+	void
+	SetupZoneCouplingGroups();
+
 	// End Initialization Section of the Module
 	//******************************************************************************
 
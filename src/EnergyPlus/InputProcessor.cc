@@ -132,6 +132,7 @@ namespace InputProcessor {
 	int TotalAuditErrors( 0 ); // Counting some warnings that go onto only the audit file
 	int NumSecretObjects( 0 ); // Number of objects in "Secret Mode"
 	bool ProcessingIDD( false ); // True when processing IDD, false when processing IDF
+	bool DataDictionaryProcessed( false ); // True once the IDD has been read, e.g. ahead of the jobs of a batch run
 	std::ostream * echo_stream( nullptr ); // Internal stream used for input file echoing (used for performance)
 
 	//Real Variables for Module
@@ -202,7 +203,6 @@ namespace InputProcessor {
 		// na
 
 		// Using/Aliasing
-		using SortAndStringUtilities::SetupAndSort;
 		using DataOutputs::iNumberOfRecords;
 		using DataOutputs::iNumberOfDefaultedFields;
 		using DataOutputs::iTotalFieldsWithDefaults;
@@ -261,43 +261,16 @@ namespace InputProcessor {
 			ShowFatalError( "ProcessInput: Could not open file " + outputIperrFileName + " for output (write)." );
 		}
 
-		std::ifstream idd_stream( inputIddFileName, std::ios_base::in | std::ios_base::binary );
-		if ( ! idd_stream ) {
-			if ( idd_stream.is_open() ) idd_stream.close();
-			if ( ! gio::file_exists( inputIddFileName ) ) { // No such file
-				ShowFatalError( "ProcessInput: Energy+.idd missing. Program terminates. Fullname=" + inputIddFileName );
-			} else {
-				ShowFatalError( "ProcessInput: Could not open file \"" + inputIddFileName + "\" for input (read)." );
-			}
-		}
-		NumLines = 0;
-
 		DoingInputProcessing = true;
-		gio::write( EchoInputFile, fmtLD ) << " Processing Data Dictionary -- Start";
-		DisplayString( "Processing Data Dictionary" );
-		ProcessingIDD = true;
-		ProcessDataDicFile( idd_stream, ErrorsInIDD );
-		idd_stream.close();
-
-		ListOfObjects.allocate( NumObjectDefs );
-		ListOfObjects = ObjectDef( {1,NumObjectDefs} ).Name();
-		if ( SortedIDD ) {
-			iListOfObjects.allocate( NumObjectDefs );
-			SetupAndSort( ListOfObjects, iListOfObjects );
-		}
-		ObjectStartRecord.dimension( NumObjectDefs, 0 );
-		ObjectGotCount.dimension( NumObjectDefs, 0 );
-
-		if ( NumObjectDefs == 0 ) {
-			ShowFatalError( "ProcessInput: No objects found in IDD.  Program will terminate." );
-			ErrorsInIDD = true;
-		}
-		//  If no fatal to here, rewind EchoInputFile -- only keep processing data...
-		if ( ! ErrorsInIDD ) {
-			gio::rewind_truncate( EchoInputFile );
+		if ( ! DataDictionaryProcessed ) {
+			gio::write( EchoInputFile, fmtLD ) << " Processing Data Dictionary -- Start";
+			ProcessDataDictionary( ErrorsInIDD );
+			//  If no fatal to here, rewind EchoInputFile -- only keep processing data...
+			if ( ! ErrorsInIDD ) {
+				gio::rewind_truncate( EchoInputFile );
+			}
 		}
 
-		ProcessingIDD = false;
 		gio::write( EchoInputFile, fmtLD ) << " Processing Data Dictionary -- Complete";
 
 		gio::write( EchoInputFile, fmtLD ) << " Maximum number of Alpha Args=" << MaxAlphaArgsFound;
@@ -428,6 +401,53 @@ namespace InputProcessor {
 
 	}
 
+	void
+	ProcessDataDictionary( bool & ErrorsInIDD ) // set to true if errors were flagged in the data dictionary
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Reads and interprets the input data dictionary.  Split out of ProcessInput so a
+		// batch run can process the IDD once, before the processes that simulate its jobs
+		// are forked, and the jobs share the result.
+
+		// Using/Aliasing
+		using SortAndStringUtilities::SetupAndSort;
+
+		std::ifstream idd_stream( inputIddFileName, std::ios_base::in | std::ios_base::binary );
+		if ( ! idd_stream ) {
+			if ( idd_stream.is_open() ) idd_stream.close();
+			if ( ! gio::file_exists( inputIddFileName ) ) { // No such file
+				ShowFatalError( "ProcessInput: Energy+.idd missing. Program terminates. Fullname=" + inputIddFileName );
+			} else {
+				ShowFatalError( "ProcessInput: Could not open file \"" + inputIddFileName + "\" for input (read)." );
+			}
+		}
+		NumLines = 0;
+
+		DisplayString( "Processing Data Dictionary" );
+		ProcessingIDD = true;
+		ProcessDataDicFile( idd_stream, ErrorsInIDD );
+		idd_stream.close();
+
+		ListOfObjects.allocate( NumObjectDefs );
+		ListOfObjects = ObjectDef( {1,NumObjectDefs} ).Name();
+		if ( SortedIDD ) {
+			iListOfObjects.allocate( NumObjectDefs );
+			SetupAndSort( ListOfObjects, iListOfObjects );
+		}
+		ObjectStartRecord.dimension( NumObjectDefs, 0 );
+		ObjectGotCount.dimension( NumObjectDefs, 0 );
+
+		if ( NumObjectDefs == 0 ) {
+			ShowFatalError( "ProcessInput: No objects found in IDD.  Program will terminate." );
+			ErrorsInIDD = true;
+		}
+
+		ProcessingIDD = false;
+		DataDictionaryProcessed = true;
+
+	}
+
 	void
 	ProcessDataDicFile(
 		std::istream & idd_stream,
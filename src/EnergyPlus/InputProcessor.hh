@@ -77,6 +77,7 @@ namespace InputProcessor {
 	extern int TotalAuditErrors; // Counting some warnings that go onto only the audit file
 	extern int NumSecretObjects; // Number of objects in "Secret Mode"
 	extern bool ProcessingIDD; // True when processing IDD, false when processing IDF
+	extern bool DataDictionaryProcessed; // True once the IDD has been read, e.g. ahead of the jobs of a batch run
 	extern std::ostream * echo_stream; // Internal stream used for input file echoing (used for performance)
 
 	//Real Variables for Module
@@ -415,6 +416,9 @@ namespace InputProcessor {
 	void
 	ProcessInput();
 
+	void
+	ProcessDataDictionary( bool & ErrorsInIDD ); // set to true if errors were flagged in the data dictionary
+
 	void
 	ProcessDataDicFile(
 		std::istream & idd_stream,
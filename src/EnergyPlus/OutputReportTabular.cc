@@ -2,7 +2,9 @@
 #include <cassert>
 #include <cmath>
 #include <iomanip>
+#include <algorithm>
 #include <map>
+#include <tuple>
 #include <utility>
 #include <vector>
 
@@ -23,6 +25,7 @@
 #include <DataErrorTracking.hh>
 #include <DataGlobalConstants.hh>
 #include <DataHeatBalance.hh>
+#include <DataHeatBalSurface.hh>
 #include <DataHVACGlobals.hh>
 #include <DataIPShortCuts.hh>
 #include <DataOutputs.hh>
@@ -31,6 +34,8 @@
 #include <DataSizing.hh>
 #include <DataStringGlobals.hh>
 #include <DataSurfaces.hh>
+#include <DataSystemVariables.hh>
+#include <DataViewFactorInformation.hh>
 #include <DataWater.hh>
 #include <DataZoneEquipment.hh>
 #include <DisplayRoutines.hh>
@@ -333,6 +338,8 @@ namespace OutputReportTabular {
 	FArray2D< Real64 > decayCurveHeat;
 	FArray3D< Real64 > ITABSFseq; // used for determining the radiant fraction on each surface
 	FArray3D< Real64 > TMULTseq; // used for determining the radiant fraction on each surface
+	FArray2D< Real64 > HConvInAtPulse; // inside convection coefficient of each surface at the pulse time step of each design day
+	FArray2D< Real64 > TempSurfInAtPulse; // inside face temperature of each surface at the pulse time step of each design day
 
 	FArray3D< Real64 > peopleInstantSeq;
 	FArray3D< Real64 > peopleLatentSeq;
@@ -390,6 +397,40 @@ namespace OutputReportTabular {
 	std::string activeForName;
 	std::string prevReportName;
 
+	// Streaming aggregation plan of the monthly, binned and BEPS reports - see SetupTabularAggregationPlan
+	int NumAggSources( 0 ); // Number of distinct variables and meters read by the plan
+	FArray1D_int AggSourceTypeOfVar; // 0=not found, 1=integer, 2=real, 3=meter, 4=schedule
+	FArray1D_int AggSourceVarNum; // Variable or meter number of each source
+	FArray1D_int AggSourceStart; // First source of each step type, the sources of a step type are contiguous
+	FArray1D< Real64 > AggSourceValue; // Value of each source at the current timestep
+	int NumMonthlyAggKernels( 0 );
+	FArray1D_int MonthlyAggColumn; // Monthly column of each monthly plan entry, grouped by kernel
+	FArray1D_int MonthlyAggSource; // Source of each monthly plan entry
+	FArray1D_bool MonthlyTablePlanned; // TRUE if a monthly table is gathered by the plan
+	FArray1D_int BinAggObject; // Binned object of each binned plan entry, grouped by step type
+	FArray1D_int BinAggRepIndex; // Binned result of each binned plan entry
+	FArray1D_int BinAggSource; // Source of each binned plan entry
+	FArray1D_int BinAggStart; // First binned plan entry of each step type
+	FArray1D_int BEPSAggTarget; // Element of the BEPS gathering array of each BEPS plan entry
+	FArray1D_int BEPSAggSource; // Source of each BEPS plan entry
+	FArray1D_int BEPSAggStart; // First BEPS plan entry of each gathering array (see GatherBEPSResultsForTimestep)
+
+	// Flags and saved arrays of the gathering routines, kept at module scope so clear_state can reset them
+	bool UpdateTabularReportsGetInput( true ); // TRUE until the tabular report input has been read
+	bool VarWarning( true ); // TRUE until the first missing monthly variable warning
+	int ErrCount1( 0 ); // Missing monthly variables
+	int ErrCount2( 0 ); // Missing monthly meters
+	bool GatherMonthlyResultsForTimestepRunOnce( true ); // TRUE until the monthly column copies below are made
+	FArray1D_int MonthlyColumnsTypeOfVar; // Copies of MonthlyColumns and MonthlyTables members used while gathering
+	FArray1D_int MonthlyColumnsStepType;
+	FArray1D_int MonthlyColumnsAggType;
+	FArray1D_int MonthlyColumnsVarNum;
+	FArray1D_int MonthlyTablesNumColumns;
+	bool GatherHeatGainReportfirstTime( true ); // TRUE until radiantHeat and radiantCool are allocated
+	FArray1D< Real64 > radiantHeat; // Radiant system heating of each zone at the current timestep
+	FArray1D< Real64 > radiantCool; // Radiant system cooling of each zone at the current timestep
+	bool AllocateLoadComponentArraysDoAllocate( true ); // TRUE until the load component arrays are allocated
+
 	// SUBROUTINE SPECIFICATIONS FOR MODULE PrimaryPlantLoops
 	//PRIVATE      DateToStr
 
@@ -405,6 +446,7 @@ namespace OutputReportTabular {
 	FArray1D< MonthlyInputType > MonthlyInput;
 	FArray1D< MonthlyTablesType > MonthlyTables;
 	FArray1D< MonthlyColumnsType > MonthlyColumns;
+	FArray1D< MonthlyAggKernelType > MonthlyAggKernel; // aggregation kernels of the monthly plan entries
 	FArray1D< TOCEntriesType > TOCEntries;
 	FArray1D< UnitConvType > UnitConv;
 
@@ -413,6 +455,216 @@ namespace OutputReportTabular {
 
 	// Functions
 
+	void
+	clear_state()
+	{
+		OutputTableBinnedCount = 0;
+		BinResultsTableCount = 0;
+		BinResultsIntervalCount = 0;
+		MonthlyInputCount = 0;
+		sizeMonthlyInput = 0;
+		MonthlyFieldSetInputCount = 0;
+		sizeMonthlyFieldSetInput = 0;
+		MonthlyTablesCount = 0;
+		MonthlyColumnsCount = 0;
+		IsMonthGathered = false;
+		TOCEntriesCount = 0;
+		TOCEntriesSize = 0;
+		UnitConvSize = 0;
+		WriteTabularFiles = false;
+		unitsStyle = 0;
+		numStyles = 0;
+		del = "";
+		TableStyle = 0;
+		timeInYear = 0.0;
+		displayTabularBEPS = false;
+		displayLEEDSummary = false;
+		displayTabularCompCosts = false;
+		displayTabularVeriSum = false;
+		displayComponentSizing = false;
+		displaySurfaceShadowing = false;
+		displayDemandEndUse = false;
+		displayAdaptiveComfort = false;
+		displaySourceEnergyEndUseSummary = false;
+		displayZoneComponentLoadSummary = false;
+		meterNumTotalsBEPS = 0;
+		meterNumTotalsSource = 0;
+		fuelfactorsused = false;
+		ffUsed = false;
+		SourceFactors = 0.0;
+		ffSchedUsed = false;
+		ffSchedIndex = 0;
+		meterNumEndUseBEPS = 0;
+		meterNumEndUseSubBEPS.deallocate();
+		resourceTypeNames = "";
+		sourceTypeNames = "";
+		endUseNames = "";
+		gatherTotalsBEPS = 0.0;
+		gatherTotalsBySourceBEPS = 0.0;
+		gatherTotalsSource = 0.0;
+		gatherTotalsBySource = 0.0;
+		gatherEndUseBEPS = 0.0;
+		gatherEndUseBySourceBEPS = 0.0;
+		gatherEndUseSubBEPS.deallocate();
+		gatherDemandTotal = 0.0;
+		gatherDemandEndUse = 0.0;
+		gatherDemandEndUseSub.deallocate();
+		gatherDemandTimeStamp = 0;
+		gatherElapsedTimeBEPS = 0.0;
+		buildingGrossFloorArea = 0.0;
+		buildingConditionedFloorArea = 0.0;
+		fuelFactorSchedulesUsed = false;
+		meterNumPowerFuelFireGen = 0;
+		gatherPowerFuelFireGen = 0.0;
+		meterNumPowerPV = 0;
+		gatherPowerPV = 0.0;
+		meterNumPowerWind = 0;
+		gatherPowerWind = 0.0;
+		OverallNetEnergyFromStorage = 0.0;
+		meterNumPowerHTGeothermal = 0;
+		gatherPowerHTGeothermal = 0.0;
+		meterNumElecProduced = 0;
+		gatherElecProduced = 0.0;
+		meterNumElecPurchased = 0;
+		gatherElecPurchased = 0.0;
+		meterNumElecSurplusSold = 0;
+		gatherElecSurplusSold = 0.0;
+		meterNumWaterHeatRecovery = 0;
+		gatherWaterHeatRecovery = 0.0;
+		meterNumAirHeatRecoveryCool = 0;
+		gatherAirHeatRecoveryCool = 0.0;
+		meterNumAirHeatRecoveryHeat = 0;
+		gatherAirHeatRecoveryHeat = 0.0;
+		meterNumHeatHTGeothermal = 0;
+		gatherHeatHTGeothermal = 0.0;
+		meterNumHeatSolarWater = 0;
+		gatherHeatSolarWater = 0.0;
+		meterNumHeatSolarAir = 0;
+		gatherHeatSolarAir = 0.0;
+		meterNumRainWater = 0;
+		gatherRainWater = 0.0;
+		meterNumCondensate = 0;
+		gatherCondensate = 0.0;
+		meterNumGroundwater = 0;
+		gatherWellwater = 0.0;
+		meterNumMains = 0;
+		gatherMains = 0.0;
+		meterNumWaterEndUseTotal = 0;
+		gatherWaterEndUseTotal = 0.0;
+		sourceFactorElectric = 0.0;
+		sourceFactorNaturalGas = 0.0;
+		efficiencyDistrictCooling = 0.0;
+		efficiencyDistrictHeating = 0.0;
+		sourceFactorSteam = 0.0;
+		sourceFactorGasoline = 0.0;
+		sourceFactorDiesel = 0.0;
+		sourceFactorCoal = 0.0;
+		sourceFactorFuelOil1 = 0.0;
+		sourceFactorFuelOil2 = 0.0;
+		sourceFactorPropane = 0.0;
+		sourceFactorOtherFuel1 = 0.0;
+		sourceFactorOtherFuel2 = 0.0;
+		td = 0;
+		DesignDayName.deallocate();
+		DesignDayCount = 0;
+		radiantPulseUsed.deallocate();
+		radiantPulseTimestep.deallocate();
+		radiantPulseReceived.deallocate();
+		loadConvectedNormal.deallocate();
+		loadConvectedWithPulse.deallocate();
+		netSurfRadSeq.deallocate();
+		decayCurveCool.deallocate();
+		decayCurveHeat.deallocate();
+		ITABSFseq.deallocate();
+		TMULTseq.deallocate();
+		HConvInAtPulse.deallocate();
+		TempSurfInAtPulse.deallocate();
+		peopleInstantSeq.deallocate();
+		peopleLatentSeq.deallocate();
+		peopleRadSeq.deallocate();
+		peopleDelaySeq.deallocate();
+		lightInstantSeq.deallocate();
+		lightRetAirSeq.deallocate();
+		lightLWRadSeq.deallocate();
+		lightSWRadSeq.deallocate();
+		lightDelaySeq.deallocate();
+		equipInstantSeq.deallocate();
+		equipLatentSeq.deallocate();
+		equipRadSeq.deallocate();
+		equipDelaySeq.deallocate();
+		refrigInstantSeq.deallocate();
+		refrigRetAirSeq.deallocate();
+		refrigLatentSeq.deallocate();
+		waterUseInstantSeq.deallocate();
+		waterUseLatentSeq.deallocate();
+		hvacLossInstantSeq.deallocate();
+		hvacLossRadSeq.deallocate();
+		hvacLossDelaySeq.deallocate();
+		powerGenInstantSeq.deallocate();
+		powerGenRadSeq.deallocate();
+		powerGenDelaySeq.deallocate();
+		infilInstantSeq.deallocate();
+		infilLatentSeq.deallocate();
+		zoneVentInstantSeq.deallocate();
+		zoneVentLatentSeq.deallocate();
+		interZoneMixInstantSeq.deallocate();
+		interZoneMixLatentSeq.deallocate();
+		feneCondInstantSeq.deallocate();
+		feneSolarRadSeq.deallocate();
+		feneSolarDelaySeq.deallocate();
+		surfDelaySeq.deallocate();
+		maxUniqueKeyCount = 0;
+		activeSubTableName.clear();
+		activeReportNameNoSpace.clear();
+		activeReportName.clear();
+		activeForName.clear();
+		prevReportName.clear();
+		NumAggSources = 0;
+		AggSourceTypeOfVar.deallocate();
+		AggSourceVarNum.deallocate();
+		AggSourceStart.deallocate();
+		AggSourceValue.deallocate();
+		NumMonthlyAggKernels = 0;
+		MonthlyAggColumn.deallocate();
+		MonthlyAggSource.deallocate();
+		MonthlyTablePlanned.deallocate();
+		BinAggObject.deallocate();
+		BinAggRepIndex.deallocate();
+		BinAggSource.deallocate();
+		BinAggStart.deallocate();
+		BEPSAggTarget.deallocate();
+		BEPSAggSource.deallocate();
+		BEPSAggStart.deallocate();
+		UpdateTabularReportsGetInput = true;
+		VarWarning = true;
+		ErrCount1 = 0;
+		ErrCount2 = 0;
+		GatherMonthlyResultsForTimestepRunOnce = true;
+		MonthlyColumnsTypeOfVar.deallocate();
+		MonthlyColumnsStepType.deallocate();
+		MonthlyColumnsAggType.deallocate();
+		MonthlyColumnsVarNum.deallocate();
+		MonthlyTablesNumColumns.deallocate();
+		GatherHeatGainReportfirstTime = true;
+		radiantHeat.deallocate();
+		radiantCool.deallocate();
+		AllocateLoadComponentArraysDoAllocate = true;
+		OutputTableBinned.deallocate();
+		BinResults.deallocate();
+		BinResultsBelow.deallocate();
+		BinResultsAbove.deallocate();
+		BinObjVarID.deallocate();
+		BinStatistics.deallocate();
+		namedMonthly.deallocate();
+		MonthlyFieldSetInput.deallocate();
+		MonthlyInput.deallocate();
+		MonthlyTables.deallocate();
+		MonthlyColumns.deallocate();
+		MonthlyAggKernel.deallocate();
+		TOCEntries.deallocate();
+		UnitConv.deallocate();
+	}
+
 	void
 	UpdateTabularReports( int const IndexTypeKey ) // What kind of data to update (Zone, HVAC)
 	{
@@ -448,13 +700,13 @@ namespace OutputReportTabular {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool GetInput( true );
+		// na
 
 		if ( IndexTypeKey != ZoneTSReporting && IndexTypeKey != HVACTSReporting ) {
 			ShowFatalError( "Invalid reporting requested -- UpdateTabularReports" );
 		}
 
-		if ( GetInput ) {
+		if ( UpdateTabularReportsGetInput ) {
 			GetInputTabularMonthly();
 			GetInputTabularTimeBins();
 			GetInputTabularStyle();
@@ -464,13 +716,15 @@ namespace OutputReportTabular {
 			GetInputFuelAndPollutionFactors();
 			SetupUnitConversions();
 			AddTOCZoneLoadComponentTable();
-			GetInput = false;
+			if ( DataSystemVariables::TabularAggregationPlan ) SetupTabularAggregationPlan();
+			UpdateTabularReportsGetInput = false;
 			date_and_time_string( _, _, _, td );
 		}
 		if ( DoOutputReporting && WriteTabularFiles && ( KindOfSim == ksRunPeriodWeather ) ) {
 			if ( IndexTypeKey == stepTypeZone ) {
 				gatherElapsedTimeBEPS += TimeStepZone;
 			}
+			if ( DataSystemVariables::TabularAggregationPlan ) GatherTabularAggregationSources( IndexTypeKey );
 			GatherMonthlyResultsForTimestep( IndexTypeKey );
 			GatherBinResultsForTimestep( IndexTypeKey );
 			GatherBEPSResultsForTimestep( IndexTypeKey );
@@ -807,9 +1061,6 @@ namespace OutputReportTabular {
 		int TablesRecount;
 		static Real64 BigNum( 0.0 );
 		bool environmentKeyFound;
-		static bool VarWarning( true );
-		static int ErrCount1( 0 );
-		static int ErrCount2( 0 );
 		//INTEGER       :: maxKeyCount
 
 		// if not a running a weather simulation do not create reports
@@ -3399,6 +3650,190 @@ namespace OutputReportTabular {
 		}
 	}
 
+	void
+	SetupTabularAggregationPlan()
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		//   Compiles the gathering of the monthly, binned and BEPS reports into a flat plan that
+		//   is followed each time step when TabularAggregationPlan is set.
+
+		// METHODOLOGY EMPLOYED:
+		//   Each distinct variable or meter read at a time step type becomes one source.  The
+		//   sources are read once per time step into AggSourceValue by
+		//   GatherTabularAggregationSources, however many tables use them.
+		//   The columns of monthly tables that only use the sum or average, maximum, minimum and
+		//   hours aggregations do not depend on each other.  They are grouped into kernels by time
+		//   step type, aggregation type and averaged or summed variable, so a kernel is a loop over
+		//   its columns without branching on the aggregation (GatherMonthlyAggregationPlan).
+		//   Tables with a value when maximum or minimum column or a column during the hours shown
+		//   depend on the order of their columns and are still gathered column by column.
+		//   The binned variables are listed by time step type and the BEPS meters by gathering
+		//   array in the same way.
+
+		// Using/Aliasing
+		using OutputProcessor::EndUseCategory;
+
+		// Locals
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		typedef std::tuple< int, int, int > SourceKey; // time step type, type of variable, variable number
+		typedef std::tuple< int, int, int > KernelKey; // time step type, aggregation type, averaged or summed
+		std::map< SourceKey, int > SourceIndex; // source of each variable or meter
+		std::map< KernelKey, std::vector< std::pair< int, int > > > KernelEntries; // column and source key of each entry
+		std::vector< std::tuple< int, int, int > > BinEntries; // time step type, binned object, binned result
+		std::vector< std::tuple< int, int, int > > BEPSEntries; // gathering array, element, meter number
+		int iTable;
+		int jColumn;
+		int curCol;
+		int iInObj;
+		int jTable;
+		int repIndex;
+		int iResource;
+		int jEndUse;
+		int kEndUseSub;
+		int iEntry;
+		int curStepType;
+		int curAggType;
+
+		// monthly tables
+		MonthlyTablePlanned.dimension( MonthlyTablesCount, false );
+		for ( iTable = 1; iTable <= MonthlyTablesCount; ++iTable ) {
+			MonthlyTablePlanned( iTable ) = true;
+			for ( jColumn = 1; jColumn <= MonthlyTables( iTable ).numColumns; ++jColumn ) {
+				curAggType = MonthlyColumns( MonthlyTables( iTable ).firstColumn + jColumn - 1 ).aggType;
+				if ( ( curAggType == aggTypeValueWhenMaxMin ) || ( curAggType == aggTypeSumOrAverageHoursShown ) || ( curAggType == aggTypeMaximumDuringHoursShown ) || ( curAggType == aggTypeMinimumDuringHoursShown ) ) {
+					MonthlyTablePlanned( iTable ) = false;
+				}
+			}
+			if ( ! MonthlyTablePlanned( iTable ) ) continue;
+			for ( jColumn = 1; jColumn <= MonthlyTables( iTable ).numColumns; ++jColumn ) {
+				curCol = MonthlyTables( iTable ).firstColumn + jColumn - 1;
+				curStepType = MonthlyColumns( curCol ).stepType;
+				if ( ( curStepType != stepTypeZone ) && ( curStepType != stepTypeHVAC ) ) continue; // never gathered
+				SourceKey const key( curStepType, MonthlyColumns( curCol ).typeOfVar, MonthlyColumns( curCol ).varNum );
+				SourceIndex[ key ] = 0;
+				KernelEntries[ KernelKey( curStepType, MonthlyColumns( curCol ).aggType, MonthlyColumns( curCol ).avgSum ) ].push_back( std::make_pair( curCol, 0 ) );
+			}
+		}
+
+		// binned variables
+		for ( iInObj = 1; iInObj <= OutputTableBinnedCount; ++iInObj ) {
+			curStepType = OutputTableBinned( iInObj ).stepType;
+			if ( ( curStepType != stepTypeZone ) && ( curStepType != stepTypeHVAC ) ) continue;
+			for ( jTable = 1; jTable <= OutputTableBinned( iInObj ).numTables; ++jTable ) {
+				repIndex = OutputTableBinned( iInObj ).resIndex + ( jTable - 1 );
+				SourceIndex[ SourceKey( curStepType, OutputTableBinned( iInObj ).typeOfVar, BinObjVarID( repIndex ).varMeterNum ) ] = 0;
+				BinEntries.push_back( std::make_tuple( curStepType, iInObj, repIndex ) );
+			}
+		}
+
+		// BEPS meters, read at the zone time step
+		if ( displayTabularBEPS || displayLEEDSummary ) {
+			for ( iResource = 1; iResource <= numResourceTypes; ++iResource ) {
+				if ( meterNumTotalsBEPS( iResource ) > 0 ) {
+					BEPSEntries.push_back( std::make_tuple( 1, iResource - 1, meterNumTotalsBEPS( iResource ) ) );
+				}
+				for ( jEndUse = 1; jEndUse <= NumEndUses; ++jEndUse ) {
+					if ( meterNumEndUseBEPS( jEndUse, iResource ) == 0 ) continue; // subcategories are only gathered with their end use
+					BEPSEntries.push_back( std::make_tuple( 2, int( gatherEndUseBEPS.index( jEndUse, iResource ) ), meterNumEndUseBEPS( jEndUse, iResource ) ) );
+					for ( kEndUseSub = 1; kEndUseSub <= EndUseCategory( jEndUse ).NumSubcategories; ++kEndUseSub ) {
+						if ( meterNumEndUseSubBEPS( iResource, jEndUse, kEndUseSub ) > 0 ) {
+							BEPSEntries.push_back( std::make_tuple( 3, int( gatherEndUseSubBEPS.index( iResource, jEndUse, kEndUseSub ) ), meterNumEndUseSubBEPS( iResource, jEndUse, kEndUseSub ) ) );
+						}
+					}
+				}
+			}
+			for ( iResource = 1; iResource <= numSourceTypes; ++iResource ) {
+				if ( meterNumTotalsSource( iResource ) > 0 ) {
+					BEPSEntries.push_back( std::make_tuple( 4, iResource - 1, meterNumTotalsSource( iResource ) ) );
+				}
+			}
+			for ( auto const & entry : BEPSEntries ) {
+				SourceIndex[ SourceKey( stepTypeZone, 3, std::get< 2 >( entry ) ) ] = 0;
+			}
+		}
+
+		// number the sources; the map keeps the sources of each time step type together
+		NumAggSources = SourceIndex.size();
+		AggSourceTypeOfVar.dimension( NumAggSources, 0 );
+		AggSourceVarNum.dimension( NumAggSources, 0 );
+		AggSourceValue.dimension( NumAggSources, 0.0 );
+		AggSourceStart.dimension( stepTypeHVAC + 1, NumAggSources + 1 );
+		iEntry = 0;
+		for ( auto & source : SourceIndex ) {
+			++iEntry;
+			source.second = iEntry;
+			AggSourceTypeOfVar( iEntry ) = std::get< 1 >( source.first );
+			AggSourceVarNum( iEntry ) = std::get< 2 >( source.first );
+			curStepType = std::get< 0 >( source.first );
+			AggSourceStart( curStepType ) = min( AggSourceStart( curStepType ), iEntry );
+		}
+		for ( curStepType = stepTypeHVAC; curStepType >= 1; --curStepType ) {
+			AggSourceStart( curStepType ) = min( AggSourceStart( curStepType ), AggSourceStart( curStepType + 1 ) );
+		}
+
+		// monthly kernels
+		NumMonthlyAggKernels = KernelEntries.size();
+		MonthlyAggKernel.allocate( NumMonthlyAggKernels );
+		MonthlyAggColumn.dimension( MonthlyColumnsCount, 0 );
+		MonthlyAggSource.dimension( MonthlyColumnsCount, 0 );
+		int iKernel = 0;
+		iEntry = 0;
+		for ( auto const & kernelEntries : KernelEntries ) {
+			++iKernel;
+			MonthlyAggKernelType & kernel( MonthlyAggKernel( iKernel ) );
+			kernel.stepType = std::get< 0 >( kernelEntries.first );
+			kernel.aggType = std::get< 1 >( kernelEntries.first );
+			kernel.avgSum = std::get< 2 >( kernelEntries.first );
+			kernel.firstEntry = iEntry + 1;
+			for ( auto const & entry : kernelEntries.second ) {
+				curCol = entry.first;
+				++iEntry;
+				MonthlyAggColumn( iEntry ) = curCol;
+				MonthlyAggSource( iEntry ) = SourceIndex[ SourceKey( kernel.stepType, MonthlyColumns( curCol ).typeOfVar, MonthlyColumns( curCol ).varNum ) ];
+			}
+			kernel.lastEntry = iEntry;
+		}
+
+		// binned entries
+		std::sort( BinEntries.begin(), BinEntries.end() );
+		BinAggObject.dimension( BinEntries.size(), 0 );
+		BinAggRepIndex.dimension( BinEntries.size(), 0 );
+		BinAggSource.dimension( BinEntries.size(), 0 );
+		BinAggStart.dimension( stepTypeHVAC + 1, int( BinEntries.size() ) + 1 );
+		iEntry = 0;
+		for ( auto const & entry : BinEntries ) {
+			++iEntry;
+			curStepType = std::get< 0 >( entry );
+			iInObj = std::get< 1 >( entry );
+			repIndex = std::get< 2 >( entry );
+			BinAggObject( iEntry ) = iInObj;
+			BinAggRepIndex( iEntry ) = repIndex;
+			BinAggSource( iEntry ) = SourceIndex[ SourceKey( curStepType, OutputTableBinned( iInObj ).typeOfVar, BinObjVarID( repIndex ).varMeterNum ) ];
+			BinAggStart( curStepType ) = min( BinAggStart( curStepType ), iEntry );
+		}
+		for ( curStepType = stepTypeHVAC; curStepType >= 1; --curStepType ) {
+			BinAggStart( curStepType ) = min( BinAggStart( curStepType ), BinAggStart( curStepType + 1 ) );
+		}
+
+		// BEPS entries
+		std::sort( BEPSEntries.begin(), BEPSEntries.end() );
+		BEPSAggTarget.dimension( BEPSEntries.size(), 0 );
+		BEPSAggSource.dimension( BEPSEntries.size(), 0 );
+		BEPSAggStart.dimension( 5, int( BEPSEntries.size() ) + 1 );
+		iEntry = 0;
+		for ( auto const & entry : BEPSEntries ) {
+			++iEntry;
+			BEPSAggTarget( iEntry ) = std::get< 1 >( entry );
+			BEPSAggSource( iEntry ) = SourceIndex[ SourceKey( stepTypeZone, 3, std::get< 2 >( entry ) ) ];
+			BEPSAggStart( std::get< 0 >( entry ) ) = min( BEPSAggStart( std::get< 0 >( entry ) ), iEntry );
+		}
+		for ( iEntry = 4; iEntry >= 1; --iEntry ) {
+			BEPSAggStart( iEntry ) = min( BEPSAggStart( iEntry ), BEPSAggStart( iEntry + 1 ) );
+		}
+
+	}
+
 	//======================================================================================================================
 	//======================================================================================================================
 
@@ -3407,6 +3842,27 @@ namespace OutputReportTabular {
 	//======================================================================================================================
 	//======================================================================================================================
 
+	void
+	GatherTabularAggregationSources( int const IndexTypeKey ) // What kind of data to update (Zone, HVAC)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		//   Reads the current values of the aggregation plan sources of the time step type.
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int curStepType;
+
+		if ( IndexTypeKey == HVACTSReporting ) {
+			curStepType = stepTypeHVAC;
+		} else {
+			curStepType = stepTypeZone;
+		}
+		for ( int iSource = AggSourceStart( curStepType ), iSource_end = AggSourceStart( curStepType + 1 ) - 1; iSource <= iSource_end; ++iSource ) {
+			AggSourceValue( iSource ) = GetInternalVariableValue( AggSourceTypeOfVar( iSource ), AggSourceVarNum( iSource ) );
+		}
+
+	}
+
 	void
 	GatherBinResultsForTimestep( int const IndexTypeKey ) // What kind of data to update (Zone, HVAC)
 	{
@@ -3442,33 +3898,50 @@ namespace OutputReportTabular {
 		int jTable;
 		Real64 curValue;
 		// values of OutputTableBinned array for current index
-		Real64 curIntervalStart;
-		Real64 curIntervalSize;
-		int curIntervalCount;
 		int curResIndex;
 		int curNumTables;
 		int curTypeOfVar;
 		int curScheduleIndex;
 		Real64 elapsedTime;
 		bool gatherThisTime;
-		Real64 topValue;
-		int binNum;
 		int repIndex;
 		int curStepType;
+		int iEntry;
+		int lastObj;
 
 		//REAL(r64), external :: GetInternalVariableValue
 
 		if ( ! DoWeathSim ) return;
 		elapsedTime = TimeStepSys;
 		timeInYear += elapsedTime;
+
+		if ( DataSystemVariables::TabularAggregationPlan ) {
+			// follow the binned entries of the aggregation plan for the time step type
+			if ( IndexTypeKey == HVACTSReporting ) {
+				curStepType = stepTypeHVAC;
+				elapsedTime = TimeStepSys;
+			} else {
+				curStepType = stepTypeZone;
+				elapsedTime = TimeStepZone;
+			}
+			lastObj = 0;
+			gatherThisTime = false;
+			for ( iEntry = BinAggStart( curStepType ); iEntry < BinAggStart( curStepType + 1 ); ++iEntry ) {
+				iInObj = BinAggObject( iEntry );
+				if ( iInObj != lastObj ) {
+					curScheduleIndex = OutputTableBinned( iInObj ).scheduleIndex;
+					gatherThisTime = ( curScheduleIndex == 0 ) || ( GetCurrentScheduleValue( curScheduleIndex ) != 0.0 );
+					lastObj = iInObj;
+				}
+				if ( gatherThisTime ) AddBinValue( iInObj, BinAggRepIndex( iEntry ), AggSourceValue( BinAggSource( iEntry ) ), elapsedTime );
+			}
+			return;
+		}
+
 		for ( iInObj = 1; iInObj <= OutputTableBinnedCount; ++iInObj ) {
 			// get values of array for current object being referenced
-			curIntervalStart = OutputTableBinned( iInObj ).intervalStart;
-			curIntervalSize = OutputTableBinned( iInObj ).intervalSize;
-			curIntervalCount = OutputTableBinned( iInObj ).intervalCount;
 			curResIndex = OutputTableBinned( iInObj ).resIndex;
 			curNumTables = OutputTableBinned( iInObj ).numTables;
-			topValue = curIntervalStart + curIntervalSize * curIntervalCount;
 			curTypeOfVar = OutputTableBinned( iInObj ).typeOfVar;
 			curStepType = OutputTableBinned( iInObj ).stepType;
 			curScheduleIndex = OutputTableBinned( iInObj ).scheduleIndex;
@@ -3488,45 +3961,73 @@ namespace OutputReportTabular {
 					if ( ( ( curStepType == stepTypeZone ) && ( IndexTypeKey == ZoneTSReporting ) ) || ( ( curStepType == stepTypeHVAC ) && ( IndexTypeKey == HVACTSReporting ) ) ) {
 						// put actual value from OutputProcesser arrays
 						curValue = GetInternalVariableValue( curTypeOfVar, BinObjVarID( repIndex ).varMeterNum );
-						// per MJW when a summed variable is used divide it by the length of the time step
 						if ( IndexTypeKey == HVACTSReporting ) {
 							elapsedTime = TimeStepSys;
 						} else {
 							elapsedTime = TimeStepZone;
 						}
-						if ( OutputTableBinned( iInObj ).avgSum == isSum ) { // if it is a summed variable
-							curValue /= ( elapsedTime * SecInHour );
-						}
-						// check if the value is above the maximum or below the minimum value
-						// first before binning the value within the range.
-						if ( curValue < curIntervalStart ) {
-							BinResultsBelow( repIndex ).mnth( Month ) += elapsedTime;
-							BinResultsBelow( repIndex ).hrly( HourOfDay ) += elapsedTime;
-						} else if ( curValue >= topValue ) {
-							BinResultsAbove( repIndex ).mnth( Month ) += elapsedTime;
-							BinResultsAbove( repIndex ).hrly( HourOfDay ) += elapsedTime;
-						} else {
-							// determine which bin the results are in
-							binNum = int( ( curValue - curIntervalStart ) / curIntervalSize ) + 1;
-							BinResults( repIndex, binNum ).mnth( Month ) += elapsedTime;
-							BinResults( repIndex, binNum ).hrly( HourOfDay ) += elapsedTime;
-						}
-						// add to statistics array
-						++BinStatistics( repIndex ).n;
-						BinStatistics( repIndex ).sum += curValue;
-						BinStatistics( repIndex ).sum2 += curValue * curValue;
-						if ( curValue < BinStatistics( repIndex ).minimum ) {
-							BinStatistics( repIndex ).minimum = curValue;
-						}
-						if ( curValue > BinStatistics( repIndex ).maximum ) {
-							BinStatistics( repIndex ).maximum = curValue;
-						}
+						AddBinValue( iInObj, repIndex, curValue, elapsedTime );
 					}
 				}
 			}
 		}
 	}
 
+	void
+	AddBinValue(
+		int const iInObj, // binned object
+		int const repIndex, // binned result
+		Real64 const curValue, // value to bin
+		Real64 const elapsedTime // length of the time step (hr)
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		//   Adds the length of the timestep to the bin of a value and the value
+		//   to the statistics of the binned result.
+
+		// Using/Aliasing
+		using DataEnvironment::Month;
+
+		// Locals
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		Real64 binValue;
+		int binNum;
+
+		OutputTableBinnedType const & binnedObj( OutputTableBinned( iInObj ) );
+		Real64 const topValue( binnedObj.intervalStart + binnedObj.intervalSize * binnedObj.intervalCount );
+
+		binValue = curValue;
+		// per MJW when a summed variable is used divide it by the length of the time step
+		if ( binnedObj.avgSum == isSum ) { // if it is a summed variable
+			binValue /= ( elapsedTime * SecInHour );
+		}
+		// check if the value is above the maximum or below the minimum value
+		// first before binning the value within the range.
+		if ( binValue < binnedObj.intervalStart ) {
+			BinResultsBelow( repIndex ).mnth( Month ) += elapsedTime;
+			BinResultsBelow( repIndex ).hrly( HourOfDay ) += elapsedTime;
+		} else if ( binValue >= topValue ) {
+			BinResultsAbove( repIndex ).mnth( Month ) += elapsedTime;
+			BinResultsAbove( repIndex ).hrly( HourOfDay ) += elapsedTime;
+		} else {
+			// determine which bin the results are in
+			binNum = int( ( binValue - binnedObj.intervalStart ) / binnedObj.intervalSize ) + 1;
+			BinResults( repIndex, binNum ).mnth( Month ) += elapsedTime;
+			BinResults( repIndex, binNum ).hrly( HourOfDay ) += elapsedTime;
+		}
+		// add to statistics array
+		++BinStatistics( repIndex ).n;
+		BinStatistics( repIndex ).sum += binValue;
+		BinStatistics( repIndex ).sum2 += binValue * binValue;
+		if ( binValue < BinStatistics( repIndex ).minimum ) {
+			BinStatistics( repIndex ).minimum = binValue;
+		}
+		if ( binValue > BinStatistics( repIndex ).maximum ) {
+			BinStatistics( repIndex ).maximum = binValue;
+		}
+	}
+
 	void
 	GatherMonthlyResultsForTimestep( int const IndexTypeKey ) // What kind of data to update (Zone, HVAC)
 	{
@@ -3588,19 +4089,13 @@ namespace OutputReportTabular {
 		int scanVarNum;
 		Real64 oldScanValue;
 		// local copies of some of the MonthlyColumns array references since
-		// profiling showed that they were slow.
-		static bool RunOnce( true );
-		static FArray1D_int MonthlyColumnsTypeOfVar;
-		static FArray1D_int MonthlyColumnsStepType;
-		static FArray1D_int MonthlyColumnsAggType;
-		static FArray1D_int MonthlyColumnsVarNum;
-		static FArray1D_int MonthlyTablesNumColumns;
-		static int curFirstColumn( 0 );
+		// profiling showed that they were slow (MonthlyColumnsTypeOfVar etc. at module scope).
+		int curFirstColumn( 0 );
 
 		if ( ! DoWeathSim ) return;
 
 		//create temporary arrays to speed processing of these arrays
-		if ( RunOnce ) {
+		if ( GatherMonthlyResultsForTimestepRunOnce ) {
 			//MonthlyColumns
 			MonthlyColumnsTypeOfVar = MonthlyColumns.typeOfVar();
 			MonthlyColumnsStepType = MonthlyColumns.stepType();
@@ -3610,7 +4105,7 @@ namespace OutputReportTabular {
 			MonthlyTablesNumColumns = MonthlyTables.numColumns();
 
 			//set flag so this block is only executed once
-			RunOnce = false;
+			GatherMonthlyResultsForTimestepRunOnce = false;
 		}
 
 		elapsedTime = TimeStepSys;
@@ -3620,7 +4115,13 @@ namespace OutputReportTabular {
 			elapsedTime = TimeStepZone;
 		}
 		IsMonthGathered( Month ) = true;
+		if ( DataSystemVariables::TabularAggregationPlan ) {
+			minuteCalculated = DetermineMinuteForReporting( IndexTypeKey );
+			EncodeMonDayHrMin( timestepTimeStamp, Month, DayOfMonth, HourOfDay, minuteCalculated );
+			GatherMonthlyAggregationPlan( IndexTypeKey, elapsedTime, timestepTimeStamp );
+		}
 		for ( iTable = 1; iTable <= MonthlyTablesCount; ++iTable ) {
+			if ( DataSystemVariables::TabularAggregationPlan && MonthlyTablePlanned( iTable ) ) continue;
 			activeMinMax = false; //at the beginning of the new timestep
 			activeHoursShown = false; //fix by JG addressing CR6482
 			curFirstColumn = MonthlyTables( iTable ).firstColumn;
@@ -3849,6 +4350,101 @@ namespace OutputReportTabular {
 		}
 	}
 
+	void
+	GatherMonthlyAggregationPlan(
+		int const IndexTypeKey, // What kind of data to update (Zone, HVAC)
+		Real64 const elapsedTime, // length of the time step (hr)
+		int const timestepTimeStamp // encoded timestamp of the time step
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		//   Gathers the monthly columns of the aggregation plan for the time step.
+
+		// METHODOLOGY EMPLOYED:
+		//   Each kernel applies the aggregation of GatherMonthlyResultsForTimestep to all of its
+		//   columns with the values of their sources.  The hours kernels count the time step when
+		//   the sign of the value is one of those counted by the aggregation type.
+
+		// Using/Aliasing
+		using DataHVACGlobals::TimeStepSys;
+		using DataEnvironment::Month;
+
+		// Locals
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int curStepType;
+		Real64 stepLength; // length of the time step (s), summed variables are divided by it for the maximum and minimum
+		Real64 weight; // weight of the values in the sum or average
+		Real64 divisor; // divisor of the values for the maximum or minimum
+		Real64 curValue;
+		bool countNegative; // hours kernels count the negative values
+		bool countZero; // hours kernels count the zero values
+		bool countPositive; // hours kernels count the positive values
+		int iKernel;
+		int iEntry;
+
+		if ( IndexTypeKey == HVACTSReporting ) {
+			curStepType = stepTypeHVAC;
+			stepLength = TimeStepSys * SecInHour;
+		} else {
+			curStepType = stepTypeZone;
+			stepLength = TimeStepZoneSec;
+		}
+		for ( iKernel = 1; iKernel <= NumMonthlyAggKernels; ++iKernel ) {
+			MonthlyAggKernelType const & kernel( MonthlyAggKernel( iKernel ) );
+			if ( kernel.stepType != curStepType ) continue;
+			if ( kernel.avgSum == isSum ) {
+				weight = 1.0;
+				divisor = stepLength;
+			} else {
+				weight = elapsedTime; //for averaging - weight by elapsed time
+				divisor = 1.0;
+			}
+			{ auto const SELECT_CASE_var( kernel.aggType );
+			if ( SELECT_CASE_var == aggTypeSumOrAvg ) {
+				for ( iEntry = kernel.firstEntry; iEntry <= kernel.lastEntry; ++iEntry ) {
+					MonthlyColumnsType & column( MonthlyColumns( MonthlyAggColumn( iEntry ) ) );
+					column.reslt( Month ) += AggSourceValue( MonthlyAggSource( iEntry ) ) * weight;
+					column.timeStamp( Month ) = 0;
+					column.duration( Month ) += elapsedTime;
+				}
+			} else if ( SELECT_CASE_var == aggTypeMaximum ) {
+				for ( iEntry = kernel.firstEntry; iEntry <= kernel.lastEntry; ++iEntry ) {
+					MonthlyColumnsType & column( MonthlyColumns( MonthlyAggColumn( iEntry ) ) );
+					curValue = AggSourceValue( MonthlyAggSource( iEntry ) ) / divisor;
+					if ( curValue > column.reslt( Month ) ) {
+						column.reslt( Month ) = curValue;
+						column.timeStamp( Month ) = timestepTimeStamp;
+						column.duration( Month ) = 0.0;
+					}
+				}
+			} else if ( SELECT_CASE_var == aggTypeMinimum ) {
+				for ( iEntry = kernel.firstEntry; iEntry <= kernel.lastEntry; ++iEntry ) {
+					MonthlyColumnsType & column( MonthlyColumns( MonthlyAggColumn( iEntry ) ) );
+					curValue = AggSourceValue( MonthlyAggSource( iEntry ) ) / divisor;
+					if ( curValue < column.reslt( Month ) ) {
+						column.reslt( Month ) = curValue;
+						column.timeStamp( Month ) = timestepTimeStamp;
+						column.duration( Month ) = 0.0;
+					}
+				}
+			} else { // hours aggregations
+				countNegative = ( SELECT_CASE_var == aggTypeHoursNonZero ) || ( SELECT_CASE_var == aggTypeHoursNonPositive ) || ( SELECT_CASE_var == aggTypeHoursNegative );
+				countZero = ( SELECT_CASE_var == aggTypeHoursZero ) || ( SELECT_CASE_var == aggTypeHoursNonPositive ) || ( SELECT_CASE_var == aggTypeHoursNonNegative );
+				countPositive = ( SELECT_CASE_var == aggTypeHoursNonZero ) || ( SELECT_CASE_var == aggTypeHoursPositive ) || ( SELECT_CASE_var == aggTypeHoursNonNegative );
+				for ( iEntry = kernel.firstEntry; iEntry <= kernel.lastEntry; ++iEntry ) {
+					curValue = AggSourceValue( MonthlyAggSource( iEntry ) );
+					if ( curValue < 0.0 ? countNegative : ( curValue > 0.0 ? countPositive : countZero ) ) {
+						MonthlyColumnsType & column( MonthlyColumns( MonthlyAggColumn( iEntry ) ) );
+						column.reslt( Month ) += elapsedTime;
+						column.timeStamp( Month ) = 0;
+						column.duration( Month ) = 0.0;
+					}
+				}
+			}}
+		}
+	}
+
 	void
 	GatherBEPSResultsForTimestep( int const IndexTypeKey ) // What kind of data to update (Zone, HVAC)
 	{
@@ -3927,6 +4523,7 @@ namespace OutputReportTabular {
 		int kEndUseSub;
 		Real64 curMeterValue;
 		int curMeterNumber;
+		int iEntry;
 
 		// if no beps report is called then skip
 
@@ -3943,36 +4540,52 @@ namespace OutputReportTabular {
 			//    END IF
 			//  END DO
 
-			// loop through all of the resources and end uses for the entire facility
-			for ( iResource = 1; iResource <= numResourceTypes; ++iResource ) {
-				curMeterNumber = meterNumTotalsBEPS( iResource );
-				if ( curMeterNumber > 0 ) {
-					curMeterValue = GetCurrentMeterValue( curMeterNumber );
-					gatherTotalsBEPS( iResource ) += curMeterValue;
+			if ( DataSystemVariables::TabularAggregationPlan ) {
+				// meters of the aggregation plan by gathering array
+				for ( iEntry = BEPSAggStart( 1 ); iEntry < BEPSAggStart( 2 ); ++iEntry ) {
+					gatherTotalsBEPS[ BEPSAggTarget( iEntry ) ] += AggSourceValue( BEPSAggSource( iEntry ) );
 				}
-
-				for ( jEndUse = 1; jEndUse <= NumEndUses; ++jEndUse ) {
-					curMeterNumber = meterNumEndUseBEPS( jEndUse, iResource );
+				for ( iEntry = BEPSAggStart( 2 ); iEntry < BEPSAggStart( 3 ); ++iEntry ) {
+					gatherEndUseBEPS[ BEPSAggTarget( iEntry ) ] += AggSourceValue( BEPSAggSource( iEntry ) );
+				}
+				for ( iEntry = BEPSAggStart( 3 ); iEntry < BEPSAggStart( 4 ); ++iEntry ) {
+					gatherEndUseSubBEPS[ BEPSAggTarget( iEntry ) ] += AggSourceValue( BEPSAggSource( iEntry ) );
+				}
+				for ( iEntry = BEPSAggStart( 4 ); iEntry < BEPSAggStart( 5 ); ++iEntry ) {
+					gatherTotalsSource[ BEPSAggTarget( iEntry ) ] += AggSourceValue( BEPSAggSource( iEntry ) );
+				}
+			} else {
+				// loop through all of the resources and end uses for the entire facility
+				for ( iResource = 1; iResource <= numResourceTypes; ++iResource ) {
+					curMeterNumber = meterNumTotalsBEPS( iResource );
 					if ( curMeterNumber > 0 ) {
 						curMeterValue = GetCurrentMeterValue( curMeterNumber );
-						gatherEndUseBEPS( jEndUse, iResource ) += curMeterValue;
+						gatherTotalsBEPS( iResource ) += curMeterValue;
+					}
 
-						for ( kEndUseSub = 1; kEndUseSub <= EndUseCategory( jEndUse ).NumSubcategories; ++kEndUseSub ) {
-							curMeterNumber = meterNumEndUseSubBEPS( iResource, jEndUse, kEndUseSub );
-							if ( curMeterNumber > 0 ) {
-								curMeterValue = GetCurrentMeterValue( curMeterNumber );
-								gatherEndUseSubBEPS( iResource, jEndUse, kEndUseSub ) += curMeterValue;
+					for ( jEndUse = 1; jEndUse <= NumEndUses; ++jEndUse ) {
+						curMeterNumber = meterNumEndUseBEPS( jEndUse, iResource );
+						if ( curMeterNumber > 0 ) {
+							curMeterValue = GetCurrentMeterValue( curMeterNumber );
+							gatherEndUseBEPS( jEndUse, iResource ) += curMeterValue;
+
+							for ( kEndUseSub = 1; kEndUseSub <= EndUseCategory( jEndUse ).NumSubcategories; ++kEndUseSub ) {
+								curMeterNumber = meterNumEndUseSubBEPS( iResource, jEndUse, kEndUseSub );
+								if ( curMeterNumber > 0 ) {
+									curMeterValue = GetCurrentMeterValue( curMeterNumber );
+									gatherEndUseSubBEPS( iResource, jEndUse, kEndUseSub ) += curMeterValue;
+								}
 							}
 						}
 					}
 				}
-			}
 
-			for ( iResource = 1; iResource <= numSourceTypes; ++iResource ) {
-				curMeterNumber = meterNumTotalsSource( iResource );
-				if ( curMeterNumber > 0 ) {
-					curMeterValue = GetCurrentMeterValue( curMeterNumber );
-					gatherTotalsSource( iResource ) += curMeterValue;
+				for ( iResource = 1; iResource <= numSourceTypes; ++iResource ) {
+					curMeterNumber = meterNumTotalsSource( iResource );
+					if ( curMeterNumber > 0 ) {
+						curMeterValue = GetCurrentMeterValue( curMeterNumber );
+						gatherTotalsSource( iResource ) += curMeterValue;
+					}
 				}
 			}
 
@@ -4357,14 +4970,11 @@ namespace OutputReportTabular {
 		static int curZone( 0 );
 		static Real64 eqpSens( 0.0 );
 		static Real64 total( 0.0 );
-		// the following arrays store the radiant total for each timestep
-		static FArray1D< Real64 > radiantHeat;
-		static FArray1D< Real64 > radiantCool;
+		// the radiant total for each timestep is stored in radiantHeat and radiantCool at module scope
 		static int timestepTimeStamp( 0 );
 		static Real64 bldgHtPk( 0.0 );
 		static Real64 bldgClPk( 0.0 );
 		static Real64 timeStepRatio( 0.0 );
-		static bool firstTime( true );
 
 		int ActualTimeMin;
 
@@ -4374,10 +4984,10 @@ namespace OutputReportTabular {
 
 		if ( IndexTypeKey == stepTypeZone ) return; //only add values over the HVAC timestep basis
 
-		if ( firstTime ) {
+		if ( GatherHeatGainReportfirstTime ) {
 			radiantHeat.allocate( NumOfZones );
 			radiantCool.allocate( NumOfZones );
-			firstTime = false;
+			GatherHeatGainReportfirstTime = false;
 		}
 		//clear the radiant surface accumulation variables
 		radiantHeat = 0.0;
@@ -10559,9 +11169,9 @@ namespace OutputReportTabular {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool DoAllocate( true );
+		// na
 
-		if ( DoAllocate ) {
+		if ( AllocateLoadComponentArraysDoAllocate ) {
 			//For many of the following arrays the last dimension is the number of environments and is same as sizing arrays
 			radiantPulseUsed.allocate( NumOfZones, {0,TotDesDays + TotRunDesPersDays} );
 			radiantPulseUsed = 0.0;
@@ -10583,6 +11193,10 @@ namespace OutputReportTabular {
 			ITABSFseq = 0.0;
 			TMULTseq.allocate( NumOfZones, NumOfTimeStepInHour * 24, TotDesDays + TotRunDesPersDays );
 			TMULTseq = 0.0;
+			HConvInAtPulse.allocate( TotSurfaces, TotDesDays + TotRunDesPersDays );
+			HConvInAtPulse = 0.0;
+			TempSurfInAtPulse.allocate( TotSurfaces, TotDesDays + TotRunDesPersDays );
+			TempSurfInAtPulse = 0.0;
 			peopleInstantSeq.allocate( NumOfZones, NumOfTimeStepInHour * 24, TotDesDays + TotRunDesPersDays );
 			peopleInstantSeq = 0.0;
 			peopleLatentSeq.allocate( NumOfZones, NumOfTimeStepInHour * 24, TotDesDays + TotRunDesPersDays );
@@ -10653,7 +11267,7 @@ namespace OutputReportTabular {
 			feneSolarDelaySeq = 0.0;
 			surfDelaySeq.allocate( TotSurfaces, NumOfTimeStepInHour * 24, TotDesDays + TotRunDesPersDays );
 			surfDelaySeq = 0.0;
-			DoAllocate = false;
+			AllocateLoadComponentArraysDoAllocate = false;
 		}
 	}
 
@@ -10807,6 +11421,188 @@ namespace OutputReportTabular {
 		}
 	}
 
+	void
+	ComputeLoadComponentDecayCurveFromCTF()
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Determines the load component decay curves from the conduction transfer functions and
+		// interior radiant exchange of each zone, used instead of ComputeLoadComponentDecayCurve
+		// when LoadComponentDecayFromCTF is set so that the pulse zone sizing run is not needed.
+
+		// METHODOLOGY EMPLOYED:
+		// The decay curve of each controlled zone is computed for the cooling and heating design
+		// days selected by ComputeZoneDecayCurveFromCTF.
+
+		// Using/Aliasing
+		using DataSizing::CalcFinalZoneSizing;
+		using DataZoneEquipment::ZoneEquipConfig;
+
+		// Locals
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int ZoneNum;
+
+		for ( ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum ) {
+			if ( ! ZoneEquipConfig( ZoneNum ).IsControlled ) continue;
+			if ( CalcFinalZoneSizing( ZoneNum ).CoolDDNum != 0 ) {
+				ComputeZoneDecayCurveFromCTF( ZoneNum, CalcFinalZoneSizing( ZoneNum ).CoolDDNum, decayCurveCool );
+			}
+			if ( CalcFinalZoneSizing( ZoneNum ).HeatDDNum != 0 ) {
+				ComputeZoneDecayCurveFromCTF( ZoneNum, CalcFinalZoneSizing( ZoneNum ).HeatDDNum, decayCurveHeat );
+			}
+		}
+	}
+
+	void
+	ComputeZoneDecayCurveFromCTF(
+		int const ZoneNum, // zone the decay curves are computed for
+		int const DesDayNum, // design day the absorbed fractions are taken from
+		FArray2< Real64 > & decayCurve // decay curves of the surfaces (decayCurveCool or decayCurveHeat)
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Computes the decay curves of the surfaces of a zone as the linear response of the inside
+		// surface heat balances to a radiant pulse absorbed during the first time step.
+
+		// METHODOLOGY EMPLOYED:
+		// The pulse is shared among the surfaces as the radiant internal gains are at 10am of the
+		// design day, when the pulse of the zone sizing run occurs.  The response is the change in
+		// the inside face temperatures from the normal run, with the zone air and the outside faces
+		// held at their normal temperatures.  Each time step the inside face balances
+		//   (CTFInside(0) + HConvIn + sum hr) T - sum hr Tother = absorbed pulse + CTF histories
+		// are solved together, where hr linearizes the ScriptF exchange between the surfaces about
+		// their inside face temperatures.  HConvIn and the inside face temperatures are those of the
+		// design day at the time step of the pulse, as gathered by GatherComponentLoadsSurfAbsFact.  The coefficients do not change with the time step so the
+		// matrix is factored once.  Windows have no CTFs and conduct with their nominal U-value.
+		// As in ComputeLoadComponentDecayCurve the decay curve is the heat convected from the surface
+		// over the radiant heat absorbed by the surface.
+
+		// Using/Aliasing
+		using DataGlobals::KelvinConv;
+		using DataGlobals::NumOfTimeStepInHour;
+		using DataHeatBalance::Construct;
+		using DataHeatBalance::NominalU;
+		using DataSurfaces::Surface;
+		using DataViewFactorInformation::ZoneInfo;
+
+		// Locals
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int NumSurf; // number of surfaces exchanging radiation in the zone
+		int NumTimeSteps; // time steps in the decay curve
+		int PulseTimeStep; // time step of the day of the pulse
+		int iSurf;
+		int jSurf;
+		int kSurf;
+		int SurfNum;
+		int ConstrNum;
+		int TimeStepNum;
+		int Term;
+		int Lag; // time steps between the terms of the CTF histories
+		Real64 hRad; // linearized radiant exchange coefficient between two surfaces (W/m2-K)
+		Real64 MeanTemp; // mean of the inside face temperatures of two surfaces (K)
+		Real64 factor;
+		FArray2D< Real64 > Coef; // coefficients of the inside face balances, factored in place
+		FArray1D< Real64 > Absorbed; // radiant pulse absorbed by each surface (per unit of the zone pulse and area)
+		FArray1D< Real64 > InsideCoef; // conduction coefficient of the current inside face temperature
+		FArray2D< Real64 > TempResp; // change in the inside face temperatures
+		FArray2D< Real64 > FluxResp; // change in the conduction into the inside faces
+		FArray1D< Real64 > Rhs;
+
+		NumSurf = ZoneInfo( ZoneNum ).NumOfSurfaces;
+		if ( NumSurf == 0 ) return;
+		NumTimeSteps = NumOfTimeStepInHour * 24;
+		PulseTimeStep = 9 * NumOfTimeStepInHour + 1;
+		Coef.dimension( NumSurf, NumSurf, 0.0 );
+		Absorbed.dimension( NumSurf, 0.0 );
+		InsideCoef.dimension( NumSurf, 0.0 );
+		TempResp.dimension( NumSurf, NumTimeSteps, 0.0 );
+		FluxResp.dimension( NumSurf, NumTimeSteps, 0.0 );
+		Rhs.dimension( NumSurf, 0.0 );
+
+		for ( iSurf = 1; iSurf <= NumSurf; ++iSurf ) {
+			SurfNum = ZoneInfo( ZoneNum ).SurfacePtr( iSurf );
+			ConstrNum = Surface( SurfNum ).Construction;
+			Absorbed( iSurf ) = ITABSFseq( SurfNum, PulseTimeStep, DesDayNum );
+			if ( Construct( ConstrNum ).TypeIsWindow ) {
+				InsideCoef( iSurf ) = NominalU( ConstrNum );
+			} else if ( Surface( SurfNum ).ExtBoundCond == SurfNum ) { // both faces see the zone
+				InsideCoef( iSurf ) = Construct( ConstrNum ).CTFInside( 0 ) - Construct( ConstrNum ).CTFCross( 0 );
+			} else {
+				InsideCoef( iSurf ) = Construct( ConstrNum ).CTFInside( 0 );
+			}
+			Coef( iSurf, iSurf ) = InsideCoef( iSurf ) + HConvInAtPulse( SurfNum, DesDayNum );
+			for ( jSurf = 1; jSurf <= NumSurf; ++jSurf ) {
+				if ( jSurf == iSurf ) continue;
+				MeanTemp = 0.5 * ( TempSurfInAtPulse( SurfNum, DesDayNum ) + TempSurfInAtPulse( ZoneInfo( ZoneNum ).SurfacePtr( jSurf ), DesDayNum ) ) + KelvinConv;
+				// ScriptF( sending, receiving ) already holds the Stefan-Boltzmann constant
+				hRad = 4.0 * ZoneInfo( ZoneNum ).ScriptF( jSurf, iSurf ) * pow_3( MeanTemp );
+				Coef( iSurf, iSurf ) += hRad;
+				Coef( iSurf, jSurf ) = -hRad;
+			}
+		}
+
+		// factor the balances; each row is diagonally dominant so no pivoting is needed
+		for ( kSurf = 1; kSurf <= NumSurf; ++kSurf ) {
+			for ( iSurf = kSurf + 1; iSurf <= NumSurf; ++iSurf ) {
+				factor = Coef( iSurf, kSurf ) / Coef( kSurf, kSurf );
+				Coef( iSurf, kSurf ) = factor;
+				for ( jSurf = kSurf + 1; jSurf <= NumSurf; ++jSurf ) {
+					Coef( iSurf, jSurf ) -= factor * Coef( kSurf, jSurf );
+				}
+			}
+		}
+
+		for ( TimeStepNum = 1; TimeStepNum <= NumTimeSteps; ++TimeStepNum ) {
+			// history terms of the CTFs, the pulse is absorbed during the first time step
+			for ( iSurf = 1; iSurf <= NumSurf; ++iSurf ) {
+				SurfNum = ZoneInfo( ZoneNum ).SurfacePtr( iSurf );
+				auto const & construct( Construct( Surface( SurfNum ).Construction ) );
+				Rhs( iSurf ) = 0.0;
+				if ( ! construct.TypeIsWindow ) {
+					Lag = max( construct.NumHistories, 1 );
+					for ( Term = 1; Term <= construct.NumCTFTerms; ++Term ) {
+						if ( TimeStepNum - Term * Lag < 1 ) break;
+						if ( Surface( SurfNum ).ExtBoundCond == SurfNum ) {
+							Rhs( iSurf ) -= ( construct.CTFInside( Term ) - construct.CTFCross( Term ) ) * TempResp( iSurf, TimeStepNum - Term * Lag );
+						} else {
+							Rhs( iSurf ) -= construct.CTFInside( Term ) * TempResp( iSurf, TimeStepNum - Term * Lag );
+						}
+						Rhs( iSurf ) += construct.CTFFlux( Term ) * FluxResp( iSurf, TimeStepNum - Term * Lag );
+					}
+				}
+				FluxResp( iSurf, TimeStepNum ) = Rhs( iSurf );
+				if ( TimeStepNum == 1 ) Rhs( iSurf ) += Absorbed( iSurf );
+			}
+			// forward and back substitution
+			for ( iSurf = 2; iSurf <= NumSurf; ++iSurf ) {
+				for ( kSurf = 1; kSurf < iSurf; ++kSurf ) {
+					Rhs( iSurf ) -= Coef( iSurf, kSurf ) * Rhs( kSurf );
+				}
+			}
+			for ( iSurf = NumSurf; iSurf >= 1; --iSurf ) {
+				for ( jSurf = iSurf + 1; jSurf <= NumSurf; ++jSurf ) {
+					Rhs( iSurf ) -= Coef( iSurf, jSurf ) * TempResp( jSurf, TimeStepNum );
+				}
+				TempResp( iSurf, TimeStepNum ) = Rhs( iSurf ) / Coef( iSurf, iSurf );
+			}
+			for ( iSurf = 1; iSurf <= NumSurf; ++iSurf ) {
+				FluxResp( iSurf, TimeStepNum ) -= InsideCoef( iSurf ) * TempResp( iSurf, TimeStepNum );
+			}
+		}
+
+		for ( iSurf = 1; iSurf <= NumSurf; ++iSurf ) {
+			SurfNum = ZoneInfo( ZoneNum ).SurfacePtr( iSurf );
+			for ( TimeStepNum = 1; TimeStepNum <= NumTimeSteps; ++TimeStepNum ) {
+				if ( Absorbed( iSurf ) != 0.0 ) {
+					decayCurve( SurfNum, TimeStepNum ) = HConvInAtPulse( SurfNum, DesDayNum ) * TempResp( iSurf, TimeStepNum ) / Absorbed( iSurf );
+				} else {
+					decayCurve( SurfNum, TimeStepNum ) = 0.0;
+				}
+			}
+		}
+	}
+
 	void
 	GatherComponentLoadsSurface()
 	{
@@ -241,6 +241,8 @@ namespace OutputReportTabular {
 	extern FArray2D< Real64 > decayCurveHeat;
 	extern FArray3D< Real64 > ITABSFseq; // used for determining the radiant fraction on each surface
 	extern FArray3D< Real64 > TMULTseq; // used for determining the radiant fraction on each surface
+	extern FArray2D< Real64 > HConvInAtPulse; // inside convection coefficient of each surface at the pulse time step of each design day
+	extern FArray2D< Real64 > TempSurfInAtPulse; // inside face temperature of each surface at the pulse time step of each design day
 
 	extern FArray3D< Real64 > peopleInstantSeq;
 	extern FArray3D< Real64 > peopleLatentSeq;
@@ -298,6 +300,40 @@ namespace OutputReportTabular {
 	extern std::string activeForName;
 	extern std::string prevReportName;
 
+	// Streaming aggregation plan of the monthly, binned and BEPS reports - see SetupTabularAggregationPlan
+	extern int NumAggSources; // Number of distinct variables and meters read by the plan
+	extern FArray1D_int AggSourceTypeOfVar; // 0=not found, 1=integer, 2=real, 3=meter, 4=schedule
+	extern FArray1D_int AggSourceVarNum; // Variable or meter number of each source
+	extern FArray1D_int AggSourceStart; // First source of each step type, the sources of a step type are contiguous
+	extern FArray1D< Real64 > AggSourceValue; // Value of each source at the current timestep
+	extern int NumMonthlyAggKernels;
+	extern FArray1D_int MonthlyAggColumn; // Monthly column of each monthly plan entry, grouped by kernel
+	extern FArray1D_int MonthlyAggSource; // Source of each monthly plan entry
+	extern FArray1D_bool MonthlyTablePlanned; // TRUE if a monthly table is gathered by the plan
+	extern FArray1D_int BinAggObject; // Binned object of each binned plan entry, grouped by step type
+	extern FArray1D_int BinAggRepIndex; // Binned result of each binned plan entry
+	extern FArray1D_int BinAggSource; // Source of each binned plan entry
+	extern FArray1D_int BinAggStart; // First binned plan entry of each step type
+	extern FArray1D_int BEPSAggTarget; // Element of the BEPS gathering array of each BEPS plan entry
+	extern FArray1D_int BEPSAggSource; // Source of each BEPS plan entry
+	extern FArray1D_int BEPSAggStart; // First BEPS plan entry of each gathering array (see GatherBEPSResultsForTimestep)
+
+	// Flags and saved arrays of the gathering routines, kept at module scope so clear_state can reset them
+	extern bool UpdateTabularReportsGetInput; // TRUE until the tabular report input has been read
+	extern bool VarWarning; // TRUE until the first missing monthly variable warning
+	extern int ErrCount1; // Missing monthly variables
+	extern int ErrCount2; // Missing monthly meters
+	extern bool GatherMonthlyResultsForTimestepRunOnce; // TRUE until the monthly column copies below are made
+	extern FArray1D_int MonthlyColumnsTypeOfVar; // Copies of MonthlyColumns and MonthlyTables members used while gathering
+	extern FArray1D_int MonthlyColumnsStepType;
+	extern FArray1D_int MonthlyColumnsAggType;
+	extern FArray1D_int MonthlyColumnsVarNum;
+	extern FArray1D_int MonthlyTablesNumColumns;
+	extern bool GatherHeatGainReportfirstTime; // TRUE until radiantHeat and radiantCool are allocated
+	extern FArray1D< Real64 > radiantHeat; // Radiant system heating of each zone at the current timestep
+	extern FArray1D< Real64 > radiantCool; // Radiant system cooling of each zone at the current timestep
+	extern bool AllocateLoadComponentArraysDoAllocate; // TRUE until the load component arrays are allocated
+
 	// SUBROUTINE SPECIFICATIONS FOR MODULE PrimaryPlantLoops
 	//PRIVATE      DateToStr
 
@@ -647,6 +683,26 @@ namespace OutputReportTabular {
 
 	};
 
+	struct MonthlyAggKernelType
+	{
+		// Members
+		int stepType; // Variable time step is Zone=1 or HVAC=2
+		int aggType; // index to the type of aggregation (see list of parameters)
+		int avgSum; // Variables are Averaged=1 or Summed=2
+		int firstEntry; // first monthly plan entry of the kernel
+		int lastEntry; // last monthly plan entry of the kernel
+
+		// Default Constructor
+		MonthlyAggKernelType() :
+			stepType( 0 ),
+			aggType( 0 ),
+			avgSum( 0 ),
+			firstEntry( 0 ),
+			lastEntry( -1 )
+		{}
+
+	};
+
 	struct TOCEntriesType
 	{
 		// Members
@@ -724,11 +780,15 @@ namespace OutputReportTabular {
 	extern FArray1D< MonthlyInputType > MonthlyInput;
 	extern FArray1D< MonthlyTablesType > MonthlyTables;
 	extern FArray1D< MonthlyColumnsType > MonthlyColumns;
+	extern FArray1D< MonthlyAggKernelType > MonthlyAggKernel; // aggregation kernels of the monthly plan entries
 	extern FArray1D< TOCEntriesType > TOCEntries;
 	extern FArray1D< UnitConvType > UnitConv;
 
 	// Functions
 
+	void
+	clear_state();
+
 	void
 	UpdateTabularReports( int const IndexTypeKey ); // What kind of data to update (Zone, HVAC)
 
@@ -808,6 +868,9 @@ namespace OutputReportTabular {
 	void
 	WriteTableOfContents();
 
+	void
+	SetupTabularAggregationPlan();
+
 	//======================================================================================================================
 	//======================================================================================================================
 
@@ -816,12 +879,30 @@ namespace OutputReportTabular {
 	//======================================================================================================================
 	//======================================================================================================================
 
+	void
+	GatherTabularAggregationSources( int const IndexTypeKey ); // What kind of data to update (Zone, HVAC)
+
 	void
 	GatherBinResultsForTimestep( int const IndexTypeKey ); // What kind of data to update (Zone, HVAC)
 
+	void
+	AddBinValue(
+		int const iInObj, // binned object
+		int const repIndex, // binned result
+		Real64 const curValue, // value to bin
+		Real64 const elapsedTime // length of the time step (hr)
+	);
+
 	void
 	GatherMonthlyResultsForTimestep( int const IndexTypeKey ); // What kind of data to update (Zone, HVAC)
 
+	void
+	GatherMonthlyAggregationPlan(
+		int const IndexTypeKey, // What kind of data to update (Zone, HVAC)
+		Real64 const elapsedTime, // length of the time step (hr)
+		int const timestepTimeStamp // encoded timestamp of the time step
+	);
+
 	void
 	GatherBEPSResultsForTimestep( int const IndexTypeKey ); // What kind of data to update (Zone, HVAC)
 
@@ -902,6 +983,16 @@ namespace OutputReportTabular {
 	void
 	ComputeLoadComponentDecayCurve();
 
+	void
+	ComputeLoadComponentDecayCurveFromCTF();
+
+	void
+	ComputeZoneDecayCurveFromCTF(
+		int const ZoneNum, // zone the decay curves are computed for
+		int const DesDayNum, // design day the absorbed fractions are taken from
+		FArray2< Real64 > & decayCurve // decay curves of the surfaces (decayCurveCool or decayCurveHeat)
+	);
+
 	void
 	GatherComponentLoadsSurface();
 
@@ -17,6 +17,7 @@
 #include <DataLoopNode.hh>
 #include <DataPlant.hh>
 #include <DataPrecisionGlobals.hh>
+#include <DataTimings.hh>
 #include <EvaporativeFluidCoolers.hh>
 #include <FluidCoolers.hh>
 #include <FuelCellElectricGenerator.hh>
@@ -194,6 +195,8 @@ namespace PlantLoopEquip {
 		using HVACVariableRefrigerantFlow::SimVRFCondenserPlant;
 		using PlantComponentTemperatureSources::SimWaterSource;
 		using PlantCentralGSHP::SimCentralGroundSourceHeatPump;
+		using DataTimings::epStartHVACProfile;
+		using DataTimings::epStopHVACProfile;
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -253,6 +256,8 @@ namespace PlantLoopEquip {
 		RunFlag = sim_component.ON;
 		CurLoad = sim_component.MyLoad;
 
+		epStartHVACProfile( sim_component.Name );
+
 		//select equipment and call equiment simulation
 		TypeOfEquip:
 		//PIPES
@@ -1131,6 +1136,8 @@ namespace PlantLoopEquip {
 			ShowFatalError( "Preceding condition causes termination." );
 		} // TypeOfEquip
 
+		epStopHVACProfile();
+
 	}
 
 	//     NOTICE
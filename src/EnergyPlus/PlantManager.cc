@@ -18,6 +18,8 @@
 #include <DataLoopNode.hh>
 #include <DataPrecisionGlobals.hh>
 #include <DataSizing.hh>
+#include <DataSystemVariables.hh>
+#include <DataTimings.hh>
 #include <EMSManager.hh>
 #include <FluidProperties.hh>
 #include <General.hh>
@@ -142,7 +144,7 @@ namespace PlantManager {
 		using DataGlobals::AnyEnergyManagementSystemInModel;
 		using PlantUtilities::LogPlantConvergencePoints;
 		using DataConvergParams::MinPlantSubIterations;
-		using DataConvergParams::MaxPlantSubIterations;
+		using DataSystemVariables::PlantLoopGroupSolve;
 
 		// SUBROUTINE ARGUMENT DEFINITIONS
 
@@ -150,13 +152,11 @@ namespace PlantManager {
 		// SUBROUTINE PARAMETER DEFINITIONS
 
 		// SUBROUTINE VARIABLE DEFINITIONS
-		int IterPlant;
 		int LoopNum;
 		int LoopSide;
-		int LoopSideNum;
-		int OtherSide;
-		bool SimHalfLoopFlag;
-		int HalfLoopNum;
+		int LoopGroupNum; // group of interconnected loops being solved
+		bool SimPlantLoopGroup; // True when some part of the loop group needs to be (re)simulated
+		bool SimAnyPlantLoopGroup; // True when any loop group did not converge
 		int CurntMinPlantSubIterations;
 
 		if ( any_eq( PlantLoop.CommonPipeType(), CommonPipe_Single ) || any_eq( PlantLoop.CommonPipeType(), CommonPipe_TwoWay ) ) {
@@ -170,14 +170,103 @@ namespace PlantManager {
 			return;
 		}
 
-		IterPlant = 0;
 		InitializeLoops( FirstHVACIteration );
 
+		if ( PlantLoopGroupSolve && NumPlantLoopGroups > 1 ) {
+			// each group of interconnected loops is iterated to convergence on its own
+			SimAnyPlantLoopGroup = false;
+			for ( LoopGroupNum = 1; LoopGroupNum <= NumPlantLoopGroups; ++LoopGroupNum ) {
+				SimPlantLoopGroup = SimPlantLoops;
+				CurntMinPlantSubIterations = MinPlantSubIterations;
+				for ( LoopNum = 1; LoopNum <= TotNumLoops; ++LoopNum ) {
+					if ( PlantLoopGroupNum( LoopNum ) != LoopGroupNum ) continue;
+					if ( PlantLoop( LoopNum ).CommonPipeType == CommonPipe_Single || PlantLoop( LoopNum ).CommonPipeType == CommonPipe_TwoWay ) {
+						CurntMinPlantSubIterations = max( 7, MinPlantSubIterations );
+					}
+				}
+				SolvePlantLoopGroup( FirstHVACIteration, LoopGroupNum, CurntMinPlantSubIterations, SimPlantLoopGroup );
+				if ( SimPlantLoopGroup ) SimAnyPlantLoopGroup = true;
+			}
+			SimPlantLoops = SimAnyPlantLoopGroup;
+		} else {
+			SolvePlantLoopGroup( FirstHVACIteration, 0, CurntMinPlantSubIterations, SimPlantLoops );
+		}
+
+		// add check for non-plant system sim flag updates
+		//  could set SimAirLoops, SimElecCircuits, SimZoneEquipment flags for now
+		for ( LoopNum = 1; LoopNum <= TotNumLoops; ++LoopNum ) {
+			for ( LoopSide = DemandSide; LoopSide <= SupplySide; ++LoopSide ) {
+			auto & this_loop_side( PlantLoop(LoopNum).LoopSide(LoopSide) );
+			if ( this_loop_side.SimAirLoopsNeeded ) SimAirLoops = true;
+				if ( this_loop_side.SimZoneEquipNeeded ) SimZoneEquipment = true;
+				//  IF (this_loop_side.SimNonZoneEquipNeeded) SimNonZoneEquipment = .TRUE.
+				if ( this_loop_side.SimElectLoadCentrNeeded ) SimElecCircuits = true;
+			}
+		}
+
+		//Also log the convergence history of all loopsides once complete
+		LogPlantConvergencePoints( FirstHVACIteration );
+
+	}
+
+	void
+	SolvePlantLoopGroup(
+		bool const FirstHVACIteration,
+		int const LoopGroupNum, // group of interconnected loops to solve, 0 for all loops
+		int const MinSubIterations, // minimum number of plant sub iterations
+		bool & SimPlantLoops // True when some part of the loop group needs to be (re)simulated
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         Sankaranarayanan K P
+		//       DATE WRITTEN   Apr 2005
+		//       MODIFIED       Oct 2026, moved from ManagePlantLoops so loop groups can be solved separately
+		//       RE-ENGINEERED  B. Griffith, Feb. 2010
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Iterates the half loops of one group of interconnected plant loops, or of all
+		// plant loops, until they no longer need to be resimulated.
+
+		// METHODOLOGY EMPLOYED:
+		// Calls half loop sides to be simulated in predetermined order, skipping loops
+		// outside the requested group.  Loops in different groups share no connections,
+		// so each group can be iterated to convergence on its own.  The groups are still
+		// solved one after another: the half loop solver and the plant component models
+		// keep module-level state, which would have to become per loop before groups
+		// could be solved concurrently.
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		using DataConvergParams::MaxPlantSubIterations;
+		using DataTimings::epStartHVACProfile;
+		using DataTimings::epStopHVACProfile;
+
+		// SUBROUTINE ARGUMENT DEFINITIONS
+
+		// Locals
+		// SUBROUTINE PARAMETER DEFINITIONS
+		static FArray1D_string const ProfileLoopSideName( 2, { "Demand Side", "Supply Side" } ); // HVAC profile entry names
+
+		// SUBROUTINE VARIABLE DEFINITIONS
+		int IterPlant;
+		int LoopNum;
+		int LoopSide;
+		int LoopSideNum;
+		int OtherSide;
+		bool SimHalfLoopFlag;
+		int HalfLoopNum;
+
+		IterPlant = 0;
+
 		while ( ( SimPlantLoops ) && ( IterPlant <= MaxPlantSubIterations ) ) {
 			// go through half loops in predetermined calling order
 			for ( HalfLoopNum = 1; HalfLoopNum <= TotNumHalfLoops; ++HalfLoopNum ) {
 
 				LoopNum = PlantCallingOrderInfo( HalfLoopNum ).LoopIndex;
+				if ( LoopGroupNum > 0 && PlantLoopGroupNum( LoopNum ) != LoopGroupNum ) continue;
 				LoopSide = PlantCallingOrderInfo( HalfLoopNum ).LoopSide;
 				OtherSide = 3 - LoopSide; //will give us 1 if LoopSide is 2, or 2 if LoopSide is 1
 
@@ -187,9 +276,13 @@ namespace PlantManager {
 
 				SimHalfLoopFlag = this_loop_side.SimLoopSideNeeded; //set half loop sim flag
 
-				if ( SimHalfLoopFlag || IterPlant <= CurntMinPlantSubIterations ) {
+				if ( SimHalfLoopFlag || IterPlant <= MinSubIterations ) {
 
+					epStartHVACProfile( this_loop.Name );
+					epStartHVACProfile( ProfileLoopSideName( LoopSide ) );
 					PlantHalfLoopSolver( FirstHVACIteration, LoopSide, LoopNum, other_loop_side.SimLoopSideNeeded );
+					epStopHVACProfile();
+					epStopHVACProfile();
 
 					// Always set this side to false,  so that it won't keep being turned on just because of first hvac
 					this_loop_side.SimLoopSideNeeded = false;
@@ -212,6 +305,7 @@ namespace PlantManager {
 			// decide new status for SimPlantLoops flag
 			SimPlantLoops = false;
 			LoopLevel: for ( LoopNum = 1; LoopNum <= TotNumLoops; ++LoopNum ) {
+				if ( LoopGroupNum > 0 && PlantLoopGroupNum( LoopNum ) != LoopGroupNum ) continue;
 				LoopSideLevel: for ( LoopSideNum = 1; LoopSideNum <= 2; ++LoopSideNum ) {
 					if ( PlantLoop( LoopNum ).LoopSide( LoopSideNum ).SimLoopSideNeeded ) {
 						SimPlantLoops = true;
@@ -225,24 +319,91 @@ namespace PlantManager {
 			LoopLevel_exit: ;
 
 			++IterPlant; // Increment the iteration counter
-			if ( IterPlant < CurntMinPlantSubIterations ) SimPlantLoops = true;
+			if ( IterPlant < MinSubIterations ) SimPlantLoops = true;
 			++PlantManageSubIterations; // these are summed across all half loops for reporting
 		} //while
 
-		// add check for non-plant system sim flag updates
-		//  could set SimAirLoops, SimElecCircuits, SimZoneEquipment flags for now
+
+	}
+
+	void
+	SetupPlantLoopGroups()
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Finds the groups of plant and condenser loops that are connected to each other
+		// through interconnecting components (chillers, heat exchangers, heat pumps, ...).
+
+		// METHODOLOGY EMPLOYED:
+		// The loop side connections set up by InterConnectTwoPlantLoopSides are followed
+		// until every loop has a group number; loops in different groups do not interact
+		// and may be solved independently.  Groups are numbered in loop order.
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+		// na
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS:
+		// na
+
+		// DERIVED TYPE DEFINITIONS:
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int LoopNum;
+		int OtherLoopNum;
+		int LoopSideNum;
+		int ConnctNum;
+		bool GroupChanged; // true while group numbers are still being merged
+
+		NumPlantLoopGroups = 0;
+		if ( TotNumLoops <= 0 ) return;
+
+		PlantLoopGroupNum.allocate( TotNumLoops );
 		for ( LoopNum = 1; LoopNum <= TotNumLoops; ++LoopNum ) {
-			for ( LoopSide = DemandSide; LoopSide <= SupplySide; ++LoopSide ) {
-			auto & this_loop_side( PlantLoop(LoopNum).LoopSide(LoopSide) );
-			if ( this_loop_side.SimAirLoopsNeeded ) SimAirLoops = true;
-				if ( this_loop_side.SimZoneEquipNeeded ) SimZoneEquipment = true;
-				//  IF (this_loop_side.SimNonZoneEquipNeeded) SimNonZoneEquipment = .TRUE.
-				if ( this_loop_side.SimElectLoadCentrNeeded ) SimElecCircuits = true;
+			PlantLoopGroupNum( LoopNum ) = LoopNum;
+		}
+
+		// connected loops take the lowest loop number in their group as the group label
+		GroupChanged = true;
+		while ( GroupChanged ) {
+			GroupChanged = false;
+			for ( LoopNum = 1; LoopNum <= TotNumLoops; ++LoopNum ) {
+				for ( LoopSideNum = DemandSide; LoopSideNum <= SupplySide; ++LoopSideNum ) {
+					auto const & this_loop_side( PlantLoop( LoopNum ).LoopSide( LoopSideNum ) );
+					if ( ! allocated( this_loop_side.Connected ) ) continue;
+					for ( ConnctNum = 1; ConnctNum <= isize( this_loop_side.Connected ); ++ConnctNum ) {
+						OtherLoopNum = this_loop_side.Connected( ConnctNum ).LoopNum;
+						if ( OtherLoopNum < 1 || OtherLoopNum > TotNumLoops ) continue;
+						if ( PlantLoopGroupNum( OtherLoopNum ) < PlantLoopGroupNum( LoopNum ) ) {
+							PlantLoopGroupNum( LoopNum ) = PlantLoopGroupNum( OtherLoopNum );
+							GroupChanged = true;
+						} else if ( PlantLoopGroupNum( LoopNum ) < PlantLoopGroupNum( OtherLoopNum ) ) {
+							PlantLoopGroupNum( OtherLoopNum ) = PlantLoopGroupNum( LoopNum );
+							GroupChanged = true;
+						}
+					}
+				}
 			}
 		}
 
-		//Also log the convergence history of all loopsides once complete
-		LogPlantConvergencePoints( FirstHVACIteration );
+		// renumber the group labels 1 to NumPlantLoopGroups
+		for ( LoopNum = 1; LoopNum <= TotNumLoops; ++LoopNum ) {
+			if ( PlantLoopGroupNum( LoopNum ) == LoopNum ) {
+				++NumPlantLoopGroups;
+				PlantLoopGroupNum( LoopNum ) = NumPlantLoopGroups;
+			} else {
+				PlantLoopGroupNum( LoopNum ) = PlantLoopGroupNum( PlantLoopGroupNum( LoopNum ) );
+			}
+		}
 
 	}
 
@@ -2130,6 +2291,7 @@ namespace PlantManager {
 				// have now called each plant component model at least once with InitLoopEquip = .TRUE.
 				//  this means the calls to InterConnectTwoPlantLoopSides have now been made, so rework calling order
 				RevisePlantCallingOrder();
+				SetupPlantLoopGroups();
 
 				// Step 4: Simulate plant loop components so their design flows are included
 
@@ -139,6 +139,17 @@ namespace PlantManager {
 		bool & SimElecCircuits // True when electic circuits need to be (re)simulated
 	);
 
+	void
+	SolvePlantLoopGroup(
+		bool const FirstHVACIteration,
+		int const LoopGroupNum, // group of interconnected loops to solve, 0 for all loops
+		int const MinSubIterations, // minimum number of plant sub iterations
+		bool & SimPlantLoops // True when some part of the loop group needs to be (re)simulated
+	);
+
+	void
+	SetupPlantLoopGroups();
+
 	void
 	GetPlantLoopData();
 
@@ -24,6 +24,7 @@
 #include <DataPlant.hh>
 #include <DataPrecisionGlobals.hh>
 #include <DataSurfaces.hh>
+#include <DataSystemVariables.hh>
 #include <FluidProperties.hh>
 #include <General.hh>
 #include <InputProcessor.hh>
@@ -6554,6 +6555,7 @@ namespace PlantPipingSystemsManager {
 		// na
 		using DataGlobals::TimeStep;
 		using DataEnvironment::CurMnDyHr;
+		using DataSystemVariables::PipingSystemsPCGSolve;
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -6571,7 +6573,7 @@ namespace PlantPipingSystemsManager {
 					if ( SELECT_CASE_var == CellType_Pipe ) {
 						//'pipes are simulated separately
 					} else if ( ( SELECT_CASE_var == CellType_GeneralField ) || ( SELECT_CASE_var == CellType_Slab ) || ( SELECT_CASE_var == CellType_HorizInsulation ) || ( SELECT_CASE_var == CellType_VertInsulation ) ) {
-						PipingSystemDomains( DomainNum ).Cells( X, Y, Z ).MyBase.Temperature = EvaluateFieldCellTemperature( DomainNum, PipingSystemDomains( DomainNum ).Cells( X, Y, Z ) );
+						if ( ! PipingSystemsPCGSolve ) PipingSystemDomains( DomainNum ).Cells( X, Y, Z ).MyBase.Temperature = EvaluateFieldCellTemperature( DomainNum, PipingSystemDomains( DomainNum ).Cells( X, Y, Z ) );
 					} else if ( SELECT_CASE_var == CellType_GroundSurface ) {
 						PipingSystemDomains( DomainNum ).Cells( X, Y, Z ).MyBase.Temperature = EvaluateGroundSurfaceTemperature( DomainNum, PipingSystemDomains( DomainNum ).Cells( X, Y, Z ) );
 					} else if ( SELECT_CASE_var == CellType_FarfieldBoundary ) {
@@ -6592,6 +6594,9 @@ namespace PlantPipingSystemsManager {
 			}
 		}
 
+		// With the boundary cells updated, the field cells are one linear system
+		if ( PipingSystemsPCGSolve ) SolveFieldCellTemperatures( DomainNum );
+
 	}
 
 	//*********************************************************************************************!
@@ -6672,6 +6677,275 @@ namespace PlantPipingSystemsManager {
 
 	//*********************************************************************************************!
 
+	void
+	SetupFieldCellOperator( int const DomainNum )
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Number the field cells of the domain and store their neighbors and neighbor conductances
+		// in flat arrays, so that the field cells can be solved together as one linear system.
+
+		// METHODOLOGY EMPLOYED:
+		// The conductances are those of EvaluateFieldCellTemperature and only depend on the mesh
+		// and the cell properties, so they are evaluated once.  Directions are stored in slot
+		// -Direction, i.e. 1 for Direction_PositiveY through 6 for Direction_NegativeZ.
+
+		// REFERENCES:
+		// na
+
+		// USE STATEMENTS:
+		// na
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int const NumDirections( 6 );
+		int X;
+		int Y;
+		int Z;
+		int NX;
+		int NY;
+		int NZ;
+		int FieldCellNum;
+		int DirectionCounter;
+		int CurDirection;
+		Real64 NeighborTemp;
+		Real64 Resistance;
+
+		auto & Domain( PipingSystemDomains( DomainNum ) );
+		auto & Op( Domain.FieldCells );
+		FArray3D_int FieldCellIndex( Domain.Cells.I1(), Domain.Cells.I2(), Domain.Cells.I3(), 0 ); // Field cell number of each domain cell, 0 if not a field cell
+
+		Op.NumCells = 0;
+		for ( Z = Domain.Cells.l3(); Z <= Domain.Cells.u3(); ++Z ) {
+			for ( Y = Domain.Cells.l2(); Y <= Domain.Cells.u2(); ++Y ) {
+				for ( X = Domain.Cells.l1(); X <= Domain.Cells.u1(); ++X ) {
+					int const CellType( Domain.Cells( X, Y, Z ).CellType );
+					if ( ( CellType == CellType_GeneralField ) || ( CellType == CellType_Slab ) || ( CellType == CellType_HorizInsulation ) || ( CellType == CellType_VertInsulation ) ) {
+						FieldCellIndex( X, Y, Z ) = ++Op.NumCells;
+					}
+				}
+			}
+		}
+
+		Op.Cell.dimension( Op.NumCells, 0 );
+		Op.Neighbor.dimension( NumDirections, Op.NumCells, 0 );
+		Op.NeighborCell.dimension( NumDirections, Op.NumCells, -1 );
+		Op.Conductance.dimension( NumDirections, Op.NumCells, 0.0 );
+		Op.Diagonal.dimension( Op.NumCells, 0.0 );
+		Op.RHS.dimension( Op.NumCells, 0.0 );
+		Op.Temperature.dimension( Op.NumCells, 0.0 );
+		Op.Residual.dimension( Op.NumCells, 0.0 );
+		Op.Search.dimension( Op.NumCells, 0.0 );
+		Op.Product.dimension( Op.NumCells, 0.0 );
+		Op.Preconditioned.dimension( Op.NumCells, 0.0 );
+
+		for ( Z = Domain.Cells.l3(); Z <= Domain.Cells.u3(); ++Z ) {
+			for ( Y = Domain.Cells.l2(); Y <= Domain.Cells.u2(); ++Y ) {
+				for ( X = Domain.Cells.l1(); X <= Domain.Cells.u1(); ++X ) {
+					FieldCellNum = FieldCellIndex( X, Y, Z );
+					if ( FieldCellNum == 0 ) continue;
+					auto const & ThisCell( Domain.Cells( X, Y, Z ) );
+					Op.Cell( FieldCellNum ) = Domain.Cells.index( X, Y, Z );
+					EvaluateCellNeighborDirections( DomainNum, ThisCell );
+					for ( DirectionCounter = lbound( NeighborFieldCells, 1 ); DirectionCounter <= ubound( NeighborFieldCells, 1 ); ++DirectionCounter ) {
+						CurDirection = NeighborFieldCells( DirectionCounter );
+						EvaluateNeighborCharacteristics( DomainNum, ThisCell, CurDirection, NeighborTemp, Resistance, NX, NY, NZ );
+						Op.Neighbor( -CurDirection, FieldCellNum ) = FieldCellIndex( NX, NY, NZ );
+						Op.NeighborCell( -CurDirection, FieldCellNum ) = Domain.Cells.index( NX, NY, NZ );
+						Op.Conductance( -CurDirection, FieldCellNum ) = 1.0 / Resistance;
+					}
+				}
+			}
+		}
+
+	}
+
+	//*********************************************************************************************!
+
+	//*********************************************************************************************!
+
+	void
+	SolveFieldCellTemperatures( int const DomainNum )
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Update all field cell temperatures of the domain at once, holding the other cells at
+		// their current temperatures.
+
+		// METHODOLOGY EMPLOYED:
+		// EvaluateFieldCellTemperature solves the balance of one cell,
+		//   T * ( 1 + Sum( Beta / R ) ) = Tprev + Sum( Beta / R * Tneighbor ),
+		// for its own temperature.  Divided by Beta, the balances of all field cells form a
+		// symmetric, diagonally dominant system, which is solved by conjugate gradients from the
+		// current temperatures.  The balance is the one the point iteration converges to.
+
+		// REFERENCES:
+		// na
+
+		// USE STATEMENTS:
+		// na
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		Real64 const ToleranceFraction( 0.01 ); // Solve tolerance as a fraction of the iteration convergence criterion
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int FieldCellNum;
+		int DirectionCounter;
+
+		auto & Domain( PipingSystemDomains( DomainNum ) );
+		auto & Op( Domain.FieldCells );
+		if ( ! allocated( Op.Cell ) ) SetupFieldCellOperator( DomainNum );
+		if ( Op.NumCells == 0 ) return;
+
+		// Beta changes with the soil heat capacity each time step, the boundary cells each iteration
+		for ( FieldCellNum = 1; FieldCellNum <= Op.NumCells; ++FieldCellNum ) {
+			auto const & ThisCell( Domain.Cells[ Op.Cell( FieldCellNum ) ] );
+			Real64 Diagonal( 1.0 / ThisCell.MyBase.Beta );
+			Real64 RHS( ThisCell.MyBase.Temperature_PrevTimeStep / ThisCell.MyBase.Beta );
+			for ( DirectionCounter = 1; DirectionCounter <= 6; ++DirectionCounter ) {
+				if ( Op.NeighborCell( DirectionCounter, FieldCellNum ) < 0 ) continue;
+				Diagonal += Op.Conductance( DirectionCounter, FieldCellNum );
+				if ( Op.Neighbor( DirectionCounter, FieldCellNum ) == 0 ) RHS += Op.Conductance( DirectionCounter, FieldCellNum ) * Domain.Cells[ Op.NeighborCell( DirectionCounter, FieldCellNum ) ].MyBase.Temperature;
+			}
+			Op.Diagonal( FieldCellNum ) = Diagonal;
+			Op.RHS( FieldCellNum ) = RHS;
+			Op.Temperature( FieldCellNum ) = ThisCell.MyBase.Temperature;
+		}
+
+		SolveFieldCellOperator( Op, ToleranceFraction * Domain.SimControls.Convergence_CurrentToPrevIteration, Op.NumCells );
+
+		for ( FieldCellNum = 1; FieldCellNum <= Op.NumCells; ++FieldCellNum ) {
+			Domain.Cells[ Op.Cell( FieldCellNum ) ].MyBase.Temperature = Op.Temperature( FieldCellNum );
+		}
+
+	}
+
+	//*********************************************************************************************!
+
+	//*********************************************************************************************!
+
+	int
+	SolveFieldCellOperator(
+		FieldCellOperator & Op,
+		Real64 const Tolerance, // Largest Jacobi correction of a cell temperature at convergence
+		int const MaxIterations
+	)
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Solve the field cell system for Op%Temperature and return the number of iterations taken.
+
+		// METHODOLOGY EMPLOYED:
+		// Conjugate gradients with the operator diagonal as preconditioner.  The system is converged
+		// when no residual, scaled by its diagonal, exceeds the tolerance.
+
+		// REFERENCES:
+		// na
+
+		// USE STATEMENTS:
+		// na
+
+		// Return value
+		int Iteration;
+
+		// Locals
+		// FUNCTION ARGUMENT DEFINITIONS:
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		int FieldCellNum;
+		Real64 ResidualDotPreconditioned( 0.0 );
+
+		FieldCellOperatorProduct( Op, Op.Temperature, Op.Product );
+		for ( FieldCellNum = 1; FieldCellNum <= Op.NumCells; ++FieldCellNum ) {
+			Op.Residual( FieldCellNum ) = Op.RHS( FieldCellNum ) - Op.Product( FieldCellNum );
+			Op.Preconditioned( FieldCellNum ) = Op.Residual( FieldCellNum ) / Op.Diagonal( FieldCellNum );
+			Op.Search( FieldCellNum ) = Op.Preconditioned( FieldCellNum );
+			ResidualDotPreconditioned += Op.Residual( FieldCellNum ) * Op.Preconditioned( FieldCellNum );
+		}
+
+		for ( Iteration = 0; Iteration < MaxIterations; ++Iteration ) {
+			Real64 MaxCorrection( 0.0 );
+			for ( FieldCellNum = 1; FieldCellNum <= Op.NumCells; ++FieldCellNum ) {
+				MaxCorrection = max( MaxCorrection, std::abs( Op.Preconditioned( FieldCellNum ) ) );
+			}
+			if ( MaxCorrection <= Tolerance ) break;
+
+			FieldCellOperatorProduct( Op, Op.Search, Op.Product );
+			Real64 SearchDotProduct( 0.0 );
+			for ( FieldCellNum = 1; FieldCellNum <= Op.NumCells; ++FieldCellNum ) {
+				SearchDotProduct += Op.Search( FieldCellNum ) * Op.Product( FieldCellNum );
+			}
+			if ( SearchDotProduct <= 0.0 ) break;
+			Real64 const StepSize( ResidualDotPreconditioned / SearchDotProduct );
+
+			Real64 const PrevResidualDotPreconditioned( ResidualDotPreconditioned );
+			ResidualDotPreconditioned = 0.0;
+			for ( FieldCellNum = 1; FieldCellNum <= Op.NumCells; ++FieldCellNum ) {
+				Op.Temperature( FieldCellNum ) += StepSize * Op.Search( FieldCellNum );
+				Op.Residual( FieldCellNum ) -= StepSize * Op.Product( FieldCellNum );
+				Op.Preconditioned( FieldCellNum ) = Op.Residual( FieldCellNum ) / Op.Diagonal( FieldCellNum );
+				ResidualDotPreconditioned += Op.Residual( FieldCellNum ) * Op.Preconditioned( FieldCellNum );
+			}
+			Real64 const SearchUpdate( ResidualDotPreconditioned / PrevResidualDotPreconditioned );
+			for ( FieldCellNum = 1; FieldCellNum <= Op.NumCells; ++FieldCellNum ) {
+				Op.Search( FieldCellNum ) = Op.Preconditioned( FieldCellNum ) + SearchUpdate * Op.Search( FieldCellNum );
+			}
+		}
+
+		return Iteration;
+	}
+
+	//*********************************************************************************************!
+
+	//*********************************************************************************************!
+
+	void
+	FieldCellOperatorProduct(
+		FieldCellOperator const & Op,
+		FArray1< Real64 > const & Temperature,
+		FArray1< Real64 > & Product
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Apply the field cell operator to a set of field cell temperatures.
+
+		// METHODOLOGY EMPLOYED:
+		// na
+
+		// REFERENCES:
+		// na
+
+		// USE STATEMENTS:
+		// na
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int FieldCellNum;
+		int DirectionCounter;
+
+		for ( FieldCellNum = 1; FieldCellNum <= Op.NumCells; ++FieldCellNum ) {
+			Real64 Sum( Op.Diagonal( FieldCellNum ) * Temperature( FieldCellNum ) );
+			for ( DirectionCounter = 1; DirectionCounter <= 6; ++DirectionCounter ) {
+				int const Neighbor( Op.Neighbor( DirectionCounter, FieldCellNum ) );
+				if ( Neighbor > 0 ) Sum -= Op.Conductance( DirectionCounter, FieldCellNum ) * Temperature( Neighbor );
+			}
+			Product( FieldCellNum ) = Sum;
+		}
+
+	}
+
+	//*********************************************************************************************!
+
+	//*********************************************************************************************!
+
 	Real64
 	EvaluateGroundSurfaceTemperature(
 		int const DomainNum,
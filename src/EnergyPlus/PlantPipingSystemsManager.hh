@@ -19,6 +19,7 @@ namespace PlantPipingSystemsManager {
 	using DataPlantPipingSystems::CartesianPipeCellInformation;
 	using DataPlantPipingSystems::DirectionNeighbor_Dictionary;
 	using DataPlantPipingSystems::DomainRectangle;
+	using DataPlantPipingSystems::FieldCellOperator;
 	using DataPlantPipingSystems::FluidCellInformation;
 	using DataPlantPipingSystems::GridRegion;
 	using DataPlantPipingSystems::MeshPartition;
@@ -795,6 +796,42 @@ namespace PlantPipingSystemsManager {
 
 	//*********************************************************************************************!
 
+	void
+	SetupFieldCellOperator( int const DomainNum );
+
+	//*********************************************************************************************!
+
+	//*********************************************************************************************!
+
+	void
+	SolveFieldCellTemperatures( int const DomainNum );
+
+	//*********************************************************************************************!
+
+	//*********************************************************************************************!
+
+	int
+	SolveFieldCellOperator(
+		FieldCellOperator & Op,
+		Real64 const Tolerance, // Largest Jacobi correction of a cell temperature at convergence
+		int const MaxIterations
+	);
+
+	//*********************************************************************************************!
+
+	//*********************************************************************************************!
+
+	void
+	FieldCellOperatorProduct(
+		FieldCellOperator const & Op,
+		FArray1< Real64 > const & Temperature,
+		FArray1< Real64 > & Product
+	);
+
+	//*********************************************************************************************!
+
+	//*********************************************************************************************!
+
 	Real64
 	EvaluateGroundSurfaceTemperature(
 		int const DomainNum,
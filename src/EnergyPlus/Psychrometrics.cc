@@ -124,7 +124,11 @@ namespace Psychrometrics {
 	FArray1D< cached_twb_t > cached_Twb; // DIMENSION(0:twbcache_size)
 #endif
 #ifdef EP_cache_PsyPsatFnTemp
+#ifdef _OPENMP
+	thread_local FArray1D< cached_psat_t > cached_Psat; // DIMENSION(0:psatcache_size), one per thread
+#else
 	FArray1D< cached_psat_t > cached_Psat; // DIMENSION(0:psatcache_size)
+#endif
 #endif
 
 	// Subroutine Specifications for the Module
@@ -276,35 +280,40 @@ namespace Psychrometrics {
 		std::string const & CalledFrom // routine this function was called from (error messages)
 	)
 	{
-		if ( RHValue > 1.01 ) {
-			if ( ! WarmupFlag ) {
-				if ( iPsyErrIndex( iPsyRhFnTdbRhovLBnd0C ) == 0 ) {
-					String = " Dry-Bulb= " + TrimSigDigits( Tdb, 2 ) + " Rhovapor= " + TrimSigDigits( Rhovapor, 3 ) + " Calculated Relative Humidity [%]= " + TrimSigDigits( RHValue * 100.0, 2 );
-					ShowWarningMessage( "Calculated Relative Humidity out of range (PsyRhFnTdbRhovLBnd0C) " );
-					if ( !CalledFrom.empty() ) {
-						ShowContinueErrorTimeStamp( " Routine=" + CalledFrom + ',' );
-					} else {
-						ShowContinueErrorTimeStamp( " Routine=Unknown," );
+#ifdef _OPENMP
+#pragma omp critical (ShowErrors)
+#endif
+		{
+			if ( RHValue > 1.01 ) {
+				if ( ! WarmupFlag ) {
+					if ( iPsyErrIndex( iPsyRhFnTdbRhovLBnd0C ) == 0 ) {
+						String = " Dry-Bulb= " + TrimSigDigits( Tdb, 2 ) + " Rhovapor= " + TrimSigDigits( Rhovapor, 3 ) + " Calculated Relative Humidity [%]= " + TrimSigDigits( RHValue * 100.0, 2 );
+						ShowWarningMessage( "Calculated Relative Humidity out of range (PsyRhFnTdbRhovLBnd0C) " );
+						if ( !CalledFrom.empty() ) {
+							ShowContinueErrorTimeStamp( " Routine=" + CalledFrom + ',' );
+						} else {
+							ShowContinueErrorTimeStamp( " Routine=Unknown," );
+						}
+						ShowContinueError( String );
+						ShowContinueError( "Relative Humidity being reset to 100.0%" );
 					}
-					ShowContinueError( String );
-					ShowContinueError( "Relative Humidity being reset to 100.0%" );
+					ShowRecurringWarningErrorAtEnd( "Calculated Relative Humidity out of range (PsyRhFnTdbRhovLBnd0C)", iPsyErrIndex( iPsyRhFnTdbRhovLBnd0C ), RHValue * 100.0, RHValue * 100.0, _, "%", "%" );
 				}
-				ShowRecurringWarningErrorAtEnd( "Calculated Relative Humidity out of range (PsyRhFnTdbRhovLBnd0C)", iPsyErrIndex( iPsyRhFnTdbRhovLBnd0C ), RHValue * 100.0, RHValue * 100.0, _, "%", "%" );
-			}
-		} else if ( RHValue < -0.05 ) {
-			if ( ! WarmupFlag ) {
-				if ( iPsyErrIndex( iPsyRhFnTdbRhovLBnd0C ) == 0 ) {
-					String = " Dry-Bulb= " + TrimSigDigits( Tdb, 2 ) + " Rhovapor= " + TrimSigDigits( Rhovapor, 3 ) + " Calculated Relative Humidity [%]= " + TrimSigDigits( RHValue * 100.0, 2 );
-					ShowWarningMessage( "Calculated Relative Humidity out of range (PsyRhFnTdbRhovLBnd0C) " );
-					if ( !CalledFrom.empty() ) {
-						ShowContinueErrorTimeStamp( " Routine=" + CalledFrom + ',' );
-					} else {
-						ShowContinueErrorTimeStamp( " Routine=Unknown," );
+			} else if ( RHValue < -0.05 ) {
+				if ( ! WarmupFlag ) {
+					if ( iPsyErrIndex( iPsyRhFnTdbRhovLBnd0C ) == 0 ) {
+						String = " Dry-Bulb= " + TrimSigDigits( Tdb, 2 ) + " Rhovapor= " + TrimSigDigits( Rhovapor, 3 ) + " Calculated Relative Humidity [%]= " + TrimSigDigits( RHValue * 100.0, 2 );
+						ShowWarningMessage( "Calculated Relative Humidity out of range (PsyRhFnTdbRhovLBnd0C) " );
+						if ( !CalledFrom.empty() ) {
+							ShowContinueErrorTimeStamp( " Routine=" + CalledFrom + ',' );
+						} else {
+							ShowContinueErrorTimeStamp( " Routine=Unknown," );
+						}
+						ShowContinueError( String );
+						ShowContinueError( "Relative Humidity being reset to 1%" );
 					}
-					ShowContinueError( String );
-					ShowContinueError( "Relative Humidity being reset to 1%" );
+					ShowRecurringWarningErrorAtEnd( "Calculated Relative Humidity out of range (PsyRhFnTdbRhovLBnd0C)", iPsyErrIndex( iPsyRhFnTdbRhovLBnd0C ), RHValue * 100.0, RHValue * 100.0, _, "%", "%" );
 				}
-				ShowRecurringWarningErrorAtEnd( "Calculated Relative Humidity out of range (PsyRhFnTdbRhovLBnd0C)", iPsyErrIndex( iPsyRhFnTdbRhovLBnd0C ), RHValue * 100.0, RHValue * 100.0, _, "%", "%" );
 			}
 		}
 	}
@@ -732,16 +741,21 @@ namespace Psychrometrics {
 #ifdef EP_psych_errors
 		if ( ! WarmupFlag ) {
 			if ( T <= -100.0 || T >= 200.0 ) {
-				if ( iPsyErrIndex( iPsyPsatFnTemp ) == 0 ) {
-					ShowWarningMessage( "Temperature out of range [-100. to 200.] (PsyPsatFnTemp)" );
-					if ( !CalledFrom.empty() ) {
-						ShowContinueErrorTimeStamp( " Routine=" + CalledFrom + ',' );
-					} else {
-						ShowContinueErrorTimeStamp( " Routine=Unknown," );
+#ifdef _OPENMP
+#pragma omp critical (ShowErrors)
+#endif
+				{
+					if ( iPsyErrIndex( iPsyPsatFnTemp ) == 0 ) {
+						ShowWarningMessage( "Temperature out of range [-100. to 200.] (PsyPsatFnTemp)" );
+						if ( !CalledFrom.empty() ) {
+							ShowContinueErrorTimeStamp( " Routine=" + CalledFrom + ',' );
+						} else {
+							ShowContinueErrorTimeStamp( " Routine=Unknown," );
+						}
+						ShowContinueError( " Input Temperature=" + TrimSigDigits( T, 2 ) );
 					}
-					ShowContinueError( " Input Temperature=" + TrimSigDigits( T, 2 ) );
+					ShowRecurringWarningErrorAtEnd( "Temperature out of range [-100. to 200.] (PsyPsatFnTemp)", iPsyErrIndex( iPsyPsatFnTemp ), T, T, _, "C", "C" );
 				}
-				ShowRecurringWarningErrorAtEnd( "Temperature out of range [-100. to 200.] (PsyPsatFnTemp)", iPsyErrIndex( iPsyPsatFnTemp ), T, T, _, "C", "C" );
 			}
 		}
 #endif
@@ -1093,35 +1107,40 @@ Label170: ;
 		std::string const & CalledFrom // routine this function was called from (error messages)
 	)
 	{
-		if ( RHValue > 1.01 ) {
-			if ( ! WarmupFlag ) {
-				if ( iPsyErrIndex( iPsyRhFnTdbRhov ) == 0 ) {
-					String = " Dry-Bulb= " + TrimSigDigits( Tdb, 2 ) + " Rhovapor= " + TrimSigDigits( Rhovapor, 3 ) + " Calculated Relative Humidity [%]= " + TrimSigDigits( RHValue * 100.0, 2 );
-					ShowWarningMessage( "Calculated Relative Humidity out of range (PsyRhFnTdbRhov) " );
-					if ( !CalledFrom.empty() ) {
-						ShowContinueErrorTimeStamp( " Routine=" + CalledFrom + ',' );
-					} else {
-						ShowContinueErrorTimeStamp( " Routine=Unknown," );
+#ifdef _OPENMP
+#pragma omp critical (ShowErrors)
+#endif
+		{
+			if ( RHValue > 1.01 ) {
+				if ( ! WarmupFlag ) {
+					if ( iPsyErrIndex( iPsyRhFnTdbRhov ) == 0 ) {
+						String = " Dry-Bulb= " + TrimSigDigits( Tdb, 2 ) + " Rhovapor= " + TrimSigDigits( Rhovapor, 3 ) + " Calculated Relative Humidity [%]= " + TrimSigDigits( RHValue * 100.0, 2 );
+						ShowWarningMessage( "Calculated Relative Humidity out of range (PsyRhFnTdbRhov) " );
+						if ( !CalledFrom.empty() ) {
+							ShowContinueErrorTimeStamp( " Routine=" + CalledFrom + ',' );
+						} else {
+							ShowContinueErrorTimeStamp( " Routine=Unknown," );
+						}
+						ShowContinueError( String );
+						ShowContinueError( "Relative Humidity being reset to 100.0 %" );
 					}
-					ShowContinueError( String );
-					ShowContinueError( "Relative Humidity being reset to 100.0 %" );
+					ShowRecurringWarningErrorAtEnd( "Calculated Relative Humidity out of range (PsyRhFnTdbRhov)", iPsyErrIndex( iPsyRhFnTdbRhov ), RHValue * 100.0, RHValue * 100.0, _, "%", "%" );
 				}
-				ShowRecurringWarningErrorAtEnd( "Calculated Relative Humidity out of range (PsyRhFnTdbRhov)", iPsyErrIndex( iPsyRhFnTdbRhov ), RHValue * 100.0, RHValue * 100.0, _, "%", "%" );
-			}
-		} else if ( RHValue < -0.05 ) {
-			if ( ! WarmupFlag ) {
-				if ( iPsyErrIndex( iPsyRhFnTdbRhov ) == 0 ) {
-					String = " Dry-Bulb= " + TrimSigDigits( Tdb, 2 ) + " Rhovapor= " + TrimSigDigits( Rhovapor, 3 ) + " Calculated Relative Humidity [%]= " + TrimSigDigits( RHValue * 100.0, 2 );
-					ShowWarningMessage( "Calculated Relative Humidity out of range (PsyRhFnTdbRhov) " );
-					if ( !CalledFrom.empty() ) {
-						ShowContinueErrorTimeStamp( " Routine=" + CalledFrom + ',' );
-					} else {
-						ShowContinueErrorTimeStamp( " Routine=Unknown," );
+			} else if ( RHValue < -0.05 ) {
+				if ( ! WarmupFlag ) {
+					if ( iPsyErrIndex( iPsyRhFnTdbRhov ) == 0 ) {
+						String = " Dry-Bulb= " + TrimSigDigits( Tdb, 2 ) + " Rhovapor= " + TrimSigDigits( Rhovapor, 3 ) + " Calculated Relative Humidity [%]= " + TrimSigDigits( RHValue * 100.0, 2 );
+						ShowWarningMessage( "Calculated Relative Humidity out of range (PsyRhFnTdbRhov) " );
+						if ( !CalledFrom.empty() ) {
+							ShowContinueErrorTimeStamp( " Routine=" + CalledFrom + ',' );
+						} else {
+							ShowContinueErrorTimeStamp( " Routine=Unknown," );
+						}
+						ShowContinueError( String );
+						ShowContinueError( "Relative Humidity being reset to 1%" );
 					}
-					ShowContinueError( String );
-					ShowContinueError( "Relative Humidity being reset to 1%" );
+					ShowRecurringWarningErrorAtEnd( "Calculated Relative Humidity out of range (PsyRhFnTdbRhov)", iPsyErrIndex( iPsyRhFnTdbRhov ), RHValue * 100.0, RHValue * 100.0, _, "%", "%" );
 				}
-				ShowRecurringWarningErrorAtEnd( "Calculated Relative Humidity out of range (PsyRhFnTdbRhov)", iPsyErrIndex( iPsyRhFnTdbRhov ), RHValue * 100.0, RHValue * 100.0, _, "%", "%" );
 			}
 		}
 	}
@@ -1209,21 +1228,26 @@ Label170: ;
 		std::string const & CalledFrom // routine this function was called from (error messages)
 	)
 	{
-		if ( W <= -0.0001 ) {
-			if ( ! WarmupFlag ) {
-				if ( iPsyErrIndex( iPsyWFnTdbRhPb ) == 0 ) {
-					String = " Dry-Bulb= " + TrimSigDigits( TDB, 2 ) + " Relative Humidity [%]= " + TrimSigDigits( RH * 100.0, 2 ) + " Pressure= " + TrimSigDigits( PB, 2 );
-					ShowWarningMessage( "Calculated Humidity Ratio is invalid (PsyWFnTdbRhPb)" );
-					if ( !CalledFrom.empty() ) {
-						ShowContinueErrorTimeStamp( " Routine=" + CalledFrom + ',' );
-					} else {
-						ShowContinueErrorTimeStamp( " Routine=Unknown," );
+#ifdef _OPENMP
+#pragma omp critical (ShowErrors)
+#endif
+		{
+			if ( W <= -0.0001 ) {
+				if ( ! WarmupFlag ) {
+					if ( iPsyErrIndex( iPsyWFnTdbRhPb ) == 0 ) {
+						String = " Dry-Bulb= " + TrimSigDigits( TDB, 2 ) + " Relative Humidity [%]= " + TrimSigDigits( RH * 100.0, 2 ) + " Pressure= " + TrimSigDigits( PB, 2 );
+						ShowWarningMessage( "Calculated Humidity Ratio is invalid (PsyWFnTdbRhPb)" );
+						if ( !CalledFrom.empty() ) {
+							ShowContinueErrorTimeStamp( " Routine=" + CalledFrom + ',' );
+						} else {
+							ShowContinueErrorTimeStamp( " Routine=Unknown," );
+						}
+						ShowContinueError( String );
+						String = "Calculated Humidity Ratio= " + TrimSigDigits( W, 4 );
+						ShowContinueError( String + " ... Humidity Ratio set to .00001" );
 					}
-					ShowContinueError( String );
-					String = "Calculated Humidity Ratio= " + TrimSigDigits( W, 4 );
-					ShowContinueError( String + " ... Humidity Ratio set to .00001" );
+					ShowRecurringWarningErrorAtEnd( "Calculated Humidity Ratio Invalid (PsyWFnTdbTwbPb)", iPsyErrIndex( iPsyWFnTdbRhPb ), W, W, _, "[]", "[]" );
 				}
-				ShowRecurringWarningErrorAtEnd( "Calculated Humidity Ratio Invalid (PsyWFnTdbTwbPb)", iPsyErrIndex( iPsyWFnTdbRhPb ), W, W, _, "[]", "[]" );
 			}
 		}
 	}
@@ -155,7 +155,11 @@ namespace Psychrometrics {
 	extern FArray1D< cached_twb_t > cached_Twb; // DIMENSION(0:twbcache_size)
 #endif
 #ifdef EP_cache_PsyPsatFnTemp
+#ifdef _OPENMP
+	extern thread_local FArray1D< cached_psat_t > cached_Psat; // DIMENSION(0:psatcache_size), one per thread
+#else
 	extern FArray1D< cached_psat_t > cached_Psat; // DIMENSION(0:psatcache_size)
+#endif
 #endif
 
 	// Subroutine Specifications for the Module
@@ -721,6 +725,9 @@ namespace Psychrometrics {
 		Int64 const Tdb_tag( bit::bit_shift( TRANSFER( T, Grid_Shift ), -Grid_Shift ) ); // Note that 2nd arg to TRANSFER is not used: Only type matters
 //		Int64 const hash( bit::bit_and( Tdb_tag, psatcache_mask ) ); //Tuned Replaced by below
 		Int64 const hash( Tdb_tag & psatcache_mask );
+#ifdef _OPENMP
+		if ( ! cached_Psat.allocated() ) cached_Psat.allocate( {0,psatcache_size} ); // Worker threads start with an empty cache
+#endif
 		auto & cPsat( cached_Psat( hash ) );
 
 		if ( cPsat.iTdb != Tdb_tag ) {
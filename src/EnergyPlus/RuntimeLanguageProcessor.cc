@@ -63,6 +63,21 @@ namespace RuntimeLanguageProcessor {
 	int const KeywordWhile( 9 ); // While statement, begins a While block
 	int const KeywordEndWhile( 10 ); // EndWhile statement, terminates a While block
 
+	// code parameters for compiled Erl statements and expressions
+	int const CodeEvaluate( 1 ); // operator or math function evaluated into a register
+	int const CodeEvaluateExpression( 2 ); // expression evaluated by the interpreter into a register
+	int const CodeSet( 3 ); // Set statement storing a register
+	int const CodeSetVariable( 4 ); // Set statement copying another Erl variable
+	int const CodeSetExpression( 5 ); // Set statement storing an expression evaluated by the interpreter
+	int const CodeReturn( 6 ); // Return statement
+	int const CodeGoto( 7 ); // Goto statement
+	int const CodeRun( 8 ); // Run statement
+	int const CodeIf( 9 ); // If statement, jumps when the condition is false
+	int const CodeElse( 10 ); // Else statement
+	int const CodeEndIf( 11 ); // EndIf statement
+	int const CodeWhile( 12 ); // While statement, jumps past the EndWhile when the condition is false
+	int const CodeEndWhile( 13 ); // EndWhile statement, jumps back to the While when the condition is true
+
 	// token type parameters for Erl code parsing
 	int const TokenNumber( 1 ); // matches the ValueNumber
 	int const TokenVariable( 4 ); // matches the ValueVariable
@@ -807,6 +822,9 @@ namespace RuntimeLanguageProcessor {
 		// Runs a stack with the interpreter.
 
 		// METHODOLOGY EMPLOYED:
+		// Stacks compiled by CompileStack are run by EvaluateCompiledStack instead, except when
+		// a full trace is requested, which is only written by the interpreter.
+
 		// Using/Aliasing
 
 		// Return value
@@ -823,6 +841,8 @@ namespace RuntimeLanguageProcessor {
 		static int VariableNum;
 		int WhileLoopExitCounter; // to avoid infinite loop in While loop
 
+		if ( ErlStack( StackNum ).Compiled && ! OutputFullEMSTrace ) return EvaluateCompiledStack( StackNum );
+
 		WhileLoopExitCounter = 0;
 		ReturnValue.Type = ValueNumber;
 		ReturnValue.Number = 0.0;
@@ -1027,6 +1047,687 @@ namespace RuntimeLanguageProcessor {
 
 	}
 
+	void
+	CompileStack( int const StackNum )
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Compiles the instructions of a parsed stack into a flat list of codes that work on
+		// numeric registers, so EvaluateCompiledStack can run the program without copying
+		// ErlValueType operands.
+
+		// METHODOLOGY EMPLOYED:
+		// Expressions are compiled depth first.  Operators and math functions become codes
+		// evaluated in place; other built-in functions (random numbers, psychrometrics, trends,
+		// curves, error management) are left to EvaluateExpression as a whole.  Jumps between
+		// instructions are resolved to code numbers once the whole stack has been compiled.
+		// A stack that cannot be compiled is left to the interpreter.
+
+		// Locals
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int InstructionNum;
+		int NumInstructions;
+		int CodeNum;
+		int CodeType;
+		int Keyword;
+		int Argument1;
+		int Argument2;
+		int ExpressionNum;
+		int Operand;
+		int Target;
+		bool Compiled;
+		FArray1D_int FirstCode; // first code of each instruction, end of the stack at NumInstructions + 1
+
+		// FLOW:
+		NumInstructions = ErlStack( StackNum ).NumInstructions;
+		ErlStack( StackNum ).Compiled = false;
+		ErlStack( StackNum ).NumCodes = 0;
+		ErlStack( StackNum ).Code.deallocate();
+		ErlStack( StackNum ).NumRegisters = 0;
+		ErlStack( StackNum ).Register.deallocate();
+		ErlStack( StackNum ).RegisterType.deallocate();
+		FirstCode.allocate( NumInstructions + 1 );
+		Compiled = true;
+
+		for ( InstructionNum = 1; InstructionNum <= NumInstructions; ++InstructionNum ) {
+			FirstCode( InstructionNum ) = ErlStack( StackNum ).NumCodes + 1;
+			Keyword = ErlStack( StackNum ).Instruction( InstructionNum ).Keyword;
+			Argument1 = ErlStack( StackNum ).Instruction( InstructionNum ).Argument1;
+			Argument2 = ErlStack( StackNum ).Instruction( InstructionNum ).Argument2;
+
+			if ( Keyword == KeywordNone ) {
+				// nothing to run
+
+			} else if ( Keyword == KeywordReturn ) {
+				Operand = 0;
+				if ( Argument1 > 0 ) Operand = CompileExpression( StackNum, Argument1 );
+				CodeNum = AddCode( StackNum, CodeReturn, InstructionNum );
+				ErlStack( StackNum ).Code( CodeNum ).Operand1 = Operand;
+
+			} else if ( Keyword == KeywordSet ) {
+				if ( Argument1 <= 0 ) {
+					Compiled = false;
+					break;
+				}
+				// a literal of an expression has the full value of that expression
+				ExpressionNum = Argument2;
+				while ( ExpressionNum > 0 ) {
+					if ( ErlExpression( ExpressionNum ).Operator != OperatorLiteral ) break;
+					if ( ErlExpression( ExpressionNum ).NumOperands != 1 ) break;
+					if ( ErlExpression( ExpressionNum ).Operand( 1 ).Type != ValueExpression ) break;
+					ExpressionNum = ErlExpression( ExpressionNum ).Operand( 1 ).Expression;
+				}
+				if ( ExpressionNum > 0 && IsCompilableExpression( ExpressionNum ) && ErlExpression( ExpressionNum ).Operator == OperatorLiteral && ErlExpression( ExpressionNum ).Operand( 1 ).Type == ValueVariable ) {
+					CodeNum = AddCode( StackNum, CodeSetVariable, InstructionNum );
+					ErlStack( StackNum ).Code( CodeNum ).Operand1 = ErlExpression( ExpressionNum ).Operand( 1 ).Variable;
+				} else if ( ExpressionNum > 0 && ! IsCompilableExpression( ExpressionNum ) ) {
+					CodeNum = AddCode( StackNum, CodeSetExpression, InstructionNum );
+					ErlStack( StackNum ).Code( CodeNum ).Argument = ExpressionNum;
+				} else {
+					Operand = CompileExpression( StackNum, ExpressionNum );
+					CodeNum = AddCode( StackNum, CodeSet, InstructionNum );
+					ErlStack( StackNum ).Code( CodeNum ).Operand1 = Operand;
+				}
+				ErlStack( StackNum ).Code( CodeNum ).Result = Argument1;
+
+			} else if ( Keyword == KeywordRun ) {
+				CodeNum = AddCode( StackNum, CodeRun, InstructionNum );
+				ErlStack( StackNum ).Code( CodeNum ).Argument = Argument1;
+
+			} else if ( ( Keyword == KeywordIf ) || ( Keyword == KeywordElse ) ) {
+				if ( Argument1 > 0 ) {
+					Operand = CompileExpression( StackNum, Argument1 );
+					CodeNum = AddCode( StackNum, CodeIf, InstructionNum );
+					ErlStack( StackNum ).Code( CodeNum ).Operand1 = Operand;
+					ErlStack( StackNum ).Code( CodeNum ).Argument = Argument2; // instruction until resolved below
+				} else {
+					CodeNum = AddCode( StackNum, CodeElse, InstructionNum );
+				}
+
+			} else if ( Keyword == KeywordGoto ) {
+				CodeNum = AddCode( StackNum, CodeGoto, InstructionNum );
+				ErlStack( StackNum ).Code( CodeNum ).Argument = Argument1;
+
+			} else if ( Keyword == KeywordEndIf ) {
+				CodeNum = AddCode( StackNum, CodeEndIf, InstructionNum );
+
+			} else if ( Keyword == KeywordWhile ) {
+				Operand = CompileExpression( StackNum, Argument1 );
+				CodeNum = AddCode( StackNum, CodeWhile, InstructionNum );
+				ErlStack( StackNum ).Code( CodeNum ).Operand1 = Operand;
+				ErlStack( StackNum ).Code( CodeNum ).Argument = Argument2 + 1; // continue after the EndWhile
+
+			} else if ( Keyword == KeywordEndWhile ) {
+				Operand = CompileExpression( StackNum, Argument1 );
+				CodeNum = AddCode( StackNum, CodeEndWhile, InstructionNum );
+				ErlStack( StackNum ).Code( CodeNum ).Operand1 = Operand;
+				ErlStack( StackNum ).Code( CodeNum ).Argument = Argument2;
+
+			} else { // keywords the interpreter does not run either
+				Compiled = false;
+				break;
+
+			}
+		}
+
+		if ( Compiled ) {
+			FirstCode( NumInstructions + 1 ) = ErlStack( StackNum ).NumCodes + 1;
+			// resolve jumps from instructions to codes
+			for ( CodeNum = 1; CodeNum <= ErlStack( StackNum ).NumCodes; ++CodeNum ) {
+				CodeType = ErlStack( StackNum ).Code( CodeNum ).Code;
+				if ( ( CodeType != CodeIf ) && ( CodeType != CodeGoto ) && ( CodeType != CodeWhile ) && ( CodeType != CodeEndWhile ) ) continue;
+				Target = ErlStack( StackNum ).Code( CodeNum ).Argument;
+				if ( Target < 1 ) {
+					Compiled = false;
+					break;
+				}
+				ErlStack( StackNum ).Code( CodeNum ).Argument = FirstCode( min( Target, NumInstructions + 1 ) );
+			}
+		}
+
+		if ( Compiled ) {
+			ErlStack( StackNum ).Compiled = true;
+		} else {
+			ErlStack( StackNum ).NumCodes = 0;
+			ErlStack( StackNum ).Code.deallocate();
+			ErlStack( StackNum ).NumRegisters = 0;
+			ErlStack( StackNum ).Register.deallocate();
+			ErlStack( StackNum ).RegisterType.deallocate();
+		}
+
+	}
+
+	int
+	CompileExpression(
+		int const StackNum,
+		int const ExpressionNum
+	)
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Compiles an expression and returns the operand holding its value: a register (> 0)
+		// or a negated Erl variable index (< 0) for a literal of a variable.
+
+		// Return value
+		int Operand;
+
+		// Locals
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		int Operand1;
+		int Operand2;
+		int CodeNum;
+
+		// FLOW:
+		if ( ExpressionNum <= 0 ) { // evaluates to zero, as in EvaluateExpression
+			Operand = AddRegister( StackNum, ValueNumber, 0.0 );
+
+		} else if ( ! IsCompilableExpression( ExpressionNum ) ) {
+			Operand = AddRegister( StackNum, ValueNumber, 0.0 );
+			CodeNum = AddCode( StackNum, CodeEvaluateExpression, 0 );
+			ErlStack( StackNum ).Code( CodeNum ).Result = Operand;
+			ErlStack( StackNum ).Code( CodeNum ).Argument = ExpressionNum;
+
+		} else if ( ErlExpression( ExpressionNum ).Operator == OperatorLiteral ) {
+			Operand = CompileOperand( StackNum, ErlExpression( ExpressionNum ).Operand( 1 ) );
+
+		} else {
+			// operands are compiled in order, as EvaluateExpression reduces them
+			Operand1 = CompileOperand( StackNum, ErlExpression( ExpressionNum ).Operand( 1 ) );
+			Operand2 = 0;
+			if ( ErlExpression( ExpressionNum ).NumOperands > 1 ) Operand2 = CompileOperand( StackNum, ErlExpression( ExpressionNum ).Operand( 2 ) );
+			Operand = AddRegister( StackNum, ValueNumber, 0.0 );
+			CodeNum = AddCode( StackNum, CodeEvaluate, 0 );
+			ErlStack( StackNum ).Code( CodeNum ).Operator = ErlExpression( ExpressionNum ).Operator;
+			ErlStack( StackNum ).Code( CodeNum ).Result = Operand;
+			ErlStack( StackNum ).Code( CodeNum ).Operand1 = Operand1;
+			ErlStack( StackNum ).Code( CodeNum ).Operand2 = Operand2;
+
+		}
+
+		return Operand;
+
+	}
+
+	int
+	CompileOperand(
+		int const StackNum,
+		ErlValueType const & Operand
+	)
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Compiles one operand of an expression: numbers are loaded into a new register,
+		// variables are referred to directly and expressions are compiled in turn.
+
+		// FLOW:
+		if ( Operand.Type == ValueVariable ) {
+			return - Operand.Variable;
+		} else if ( Operand.Type == ValueExpression ) {
+			return CompileExpression( StackNum, Operand.Expression );
+		} else {
+			return AddRegister( StackNum, Operand.Type, Operand.Number );
+		}
+
+	}
+
+	bool
+	IsCompilableExpression( int const ExpressionNum )
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Determines whether EvaluateCompiledOperator can evaluate the top of an expression,
+		// that is a literal, an operator, or one of the math functions that only use numbers.
+
+		// Return value
+		bool IsCompilable;
+
+		// Locals
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		int Operator;
+		int NumOperands;
+		int OperandNum;
+		int Type;
+
+		// FLOW:
+		Operator = ErlExpression( ExpressionNum ).Operator;
+		if ( ( Operator == OperatorLiteral ) || ( Operator == OperatorNegative ) ) {
+			NumOperands = 1;
+		} else if ( ( Operator == FuncMod ) || ( Operator == FuncMax ) || ( Operator == FuncMin ) ) {
+			NumOperands = 2;
+		} else if ( ( Operator >= OperatorDivide ) && ( Operator <= OperatiorLogicalOR ) ) {
+			NumOperands = 2;
+		} else if ( ( Operator >= FuncRound ) && ( Operator <= FuncABS ) ) {
+			NumOperands = 1;
+		} else {
+			return false;
+		}
+		if ( ErlExpression( ExpressionNum ).NumOperands != NumOperands ) return false;
+
+		IsCompilable = true;
+		for ( OperandNum = 1; OperandNum <= NumOperands; ++OperandNum ) {
+			Type = ErlExpression( ExpressionNum ).Operand( OperandNum ).Type;
+			if ( Type == ValueNumber ) continue;
+			if ( ( Type == ValueVariable ) && ( ErlExpression( ExpressionNum ).Operand( OperandNum ).Variable > 0 ) ) continue;
+			if ( Type == ValueExpression ) continue;
+			IsCompilable = false;
+		}
+
+		return IsCompilable;
+
+	}
+
+	int
+	AddCode(
+		int const StackNum,
+		int const Code,
+		int const InstructionNum
+	)
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Appends a code to the compiled form of a stack and returns its index.
+
+		// FLOW:
+		if ( ErlStack( StackNum ).NumCodes == 0 ) {
+			ErlStack( StackNum ).Code.allocate( 1 );
+			ErlStack( StackNum ).NumCodes = 1;
+		} else {
+			ErlStack( StackNum ).Code.redimension( ++ErlStack( StackNum ).NumCodes );
+		}
+		ErlStack( StackNum ).Code( ErlStack( StackNum ).NumCodes ) = ErlCodeType();
+		ErlStack( StackNum ).Code( ErlStack( StackNum ).NumCodes ).Code = Code;
+		ErlStack( StackNum ).Code( ErlStack( StackNum ).NumCodes ).InstructionNum = InstructionNum;
+
+		return ErlStack( StackNum ).NumCodes;
+
+	}
+
+	int
+	AddRegister(
+		int const StackNum,
+		int const Type,
+		Real64 const Number
+	)
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Appends a register to a compiled stack, loaded with a value, and returns its index.
+
+		// FLOW:
+		if ( ErlStack( StackNum ).NumRegisters == 0 ) {
+			ErlStack( StackNum ).Register.allocate( 1 );
+			ErlStack( StackNum ).RegisterType.allocate( 1 );
+			ErlStack( StackNum ).NumRegisters = 1;
+		} else {
+			ErlStack( StackNum ).Register.redimension( ++ErlStack( StackNum ).NumRegisters );
+			ErlStack( StackNum ).RegisterType.redimension( ErlStack( StackNum ).NumRegisters );
+		}
+		ErlStack( StackNum ).Register( ErlStack( StackNum ).NumRegisters ) = Number;
+		ErlStack( StackNum ).RegisterType( ErlStack( StackNum ).NumRegisters ) = Type;
+
+		return ErlStack( StackNum ).NumRegisters;
+
+	}
+
+	ErlValueType
+	EvaluateCompiledStack( int const StackNum )
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Runs a stack compiled by CompileStack, with the same results as EvaluateStack.
+
+		// METHODOLOGY EMPLOYED:
+		// Values are carried as a number and a value type.  The message of an error value is
+		// kept aside and only copied when an error is stored, traced or returned.  The value of
+		// the last statement is tracked the same way, so a RETURN with no expression traces and
+		// returns what the interpreter would.
+
+		// Return value
+		ErlValueType ReturnValue;
+
+		// Locals
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		int CodeNum;
+		int VariableNum;
+		int WhileLoopExitCounter; // to avoid infinite loop in While loop
+		int Type1;
+		int Type2;
+		Real64 Number1;
+		Real64 Number2;
+		int ReturnType; // value type of the last statement
+		Real64 ReturnNumber; // number of the last statement
+		std::string ErrorString; // message of the most recent error value
+		ErlValueType InterpretedValue; // value of an expression left to the interpreter
+
+		// FLOW:
+		auto & Stack( ErlStack( StackNum ) );
+		ReturnType = ValueNumber;
+		ReturnNumber = 0.0;
+		WhileLoopExitCounter = 0;
+
+		CodeNum = 1;
+		while ( CodeNum <= Stack.NumCodes ) {
+			auto const & Code( Stack.Code( CodeNum ) );
+
+			{ auto const SELECT_CASE_var( Code.Code );
+
+			if ( SELECT_CASE_var == CodeEvaluate ) {
+				GetCompiledOperand( Stack, Code.Operand1, Number1, Type1, ErrorString );
+				if ( Code.Operand2 != 0 ) {
+					GetCompiledOperand( Stack, Code.Operand2, Number2, Type2, ErrorString );
+				} else {
+					Number2 = 0.0;
+					Type2 = ValueNull;
+				}
+				Stack.RegisterType( Code.Result ) = EvaluateCompiledOperator( Code.Operator, Number1, Type1, Number2, Type2, Stack.Register( Code.Result ), ErrorString );
+
+			} else if ( SELECT_CASE_var == CodeEvaluateExpression ) {
+				InterpretedValue = EvaluateExpression( Code.Argument );
+				Stack.Register( Code.Result ) = InterpretedValue.Number;
+				Stack.RegisterType( Code.Result ) = InterpretedValue.Type;
+				if ( InterpretedValue.Type == ValueError ) ErrorString = InterpretedValue.Error;
+
+			} else if ( SELECT_CASE_var == CodeSet ) {
+				GetCompiledOperand( Stack, Code.Operand1, ReturnNumber, ReturnType, ErrorString );
+				VariableNum = Code.Result;
+				if ( ( ! ErlVariable( VariableNum ).ReadOnly ) && ( ! ErlVariable( VariableNum ).Value.TrendVariable ) ) {
+					auto & Value( ErlVariable( VariableNum ).Value );
+					Value.Type = ReturnType;
+					Value.Number = ReturnNumber;
+					Value.String.clear();
+					Value.Variable = 0;
+					Value.Expression = 0;
+					Value.TrendVarPointer = 0;
+					if ( ReturnType == ValueError ) {
+						Value.Error = ErrorString;
+					} else {
+						Value.Error.clear();
+					}
+				} else if ( ErlVariable( VariableNum ).Value.TrendVariable ) {
+					ErlVariable( VariableNum ).Value.Number = ReturnNumber;
+					if ( ReturnType == ValueError ) {
+						ErlVariable( VariableNum ).Value.Error = ErrorString;
+					} else {
+						ErlVariable( VariableNum ).Value.Error.clear();
+					}
+				}
+				WriteCompiledTrace( StackNum, Code.InstructionNum, ReturnType, ErrorString );
+
+			} else if ( SELECT_CASE_var == CodeSetVariable ) {
+				ReturnNumber = ErlVariable( Code.Operand1 ).Value.Number;
+				ReturnType = ErlVariable( Code.Operand1 ).Value.Type;
+				if ( ReturnType == ValueError ) ErrorString = ErlVariable( Code.Operand1 ).Value.Error;
+				VariableNum = Code.Result;
+				if ( ( ! ErlVariable( VariableNum ).ReadOnly ) && ( ! ErlVariable( VariableNum ).Value.TrendVariable ) ) {
+					ErlVariable( VariableNum ).Value = ErlVariable( Code.Operand1 ).Value;
+				} else if ( ErlVariable( VariableNum ).Value.TrendVariable ) {
+					ErlVariable( VariableNum ).Value.Number = ReturnNumber;
+					ErlVariable( VariableNum ).Value.Error = ErlVariable( Code.Operand1 ).Value.Error;
+				}
+				WriteCompiledTrace( StackNum, Code.InstructionNum, ReturnType, ErrorString );
+
+			} else if ( SELECT_CASE_var == CodeSetExpression ) {
+				InterpretedValue = EvaluateExpression( Code.Argument );
+				ReturnNumber = InterpretedValue.Number;
+				ReturnType = InterpretedValue.Type;
+				if ( ReturnType == ValueError ) ErrorString = InterpretedValue.Error;
+				VariableNum = Code.Result;
+				if ( ( ! ErlVariable( VariableNum ).ReadOnly ) && ( ! ErlVariable( VariableNum ).Value.TrendVariable ) ) {
+					ErlVariable( VariableNum ).Value = InterpretedValue;
+				} else if ( ErlVariable( VariableNum ).Value.TrendVariable ) {
+					ErlVariable( VariableNum ).Value.Number = InterpretedValue.Number;
+					ErlVariable( VariableNum ).Value.Error = InterpretedValue.Error;
+				}
+				WriteCompiledTrace( StackNum, Code.InstructionNum, ReturnType, ErrorString );
+
+			} else if ( SELECT_CASE_var == CodeReturn ) {
+				if ( Code.Operand1 != 0 ) GetCompiledOperand( Stack, Code.Operand1, ReturnNumber, ReturnType, ErrorString );
+				WriteCompiledTrace( StackNum, Code.InstructionNum, ReturnType, ErrorString );
+				break; // RETURN always terminates an instruction stack
+
+			} else if ( SELECT_CASE_var == CodeGoto ) {
+				ReturnType = ValueString;
+				CodeNum = Code.Argument;
+				continue;
+
+			} else if ( SELECT_CASE_var == CodeRun ) {
+				InterpretedValue = EvaluateStack( Code.Argument );
+				ReturnNumber = InterpretedValue.Number;
+				ReturnType = InterpretedValue.Type;
+				if ( ReturnType == ValueError ) ErrorString = InterpretedValue.Error;
+
+			} else if ( SELECT_CASE_var == CodeIf ) {
+				GetCompiledOperand( Stack, Code.Operand1, ReturnNumber, ReturnType, ErrorString );
+				WriteCompiledTrace( StackNum, Code.InstructionNum, ReturnType, ErrorString );
+				if ( ReturnNumber == 0.0 ) { //  This is the FALSE case
+					CodeNum = Code.Argument;
+					continue;
+				}
+
+			} else if ( SELECT_CASE_var == CodeElse ) {
+				ReturnType = ValueNumber;
+				ReturnNumber = 1.0;
+
+			} else if ( SELECT_CASE_var == CodeEndIf ) {
+				ReturnType = ValueString;
+
+			} else if ( SELECT_CASE_var == CodeWhile ) {
+				GetCompiledOperand( Stack, Code.Operand1, ReturnNumber, ReturnType, ErrorString );
+				WriteCompiledTrace( StackNum, Code.InstructionNum, ReturnType, ErrorString );
+				if ( ReturnNumber == 0.0 ) { //  This is the FALSE case
+					CodeNum = Code.Argument;
+					continue;
+				}
+
+			} else if ( SELECT_CASE_var == CodeEndWhile ) {
+				GetCompiledOperand( Stack, Code.Operand1, ReturnNumber, ReturnType, ErrorString );
+				if ( ( ReturnNumber != 0.0 ) && ( WhileLoopExitCounter <= MaxWhileLoopIterations ) ) { //  This is the True case
+					WriteCompiledTrace( StackNum, Code.InstructionNum, ReturnType, ErrorString );
+					CodeNum = Code.Argument;
+					++WhileLoopExitCounter;
+					continue;
+				} else { // false, leave while block
+					if ( WhileLoopExitCounter > MaxWhileLoopIterations ) {
+						ReturnType = ValueError;
+						ErrorString = "Maximum WHILE loop iteration limit reached";
+						WriteCompiledTrace( StackNum, Code.InstructionNum, ReturnType, ErrorString );
+					} else {
+						ReturnType = ValueNumber;
+						ReturnNumber = 0.0;
+					}
+					WhileLoopExitCounter = 0;
+				}
+
+			}}
+
+			++CodeNum;
+		} // CodeNum
+
+		ReturnValue.Type = ReturnType;
+		ReturnValue.Number = ReturnNumber;
+		if ( ReturnType == ValueError ) ReturnValue.Error = ErrorString;
+
+		return ReturnValue;
+
+	}
+
+	int
+	EvaluateCompiledOperator(
+		int const Operator,
+		Real64 const Number1,
+		int const Type1,
+		Real64 const Number2,
+		int const Type2,
+		Real64 & Result,
+		std::string & Error
+	)
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Evaluates an operator or math function for EvaluateCompiledStack and returns the
+		// value type of the result, following EvaluateExpression.  The message is set only
+		// when the result is an error.
+
+		// Using/Aliasing
+		using DataGlobals::DegToRadians;
+		using General::TrimSigDigits;
+
+		// Return value
+		int ResultType;
+
+		// Locals
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		Real64 TestValue; // local temporary
+
+		// FLOW:
+		ResultType = ValueNumber;
+		Result = 0.0;
+
+		// binary operators other than == give zero unless both operands are numbers
+		if ( ( Operator >= OperatorDivide ) && ( Operator <= OperatiorLogicalOR ) && ( Operator != OperatorEqual ) ) {
+			if ( ( Type1 != ValueNumber ) || ( Type2 != ValueNumber ) ) return ResultType;
+		}
+
+		{ auto const SELECT_CASE_var( Operator );
+
+		if ( SELECT_CASE_var == OperatorNegative ) {
+			Result = -1.0 * Number1;
+		} else if ( SELECT_CASE_var == OperatorDivide ) {
+			if ( Number2 == 0.0 ) {
+				ResultType = ValueError;
+				Error = "Divide by zero!";
+			} else {
+				Result = Number1 / Number2;
+			}
+		} else if ( SELECT_CASE_var == OperatorMultiply ) {
+			Result = Number1 * Number2;
+		} else if ( SELECT_CASE_var == OperatorSubtract ) {
+			Result = Number1 - Number2;
+		} else if ( SELECT_CASE_var == OperatorAdd ) {
+			Result = Number1 + Number2;
+		} else if ( SELECT_CASE_var == OperatorEqual ) {
+			if ( ( Type1 == Type2 ) && ( ( Type1 == ValueNull ) || ( ( Type1 == ValueNumber ) && ( Number1 == Number2 ) ) ) ) {
+				Result = True.Number;
+			} else {
+				Result = False.Number;
+			}
+		} else if ( SELECT_CASE_var == OperatorNotEqual ) {
+			Result = ( Number1 != Number2 ) ? True.Number : False.Number;
+		} else if ( SELECT_CASE_var == OperatorLessOrEqual ) {
+			Result = ( Number1 <= Number2 ) ? True.Number : False.Number;
+		} else if ( SELECT_CASE_var == OperatorGreaterOrEqual ) {
+			Result = ( Number1 >= Number2 ) ? True.Number : False.Number;
+		} else if ( SELECT_CASE_var == OperatorLessThan ) {
+			Result = ( Number1 < Number2 ) ? True.Number : False.Number;
+		} else if ( SELECT_CASE_var == OperatorGreaterThan ) {
+			Result = ( Number1 > Number2 ) ? True.Number : False.Number;
+		} else if ( SELECT_CASE_var == OperatorRaiseToPower ) {
+			TestValue = std::pow( Number1, Number2 );
+			if ( std::isnan( TestValue ) ) {
+				ResultType = ValueError;
+				Error = "Attempted to raise to power with incompatible numbers: " + TrimSigDigits( Number1, 6 ) + " raised to " + TrimSigDigits( Number2, 6 );
+			} else {
+				Result = TestValue;
+			}
+		} else if ( SELECT_CASE_var == OperatorLogicalAND ) {
+			Result = ( ( Number1 == True.Number ) && ( Number2 == True.Number ) ) ? True.Number : False.Number;
+		} else if ( SELECT_CASE_var == OperatiorLogicalOR ) {
+			Result = ( ( Number1 == True.Number ) || ( Number2 == True.Number ) ) ? True.Number : False.Number;
+		} else if ( SELECT_CASE_var == FuncRound ) {
+			Result = nint( Number1 );
+		} else if ( SELECT_CASE_var == FuncMod ) {
+			Result = mod( Number1, Number2 );
+		} else if ( SELECT_CASE_var == FuncSin ) {
+			Result = std::sin( Number1 );
+		} else if ( SELECT_CASE_var == FuncCos ) {
+			Result = std::cos( Number1 );
+		} else if ( SELECT_CASE_var == FuncArcSin ) {
+			Result = std::asin( Number1 );
+		} else if ( SELECT_CASE_var == FuncArcCos ) {
+			Result = std::acos( Number1 );
+		} else if ( SELECT_CASE_var == FuncDegToRad ) {
+			Result = Number1 * DegToRadians;
+		} else if ( SELECT_CASE_var == FuncRadToDeg ) {
+			Result = Number1 / DegToRadians;
+		} else if ( SELECT_CASE_var == FuncExp ) {
+			if ( Number1 < 700.0 ) {
+				Result = std::exp( Number1 );
+			} else {
+				ResultType = ValueError;
+				Error = "Attempted to calculate exponential value of too large a number: " + TrimSigDigits( Number1, 4 );
+			}
+		} else if ( SELECT_CASE_var == FuncLn ) {
+			if ( Number1 > 0.0 ) {
+				Result = std::log( Number1 );
+			} else {
+				ResultType = ValueError;
+				Error = "Natural Log of zero or less!";
+			}
+		} else if ( SELECT_CASE_var == FuncMax ) {
+			Result = max( Number1, Number2 );
+		} else if ( SELECT_CASE_var == FuncMin ) {
+			Result = min( Number1, Number2 );
+		} else if ( SELECT_CASE_var == FuncABS ) {
+			Result = std::abs( Number1 );
+		} else {
+			ShowFatalError( "caught unexpected compiled operator in EvaluateCompiledOperator" );
+		}}
+
+		return ResultType;
+
+	}
+
+	void
+	GetCompiledOperand(
+		ErlStackType const & Stack, // compiled stack holding the registers
+		int const Operand, // register (> 0) or negated Erl variable index (< 0)
+		Real64 & Number,
+		int & Type,
+		std::string & Error // set only when the operand is a variable holding an error
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Reads the number and value type of a compiled operand.
+
+		// FLOW:
+		if ( Operand > 0 ) {
+			Number = Stack.Register( Operand );
+			Type = Stack.RegisterType( Operand );
+		} else {
+			Number = ErlVariable( - Operand ).Value.Number;
+			Type = ErlVariable( - Operand ).Value.Type;
+			if ( Type == ValueError ) Error = ErlVariable( - Operand ).Value.Error;
+		}
+
+	}
+
+	void
+	WriteCompiledTrace(
+		int const StackNum,
+		int const InstructionNum,
+		int const Type,
+		std::string const & Error
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Reports an error value from a compiled stack through WriteTrace.  Compiled stacks are
+		// only run when the trace is limited to errors, so other values are never written.
+
+		// Locals
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		ErlValueType ErrorValue;
+
+		// FLOW:
+		if ( ( Type != ValueError ) || ( ! OutputEMSErrors ) ) return;
+
+		ErrorValue.Type = ValueError;
+		ErrorValue.Error = Error;
+		WriteTrace( StackNum, InstructionNum, ErrorValue );
+
+	}
+
 	//******************************************************************************************
 
 	//  Expression Processor
@@ -2858,6 +3559,10 @@ namespace RuntimeLanguageProcessor {
 				ShowFatalError( "Errors found in parsing EMS Runtime Language input. Preceding condition causes termination." );
 			}
 
+			for ( StackNum = 1; StackNum <= NumErlStacks; ++StackNum ) {
+				CompileStack( StackNum );
+			}
+
 			if ( ( NumEMSOutputVariables > 0 ) || ( NumEMSMeteredOutputVariables > 0 ) ) {
 				RuntimeReportVar.allocate( NumEMSOutputVariables + NumEMSMeteredOutputVariables );
 			}
@@ -35,6 +35,21 @@ namespace RuntimeLanguageProcessor {
 	extern int const KeywordWhile; // While statement, begins a While block
 	extern int const KeywordEndWhile; // EndWhile statement, terminates a While block
 
+	// code parameters for compiled Erl statements and expressions
+	extern int const CodeEvaluate; // operator or math function evaluated into a register
+	extern int const CodeEvaluateExpression; // expression evaluated by the interpreter into a register
+	extern int const CodeSet; // Set statement storing a register
+	extern int const CodeSetVariable; // Set statement copying another Erl variable
+	extern int const CodeSetExpression; // Set statement storing an expression evaluated by the interpreter
+	extern int const CodeReturn; // Return statement
+	extern int const CodeGoto; // Goto statement
+	extern int const CodeRun; // Run statement
+	extern int const CodeIf; // If statement, jumps when the condition is false
+	extern int const CodeElse; // Else statement
+	extern int const CodeEndIf; // EndIf statement
+	extern int const CodeWhile; // While statement, jumps past the EndWhile when the condition is false
+	extern int const CodeEndWhile; // EndWhile statement, jumps back to the While when the condition is true
+
 	// token type parameters for Erl code parsing
 	extern int const TokenNumber; // matches the ValueNumber
 	extern int const TokenVariable; // matches the ValueVariable
@@ -201,6 +216,69 @@ namespace RuntimeLanguageProcessor {
 		ErlValueType const & ReturnValue
 	);
 
+	void
+	CompileStack( int const StackNum );
+
+	int
+	CompileExpression(
+		int const StackNum,
+		int const ExpressionNum
+	);
+
+	int
+	CompileOperand(
+		int const StackNum,
+		ErlValueType const & Operand
+	);
+
+	bool
+	IsCompilableExpression( int const ExpressionNum );
+
+	int
+	AddCode(
+		int const StackNum,
+		int const Code,
+		int const InstructionNum
+	);
+
+	int
+	AddRegister(
+		int const StackNum,
+		int const Type,
+		Real64 const Number
+	);
+
+	ErlValueType
+	EvaluateCompiledStack( int const StackNum );
+
+	int
+	EvaluateCompiledOperator(
+		int const Operator,
+		Real64 const Number1,
+		int const Type1,
+		Real64 const Number2,
+		int const Type2,
+		Real64 & Result,
+		std::string & Error
+	);
+
+	void
+	GetCompiledOperand(
+		DataRuntimeLanguage::ErlStackType const & Stack,
+		int const Operand,
+		Real64 & Number,
+		int & Type,
+		std::string & Error
+	);
+
+	void
+	WriteCompiledTrace(
+		int const StackNum,
+		int const InstructionNum,
+		int const Type,
+		std::string const & Error
+	);
+
 	//******************************************************************************************
 
 	//  Expression Processor
@@ -25,6 +25,7 @@
 #include <DataPrecisionGlobals.hh>
 #include <DataSizing.hh>
 #include <DataSystemVariables.hh>
+#include <DataTimings.hh>
 #include <DataZoneEquipment.hh>
 #include <DesiccantDehumidifiers.hh>
 #include <EMSManager.hh>
@@ -145,6 +146,10 @@ namespace SimAirServingZones {
 	// MODULE VARIABLE DECLARATIONS:
 	bool GetAirLoopInputFlag( true ); // Flag set to make sure you get input once
 	int NumOfTimeStepInDay; // number of zone time steps in a day
+	FArray1D_int AirLoopSimIterMax; // max controller iterations on each air loop in the current HVAC iteration
+	FArray1D_int AirLoopSimIterTot; // controller iterations on each air loop in the current HVAC iteration
+	FArray1D_int AirLoopSimNumCalls; // air loop component simulation calls on each air loop in the current HVAC iteration
+	FArray1D_int AirLoopSimIterTotSum; // controller iterations on each air loop in the current HVAC step (report variable)
 
 	// Subroutine Specifications for the Module
 	// Driver/Manager Routines
@@ -2067,12 +2072,11 @@ namespace SimAirServingZones {
 		// REFERENCES: None
 
 		// Using/Aliasing
-		using HVACInterfaceManager::UpdateHVACInterface;
-		using MixedAir::SimOAController;
 		using DataGlobals::BeginTimeStepFlag;
 		using General::GetPreviousHVACTime;
-		using DataConvergParams::CalledFromAirSystemSupplySideDeck1;
-		using DataConvergParams::CalledFromAirSystemSupplySideDeck2;
+		using DataTimings::epStartHVACProfile;
+		using DataTimings::epStopHVACProfile;
+		using DataGlobals::DisplayAdvancedReportVariables;
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -2098,21 +2102,8 @@ namespace SimAirServingZones {
 		static int NumCallsTot( 0 );
 		// Primary Air Sys DO loop index
 		int AirLoopNum;
-		// Max number of iterations performed by controllers on each air loop
-		int AirLoopIterMax;
-		// Aggregated number of iterations across all controllers on each air loop
-		int AirLoopIterTot;
-		// Total number of times SimAirLoopComponents() has been invoked to simulate each air loop
-		int AirLoopNumCalls;
-		// Primary air system outlet DO loop index
-		int AirSysOutNum;
-		// DO loop index; there are 2 passes - the 2nd is done only if mass balance fails
-		int AirLoopPass;
 		// Output variable setup flag
 		static bool OutputSetupFlag( false );
-		// Flag set by ResolveSysFlow; if TRUE, mass balance failed and there must be a second pass
-		bool SysReSim;
-		int CalledFrom;
 
 		// FLOW:
 
@@ -2121,6 +2112,15 @@ namespace SimAirServingZones {
 			SetupOutputVariable( "Air System Simulation Maximum Iteration Count []", IterMax, "HVAC", "Sum", "SimAir" );
 			SetupOutputVariable( "Air System Simulation Iteration Count []", IterTot, "HVAC", "Sum", "SimAir" );
 			SetupOutputVariable( "Air System Component Model Simulation Calls []", NumCallsTot, "HVAC", "Sum", "SimAir" );
+			AirLoopSimIterMax.dimension( NumPrimaryAirSys, 0 );
+			AirLoopSimIterTot.dimension( NumPrimaryAirSys, 0 );
+			AirLoopSimNumCalls.dimension( NumPrimaryAirSys, 0 );
+			AirLoopSimIterTotSum.dimension( NumPrimaryAirSys, 0 );
+			if ( DisplayAdvancedReportVariables ) {
+				for ( AirLoopNum = 1; AirLoopNum <= NumPrimaryAirSys; ++AirLoopNum ) {
+					SetupOutputVariable( "Air System Simulation Iteration Count []", AirLoopSimIterTotSum( AirLoopNum ), "HVAC", "Sum", PrimaryAirSystem( AirLoopNum ).Name );
+				}
+			}
 			OutputSetupFlag = true;
 		}
 
@@ -2139,6 +2139,7 @@ namespace SimAirServingZones {
 				SavedPreviousHVACTime = rxTime;
 				IterTot = 0;
 				NumCallsTot = 0;
+				AirLoopSimIterTotSum = 0;
 			}
 		}
 
@@ -2146,77 +2147,180 @@ namespace SimAirServingZones {
 		// and controllers
 		for ( AirLoopNum = 1; AirLoopNum <= NumPrimaryAirSys; ++AirLoopNum ) { // NumPrimaryAirSys is the number of primary air loops
 
-			// Check to see if System Availability Managers are asking for fans to cycle on or shut off
-			// and set fan on/off flags accordingly.
-			TurnFansOn = false;
-			TurnFansOff = false;
-			NightVentOn = false;
-			if ( PriAirSysAvailMgr( AirLoopNum ).AvailStatus == CycleOn ) {
-				TurnFansOn = true;
-			}
-			if ( PriAirSysAvailMgr( AirLoopNum ).AvailStatus == ForceOff ) {
-				TurnFansOff = true;
-			}
-			if ( AirLoopControlInfo( AirLoopNum ).NightVent ) {
-				NightVentOn = true;
-			}
-
-			//   Set current system number for sizing routines
-			CurSysNum = AirLoopNum;
-
-			// RR why is this called here, it's called first in SimAirLoop. Causes no diff's to comment out.
-			//    IF (AirLoopControlInfo(AirLoopNum)%OACtrlNum > 0) THEN
-			//      CALL SimOAController( &
-			//        AirLoopControlInfo(AirLoopNum)%OACtrlName, &
-			//        AirLoopControlInfo(AirLoopNum)%OACtrlNum,  &
-			//        FirstHVACIteration, &
-			//        AirLoopNum )
-			//    END IF
-
-			// 2 passes; 1 usually suffices; 2 is done if ResolveSysFlow detects a failure of mass balance
-			SimPasses: for ( AirLoopPass = 1; AirLoopPass <= 2; ++AirLoopPass ) {
-
-				SysReSim = false;
-
-				// Simulate controllers on air loop with current air mass flow rates
-				SimAirLoop( FirstHVACIteration, AirLoopNum, AirLoopPass, AirLoopIterMax, AirLoopIterTot, AirLoopNumCalls );
-
-				// Update tracker for maximum number of iterations needed by any controller on all air loops
-				IterMax = max( IterMax, AirLoopIterMax );
-				// Update tracker for aggregated number of iterations needed by all controllers on all air loops
-				IterTot += AirLoopIterTot;
-				// Update tracker for total number of times SimAirLoopComponents() has been invoked across all air loops
-				NumCallsTot += AirLoopNumCalls;
-
-				// At the end of the first pass, check whether a second pass is needed or not
-				if ( AirLoopPass == 1 ) {
-					// If simple system, skip second pass
-					if ( AirLoopControlInfo( AirLoopNum ).Simple ) goto SimPasses_exit;
-					ResolveSysFlow( AirLoopNum, SysReSim );
-					// If mass balance OK, skip second pass
-					if ( ! SysReSim ) goto SimPasses_exit;
-				}
-
-				SimPasses_loop: ; // end pass loop
-			}
-			SimPasses_exit: ;
-
-			// Air system side has been simulated, now transfer conditions across to
-			// the zone equipment side, looping through all supply air paths for this
-			// air loop.
-			for ( AirSysOutNum = 1; AirSysOutNum <= AirToZoneNodeInfo( AirLoopNum ).NumSupplyNodes; ++AirSysOutNum ) {
-				if ( AirSysOutNum == 1 ) CalledFrom = CalledFromAirSystemSupplySideDeck1;
-				if ( AirSysOutNum == 2 ) CalledFrom = CalledFromAirSystemSupplySideDeck2;
-				UpdateHVACInterface( AirLoopNum, CalledFrom, AirToZoneNodeInfo( AirLoopNum ).AirLoopSupplyNodeNum( AirSysOutNum ), AirToZoneNodeInfo( AirLoopNum ).ZoneEquipSupplyNodeNum( AirSysOutNum ), SimZoneEquipment );
-			} // ...end of DO loop over supply air paths for this air loop.
+			epStartHVACProfile( PrimaryAirSystem( AirLoopNum ).Name );
+			SimOneAirLoop( FirstHVACIteration, AirLoopNum, SimZoneEquipment );
+			epStopHVACProfile( AirLoopSimIterTot( AirLoopNum ) );
 
 		} // End of Air Loop iteration
 
+		MergeAirLoopSimStatistics( IterMax, IterTot, NumCallsTot );
+
 		// Reset current system number for sizing routines
 		CurSysNum = 0;
 
 	}
 
+	void
+	MergeAirLoopSimStatistics(
+		int & IterMax, // maximum controller iterations on any air loop
+		int & IterTot, // controller iterations summed over all air loops
+		int & NumCallsTot // air loop component simulation calls summed over all air loops
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Adds the controller iteration statistics of each air loop for the current HVAC
+		// iteration to the all-air-loop trackers and to the per-air-loop step totals.
+
+		// METHODOLOGY EMPLOYED:
+		// The air loops are visited in air loop order, so the trackers do not depend on
+		// the order in which SimOneAirLoop was called for the loops.
+
+		// Locals
+		int AirLoopNum; // Primary Air Sys DO loop index
+
+		for ( AirLoopNum = 1; AirLoopNum <= NumPrimaryAirSys; ++AirLoopNum ) {
+			// Update tracker for maximum number of iterations needed by any controller on all air loops
+			IterMax = max( IterMax, AirLoopSimIterMax( AirLoopNum ) );
+			// Update tracker for aggregated number of iterations needed by all controllers on all air loops
+			IterTot += AirLoopSimIterTot( AirLoopNum );
+			// Update tracker for total number of times SimAirLoopComponents() has been invoked across all air loops
+			NumCallsTot += AirLoopSimNumCalls( AirLoopNum );
+			AirLoopSimIterTotSum( AirLoopNum ) += AirLoopSimIterTot( AirLoopNum );
+		}
+
+	}
+
+	void
+	SimOneAirLoop(
+		bool const FirstHVACIteration,
+		int const AirLoopNum, // index of the primary air system to simulate
+		bool & SimZoneEquipment
+	)
+	{
+
+		// SUBROUTINE INFORMATION
+		//             AUTHOR:  Russ Taylor, Dan Fisher, Fred Buhl
+		//       DATE WRITTEN:  Oct 1997
+		//           MODIFIED:  Oct 2026, moved from SimAirLoops
+		//      RE-ENGINEERED:  This is new code, not reengineered
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Simulates one primary air system and passes its outlet node conditions
+		// on to the attached Zone Equipment inlet nodes.
+
+		// METHODOLOGY EMPLOYED:
+		// The air loop is simulated with up to two passes (the second only if mass balance
+		// fails).  The controller iteration statistics are kept per air loop in
+		// AirLoopSimIterMax, AirLoopSimIterTot and AirLoopSimNumCalls; SimAirLoops merges
+		// them in air loop order so the totals do not depend on the order the loops run in.
+		// The loops are still simulated one after another: TurnFansOn, TurnFansOff,
+		// NightVentOn and CurSysNum are process-wide, and the fan, coil and mixer models
+		// keep module-level state, so these would have to become per loop first.
+
+		// REFERENCES: None
+
+		// Using/Aliasing
+		using HVACInterfaceManager::UpdateHVACInterface;
+		using DataConvergParams::CalledFromAirSystemSupplySideDeck1;
+		using DataConvergParams::CalledFromAirSystemSupplySideDeck2;
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+		// TRUE if first full HVAC iteration in an HVAC timestep
+		// TRUE if Zone Equipment needs to be resimulated.
+
+		// SUBROUTINE PARAMETER DEFINITIONS: None
+
+		// INTERFACE BLOCK DEFINITIONS: None
+
+		// DERIVED TYPE DEFINITIONS: None
+
+		// SUBROUTINE LOCAL VARIABLE DEFINITIONS
+		// Max number of iterations performed by controllers on each air loop
+		int AirLoopIterMax;
+		// Aggregated number of iterations across all controllers on each air loop
+		int AirLoopIterTot;
+		// Total number of times SimAirLoopComponents() has been invoked to simulate each air loop
+		int AirLoopNumCalls;
+		// Primary air system outlet DO loop index
+		int AirSysOutNum;
+		// DO loop index; there are 2 passes - the 2nd is done only if mass balance fails
+		int AirLoopPass;
+		// Flag set by ResolveSysFlow; if TRUE, mass balance failed and there must be a second pass
+		bool SysReSim;
+		int CalledFrom;
+
+		// FLOW:
+
+		AirLoopSimIterMax( AirLoopNum ) = 0;
+		AirLoopSimIterTot( AirLoopNum ) = 0;
+		AirLoopSimNumCalls( AirLoopNum ) = 0;
+
+		// Check to see if System Availability Managers are asking for fans to cycle on or shut off
+		// and set fan on/off flags accordingly.
+		TurnFansOn = false;
+		TurnFansOff = false;
+		NightVentOn = false;
+		if ( PriAirSysAvailMgr( AirLoopNum ).AvailStatus == CycleOn ) {
+			TurnFansOn = true;
+		}
+		if ( PriAirSysAvailMgr( AirLoopNum ).AvailStatus == ForceOff ) {
+			TurnFansOff = true;
+		}
+		if ( AirLoopControlInfo( AirLoopNum ).NightVent ) {
+			NightVentOn = true;
+		}
+
+		//   Set current system number for sizing routines
+		CurSysNum = AirLoopNum;
+
+		// RR why is this called here, it's called first in SimAirLoop. Causes no diff's to comment out.
+		//    IF (AirLoopControlInfo(AirLoopNum)%OACtrlNum > 0) THEN
+		//      CALL SimOAController( &
+		//        AirLoopControlInfo(AirLoopNum)%OACtrlName, &
+		//        AirLoopControlInfo(AirLoopNum)%OACtrlNum,  &
+		//        FirstHVACIteration, &
+		//        AirLoopNum )
+		//    END IF
+
+		// 2 passes; 1 usually suffices; 2 is done if ResolveSysFlow detects a failure of mass balance
+		SimPasses: for ( AirLoopPass = 1; AirLoopPass <= 2; ++AirLoopPass ) {
+
+			SysReSim = false;
+
+			// Simulate controllers on air loop with current air mass flow rates
+			SimAirLoop( FirstHVACIteration, AirLoopNum, AirLoopPass, AirLoopIterMax, AirLoopIterTot, AirLoopNumCalls );
+
+			// Update this air loop's statistics for the current HVAC iteration
+			AirLoopSimIterMax( AirLoopNum ) = max( AirLoopSimIterMax( AirLoopNum ), AirLoopIterMax );
+			AirLoopSimIterTot( AirLoopNum ) += AirLoopIterTot;
+			AirLoopSimNumCalls( AirLoopNum ) += AirLoopNumCalls;
+
+			// At the end of the first pass, check whether a second pass is needed or not
+			if ( AirLoopPass == 1 ) {
+				// If simple system, skip second pass
+				if ( AirLoopControlInfo( AirLoopNum ).Simple ) goto SimPasses_exit;
+				ResolveSysFlow( AirLoopNum, SysReSim );
+				// If mass balance OK, skip second pass
+				if ( ! SysReSim ) goto SimPasses_exit;
+			}
+
+			SimPasses_loop: ; // end pass loop
+		}
+		SimPasses_exit: ;
+
+		// Air system side has been simulated, now transfer conditions across to
+		// the zone equipment side, looping through all supply air paths for this
+		// air loop.
+		for ( AirSysOutNum = 1; AirSysOutNum <= AirToZoneNodeInfo( AirLoopNum ).NumSupplyNodes; ++AirSysOutNum ) {
+			if ( AirSysOutNum == 1 ) CalledFrom = CalledFromAirSystemSupplySideDeck1;
+			if ( AirSysOutNum == 2 ) CalledFrom = CalledFromAirSystemSupplySideDeck2;
+			UpdateHVACInterface( AirLoopNum, CalledFrom, AirToZoneNodeInfo( AirLoopNum ).AirLoopSupplyNodeNum( AirSysOutNum ), AirToZoneNodeInfo( AirLoopNum ).ZoneEquipSupplyNodeNum( AirSysOutNum ), SimZoneEquipment );
+		} // ...end of DO loop over supply air paths for this air loop.
+
+	}
+
 	void
 	SimAirLoop(
 		bool const FirstHVACIteration,
@@ -2402,6 +2506,8 @@ namespace SimAirServingZones {
 		using namespace DataHVACControllers;
 		using HVACControllers::ManageControllers;
 		using General::CreateSysTimeIntervalString;
+		using DataTimings::epStartHVACProfile;
+		using DataTimings::epStopHVACProfile;
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -2492,6 +2598,7 @@ namespace SimAirServingZones {
 			}
 
 			// For each controller in sequence, iterate until convergence
+			epStartHVACProfile( PrimaryAirSystem( AirLoopNum ).ControllerName( AirLoopControlNum ) );
 			while ( ! ControllerConvergedFlag ) {
 
 				++Iter;
@@ -2537,6 +2644,7 @@ namespace SimAirServingZones {
 				}
 
 			} // End of the Convergence Iteration
+			epStopHVACProfile( Iter );
 
 			// Update tracker for max iteration counter across all controllers on this air loops
 			IterMax = max( IterMax, Iter );
@@ -2705,7 +2813,9 @@ namespace SimAirServingZones {
 
 		// REFERENCES: None
 
-		// USE STATEMENTS: None
+		// Using/Aliasing
+		using DataTimings::epStartHVACProfile;
+		using DataTimings::epStopHVACProfile;
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -2737,7 +2847,9 @@ namespace SimAirServingZones {
 				CompType_Num = PrimaryAirSystem( AirLoopNum ).Branch( BranchNum ).Comp( CompNum ).CompType_Num;
 
 				// Simulate each component on PrimaryAirSystem(AirLoopNum)%Branch(BranchNum)%Name
+				epStartHVACProfile( PrimaryAirSystem( AirLoopNum ).Branch( BranchNum ).Comp( CompNum ).Name );
 				SimAirLoopComponent( PrimaryAirSystem( AirLoopNum ).Branch( BranchNum ).Comp( CompNum ).Name, CompType_Num, FirstHVACIteration, AirLoopNum, PrimaryAirSystem( AirLoopNum ).Branch( BranchNum ).Comp( CompNum ).CompIndex );
+				epStopHVACProfile();
 			} // End of component loop
 
 			// Enforce continuity through the splitter
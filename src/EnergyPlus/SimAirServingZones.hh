@@ -4,6 +4,9 @@
 // C++ Headers
 #include <string>
 
+// ObjexxFCL Headers
+#include <ObjexxFCL/FArray1D.hh>
+
 // EnergyPlus Headers
 #include <EnergyPlus.hh>
 
@@ -54,6 +57,10 @@ namespace SimAirServingZones {
 	// MODULE VARIABLE DECLARATIONS:
 	extern bool GetAirLoopInputFlag; // Flag set to make sure you get input once
 	extern int NumOfTimeStepInDay; // number of zone time steps in a day
+	extern FArray1D_int AirLoopSimIterMax; // max controller iterations on each air loop in the current HVAC iteration
+	extern FArray1D_int AirLoopSimIterTot; // controller iterations on each air loop in the current HVAC iteration
+	extern FArray1D_int AirLoopSimNumCalls; // air loop component simulation calls on each air loop in the current HVAC iteration
+	extern FArray1D_int AirLoopSimIterTotSum; // controller iterations on each air loop in the current HVAC step (report variable)
 
 	// Subroutine Specifications for the Module
 	// Driver/Manager Routines
@@ -97,6 +104,20 @@ namespace SimAirServingZones {
 		bool & SimZoneEquipment
 	);
 
+	void
+	SimOneAirLoop(
+		bool const FirstHVACIteration,
+		int const AirLoopNum, // index of the primary air system to simulate
+		bool & SimZoneEquipment
+	);
+
+	void
+	MergeAirLoopSimStatistics(
+		int & IterMax, // maximum controller iterations on any air loop
+		int & IterTot, // controller iterations summed over all air loops
+		int & NumCallsTot // air loop component simulation calls summed over all air loops
+	);
+
 	void
 	SimAirLoop(
 		bool const FirstHVACIteration,
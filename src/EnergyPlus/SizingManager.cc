@@ -1,6 +1,17 @@
 // C++ Headers
+#include <cerrno>
 #include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
 #include <string>
+#ifndef _WIN32
+#include <signal.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/FArray.functions.hh>
@@ -18,6 +29,7 @@
 #include <DataPrecisionGlobals.hh>
 #include <DataSizing.hh>
 #include <DataStringGlobals.hh>
+#include <DataSystemVariables.hh>
 #include <DataZoneEquipment.hh>
 #include <DisplayRoutines.hh>
 #include <EMSManager.hh>
@@ -28,6 +40,7 @@
 #include <OutputReportTabular.hh>
 #include <ScheduleManager.hh>
 #include <SimAirServingZones.hh>
+#include <SolarShading.hh>
 #include <SQLiteProcedures.hh>
 #include <UtilityRoutines.hh>
 #include <WeatherManager.hh>
@@ -75,6 +88,12 @@ namespace SizingManager {
 
 	// MODULE VARIABLE DECLARATIONS:
 	int NumAirLoops( 0 );
+	int NumZoneSizingWorkers( 0 ); // number of forked processes sharing the zone sizing periods
+	int ZoneSizingWorkerNum( 0 ); // index of this process among the zone sizing workers (0 = main process)
+	int FirstWorkerSimDay( 0 ); // first overall sim day simulated after the workers were started
+	FArray1D_int ZoneSizingWorkerPid; // process id of each zone sizing worker
+	FArray1D_int ZoneSizingWorkerPipe; // read end of the pipe each worker returns its results through
+	int ZoneSizingResultPipe( -1 ); // write end of the result pipe (in a worker)
 
 	// SUBROUTINE SPECIFICATIONS FOR MODULE SimulationManager
 
@@ -129,6 +148,8 @@ namespace SizingManager {
 		using OutputReportTabular::AllocateLoadComponentArrays;
 		using OutputReportTabular::DeallocateLoadComponentArrays;
 		using OutputReportTabular::ComputeLoadComponentDecayCurve;
+		using OutputReportTabular::ComputeLoadComponentDecayCurveFromCTF;
+		using DataSystemVariables::LoadComponentDecayFromCTF;
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -164,6 +185,7 @@ namespace SizingManager {
 		int write_stat;
 		int numZoneSizeIter; // number of times to repeat zone sizing calcs. 1 normal, 2 load component reporting
 		int iZoneCalcIter; // index for repeating the zone sizing calcs
+		int LastPeriod; // last sizing period simulated by this process
 		static bool runZeroingOnce( true );
 		bool isUserReqCompLoadReport;
 
@@ -202,7 +224,7 @@ namespace SizingManager {
 				ShowWarningError( RoutineName + "The ZoneComponentLoadSummary report was requested but no sizing objects were found so that report cannot be generated." );
 			}
 		}
-		if ( CompLoadReportIsReq ) { //if that report is created then zone sizing calculations are repeated
+		if ( CompLoadReportIsReq && ! LoadComponentDecayFromCTF ) { //if that report is created then zone sizing calculations are repeated
 			numZoneSizeIter = 2;
 		} else {
 			numZoneSizeIter = 1;
@@ -253,13 +275,14 @@ namespace SizingManager {
 				//the pulse simulation needs to be done first (the 1 in the following line) otherwise
 				//the difference seen in the loads in the epluspls and epluszsz files are not
 				//simple decreasing curves but appear as amost random fluctuations.
-				isPulseZoneSizing = ( CompLoadReportIsReq && ( iZoneCalcIter == 1 ) );
+				isPulseZoneSizing = ( ( numZoneSizeIter == 2 ) && ( iZoneCalcIter == 1 ) );
 
 				Available = true;
 
 				ResetEnvironmentCounter();
 				CurOverallSimDay = 0;
 				NumSizingPeriodsPerformed = 0;
+				LastPeriod = 0;
 				while ( Available ) { // loop over environments
 
 					GetNextEnvironment( Available, ErrorsFound ); // get an environment
@@ -274,6 +297,15 @@ namespace SizingManager {
 
 					++NumSizingPeriodsPerformed;
 
+					// the periods after the first may be shared among worker processes (not with the pulse)
+					if ( NumSizingPeriodsPerformed == 2 && ! CompLoadReportIsReq ) {
+						StartZoneSizingWorkers( CurOverallSimDay + 1 );
+					}
+					if ( NumZoneSizingWorkers > 0 && mod( NumSizingPeriodsPerformed - 2, NumZoneSizingWorkers + 1 ) != ZoneSizingWorkerNum ) {
+						CurOverallSimDay += NumOfDayInEnvrn;
+						continue;
+					}
+
 					BeginEnvrnFlag = true;
 					EndEnvrnFlag = false;
 					EndMonthFlag = false;
@@ -391,9 +423,13 @@ namespace SizingManager {
 
 					LastMonth = Month;
 					LastDayOfMonth = DayOfMonth;
+					LastPeriod = NumSizingPeriodsPerformed;
 
 				} // ... End environment loop
 
+				if ( ZoneSizingWorkerNum > 0 ) FinishZoneSizingWorker( LastPeriod, LastMonth, LastDayOfMonth );
+				if ( NumZoneSizingWorkers > 0 ) CollectZoneSizingWorkers( LastPeriod, LastMonth, LastDayOfMonth );
+
 				if ( NumSizingPeriodsPerformed > 0 ) {
 					UpdateZoneSizing( EndZoneSizingCalc );
 					ZoneSizingRunDone = true;
@@ -411,7 +447,11 @@ namespace SizingManager {
 			// both the pulse and normal zone sizing is complete so now post processing of the results is performed
 			if ( CompLoadReportIsReq ) {
 				// call the routine that computes the decay curve
-				ComputeLoadComponentDecayCurve();
+				if ( LoadComponentDecayFromCTF ) {
+					ComputeLoadComponentDecayCurveFromCTF();
+				} else {
+					ComputeLoadComponentDecayCurve();
+				}
 				// remove some of the arrays used to derive the decay curves
 				DeallocateLoadComponentArrays();
 			}
@@ -667,6 +707,510 @@ namespace SizingManager {
 
 	}
 
+	void
+	StartZoneSizingWorkers( int const FirstDay ) // first overall sim day of the periods shared among the workers
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Forks the worker processes that simulate the remaining zone sizing periods
+		// alongside this (main) process.
+
+		// METHODOLOGY EMPLOYED:
+		// Called once the first sizing period has been simulated, so all input has been
+		// gotten and each worker starts from the same state the main process continues
+		// from.  Periods are dealt round robin; each worker returns its days of
+		// CalcZoneSizing through a pipe.  If a worker cannot be started the periods are
+		// simulated sequentially.
+
+		// Using/Aliasing
+		using DataEnvironment::TotDesDays;
+		using DataSystemVariables::DesignDaySizingWorkers;
+		using General::RoundSigDigits;
+
+		// Locals
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		static std::string const RoutineName( "StartZoneSizingWorkers: " );
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int NumWorkers; // number of worker processes to start
+		int WorkerNum; // worker index
+		int Unit; // file unit number
+		bool Failed; // true if a pipe or process could not be created
+
+		if ( DesignDaySizingWorkers <= 1 ) return;
+		// the main process simulates its share of the periods after the first one
+		NumWorkers = min( DesignDaySizingWorkers - 1, TotDesDays + TotRunDesPers - 2 );
+		if ( NumWorkers < 1 ) return;
+
+#ifndef _WIN32
+		// anything still buffered would be written again by each worker
+		for ( Unit = 1; Unit <= 1000; ++Unit ) {
+			gio::flush( Unit );
+		}
+		std::cout.flush();
+		std::cerr.flush();
+		SolarShading::shd_stream.flush();
+
+		ZoneSizingWorkerPid.dimension( NumWorkers, 0 );
+		ZoneSizingWorkerPipe.dimension( NumWorkers, -1 );
+		NumZoneSizingWorkers = NumWorkers;
+		DeferFinalZoneSizing = true;
+		FirstWorkerSimDay = FirstDay;
+		Failed = false;
+		for ( WorkerNum = 1; WorkerNum <= NumWorkers; ++WorkerNum ) {
+			int PipeFd[ 2 ];
+			if ( pipe( PipeFd ) != 0 ) {
+				Failed = true;
+				break;
+			}
+			pid_t const Pid( fork() );
+			if ( Pid < 0 ) {
+				close( PipeFd[ 0 ] );
+				close( PipeFd[ 1 ] );
+				Failed = true;
+				break;
+			}
+			if ( Pid == 0 ) { // worker
+				close( PipeFd[ 0 ] );
+				for ( int Prev = 1; Prev < WorkerNum; ++Prev ) {
+					close( ZoneSizingWorkerPipe( Prev ) );
+				}
+				ZoneSizingWorkerNum = WorkerNum;
+				ZoneSizingResultPipe = PipeFd[ 1 ];
+				InitZoneSizingWorker();
+				return;
+			}
+			close( PipeFd[ 1 ] );
+			ZoneSizingWorkerPid( WorkerNum ) = Pid;
+			ZoneSizingWorkerPipe( WorkerNum ) = PipeFd[ 0 ];
+		}
+
+		if ( Failed ) {
+			for ( WorkerNum = 1; WorkerNum <= NumWorkers; ++WorkerNum ) {
+				if ( ZoneSizingWorkerPid( WorkerNum ) <= 0 ) continue;
+				kill( ZoneSizingWorkerPid( WorkerNum ), SIGKILL );
+				waitpid( ZoneSizingWorkerPid( WorkerNum ), nullptr, 0 );
+				close( ZoneSizingWorkerPipe( WorkerNum ) );
+				std::remove( ZoneSizingWorkerErrFileName( WorkerNum ).c_str() );
+			}
+			ZoneSizingWorkerPid.deallocate();
+			ZoneSizingWorkerPipe.deallocate();
+			NumZoneSizingWorkers = 0;
+			DeferFinalZoneSizing = false;
+			ShowWarningError( RoutineName + "Could not start the zone sizing worker processes; the sizing periods will be simulated sequentially." );
+			return;
+		}
+
+		DisplayString( "Sharing Zone Sizing periods among " + RoundSigDigits( NumWorkers + 1 ) + " processes" );
+#else
+		static bool WarningIssued( false ); // true once the platform warning has been shown
+		if ( ! WarningIssued ) {
+			ShowWarningError( RoutineName + "DesignDaySizingWorkers is not supported on this platform; the sizing periods will be simulated sequentially." );
+			WarningIssued = true;
+		}
+#endif
+
+	}
+
+	void
+	InitZoneSizingWorker()
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Detaches a newly forked zone sizing worker from the output of the main process.
+
+		// METHODOLOGY EMPLOYED:
+		// The worker shares the open files of the main process.  Output units are
+		// reopened on the null device, except the error file, which is reopened on a
+		// file of its own that the main process appends to its error file.  Input units
+		// are reopened by name at the same position so reads no longer move the file
+		// position of the main process.  Console and SQLite output are dropped.
+
+		// Using/Aliasing
+		using DataStringGlobals::outputErrFileName;
+		using DataStringGlobals::outputEndFileName;
+
+		// Locals
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		static std::string const NullDevice( "/dev/null" );
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		std::string MainErrFileName; // error file name of the main process
+		int Unit; // file unit number
+
+#ifndef _WIN32
+		MainErrFileName = outputErrFileName;
+		outputErrFileName = ZoneSizingWorkerErrFileName( ZoneSizingWorkerNum );
+		outputEndFileName = NullDevice;
+
+		for ( Unit = 1; Unit <= 1000; ++Unit ) {
+			IOFlags flags;
+			gio::inquire( Unit, flags );
+			if ( ! flags.open() ) continue;
+			if ( flags.write() ) {
+				std::string const FileName( flags.name() == MainErrFileName ? outputErrFileName : NullDevice );
+				{ IOFlags wflags; wflags.ACTION( "write" ); gio::open( Unit, FileName, wflags ); }
+			} else if ( flags.read() ) {
+				std::string const FileName( flags.name() );
+				std::istream * Stream_p( gio::inp_stream( Unit ) );
+				std::streampos const Pos( Stream_p != nullptr ? Stream_p->tellg() : std::streampos( 0 ) );
+				{ IOFlags rflags; rflags.ACTION( "read" ); gio::open( Unit, FileName, rflags ); }
+				Stream_p = gio::inp_stream( Unit );
+				if ( Stream_p != nullptr && Pos > 0 ) Stream_p->seekg( Pos );
+			}
+		}
+		// these point into streams of units that have just been reopened
+		eso_stream = nullptr;
+		mtr_stream = nullptr;
+		InputProcessor::echo_stream = nullptr;
+
+		SolarShading::shd_stream.setstate( std::ios::badbit );
+		std::cout.setstate( std::ios::badbit );
+		std::cerr.setstate( std::ios::badbit );
+		// the database connection belongs to the main process
+		sqlite.release();
+#endif
+
+	}
+
+	void
+	FinishZoneSizingWorker(
+		int LastPeriod, // last sizing period simulated by this worker
+		int LastMonth, // month at the end of that period
+		int LastDayOfMonth // day of month at the end of that period
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Returns the results of a zone sizing worker to the main process and ends the worker.
+
+		// METHODOLOGY EMPLOYED:
+		// The results are packed and written to the result pipe.  The worker ends with
+		// _exit so that nothing the main process owns is flushed or closed twice.
+
+		// Locals
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		ZoneSizingResultBuffer Buf; // packed results
+		std::string::size_type Written; // number of bytes written to the pipe
+		int Unit; // file unit number
+
+#ifndef _WIN32
+		Buf.Pack = true;
+		TransferZoneSizingResults( Buf, LastPeriod, LastMonth, LastDayOfMonth );
+
+		Written = 0;
+		while ( Written < Buf.Data.size() ) {
+			ssize_t const Count( write( ZoneSizingResultPipe, Buf.Data.data() + Written, Buf.Data.size() - Written ) );
+			if ( Count < 0 ) {
+				if ( errno == EINTR ) continue;
+				_exit( EXIT_FAILURE );
+			}
+			Written += Count;
+		}
+		close( ZoneSizingResultPipe );
+
+		for ( Unit = 1; Unit <= 1000; ++Unit ) {
+			gio::flush( Unit );
+		}
+		_exit( EXIT_SUCCESS );
+#endif
+
+	}
+
+	void
+	CollectZoneSizingWorkers(
+		int & LastPeriod, // last sizing period simulated by any process
+		int & LastMonth, // month at the end of that period
+		int & LastDayOfMonth // day of month at the end of that period
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Waits for the zone sizing workers and merges their results into the main process.
+
+		// METHODOLOGY EMPLOYED:
+		// Each worker's days of CalcZoneSizing, ZoneSizing and DesDayWeath are read from
+		// its pipe and its error file is appended to the main error file.  Once all days
+		// are in place they are merged into CalcFinalZoneSizing in day order, as the
+		// sequential calculation does at the end of each day.
+
+		// Using/Aliasing
+		using ZoneEquipmentManager::UpdateFinalZoneSizing;
+		using General::RoundSigDigits;
+
+		// Locals
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		static std::string const RoutineName( "CollectZoneSizingWorkers: " );
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int WorkerNum; // worker index
+		int Day; // overall sim day
+		bool ErrorsFound; // true if a worker failed
+		char Chunk[ 65536 ]; // read buffer
+
+#ifndef _WIN32
+		ErrorsFound = false;
+		for ( WorkerNum = 1; WorkerNum <= NumZoneSizingWorkers; ++WorkerNum ) {
+			ZoneSizingResultBuffer Buf;
+			Buf.Pack = false;
+			while ( true ) {
+				ssize_t const Count( read( ZoneSizingWorkerPipe( WorkerNum ), Chunk, sizeof( Chunk ) ) );
+				if ( Count < 0 && errno == EINTR ) continue;
+				if ( Count <= 0 ) break;
+				Buf.Data.append( Chunk, Count );
+			}
+			close( ZoneSizingWorkerPipe( WorkerNum ) );
+
+			int Status( 0 );
+			while ( waitpid( ZoneSizingWorkerPid( WorkerNum ), &Status, 0 ) < 0 && errno == EINTR ) {}
+			AppendZoneSizingWorkerErrors( WorkerNum );
+
+			bool Succeeded( WIFEXITED( Status ) && WEXITSTATUS( Status ) == EXIT_SUCCESS );
+			int WorkerLastPeriod( 0 );
+			int WorkerLastMonth( 0 );
+			int WorkerLastDayOfMonth( 0 );
+			if ( Succeeded ) {
+				TransferZoneSizingResults( Buf, WorkerLastPeriod, WorkerLastMonth, WorkerLastDayOfMonth );
+				Succeeded = ( Buf.Ok && Buf.Pos == Buf.Data.size() );
+			}
+			if ( ! Succeeded ) {
+				ShowSevereError( RoutineName + "Zone sizing worker process " + RoundSigDigits( WorkerNum ) + " did not complete its sizing periods." );
+				ErrorsFound = true;
+			} else if ( WorkerLastPeriod > LastPeriod ) {
+				LastPeriod = WorkerLastPeriod;
+				LastMonth = WorkerLastMonth;
+				LastDayOfMonth = WorkerLastDayOfMonth;
+			}
+		}
+		ZoneSizingWorkerPid.deallocate();
+		ZoneSizingWorkerPipe.deallocate();
+		NumZoneSizingWorkers = 0;
+		if ( ErrorsFound ) {
+			ShowFatalError( RoutineName + "Preceding zone sizing errors cause program termination" );
+		}
+
+		DeferFinalZoneSizing = false;
+		for ( Day = FirstWorkerSimDay; Day <= CurOverallSimDay; ++Day ) {
+			UpdateFinalZoneSizing( Day );
+		}
+#endif
+
+	}
+
+	template< typename T >
+	inline
+	void
+	TransferValue(
+		ZoneSizingResultBuffer & Buf,
+		T & Value
+	)
+	{
+		if ( Buf.Pack ) {
+			Buf.Data.append( reinterpret_cast< char const * >( &Value ), sizeof( T ) );
+		} else if ( Buf.Ok && Buf.Pos + sizeof( T ) <= Buf.Data.size() ) {
+			std::memcpy( &Value, Buf.Data.data() + Buf.Pos, sizeof( T ) );
+			Buf.Pos += sizeof( T );
+		} else {
+			Buf.Ok = false;
+		}
+	}
+
+	inline
+	void
+	TransferValue(
+		ZoneSizingResultBuffer & Buf,
+		std::string & String
+	)
+	{
+		int Length( String.size() );
+		TransferValue( Buf, Length );
+		if ( Buf.Pack ) {
+			Buf.Data.append( String );
+		} else if ( Buf.Ok && Length >= 0 && Buf.Pos + Length <= Buf.Data.size() ) {
+			String.assign( Buf.Data, Buf.Pos, Length );
+			Buf.Pos += Length;
+		} else {
+			Buf.Ok = false;
+		}
+	}
+
+	inline
+	void
+	TransferValue(
+		ZoneSizingResultBuffer & Buf,
+		FArray1D< Real64 > & Values
+	)
+	{
+		int Length( Values.isize() );
+		TransferValue( Buf, Length );
+		if ( ! Buf.Pack && Length != Values.isize() ) Buf.Ok = false; // arrays are sized identically in every process
+		if ( ! Buf.Ok ) return;
+		for ( int i = 1; i <= Length; ++i ) {
+			TransferValue( Buf, Values( i ) );
+		}
+	}
+
+	void
+	TransferZoneSizingResults(
+		ZoneSizingResultBuffer & Buf,
+		int & LastPeriod, // last sizing period simulated by the worker
+		int & LastMonth, // month at the end of that period
+		int & LastDayOfMonth // day of month at the end of that period
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Packs (Buf%Pack) or unpacks the zone sizing results of the days a worker simulated.
+
+		// METHODOLOGY EMPLOYED:
+		// One field list serves both directions so the two cannot drift apart.  A day was
+		// simulated by the worker if its design day weather has a date; only the fields
+		// UpdateZoneSizing( EndZoneSizingCalc ) and UpdateFinalZoneSizing use are moved.
+		// The thermostat set point extremes are combined with those of the main process.
+
+		// Locals
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int Day; // overall sim day
+		int CtrlZoneNum; // controlled zone index
+		int Simulated; // 1 if the worker simulated the day
+
+		TransferValue( Buf, LastPeriod );
+		TransferValue( Buf, LastMonth );
+		TransferValue( Buf, LastDayOfMonth );
+
+		for ( Day = FirstWorkerSimDay; Day <= CurOverallSimDay; ++Day ) {
+			Simulated = ( Buf.Pack && ! DesDayWeath( Day ).DateString.empty() ) ? 1 : 0;
+			TransferValue( Buf, Simulated );
+			if ( ! Buf.Ok ) return;
+			if ( Simulated == 0 ) continue;
+
+			auto & Weath( DesDayWeath( Day ) );
+			TransferValue( Buf, Weath.DateString );
+			TransferValue( Buf, Weath.Temp );
+			TransferValue( Buf, Weath.HumRat );
+			TransferValue( Buf, Weath.Press );
+
+			for ( CtrlZoneNum = 1; CtrlZoneNum <= NumOfZones; ++CtrlZoneNum ) {
+				if ( ! ZoneEquipConfig( CtrlZoneNum ).IsControlled ) continue;
+				auto & Calc( CalcZoneSizing( CtrlZoneNum, Day ) );
+				TransferValue( Buf, Calc.CoolDesDay );
+				TransferValue( Buf, Calc.HeatDesDay );
+				TransferValue( Buf, Calc.HeatDDNum );
+				TransferValue( Buf, Calc.CoolDDNum );
+				TransferValue( Buf, Calc.TimeStepNumAtHeatMax );
+				TransferValue( Buf, Calc.TimeStepNumAtCoolMax );
+				TransferValue( Buf, Calc.DesHeatDens );
+				TransferValue( Buf, Calc.DesHeatLoad );
+				TransferValue( Buf, Calc.DesHeatMassFlow );
+				TransferValue( Buf, Calc.ZoneTempAtHeatPeak );
+				TransferValue( Buf, Calc.OutTempAtHeatPeak );
+				TransferValue( Buf, Calc.ZoneRetTempAtHeatPeak );
+				TransferValue( Buf, Calc.HeatTstatTemp );
+				TransferValue( Buf, Calc.ZoneHumRatAtHeatPeak );
+				TransferValue( Buf, Calc.OutHumRatAtHeatPeak );
+				TransferValue( Buf, Calc.DesHeatVolFlow );
+				TransferValue( Buf, Calc.DesHeatCoilInTemp );
+				TransferValue( Buf, Calc.DesHeatCoilInHumRat );
+				TransferValue( Buf, Calc.DesCoolDens );
+				TransferValue( Buf, Calc.DesCoolLoad );
+				TransferValue( Buf, Calc.DesCoolMassFlow );
+				TransferValue( Buf, Calc.ZoneTempAtCoolPeak );
+				TransferValue( Buf, Calc.OutTempAtCoolPeak );
+				TransferValue( Buf, Calc.ZoneRetTempAtCoolPeak );
+				TransferValue( Buf, Calc.CoolTstatTemp );
+				TransferValue( Buf, Calc.ZoneHumRatAtCoolPeak );
+				TransferValue( Buf, Calc.OutHumRatAtCoolPeak );
+				TransferValue( Buf, Calc.DesCoolVolFlow );
+				TransferValue( Buf, Calc.DesCoolCoilInTemp );
+				TransferValue( Buf, Calc.DesCoolCoilInHumRat );
+				TransferValue( Buf, Calc.HeatFlowSeq );
+				TransferValue( Buf, Calc.HeatLoadSeq );
+				TransferValue( Buf, Calc.HeatZoneTempSeq );
+				TransferValue( Buf, Calc.HeatOutTempSeq );
+				TransferValue( Buf, Calc.HeatZoneRetTempSeq );
+				TransferValue( Buf, Calc.HeatTstatTempSeq );
+				TransferValue( Buf, Calc.HeatZoneHumRatSeq );
+				TransferValue( Buf, Calc.HeatOutHumRatSeq );
+				TransferValue( Buf, Calc.CoolFlowSeq );
+				TransferValue( Buf, Calc.CoolLoadSeq );
+				TransferValue( Buf, Calc.CoolZoneTempSeq );
+				TransferValue( Buf, Calc.CoolOutTempSeq );
+				TransferValue( Buf, Calc.CoolZoneRetTempSeq );
+				TransferValue( Buf, Calc.CoolTstatTempSeq );
+				TransferValue( Buf, Calc.CoolZoneHumRatSeq );
+				TransferValue( Buf, Calc.CoolOutHumRatSeq );
+				auto & Siz( ZoneSizing( CtrlZoneNum, Day ) );
+				TransferValue( Buf, Siz.DesHeatSetPtSeq );
+				TransferValue( Buf, Siz.HeatTstatTempSeq );
+				TransferValue( Buf, Siz.DesCoolSetPtSeq );
+				TransferValue( Buf, Siz.CoolTstatTempSeq );
+			}
+		}
+
+		FArray1D< Real64 > SetPtHi( ZoneSizThermSetPtHi ); // worker's highest thermostat set points
+		FArray1D< Real64 > SetPtLo( ZoneSizThermSetPtLo ); // worker's lowest thermostat set points
+		TransferValue( Buf, SetPtHi );
+		TransferValue( Buf, SetPtLo );
+		if ( ! Buf.Pack && Buf.Ok ) {
+			for ( CtrlZoneNum = 1; CtrlZoneNum <= SetPtHi.isize(); ++CtrlZoneNum ) {
+				ZoneSizThermSetPtHi( CtrlZoneNum ) = max( ZoneSizThermSetPtHi( CtrlZoneNum ), SetPtHi( CtrlZoneNum ) );
+				ZoneSizThermSetPtLo( CtrlZoneNum ) = min( ZoneSizThermSetPtLo( CtrlZoneNum ), SetPtLo( CtrlZoneNum ) );
+			}
+		}
+
+	}
+
+	void
+	AppendZoneSizingWorkerErrors( int const WorkerNum )
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Appends the error file of a zone sizing worker to the main error file.
+
+		// METHODOLOGY EMPLOYED:
+		// Warnings, severes and their continuation lines are shown again through the usual
+		// routines so they are counted and reach SQLite as if the main process had issued
+		// them.  The worker's file is removed afterwards.
+
+		// Locals
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		static std::string const WarningPrefix( " ** Warning ** " );
+		static std::string const SeverePrefix( " ** Severe  ** " );
+		static std::string const ContinuePrefix( " **   ~~~   ** " );
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		std::string const FileName( ZoneSizingWorkerErrFileName( WorkerNum ) );
+		std::string Line; // line of the worker's error file
+
+		{ std::ifstream ErrFile( FileName );
+		while ( std::getline( ErrFile, Line ) ) {
+			if ( has_prefix( Line, "Program Version," ) ) continue;
+			if ( has_prefix( Line, "  " ) ) Line.erase( 0, 2 ); // written with format (2X,A)
+			if ( has_prefix( Line, WarningPrefix ) ) {
+				ShowWarningError( Line.substr( WarningPrefix.length() ) );
+			} else if ( has_prefix( Line, SeverePrefix ) ) {
+				ShowSevereError( Line.substr( SeverePrefix.length() ) );
+			} else if ( has_prefix( Line, ContinuePrefix ) ) {
+				ShowContinueError( Line.substr( ContinuePrefix.length() ) );
+			} else {
+				ShowErrorMessage( Line );
+			}
+		}}
+		std::remove( FileName.c_str() );
+
+	}
+
+	std::string
+	ZoneSizingWorkerErrFileName( int const WorkerNum )
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns the name of the error file a zone sizing worker writes to.
+
+		return DataStringGlobals::outputErrFileName + ".w" + General::RoundSigDigits( WorkerNum );
+
+	}
+
 	void
 	GetOARequirements()
 	{
@@ -23,6 +23,12 @@ namespace SizingManager {
 
 	// MODULE VARIABLE DECLARATIONS:
 	extern int NumAirLoops;
+	extern int NumZoneSizingWorkers; // number of forked processes sharing the zone sizing periods
+	extern int ZoneSizingWorkerNum; // index of this process among the zone sizing workers (0 = main process)
+	extern int FirstWorkerSimDay; // first overall sim day simulated after the workers were started
+	extern FArray1D_int ZoneSizingWorkerPid; // process id of each zone sizing worker
+	extern FArray1D_int ZoneSizingWorkerPipe; // read end of the pipe each worker returns its results through
+	extern int ZoneSizingResultPipe; // write end of the result pipe (in a worker)
 
 	// SUBROUTINE SPECIFICATIONS FOR MODULE SimulationManager
 
@@ -53,11 +59,62 @@ namespace SizingManager {
 
 	};
 
+	struct ZoneSizingResultBuffer
+	{
+		// Members
+		bool Pack; // true when results are written to Data, false when they are read from it
+		bool Ok; // false once an unpack has run past the end of Data or found a size mismatch
+		std::string::size_type Pos; // read position in Data
+		std::string Data; // packed zone sizing results
+
+		// Default Constructor
+		ZoneSizingResultBuffer() :
+			Pack( true ),
+			Ok( true ),
+			Pos( 0 )
+		{}
+
+	};
+
 	// Functions
 
 	void
 	ManageSizing();
 
+	void
+	StartZoneSizingWorkers( int const FirstDay ); // first overall sim day of the periods shared among the workers
+
+	void
+	InitZoneSizingWorker();
+
+	void
+	FinishZoneSizingWorker(
+		int LastPeriod, // last sizing period simulated by this worker
+		int LastMonth, // month at the end of that period
+		int LastDayOfMonth // day of month at the end of that period
+	);
+
+	void
+	CollectZoneSizingWorkers(
+		int & LastPeriod, // last sizing period simulated by any process
+		int & LastMonth, // month at the end of that period
+		int & LastDayOfMonth // day of month at the end of that period
+	);
+
+	void
+	TransferZoneSizingResults(
+		ZoneSizingResultBuffer & Buf,
+		int & LastPeriod, // last sizing period simulated by the worker
+		int & LastMonth, // month at the end of that period
+		int & LastDayOfMonth // day of month at the end of that period
+	);
+
+	void
+	AppendZoneSizingWorkerErrors( int const WorkerNum );
+
+	std::string
+	ZoneSizingWorkerErrFileName( int const WorkerNum );
+
 	void
 	GetOARequirements();
 
@@ -0,0 +1,168 @@
+// C++ Headers
+#include <string>
+#include <vector>
+
+// EnergyPlus Headers
+#include <StateManagement.hh>
+#include <ConductionTransferFunctionCalc.hh>
+#include <CurveManager.hh>
+#include <DataAirLoop.hh>
+#include <DataAirSystems.hh>
+#include <DataEnvironment.hh>
+#include <DataGlobals.hh>
+#include <DataHeatBalance.hh>
+#include <DataHeatBalFanSys.hh>
+#include <DataHVACGlobals.hh>
+#include <DataLoopNode.hh>
+#include <DataPlant.hh>
+#include <DataSizing.hh>
+#include <DataSurfaces.hh>
+#include <DataTimings.hh>
+#include <DataZoneControls.hh>
+#include <DataZoneEnergyDemands.hh>
+#include <DataZoneEquipment.hh>
+#include <FluidProperties.hh>
+#include <OutputReportTabular.hh>
+#include <WarmupSnapshot.hh>
+#include <WindowComplexManager.hh>
+#include <WindowManager.hh>
+
+namespace EnergyPlus {
+
+	// Modules that keep namespace or saved routine state and have no clear_state in clearAllStates yet
+	static std::vector< std::string > const ModulesNotCleared( {
+		"AirflowNetworkBalanceManager", "AirflowNetworkSolver", "BaseboardElectric", "BaseboardRadiator",
+		"Boilers", "BoilerSteam", "BranchInputManager", "ChillerAbsorption", "ChillerElectricEIR",
+		"ChillerExhaustAbsorption", "ChillerGasAbsorption", "ChillerIndirectAbsorption", "ChillerReformulatedEIR",
+		"CommandLineInterface", "CondenserLoopTowers", "ConvectionCoefficients", "CoolTower",
+		"CostEstimateManager", "CrossVentMgr", "CTElectricGenerator", "DataAirflowNetwork",
+		"DataBranchAirLoopPlant", "DataBranchNodeConnections", "DataBSDFWindow", "DataContaminantBalance",
+		"DataConvergParams", "DataCostEstimate", "DataDaylighting", "DataDaylightingDevices", "DataDefineEquip",
+		"DataErrorTracking", "DataGenerators", "DataHeatBalSurface", "DataIPShortCuts", "DataMoistureBalance",
+		"DataMoistureBalanceEMPD", "DataOutputs", "DataPhotovoltaics", "DataPlantPipingSystems",
+		"DataReportingFlags", "DataRoomAirModel", "DataRuntimeLanguage", "DataShadowingCombinations",
+		"DataStringGlobals", "DataSurfaceColors", "DataSurfaceLists", "DataSystemVariables", "DataUCSDSharedData",
+		"DataViewFactorInformation", "DataWater", "DataWindowEquivalentLayer", "DaylightingDevices",
+		"DaylightingManager", "DemandManager", "DesiccantDehumidifiers", "DirectAirManager", "DisplacementVentMgr",
+		"DualDuct", "DXCoils", "DXFEarClipping", "EarthTube", "EconomicLifeCycleCost", "EconomicTariff",
+		"EcoRoofManager", "ElectricBaseboardRadiator", "EMSManager", "EvaporativeCoolers",
+		"EvaporativeFluidCoolers", "ExteriorEnergyUse", "ExternalInterface", "FanCoilUnits", "Fans",
+		"FaultsManager", "FluidCoolers", "FuelCellElectricGenerator", "Furnaces", "General",
+		"GeneratorDynamicsManager", "GeneratorFuelSupply", "GlobalNames", "GroundHeatExchangers",
+		"HeatBalanceAirManager", "HeatBalanceHAMTManager", "HeatBalanceIntRadExchange", "HeatBalanceManager",
+		"HeatBalanceSurfaceManager", "HeatBalFiniteDiffManager", "HeatingCoils", "HeatPumpWaterToWaterCOOLING",
+		"HeatPumpWaterToWaterHEATING", "HeatPumpWaterToWaterSimple", "HeatRecovery", "HighTempRadiantSystem",
+		"Humidifiers", "HVACControllers", "HVACCooledBeam", "HVACDuct", "HVACDXHeatPumpSystem", "HVACDXSystem",
+		"HVACHXAssistedCoolingCoil", "HVACInterfaceManager", "HVACManager", "HVACMultiSpeedHeatPump",
+		"HVACSingleDuctInduc", "HVACStandAloneERV", "HVACUnitaryBypassVAV", "HVACUnitarySystem",
+		"HVACVariableRefrigerantFlow", "HWBaseboardRadiator", "ICEngineElectricGenerator", "IceThermalStorage",
+		"InputProcessor", "InternalHeatGains", "LowTempRadiantSystem", "ManageElectricPower", "MatrixDataManager",
+		"MicroCHPElectricGenerator", "MicroturbineElectricGenerator", "MixedAir", "MixerComponent",
+		"MoistureBalanceEMPDManager", "MundtSimMgr", "NodeInputManager", "NonZoneEquipmentManager",
+		"OutAirNodeManager", "OutdoorAirUnit", "OutputProcessor", "OutputReportPredefined", "OutsideEnergySources",
+		"PackagedTerminalHeatPump", "PackagedThermalStorageCoil", "Photovoltaics", "PhotovoltaicThermalCollectors",
+		"PipeHeatTransfer", "Pipes", "PlantCentralGSHP", "PlantChillers", "PlantComponentTemperatureSources",
+		"PlantCondLoopOperation", "PlantHeatExchangerFluidToFluid", "PlantLoadProfile", "PlantLoopEquip",
+		"PlantLoopSolver", "PlantManager", "PlantPipingSystemsManager", "PlantPressureSystem", "PlantUtilities",
+		"PlantValves", "PollutionModule", "PondGroundHeatExchanger", "PoweredInductionUnits", "Psychrometrics",
+		"Pumps", "PurchasedAirManager", "RefrigeratedCase", "ReportSizingManager", "ReturnAirPathManager",
+		"RoomAirModelManager", "RoomAirModelUserTempPattern", "RootFinder", "RuntimeLanguageProcessor",
+		"ScheduleManager", "SetPointManager", "SimAirServingZones", "SimulationManager", "SingleDuct",
+		"SizingManager", "SolarCollectors", "SolarReflectionManager", "SolarShading", "SplitterComponent",
+		"StandardRatings", "SteamBaseboardRadiator", "SteamCoils", "SurfaceGeometry", "SurfaceGroundHeatExchanger",
+		"SwimmingPool", "SystemAvailabilityManager", "SystemReports", "TARCOGGasses90", "TARCOGMain",
+		"TARCOGOutput", "ThermalChimney", "ThermalComfort", "ThermalISO15099Calc", "TranspiredCollector",
+		"UFADManager", "UnitHeater", "UnitVentilator", "UserDefinedComponents", "VariableSpeedCoils", "Vectors",
+		"VentilatedSlab", "WaterCoils", "WaterManager", "WaterThermalTanks", "WaterToAirHeatPump",
+		"WaterToAirHeatPumpSimple", "WaterUse", "WeatherManager", "WindowAC", "WindowEquivalentLayer",
+		"WindTurbine", "ZoneAirLoopEquipmentManager", "ZoneContaminantPredictorCorrector",
+		"ZoneDehumidifier", "ZoneEquipmentManager", "ZonePlenum", "ZoneTempPredictorCorrector"
+	} );
+
+	void
+	clearAllStates()
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Restores the module variables of the modules listed below to their initial values,
+		// so that a new set of input can be processed in the same process (unit tests,
+		// repeated runs through the library).
+
+		// METHODOLOGY EMPLOYED:
+		// Each module with a clear_state routine is listed here.  A module is listed once its
+		// clear_state covers all of its namespace-scope variables; input flags held as local
+		// statics inside routines must be moved to module scope first.  The modules that are
+		// not covered yet are listed in ModulesNotCleared (see modulesNotCleared).
+
+		// REFERENCES:
+		// na
+
+		ConductionTransferFunctionCalc::clear_state();
+		CurveManager::clear_state();
+		DataAirLoop::clear_state();
+		DataAirSystems::clear_state();
+		DataEnvironment::clear_state();
+		DataGlobals::clear_state();
+		DataHeatBalance::clear_state();
+		DataHeatBalFanSys::clear_state();
+		DataHVACGlobals::clear_state();
+		DataLoopNode::clear_state();
+		DataPlant::clear_state();
+		DataSizing::clear_state();
+		DataSurfaces::clear_state();
+		DataTimings::clear_state();
+		DataZoneControls::clear_state();
+		DataZoneEnergyDemands::clear_state();
+		DataZoneEquipment::clear_state();
+		FluidProperties::clear_state();
+		OutputReportTabular::clear_state();
+		WarmupSnapshot::clear_state();
+		WindowComplexManager::clear_state();
+		WindowManager::clear_state();
+
+	}
+
+	std::string
+	modulesNotCleared()
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns the names of the modules whose state clearAllStates does not restore, separated
+		// by commas, or an empty string once every module is covered.
+
+		// METHODOLOGY EMPLOYED:
+		// A module is removed from ModulesNotCleared when its clear_state is added to clearAllStates.
+
+		// REFERENCES:
+		// na
+
+		std::string Names;
+		for ( auto const & Name : ModulesNotCleared ) {
+			if ( ! Names.empty() ) Names += ", ";
+			Names += Name;
+		}
+		return Names;
+
+	}
+
+	//     NOTICE
+	//     Copyright  1996-2014 The Board of Trustees of the University of Illinois
+	//     and The Regents of the University of California through Ernest Orlando Lawrence
+	//     Berkeley National Laboratory.  All rights reserved.
+	//     Portions of the EnergyPlus software package have been developed and copyrighted
+	//     by other individuals, companies and institutions.  These portions have been
+	//     incorporated into the EnergyPlus software package under license.   For a complete
+	//     list of contributors, see "Notice" located in main.cc.
+	//     NOTICE: The U.S. Government is granted for itself and others acting on its
+	//     behalf a paid-up, nonexclusive, irrevocable, worldwide license in this data to
+	//     reproduce, prepare derivative works, and perform publicly and display publicly.
+	//     Beginning five (5) years after permission to assert copyright is granted,
+	//     subject to two possible five year renewals, the U.S. Government is granted for
+	//     itself and others acting on its behalf a paid-up, non-exclusive, irrevocable
+	//     worldwide license in this data to reproduce, prepare derivative works,
+	//     distribute copies to the public, perform publicly and display publicly, and to
+	//     permit others to do so.
+	//     TRADEMARKS: EnergyPlus is a trademark of the US Department of Energy.
+
+
+} // EnergyPlus
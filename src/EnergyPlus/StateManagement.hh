@@ -0,0 +1,22 @@
+#ifndef StateManagement_hh_INCLUDED
+#define StateManagement_hh_INCLUDED
+
+// C++ Headers
+#include <string>
+
+// EnergyPlus Headers
+#include <EnergyPlus.hh>
+
+namespace EnergyPlus {
+
+	// Functions
+
+	void
+	clearAllStates();
+
+	std::string
+	modulesNotCleared();
+
+} // EnergyPlus
+
+#endif
@@ -200,6 +200,7 @@ AbortEnergyPlus()
 #ifdef EP_Detailed_Timings
 	epSummaryTimes( Time_Finish - Time_Start );
 #endif
+	epWriteHVACProfile();
 	CloseOutOpenFiles();
 	// Close the socket used by ExternalInterface. This call also sends the flag "-1" to the ExternalInterface,
 	// indicating that E+ terminated with an error.
@@ -431,6 +432,7 @@ EndEnergyPlus()
 #ifdef EP_Detailed_Timings
 	epSummaryTimes( Time_Finish - Time_Start );
 #endif
+	epWriteHVACProfile();
 	CloseOutOpenFiles();
 	// Close the ExternalInterface socket. This call also sends the flag "1" to the ExternalInterface,
 	// indicating that E+ finished its simulation
@@ -1506,6 +1508,11 @@ StoreRecurringErrorMessage(
 
 }
 
+// Standard error output file of ShowErrorMessage
+static int TotalErrors( 0 ); // used to determine when to open standard error output file.
+static int StandardErrorOutput;
+static bool ErrFileOpened( false );
+
 void
 ShowErrorMessage(
 	std::string const & ErrorMessage,
@@ -1552,10 +1559,7 @@ ShowErrorMessage(
 	// na
 
 	// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-	static int TotalErrors( 0 ); // used to determine when to open standard error output file.
-	static int StandardErrorOutput;
 	int write_stat;
-	static bool ErrFileOpened( false );
 
 	if ( TotalErrors == 0 && ! ErrFileOpened ) {
 		StandardErrorOutput = GetNewUnitNumber();
@@ -1583,6 +1587,23 @@ ShowErrorMessage(
 
 }
 
+void
+CloseErrorMessageFile()
+{
+
+	// PURPOSE OF THIS SUBROUTINE:
+	// Closes the standard error output file, if ShowErrorMessage has opened it, so the
+	// next error message opens DataStringGlobals::outputErrFileName afresh.  A batch run
+	// calls this before forking the process of each job.
+
+	if ( ErrFileOpened ) {
+		gio::close( StandardErrorOutput );
+		ErrFileOpened = false;
+	}
+	TotalErrors = 0;
+
+}
+
 void
 SummarizeErrors()
 {
@@ -212,6 +212,9 @@ ShowErrorMessage(
 	Optional_int OutUnit2 = _
 );
 
+void
+CloseErrorMessageFile();
+
 void
 SummarizeErrors();
 
@@ -0,0 +1,551 @@
+// C++ Headers
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <map>
+#include <string>
+#include <vector>
+#ifdef _WIN32
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
+
+// ObjexxFCL Headers
+#include <ObjexxFCL/FArray.functions.hh>
+
+// EnergyPlus Headers
+#include <WarmupSnapshot.hh>
+#include <DataEnvironment.hh>
+#include <DataGlobals.hh>
+#include <DataHeatBalance.hh>
+#include <DataHeatBalFanSys.hh>
+#include <DataHeatBalSurface.hh>
+#include <DataPrecisionGlobals.hh>
+#include <DataSurfaces.hh>
+#include <DataSystemVariables.hh>
+#include <DisplayRoutines.hh>
+#include <HeatBalanceManager.hh>
+#include <UtilityRoutines.hh>
+
+namespace EnergyPlus {
+
+namespace WarmupSnapshot {
+
+	// PURPOSE OF THIS MODULE:
+	// Saves the thermal state of the building at the end of warmup and starts later runs
+	// of the same model from it, so that warmup only has to confirm convergence instead
+	// of building up the surface and zone histories from a uniform 23C.
+
+	// METHODOLOGY EMPLOYED:
+	// When warmup converges, the CTF temperature and flux histories, the zone air
+	// temperature and humidity histories, and the last warmup day's convergence values are
+	// copied into a record keyed by environment and written to a binary file.  A later run
+	// reads the file and, in the begin environment initializations, overwrites the default
+	// initial state with the saved one when the model signature (zones, surfaces,
+	// constructions, time step) matches.  Warmup still runs and still has to pass
+	// CheckWarmupConvergence; it is only excused from the minimum number of warmup days.
+	// The file is written in native byte order and is meant to be reused on the same machine.
+
+	// REFERENCES:
+	// na
+
+	// OTHER NOTES:
+	// Only models where every surface uses the CTF algorithm are supported.  The CondFD, HAMT
+	// and EMPD solutions and the ground domains have state of their own that is not saved.
+
+	// Using/Aliasing
+	using namespace DataPrecisionGlobals;
+	using DataGlobals::NumOfZones;
+	using DataGlobals::NumOfTimeStepInHour;
+	using DataGlobals::KindOfSim;
+	using DataGlobals::DoingSizing;
+	using DataEnvironment::EnvironmentName;
+	using DataSystemVariables::WarmupSnapshotSaveFile;
+	using DataSystemVariables::WarmupSnapshotLoadFile;
+
+	// Data
+	// MODULE PARAMETER DEFINITIONS
+	std::string const SnapshotFileTag( "EPWARMUP" ); // Leading characters of a snapshot file
+	std::int32_t const SnapshotFileVersion( 1 ); // Layout version of a snapshot file
+
+	// DERIVED TYPE DEFINITIONS
+	// na
+
+	// MODULE VARIABLE DECLARATIONS:
+	bool WarmupStateRestored( false ); // TRUE if the current environment started from a saved warmup state
+	bool SnapshotFileRead( false ); // TRUE once the snapshot load file has been read
+	bool SnapshotNotSupportedWarning( false ); // TRUE once the unsupported-model warning has been shown
+	std::map< std::string, SnapshotRecord > SnapshotRecords; // Saved warmup states, by environment key
+
+	// SUBROUTINE SPECIFICATIONS FOR MODULE WarmupSnapshot
+
+	// Functions
+
+	void
+	clear_state()
+	{
+		WarmupStateRestored = false;
+		SnapshotFileRead = false;
+		SnapshotNotSupportedWarning = false;
+		SnapshotRecords.clear();
+	}
+
+	void
+	InitWarmupSnapshot()
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Called at the beginning of each environment.  Reads the snapshot file on first use,
+		// finds the record for the environment and, if it belongs to this model, restores the
+		// warmup convergence values and flags the environment as restored so the surface and
+		// zone air histories are restored in their own begin environment initializations.
+
+		WarmupStateRestored = false;
+		if ( WarmupSnapshotLoadFile.empty() ) return;
+
+		if ( ! SnapshotFileRead ) {
+			SnapshotFileRead = true;
+			if ( ! ReadSnapshotFile( WarmupSnapshotLoadFile ) ) {
+				ShowWarningError( "InitWarmupSnapshot: Could not read warmup snapshot file=\"" + WarmupSnapshotLoadFile + "\"." );
+				ShowContinueError( "...Warmup will start from the default initial state." );
+			}
+		}
+
+		if ( ! SnapshotSupported() ) return;
+
+		auto const Found( SnapshotRecords.find( SnapshotKey() ) );
+		if ( Found == SnapshotRecords.end() ) return;
+		if ( Found->second.Signature != ModelSignature() ) {
+			ShowWarningError( "InitWarmupSnapshot: Saved warmup state for Environment=\"" + EnvironmentName + "\" does not match the current model." );
+			ShowContinueError( "...Warmup will start from the default initial state." );
+			return;
+		}
+
+		TransferConvergenceHistories( Found->second, true );
+		WarmupStateRestored = true;
+		DisplayString( "Starting Warmup from Saved State" );
+
+	}
+
+	void
+	RestoreSurfaceHistories()
+	{
+		if ( ! WarmupStateRestored ) return;
+		TransferSurfaceHistories( SnapshotRecords[ SnapshotKey() ], true );
+	}
+
+	void
+	RestoreZoneAirHistories()
+	{
+		if ( ! WarmupStateRestored ) return;
+		TransferZoneAirHistories( SnapshotRecords[ SnapshotKey() ], true );
+	}
+
+	void
+	SaveWarmupSnapshot()
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Called when warmup has converged.  Replaces the record for the environment with the
+		// current state and rewrites the snapshot file, so that states saved for earlier
+		// environments survive a run that is stopped part way.
+
+		if ( WarmupSnapshotSaveFile.empty() ) return;
+		if ( ! SnapshotSupported() ) return;
+
+		SnapshotRecord & Record( SnapshotRecords[ SnapshotKey() ] );
+		Record.Signature = ModelSignature();
+		Record.Arrays.clear();
+		TransferSurfaceHistories( Record, false );
+		TransferZoneAirHistories( Record, false );
+		TransferConvergenceHistories( Record, false );
+
+		if ( ! WriteSnapshotFile( WarmupSnapshotSaveFile ) ) {
+			ShowWarningError( "SaveWarmupSnapshot: Could not write warmup snapshot file=\"" + WarmupSnapshotSaveFile + "\"." );
+		}
+
+	}
+
+	std::string
+	SnapshotKey()
+	{
+		// Sizing runs of a design day warm up with ideal loads, so they get a record of their own
+		return EnvironmentName + '|' + std::to_string( KindOfSim ) + ( DoingSizing ? "|Sizing" : "" );
+	}
+
+	template< typename T >
+	inline
+	void
+	HashValue(
+		std::uint64_t & Hash,
+		T const Value
+	)
+	{
+		// FNV-1a over the bytes of the value
+		unsigned char const * Bytes( reinterpret_cast< unsigned char const * >( &Value ) );
+		for ( std::size_t i = 0; i < sizeof( T ); ++i ) {
+			Hash ^= Bytes[ i ];
+			Hash *= 1099511628211ull;
+		}
+	}
+
+	std::uint64_t
+	ModelSignature()
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Hashes the model features that the layout and meaning of the saved arrays depend on.
+
+		// Using/Aliasing
+		using DataHeatBalance::Construct;
+		using DataHeatBalance::MaxCTFTerms;
+		using DataHeatBalance::Zone;
+		using DataSurfaces::Surface;
+		using DataSurfaces::TotSurfaces;
+
+		std::uint64_t Hash( 14695981039346656037ull );
+
+		HashValue( Hash, NumOfZones );
+		HashValue( Hash, TotSurfaces );
+		HashValue( Hash, MaxCTFTerms );
+		HashValue( Hash, NumOfTimeStepInHour );
+		for ( int ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum ) {
+			HashValue( Hash, Zone( ZoneNum ).Volume );
+		}
+		for ( int SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+			int const ConstrNum( Surface( SurfNum ).Construction );
+			HashValue( Hash, ConstrNum );
+			HashValue( Hash, Surface( SurfNum ).ExtBoundCond );
+			if ( ConstrNum <= 0 || ! Surface( SurfNum ).HeatTransSurf ) continue;
+			HashValue( Hash, Construct( ConstrNum ).NumCTFTerms );
+			HashValue( Hash, Construct( ConstrNum ).NumHistories );
+			HashValue( Hash, Construct( ConstrNum ).UValue );
+		}
+
+		return Hash;
+
+	}
+
+	bool
+	SnapshotSupported()
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns true if every surface uses the CTF solution, whose whole state is captured
+		// by the saved arrays.
+
+		// Using/Aliasing
+		using DataHeatBalance::HeatTransferAlgosUsed;
+		using DataHeatBalance::UseCTF;
+
+		if ( NumOfZones > 0 && all_eq( HeatTransferAlgosUsed, UseCTF ) ) return true;
+
+		if ( ! SnapshotNotSupportedWarning ) {
+			ShowWarningError( "Warmup snapshots are only supported when all surfaces use the CTF heat balance algorithm." );
+			ShowContinueError( "...The warmup state will not be saved or restored." );
+			SnapshotNotSupportedWarning = true;
+		}
+		return false;
+
+	}
+
+	template< typename T >
+	void
+	TransferArray(
+		SnapshotRecord & Record,
+		std::string const & Name,
+		FArray< T > & A,
+		bool const Restore
+	)
+	{
+		if ( Restore ) {
+			auto const Found( Record.Arrays.find( Name ) );
+			if ( ( Found == Record.Arrays.end() ) || ( Found->second.size() != A.size() ) ) return;
+			std::vector< Real64 > const & Values( Found->second );
+			for ( std::size_t i = 0, e = A.size(); i < e; ++i ) {
+				A[ i ] = static_cast< T >( Values[ i ] );
+			}
+		} else {
+			std::vector< Real64 > & Values( Record.Arrays[ Name ] );
+			Values.resize( A.size() );
+			for ( std::size_t i = 0, e = A.size(); i < e; ++i ) {
+				Values[ i ] = static_cast< Real64 >( A[ i ] );
+			}
+		}
+	}
+
+	void
+	TransferSurfaceHistories(
+		SnapshotRecord & Record,
+		bool const Restore
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Saves or restores the arrays set by HeatBalanceSurfaceManager::InitThermalAndFluxHistories:
+		// the CTF histories, the surface temperatures and the zone air temperatures and
+		// humidity ratios that the first surface heat balance of the environment uses.
+
+		// Using/Aliasing
+		using namespace DataHeatBalSurface;
+		using namespace DataHeatBalFanSys;
+		using DataHeatBalance::MRT;
+
+		TransferArray( Record, "TH", TH, Restore );
+		TransferArray( Record, "QH", QH, Restore );
+		TransferArray( Record, "THM", THM, Restore );
+		TransferArray( Record, "QHM", QHM, Restore );
+		TransferArray( Record, "TsrcHist", TsrcHist, Restore );
+		TransferArray( Record, "QsrcHist", QsrcHist, Restore );
+		TransferArray( Record, "TsrcHistM", TsrcHistM, Restore );
+		TransferArray( Record, "QsrcHistM", QsrcHistM, Restore );
+		TransferArray( Record, "SUMH", SUMH, Restore );
+		TransferArray( Record, "TempSurfIn", TempSurfIn, Restore );
+		TransferArray( Record, "TempSurfInTmp", TempSurfInTmp, Restore );
+		TransferArray( Record, "TempSurfOut", TempSurfOut, Restore );
+		TransferArray( Record, "MRT", MRT, Restore );
+		TransferArray( Record, "MAT", MAT, Restore );
+		TransferArray( Record, "ZT", ZT, Restore );
+		TransferArray( Record, "ZTAV", ZTAV, Restore );
+		TransferArray( Record, "XMAT", XMAT, Restore );
+		TransferArray( Record, "XM2T", XM2T, Restore );
+		TransferArray( Record, "XM3T", XM3T, Restore );
+		TransferArray( Record, "XM4T", XM4T, Restore );
+		TransferArray( Record, "XMPT", XMPT, Restore );
+		TransferArray( Record, "DSXMAT", DSXMAT, Restore );
+		TransferArray( Record, "DSXM2T", DSXM2T, Restore );
+		TransferArray( Record, "DSXM3T", DSXM3T, Restore );
+		TransferArray( Record, "DSXM4T", DSXM4T, Restore );
+		TransferArray( Record, "ZoneTMX", ZoneTMX, Restore );
+		TransferArray( Record, "ZoneTM2", ZoneTM2, Restore );
+		TransferArray( Record, "ZoneAirHumRat", ZoneAirHumRat, Restore );
+		TransferArray( Record, "ZoneAirHumRatAvg", ZoneAirHumRatAvg, Restore );
+		TransferArray( Record, "ZoneAirHumRatOld", ZoneAirHumRatOld, Restore );
+
+	}
+
+	void
+	TransferZoneAirHistories(
+		SnapshotRecord & Record,
+		bool const Restore
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Saves or restores the zone air history terms that ZoneTempPredictorCorrector resets
+		// at the beginning of each environment.
+
+		// Using/Aliasing
+		using namespace DataHeatBalFanSys;
+
+		TransferArray( Record, "ZTM1", ZTM1, Restore );
+		TransferArray( Record, "ZTM2", ZTM2, Restore );
+		TransferArray( Record, "ZTM3", ZTM3, Restore );
+		TransferArray( Record, "WZoneTimeMinus1", WZoneTimeMinus1, Restore );
+		TransferArray( Record, "WZoneTimeMinus2", WZoneTimeMinus2, Restore );
+		TransferArray( Record, "WZoneTimeMinus3", WZoneTimeMinus3, Restore );
+		TransferArray( Record, "WZoneTimeMinus4", WZoneTimeMinus4, Restore );
+		TransferArray( Record, "WZoneTimeMinusP", WZoneTimeMinusP, Restore );
+		TransferArray( Record, "DSWZoneTimeMinus1", DSWZoneTimeMinus1, Restore );
+		TransferArray( Record, "DSWZoneTimeMinus2", DSWZoneTimeMinus2, Restore );
+		TransferArray( Record, "DSWZoneTimeMinus3", DSWZoneTimeMinus3, Restore );
+		TransferArray( Record, "DSWZoneTimeMinus4", DSWZoneTimeMinus4, Restore );
+		TransferArray( Record, "ZoneT1", ZoneT1, Restore );
+		TransferArray( Record, "ZoneW1", ZoneW1, Restore );
+		TransferArray( Record, "ZoneWMX", ZoneWMX, Restore );
+		TransferArray( Record, "ZoneWM2", ZoneWM2, Restore );
+
+	}
+
+	void
+	TransferConvergenceHistories(
+		SnapshotRecord & Record,
+		bool const Restore
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Saves or restores the last warmup day's zone temperature and load extremes, which the
+		// first warmup day of a restored run is compared against.
+
+		// Using/Aliasing
+		using namespace HeatBalanceManager;
+
+		TransferArray( Record, "MaxTempPrevDay", MaxTempPrevDay, Restore );
+		TransferArray( Record, "MinTempPrevDay", MinTempPrevDay, Restore );
+		TransferArray( Record, "MaxHeatLoadPrevDay", MaxHeatLoadPrevDay, Restore );
+		TransferArray( Record, "MaxCoolLoadPrevDay", MaxCoolLoadPrevDay, Restore );
+
+	}
+
+	template< typename T >
+	inline
+	void
+	WriteValue(
+		std::ofstream & File,
+		T const & Value
+	)
+	{
+		File.write( reinterpret_cast< char const * >( &Value ), sizeof( T ) );
+	}
+
+	inline
+	void
+	WriteString(
+		std::ofstream & File,
+		std::string const & String
+	)
+	{
+		WriteValue( File, static_cast< std::uint32_t >( String.size() ) );
+		File.write( String.data(), String.size() );
+	}
+
+	bool
+	WriteSnapshotFile( std::string const & FileName )
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Writes all snapshot records to FileName.  Returns false if the file could not be written.
+
+		// METHODOLOGY EMPLOYED:
+		// Layout: tag, version, record count, then per record the key, signature, array count
+		// and per array its name, length and values.  Strings are written as a 32 bit length
+		// followed by the characters.  The records go to a temporary file, named after this
+		// process, that is then renamed over FileName, so an interrupted or concurrent run
+		// never leaves a partly written snapshot behind.
+
+#ifdef _WIN32
+		std::string const TempFileName( FileName + '.' + std::to_string( _getpid() ) + ".tmp" );
+#else
+		std::string const TempFileName( FileName + '.' + std::to_string( getpid() ) + ".tmp" );
+#endif
+		std::ofstream File( TempFileName, std::ios::binary | std::ios::trunc );
+		if ( ! File ) return false;
+
+		File.write( SnapshotFileTag.data(), SnapshotFileTag.size() );
+		WriteValue( File, SnapshotFileVersion );
+		WriteValue( File, static_cast< std::uint32_t >( SnapshotRecords.size() ) );
+		for ( auto const & Entry : SnapshotRecords ) {
+			WriteString( File, Entry.first );
+			WriteValue( File, Entry.second.Signature );
+			WriteValue( File, static_cast< std::uint32_t >( Entry.second.Arrays.size() ) );
+			for ( auto const & Array : Entry.second.Arrays ) {
+				WriteString( File, Array.first );
+				WriteValue( File, static_cast< std::uint64_t >( Array.second.size() ) );
+				if ( ! Array.second.empty() ) File.write( reinterpret_cast< char const * >( Array.second.data() ), Array.second.size() * sizeof( Real64 ) );
+			}
+		}
+		File.close();
+
+		if ( ! File ) {
+			std::remove( TempFileName.c_str() );
+			return false;
+		}
+		if ( std::rename( TempFileName.c_str(), FileName.c_str() ) != 0 ) {
+			// rename does not replace an existing file on Windows
+			std::remove( FileName.c_str() );
+			if ( std::rename( TempFileName.c_str(), FileName.c_str() ) != 0 ) {
+				std::remove( TempFileName.c_str() );
+				return false;
+			}
+		}
+		return true;
+
+	}
+
+	template< typename T >
+	inline
+	bool
+	ReadValue(
+		std::ifstream & File,
+		T & Value
+	)
+	{
+		return static_cast< bool >( File.read( reinterpret_cast< char * >( &Value ), sizeof( T ) ) );
+	}
+
+	inline
+	bool
+	ReadString(
+		std::ifstream & File,
+		std::string & String
+	)
+	{
+		std::uint32_t Length( 0 );
+		if ( ! ReadValue( File, Length ) ) return false;
+		String.resize( Length );
+		return ( Length == 0 ) || static_cast< bool >( File.read( &String[ 0 ], Length ) );
+	}
+
+	bool
+	ReadSnapshotFile( std::string const & FileName )
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Reads the snapshot records in FileName (written by WriteSnapshotFile) into
+		// SnapshotRecords.  Returns false, leaving SnapshotRecords unchanged, if the file is
+		// missing, is not a snapshot file or is truncated.
+
+		std::ifstream File( FileName, std::ios::binary );
+		if ( ! File ) return false;
+
+		std::string Tag( SnapshotFileTag.size(), ' ' );
+		std::int32_t Version( 0 );
+		std::uint32_t NumRecords( 0 );
+		if ( ! File.read( &Tag[ 0 ], Tag.size() ) || Tag != SnapshotFileTag ) return false;
+		if ( ! ReadValue( File, Version ) || Version != SnapshotFileVersion ) return false;
+		if ( ! ReadValue( File, NumRecords ) ) return false;
+
+		std::map< std::string, SnapshotRecord > Records;
+		for ( std::uint32_t RecNum = 0; RecNum < NumRecords; ++RecNum ) {
+			std::string Key;
+			std::uint32_t NumArrays( 0 );
+			if ( ! ReadString( File, Key ) ) return false;
+			SnapshotRecord & Record( Records[ Key ] );
+			if ( ! ReadValue( File, Record.Signature ) ) return false;
+			if ( ! ReadValue( File, NumArrays ) ) return false;
+			for ( std::uint32_t ArrayNum = 0; ArrayNum < NumArrays; ++ArrayNum ) {
+				std::string Name;
+				std::uint64_t Size( 0 );
+				if ( ! ReadString( File, Name ) ) return false;
+				if ( ! ReadValue( File, Size ) ) return false;
+				std::vector< Real64 > & Values( Record.Arrays[ Name ] );
+				Values.resize( Size );
+				if ( Size > 0 && ! File.read( reinterpret_cast< char * >( Values.data() ), Size * sizeof( Real64 ) ) ) return false;
+			}
+		}
+
+		for ( auto & Entry : Records ) {
+			SnapshotRecords[ Entry.first ] = std::move( Entry.second );
+		}
+		return true;
+
+	}
+
+	//     NOTICE
+
+	//     Copyright  1996-2014 The Board of Trustees of the University of Illinois
+	//     and The Regents of the University of California through Ernest Orlando Lawrence
+	//     Berkeley National Laboratory.  All rights reserved.
+
+	//     Portions of the EnergyPlus software package have been developed and copyrighted
+	//     by other individuals, companies and institutions.  These portions have been
+	//     incorporated into the EnergyPlus software package under license.   For a complete
+	//     list of contributors, see "Notice" located in main.cc.
+
+	//     NOTICE: The U.S. Government is granted for itself and others acting on its
+	//     behalf a paid-up, nonexclusive, irrevocable, worldwide license in this data to
+	//     reproduce, prepare derivative works, and perform publicly and display publicly.
+	//     Beginning five (5) years after permission to assert copyright is granted,
+	//     subject to two possible five year renewals, the U.S. Government is granted for
+	//     itself and others acting on its behalf a paid-up, non-exclusive, irrevocable
+	//     worldwide license in this data to reproduce, prepare derivative works,
+	//     distribute copies to the public, perform publicly and display publicly, and to
+	//     permit others to do so.
+
+	//     TRADEMARKS: EnergyPlus is a trademark of the US Department of Energy.
+
+} // WarmupSnapshot
+
+} // EnergyPlus
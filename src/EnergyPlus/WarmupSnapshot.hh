@@ -0,0 +1,121 @@
+#ifndef WarmupSnapshot_hh_INCLUDED
+#define WarmupSnapshot_hh_INCLUDED
+
+// C++ Headers
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+// EnergyPlus Headers
+#include <EnergyPlus.hh>
+
+namespace EnergyPlus {
+
+namespace WarmupSnapshot {
+
+	// Data
+	// MODULE PARAMETER DEFINITIONS
+	// na
+
+	// DERIVED TYPE DEFINITIONS
+
+	struct SnapshotRecord
+	{
+		// Members
+		std::uint64_t Signature; // Hash of the model features the saved state depends on
+		std::map< std::string, std::vector< Real64 > > Arrays; // Saved module arrays, by array name
+
+		// Default Constructor
+		SnapshotRecord() :
+			Signature( 0 )
+		{}
+
+	};
+
+	// MODULE VARIABLE DECLARATIONS:
+	extern bool WarmupStateRestored; // TRUE if the current environment started from a saved warmup state
+	extern bool SnapshotFileRead; // TRUE once the snapshot load file has been read
+	extern bool SnapshotNotSupportedWarning; // TRUE once the unsupported-model warning has been shown
+	extern std::map< std::string, SnapshotRecord > SnapshotRecords; // Saved warmup states, by environment key
+
+	// SUBROUTINE SPECIFICATIONS FOR MODULE WarmupSnapshot
+
+	// Functions
+
+	void
+	clear_state();
+
+	void
+	InitWarmupSnapshot();
+
+	void
+	RestoreSurfaceHistories();
+
+	void
+	RestoreZoneAirHistories();
+
+	void
+	SaveWarmupSnapshot();
+
+	std::string
+	SnapshotKey();
+
+	std::uint64_t
+	ModelSignature();
+
+	bool
+	SnapshotSupported();
+
+	void
+	TransferSurfaceHistories(
+		SnapshotRecord & Record,
+		bool const Restore
+	);
+
+	void
+	TransferZoneAirHistories(
+		SnapshotRecord & Record,
+		bool const Restore
+	);
+
+	void
+	TransferConvergenceHistories(
+		SnapshotRecord & Record,
+		bool const Restore
+	);
+
+	bool
+	WriteSnapshotFile( std::string const & FileName );
+
+	bool
+	ReadSnapshotFile( std::string const & FileName );
+
+	//     NOTICE
+
+	//     Copyright  1996-2014 The Board of Trustees of the University of Illinois
+	//     and The Regents of the University of California through Ernest Orlando Lawrence
+	//     Berkeley National Laboratory.  All rights reserved.
+
+	//     Portions of the EnergyPlus software package have been developed and copyrighted
+	//     by other individuals, companies and institutions.  These portions have been
+	//     incorporated into the EnergyPlus software package under license.   For a complete
+	//     list of contributors, see "Notice" located in main.cc.
+
+	//     NOTICE: The U.S. Government is granted for itself and others acting on its
+	//     behalf a paid-up, nonexclusive, irrevocable, worldwide license in this data to
+	//     reproduce, prepare derivative works, and perform publicly and display publicly.
+	//     Beginning five (5) years after permission to assert copyright is granted,
+	//     subject to two possible five year renewals, the U.S. Government is granted for
+	//     itself and others acting on its behalf a paid-up, non-exclusive, irrevocable
+	//     worldwide license in this data to reproduce, prepare derivative works,
+	//     distribute copies to the public, perform publicly and display publicly, and to
+	//     permit others to do so.
+
+	//     TRADEMARKS: EnergyPlus is a trademark of the US Department of Energy.
+
+} // WarmupSnapshot
+
+} // EnergyPlus
+
+#endif
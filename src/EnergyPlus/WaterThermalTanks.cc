@@ -24,6 +24,7 @@
 #include <DataPlant.hh>
 #include <DataPrecisionGlobals.hh>
 #include <DataSizing.hh>
+#include <DataSystemVariables.hh>
 #include <DataSurfaces.hh>
 #include <DataZoneEquipment.hh>
 #include <DXCoils.hh>
@@ -5741,6 +5742,10 @@ namespace WaterThermalTanks {
 		// node at a sub time step interval of one second.  Temperatures and energies change dynamically over the system
 		// time step.  Final node temperatures are reported as final instantaneous values as well as averages over the
 		// time step.  Heat transfer rates are averages over the time step.
+		// With StratifiedTankImplicitSolve the node heat balances are solved together by the backward Euler method
+		// (SolveStratifiedTankNodes) over sub time steps of up to MaxImplicitTimeStep.  A sub time step is halved while a
+		// heater would switch within it, so the thermostats are still resolved to one second.  Temperature inversions are
+		// removed after each solve by mixing the inverted nodes (MixStratifiedTankNodes) instead of the mixing rate.
 
 		// Using/Aliasing
 		using DataGlobals::TimeStep;
@@ -5750,18 +5755,23 @@ namespace WaterThermalTanks {
 		using DataHVACGlobals::TimeStepSys;
 		using FluidProperties::GetDensityGlycol;
 		using FluidProperties::GetSpecificHeatGlycol;
+		using DataSystemVariables::StratifiedTankImplicitSolve;
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
 
 		// SUBROUTINE PARAMETER DEFINITIONS:
-		Real64 const dt( 1.0 ); // Sub time step interval (s)
+		Real64 const ExplicitTimeStep( 1.0 ); // Sub time step interval of the explicit solution (s)
+		Real64 const MaxImplicitTimeStep( 60.0 ); // Longest sub time step interval of the implicit solution (s)
 		static std::string const RoutineName( "CalcWaterThermalTankStratified" );
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		Real64 TimeElapsed; // Fraction of the current hour that has elapsed (h)
 		Real64 SecInTimeStep; // Seconds in one timestep (s)
 		Real64 TimeRemaining; // Time remaining in the current timestep (s)
+		Real64 dt; // Sub time step interval (s)
+		Real64 ImplicitTimeStep; // Sub time step interval tried next by the implicit solution (s)
+		bool HeaterSwitches; // TRUE if a heater would switch within the implicit sub time step
 		int NumNodes; // Number of stratified nodes
 		int NodeNum; // Node number index
 		Real64 NodeMass; // Mass of water in a node (kg)
@@ -5799,6 +5809,7 @@ namespace WaterThermalTanks {
 		Real64 Qfuel; // Heating rate for fuel consumed (W)
 		Real64 UseInletTemp; // Use side inlet temperature (C)
 		Real64 UseMassFlowRate; // Use side flow rate, including effectiveness factor (kg/s)
+		Real64 UseOutletNodeTemp; // Temperature of the use outlet node over the sub time step (C)
 		Real64 SourceInletTemp; // Source side inlet temperature (C)
 		Real64 SourceMassFlowRate; // Source side flow rate, including effectiveness factor (kg/s)
 		int CycleOnCount1; // Number of times heater 1 cycles on in the current time step
@@ -5898,14 +5909,22 @@ namespace WaterThermalTanks {
 		Runtime1 = 0.0;
 		Runtime2 = 0.0;
 		SetPointRecovered = false;
+		UseOutletNodeTemp = 0.0;
 
 		if ( Tank.InletMode == InletModeFixed ) CalcNodeMassFlows( WaterThermalTankNum, InletModeFixed );
 
+		ImplicitTimeStep = MaxImplicitTimeStep;
 		TimeRemaining = SecInTimeStep;
 		while ( TimeRemaining > 0.0 ) {
 
 			if ( Tank.InletMode == InletModeSeeking ) CalcNodeMassFlows( WaterThermalTankNum, InletModeSeeking );
 
+			if ( StratifiedTankImplicitSolve ) {
+				dt = min( ImplicitTimeStep, TimeRemaining );
+			} else {
+				dt = ExplicitTimeStep;
+			}
+
 			if ( ! Tank.IsChilledWaterTank ) {
 
 				// Control the first heater element (master)
@@ -5928,7 +5947,6 @@ namespace WaterThermalTanks {
 
 				if ( Tank.HeaterOn1 ) {
 					Qheater1 = Tank.MaxCapacity;
-					Runtime1 += dt;
 				} else {
 					Qheater1 = 0.0;
 				}
@@ -5958,7 +5976,6 @@ namespace WaterThermalTanks {
 
 				if ( Tank.HeaterOn2 ) {
 					Qheater2 = Tank.MaxCapacity2;
-					Runtime2 += dt;
 				} else {
 					Qheater2 = 0.0;
 				}
@@ -5970,8 +5987,6 @@ namespace WaterThermalTanks {
 			}
 
 			if ( Tank.HeaterOn1 || Tank.HeaterOn2 ) {
-				Runtime += dt;
-
 				Qfuel = ( Qheater1 + Qheater2 ) / Tank.Efficiency;
 				Qoncycfuel = Tank.OnCycParaLoad;
 				Qoffcycfuel = 0.0;
@@ -5981,10 +5996,49 @@ namespace WaterThermalTanks {
 				Qoffcycfuel = Tank.OffCycParaLoad;
 			}
 
+			if ( StratifiedTankImplicitSolve ) {
+				// Solve the node heat balances at the end of the sub time step; shorten the sub time step while a heater
+				// would switch within it
+				while ( true ) {
+					SolveStratifiedTankNodes( WaterThermalTankNum, dt, Cp, HPWHCondenserDeltaT, Qheater1, Qheater2 );
+					if ( dt <= ExplicitTimeStep ) break;
+
+					HeaterSwitches = false;
+					if ( ! Tank.IsChilledWaterTank ) {
+						if ( Tank.MaxCapacity > 0.0 ) {
+							NodeTemp = Tank.Node( Tank.HeaterNode1 ).NewTemp;
+							if ( Tank.HeaterOn1 ) {
+								if ( NodeTemp >= SetPointTemp1 ) HeaterSwitches = true;
+							} else {
+								if ( NodeTemp < MinTemp1 ) HeaterSwitches = true;
+							}
+						}
+						if ( ( Tank.MaxCapacity2 > 0.0 ) && ! ( ( Tank.ControlType == PriorityMasterSlave ) && Tank.HeaterOn1 ) ) {
+							NodeTemp = Tank.Node( Tank.HeaterNode2 ).NewTemp;
+							if ( Tank.HeaterOn2 ) {
+								if ( NodeTemp >= SetPointTemp2 ) HeaterSwitches = true;
+							} else {
+								if ( NodeTemp < MinTemp2 ) HeaterSwitches = true;
+							}
+						}
+					}
+					if ( ! HeaterSwitches ) break;
+
+					dt = max( 0.5 * dt, ExplicitTimeStep );
+					ImplicitTimeStep = dt;
+				}
+				MixStratifiedTankNodes( WaterThermalTankNum );
+			}
+
 			// Loop through all nodes and simulate heat balance
 			for ( NodeNum = 1; NodeNum <= NumNodes; ++NodeNum ) {
 				NodeMass = Tank.Node( NodeNum ).Mass;
-				NodeTemp = Tank.Node( NodeNum ).Temp;
+				if ( StratifiedTankImplicitSolve ) {
+					NodeTemp = Tank.Node( NodeNum ).NewTemp;
+				} else {
+					NodeTemp = Tank.Node( NodeNum ).Temp;
+				}
+				if ( NodeNum == Tank.UseOutletStratNode ) UseOutletNodeTemp = NodeTemp;
 
 				UseMassFlowRate = Tank.Node( NodeNum ).UseMassFlowRate * Tank.UseEffectiveness;
 				SourceMassFlowRate = Tank.Node( NodeNum ).SourceMassFlowRate * Tank.SourceEffectiveness;
@@ -5993,27 +6047,6 @@ namespace WaterThermalTanks {
 				Quse = UseMassFlowRate * Cp * ( UseInletTemp - NodeTemp );
 				Qsource = CalcStratifiedTankSourceSideHeatTransferRate(HPWHCondenserDeltaT, SourceInletTemp, Cp, SourceMassFlowRate, NodeTemp);
 				
-				InvMixUp = 0.0;
-				if ( NodeNum > 1 ) {
-					TempUp = Tank.Node( NodeNum - 1 ).Temp;
-					if ( TempUp < NodeTemp ) InvMixUp = Tank.InversionMixingRate;
-				}
-
-				InvMixDn = 0.0;
-				if ( NodeNum < NumNodes ) {
-					TempDn = Tank.Node( NodeNum + 1 ).Temp;
-					if ( TempDn > NodeTemp ) InvMixDn = Tank.InversionMixingRate;
-				}
-
-				// Heat transfer due to vertical conduction between nodes
-				Qcond = Tank.Node( NodeNum ).CondCoeffUp * ( TempUp - NodeTemp ) + Tank.Node( NodeNum ).CondCoeffDn * ( TempDn - NodeTemp );
-
-				// Heat transfer due to fluid flow between inlet and outlet nodes
-				Qflow = Tank.Node( NodeNum ).MassFlowFromUpper * Cp * ( TempUp - NodeTemp ) + Tank.Node( NodeNum ).MassFlowFromLower * Cp * ( TempDn - NodeTemp );
-
-				// Heat transfer due to temperature inversion mixing between nodes
-				Qmix = InvMixUp * Cp * ( TempUp - NodeTemp ) + InvMixDn * Cp * ( TempDn - NodeTemp );
-
 				if ( Tank.HeaterOn1 || Tank.HeaterOn2 ) {
 					LossCoeff = Tank.Node( NodeNum ).OnCycLossCoeff;
 					Qloss = LossCoeff * ( AmbientTemp - NodeTemp );
@@ -6037,8 +6070,31 @@ namespace WaterThermalTanks {
 
 				Qunmet = max( Qneeded - Qheater1 - Qheater2, 0.0 );
 
-				// Calculate node heat balance
-				Tank.Node( NodeNum ).NewTemp = NodeTemp + ( Quse + Qsource + Qcond + Qflow + Qmix + Qloss + Qheat ) * dt / ( NodeMass * Cp );
+				if ( ! StratifiedTankImplicitSolve ) {
+					InvMixUp = 0.0;
+					if ( NodeNum > 1 ) {
+						TempUp = Tank.Node( NodeNum - 1 ).Temp;
+						if ( TempUp < NodeTemp ) InvMixUp = Tank.InversionMixingRate;
+					}
+
+					InvMixDn = 0.0;
+					if ( NodeNum < NumNodes ) {
+						TempDn = Tank.Node( NodeNum + 1 ).Temp;
+						if ( TempDn > NodeTemp ) InvMixDn = Tank.InversionMixingRate;
+					}
+
+					// Heat transfer due to vertical conduction between nodes
+					Qcond = Tank.Node( NodeNum ).CondCoeffUp * ( TempUp - NodeTemp ) + Tank.Node( NodeNum ).CondCoeffDn * ( TempDn - NodeTemp );
+
+					// Heat transfer due to fluid flow between inlet and outlet nodes
+					Qflow = Tank.Node( NodeNum ).MassFlowFromUpper * Cp * ( TempUp - NodeTemp ) + Tank.Node( NodeNum ).MassFlowFromLower * Cp * ( TempDn - NodeTemp );
+
+					// Heat transfer due to temperature inversion mixing between nodes
+					Qmix = InvMixUp * Cp * ( TempUp - NodeTemp ) + InvMixDn * Cp * ( TempDn - NodeTemp );
+
+					// Calculate node heat balance
+					Tank.Node( NodeNum ).NewTemp = NodeTemp + ( Quse + Qsource + Qcond + Qflow + Qmix + Qloss + Qheat ) * dt / ( NodeMass * Cp );
+				}
 
 				if ( ! Tank.IsChilledWaterTank ) {
 					if ( ( NodeNum == 1 ) && ( Tank.Node( 1 ).NewTemp > MaxTemp ) ) {
@@ -6055,7 +6111,13 @@ namespace WaterThermalTanks {
 
 			} // NodeNum
 
-			Euse += UseMassFlowRate * Cp * (UseInletTemp - Tank.Node( Tank.UseOutletStratNode ).Temp) * dt;
+			Euse += UseMassFlowRate * Cp * (UseInletTemp - UseOutletNodeTemp) * dt;
+
+			if ( ! Tank.IsChilledWaterTank ) {
+				if ( Tank.HeaterOn1 ) Runtime1 += dt;
+				if ( Tank.HeaterOn2 ) Runtime2 += dt;
+			}
+			if ( Tank.HeaterOn1 || Tank.HeaterOn2 ) Runtime += dt;
 
 			// Calculation for standard ratings
 			if ( ! Tank.FirstRecoveryDone ) {
@@ -6068,6 +6130,7 @@ namespace WaterThermalTanks {
 			Tank.Node.TempSum() += Tank.Node.Temp() * dt;
 
 			TimeRemaining -= dt;
+			if ( StratifiedTankImplicitSolve ) ImplicitTimeStep = min( 2.0 * ImplicitTimeStep, MaxImplicitTimeStep );
 
 		} // TimeRemaining > 0.0
 
@@ -6181,6 +6244,171 @@ namespace WaterThermalTanks {
 		return Qsource;
 	}
 
+	void
+	SolveStratifiedTankNodes(
+		int const WaterThermalTankNum, // Water Heater being simulated
+		Real64 const dt, // Sub time step interval (s)
+		Real64 const Cp, // Specific heat of water (J/kg K)
+		Real64 const HPWHCondenserDeltaT, // Temperature difference across the heat pump condenser, zero without a heat pump (C)
+		Real64 const Qheater1, // Heating rate of heater 1 (W)
+		Real64 const Qheater2 // Heating rate of heater 2 (W)
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Calculates the node temperatures of a stratified tank at the end of a sub time step from the temperatures
+		// at its start.
+
+		// METHODOLOGY EMPLOYED:
+		// Backward Euler.  The use and source flows, losses, vertical conduction and the flows between nodes of each
+		// node heat balance in CalcWaterThermalTankStratified are taken at the end of the sub time step.  The nodes are
+		// coupled only to the nodes above and below, so the heat balances form a tridiagonal system that is solved by the
+		// Thomas algorithm.  The system is diagonally dominant, so the solution is stable for any sub time step.
+		// The heaters and parasitics are constant over the sub time step.  Inversion mixing is left to
+		// MixStratifiedTankNodes.  The temperatures are returned in Node%NewTemp.
+
+		// Locals
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		static FArray1D< Real64 > CoefA; // Coefficients of the upper node temperatures (W/K)
+		static FArray1D< Real64 > CoefB; // Coefficients of the node temperatures (W/K)
+		static FArray1D< Real64 > CoefC; // Coefficients of the lower node temperatures (W/K)
+		static FArray1D< Real64 > CoefD; // Right hand sides (W)
+		int NodeNum; // Node number index
+		Real64 Capacitance; // Node heat capacity over the sub time step (W/K)
+		Real64 UseMassFlowRate; // Use side flow rate, including effectiveness factor (kg/s)
+		Real64 SourceMassFlowRate; // Source side flow rate, including effectiveness factor (kg/s)
+		Real64 LossCoeff; // Loss coefficient to ambient environment (W/K)
+		Real64 Qheat; // Net heating rate for non-temp dependent sources, i.e. heater and parasitics (W)
+		Real64 Denom; // Pivot of the forward elimination (W/K)
+
+		// References
+		WaterThermalTankData &Tank = WaterThermalTank( WaterThermalTankNum ); // Tank object
+
+		// FLOW:
+		int const NumNodes = Tank.Nodes;
+		if ( CoefA.isize() < NumNodes ) {
+			CoefA.allocate( NumNodes );
+			CoefB.allocate( NumNodes );
+			CoefC.allocate( NumNodes );
+			CoefD.allocate( NumNodes );
+		}
+
+		for ( NodeNum = 1; NodeNum <= NumNodes; ++NodeNum ) {
+			StratifiedNodeData const & Node( Tank.Node( NodeNum ) );
+			Capacitance = Node.Mass * Cp / dt;
+			UseMassFlowRate = Node.UseMassFlowRate * Tank.UseEffectiveness;
+			SourceMassFlowRate = Node.SourceMassFlowRate * Tank.SourceEffectiveness;
+
+			if ( Tank.HeaterOn1 || Tank.HeaterOn2 ) {
+				LossCoeff = Node.OnCycLossCoeff;
+				Qheat = Node.OnCycParaLoad * Tank.OnCycParaFracToTank;
+				if ( NodeNum == Tank.HeaterNode1 ) Qheat += Qheater1;
+				if ( NodeNum == Tank.HeaterNode2 ) Qheat += Qheater2;
+			} else {
+				LossCoeff = Node.OffCycLossCoeff;
+				Qheat = Node.OffCycParaLoad * Tank.OffCycParaFracToTank;
+			}
+
+			CoefB( NodeNum ) = Capacitance + UseMassFlowRate * Cp + LossCoeff;
+			CoefD( NodeNum ) = Capacitance * Node.Temp + UseMassFlowRate * Cp * Tank.UseInletTemp + LossCoeff * Tank.AmbientTemp + Qheat;
+
+			// Same cases as CalcStratifiedTankSourceSideHeatTransferRate
+			if ( HPWHCondenserDeltaT > 0.0 ) {
+				CoefD( NodeNum ) += SourceMassFlowRate * Cp * HPWHCondenserDeltaT;
+			} else {
+				CoefB( NodeNum ) += SourceMassFlowRate * Cp;
+				CoefD( NodeNum ) += SourceMassFlowRate * Cp * Tank.SourceInletTemp;
+			}
+
+			CoefA( NodeNum ) = 0.0;
+			if ( NodeNum > 1 ) {
+				CoefA( NodeNum ) = -( Node.CondCoeffUp + Node.MassFlowFromUpper * Cp );
+				CoefB( NodeNum ) -= CoefA( NodeNum );
+			}
+
+			CoefC( NodeNum ) = 0.0;
+			if ( NodeNum < NumNodes ) {
+				CoefC( NodeNum ) = -( Node.CondCoeffDn + Node.MassFlowFromLower * Cp );
+				CoefB( NodeNum ) -= CoefC( NodeNum );
+			}
+		}
+
+		// Forward elimination and back substitution
+		CoefC( 1 ) /= CoefB( 1 );
+		CoefD( 1 ) /= CoefB( 1 );
+		for ( NodeNum = 2; NodeNum <= NumNodes; ++NodeNum ) {
+			Denom = CoefB( NodeNum ) - CoefA( NodeNum ) * CoefC( NodeNum - 1 );
+			CoefC( NodeNum ) /= Denom;
+			CoefD( NodeNum ) = ( CoefD( NodeNum ) - CoefA( NodeNum ) * CoefD( NodeNum - 1 ) ) / Denom;
+		}
+		Tank.Node( NumNodes ).NewTemp = CoefD( NumNodes );
+		for ( NodeNum = NumNodes - 1; NodeNum >= 1; --NodeNum ) {
+			Tank.Node( NodeNum ).NewTemp = CoefD( NodeNum ) - CoefC( NodeNum ) * Tank.Node( NodeNum + 1 ).NewTemp;
+		}
+
+	}
+
+	void
+	MixStratifiedTankNodes( int const WaterThermalTankNum ) // Water Heater being simulated
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Removes temperature inversions from the new node temperatures of a stratified tank.
+
+		// METHODOLOGY EMPLOYED:
+		// Each node warmer than the node above it is fully mixed with it, which conserves the energy of the nodes.  Going
+		// down the tank, the nodes are collected into mixed groups; a new group that is warmer than the group above is
+		// merged with it until the group temperatures decrease downwards.  This is the limit of the inversion mixing
+		// rate of the explicit solution.
+
+		// Locals
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		static FArray1D_int GroupFirstNode; // First node of each mixed group
+		static FArray1D< Real64 > GroupMass; // Mass of each mixed group (kg)
+		static FArray1D< Real64 > GroupTemp; // Mixed temperature of each mixed group (C)
+		int NumGroups; // Number of mixed groups
+		int NodeNum; // Node number index
+		int GroupNum; // Mixed group index
+		int LastNode; // Last node of a mixed group
+
+		// References
+		WaterThermalTankData &Tank = WaterThermalTank( WaterThermalTankNum ); // Tank object
+
+		// FLOW:
+		int const NumNodes = Tank.Nodes;
+		if ( GroupMass.isize() < NumNodes ) {
+			GroupFirstNode.allocate( NumNodes );
+			GroupMass.allocate( NumNodes );
+			GroupTemp.allocate( NumNodes );
+		}
+
+		NumGroups = 0;
+		for ( NodeNum = 1; NodeNum <= NumNodes; ++NodeNum ) {
+			++NumGroups;
+			GroupFirstNode( NumGroups ) = NodeNum;
+			GroupMass( NumGroups ) = Tank.Node( NodeNum ).Mass;
+			GroupTemp( NumGroups ) = Tank.Node( NodeNum ).NewTemp;
+			while ( ( NumGroups > 1 ) && ( GroupTemp( NumGroups ) > GroupTemp( NumGroups - 1 ) ) ) {
+				GroupTemp( NumGroups - 1 ) = ( GroupMass( NumGroups - 1 ) * GroupTemp( NumGroups - 1 ) + GroupMass( NumGroups ) * GroupTemp( NumGroups ) ) / ( GroupMass( NumGroups - 1 ) + GroupMass( NumGroups ) );
+				GroupMass( NumGroups - 1 ) += GroupMass( NumGroups );
+				--NumGroups;
+			}
+		}
+		if ( NumGroups == NumNodes ) return;
+
+		for ( GroupNum = 1; GroupNum <= NumGroups; ++GroupNum ) {
+			if ( GroupNum < NumGroups ) {
+				LastNode = GroupFirstNode( GroupNum + 1 ) - 1;
+			} else {
+				LastNode = NumNodes;
+			}
+			for ( NodeNum = GroupFirstNode( GroupNum ); NodeNum <= LastNode; ++NodeNum ) {
+				Tank.Node( NodeNum ).NewTemp = GroupTemp( GroupNum );
+			}
+		}
+
+	}
+
 	void
 	CalcNodeMassFlows(
 		int const WaterThermalTankNum, // Water Heater being simulated
@@ -1767,7 +1767,20 @@ namespace WaterThermalTanks {
 		Real64 SourceMassFlowRate, // source mass flow rate (kg/s)
 		Real64 NodeTemp // temperature of the source inlet node (C)
 	);
-	
+
+	void
+	SolveStratifiedTankNodes(
+		int const WaterThermalTankNum, // Water Heater being simulated
+		Real64 const dt, // Sub time step interval (s)
+		Real64 const Cp, // Specific heat of water (J/kg K)
+		Real64 const HPWHCondenserDeltaT, // Temperature difference across the heat pump condenser, zero without a heat pump (C)
+		Real64 const Qheater1, // Heating rate of heater 1 (W)
+		Real64 const Qheater2 // Heating rate of heater 2 (W)
+	);
+
+	void
+	MixStratifiedTankNodes( int const WaterThermalTankNum ); // Water Heater being simulated
+
 	void
 	CalcNodeMassFlows(
 		int const WaterThermalTankNum, // Water Heater being simulated
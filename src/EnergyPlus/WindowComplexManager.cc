@@ -98,11 +98,14 @@ namespace WindowComplexManager {
 	int const Back_Transmitted( 5 );
 	int const Back_Reflected( 6 );
 
+	Real64 const BSDFSparseDensityLimit( 0.5 ); // Largest fraction of nonzero elements for which a BSDF matrix is compressed
+
 	// DERIVED TYPE DEFINITIONS:
 
 	// MODULE VARIABLE DECLARATIONS:
 
 	int NumComplexWind( 0 ); // Total number of complex windows
+	bool InitComplexWindowsOnce( true ); // TRUE until the complex window geometry and static properties are set up
 	//Debug
 	FArray2D_int DbgIBm( 24, 60 );
 	FArray2D< Real64 > DbgTheta( 24, 60 );
@@ -120,6 +123,21 @@ namespace WindowComplexManager {
 
 	// Functions
 
+	void
+	clear_state()
+	{
+		NumComplexWind = 0;
+		InitComplexWindowsOnce = true;
+		DbgIBm = 0;
+		DbgTheta = 0.0;
+		DbgPhi = 0.0;
+		DdbgTheta = 0.0;
+		DdbgPhi = 0.0;
+		BasisList.deallocate();
+		WindowList.deallocate();
+		WindowStateList.deallocate();
+	}
+
 	void
 	InitBSDFWindows()
 	{
@@ -655,11 +673,11 @@ namespace WindowComplexManager {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static bool Once( true ); // Flag for insuring things happen once
+		// na
 
 		//One-time initialization
-		if ( Once ) {
-			Once = false;
+		if ( InitComplexWindowsOnce ) {
+			InitComplexWindowsOnce = false;
 			InitBSDFWindows();
 			CalcStaticProperties();
 		}
@@ -1000,11 +1018,7 @@ namespace WindowComplexManager {
 				State.WinToSurfBmTrans( I, Hour, TS ) = Sum1;
 			} //Back surface loop
 			//Calculate the directional-hemispherical transmittance
-			Sum1 = 0.0;
-			for ( J = 1; J <= Geom.Trn.NBasis; ++J ) {
-				Sum1 += Geom.Trn.Lamda( J ) * Construct( IConst ).BSDFInput.SolFrtTrans( J, IBm );
-			}
-			State.WinDirHemiTrans( Hour, TS ) = Sum1;
+			State.WinDirHemiTrans( Hour, TS ) = State.DirHemiTrans( IBm );
 			//Calculate the directional specular transmittance
 			//Note:  again using assumption that Inc and Trn basis have same structure
 			State.WinDirSpecTrans( Hour, TS ) = Geom.Trn.Lamda( IBm ) * Construct( IConst ).BSDFInput.SolFrtTrans( IBm, IBm );
@@ -1022,9 +1036,7 @@ namespace WindowComplexManager {
 			JRay = Geom.GndIndex( J );
 			if ( Geom.SolBmGndWt( J, Hour, TS ) > 0.0 ) {
 				Sum2 += Geom.SolBmGndWt( J, Hour, TS ) * Geom.Inc.Lamda( JRay );
-				for ( M = 1; M <= Geom.Trn.NBasis; ++M ) { //Outgoing ray loop
-					Sum1 += Geom.SolBmGndWt( J, Hour, TS ) * Geom.Inc.Lamda( JRay ) * Geom.Trn.Lamda( M ) * Construct( IConst ).BSDFInput.SolFrtTrans( M, JRay );
-				} //Outgoing ray loop
+				Sum1 += Geom.SolBmGndWt( J, Hour, TS ) * Geom.Inc.Lamda( JRay ) * State.DirHemiTrans( JRay );
 			}
 		} //Indcident ray loop
 		if ( Sum2 > 0.0 ) {
@@ -1076,11 +1088,7 @@ namespace WindowComplexManager {
 				//Here calculate the back incidence properties for the solar ray
 				//this does not say whether or not the ray can pass through the
 				//back surface window and hit this one!
-				Sum1 = 0.0;
-				for ( J = 1; J <= Geom.Trn.NBasis; ++J ) {
-					Sum1 += Geom.Trn.Lamda( J ) * Construct( IConst ).BSDFInput.SolBkRefl( J, BkIncRay );
-				}
-				Refl = Sum1;
+				Refl = State.DirHemiBkRefl( BkIncRay );
 				for ( L = 1; L <= State.NLayers; ++L ) {
 					Absorb( L ) = Construct( IConst ).BSDFInput.Layer( L ).BkAbs( 1, BkIncRay );
 				}
@@ -2053,18 +2061,58 @@ namespace WindowComplexManager {
 		Real64 Sum2; // general purpose temporary sum
 		Real64 Sum3; // general purpose temporary sum
 		Real64 Hold; // temp variable
+		FArray1D< Real64 > Ones; // unit weight for each ray
+		FArray1D< Real64 > TransRowSums; // front transmittance summed over outgoing rays, weighted by Lamda
+		FArray1D< Real64 > VisTransRowSums; // front visible transmittance summed over outgoing rays, weighted by Lamda
+		FArray1D< Real64 > TransColSums; // front transmittance summed over the first index
+		FArray1D< Real64 > ReflIncSums; // back reflectance summed over the first index, weighted by the Inc basis Lamda
+		FArray1D< Real64 > ReflColSums; // back reflectance summed over the first index
+		FArray1D< Real64 > VisReflSums; // back visible reflectance summed over the first index, weighted by Lamda
 
 		IConst = SurfaceWindow( ISurf ).ComplexFen.State( IState ).Konst;
 
+		// The sums over outgoing rays of the property matrices are formed once here, with the matrix
+		// kernels, and are shared by the hemispherical, sky and ground quantities below
+		auto const & BSDFInput( Construct( IConst ).BSDFInput );
+		Ones.dimension( BSDFInput.NBasis, 1.0 );
+		TransRowSums.allocate( BSDFInput.NBasis );
+		VisTransRowSums.allocate( BSDFInput.NBasis );
+		TransColSums.allocate( BSDFInput.NBasis );
+		ReflIncSums.allocate( BSDFInput.NBasis );
+		ReflColSums.allocate( BSDFInput.NBasis );
+		VisReflSums.allocate( BSDFInput.NBasis );
+		if ( ! allocated( State.DirHemiTrans ) ) State.DirHemiTrans.allocate( BSDFInput.NBasis );
+		if ( ! allocated( State.DirHemiBkRefl ) ) State.DirHemiBkRefl.allocate( BSDFInput.NBasis );
+		BSDFRowSums( BSDFInput.SolFrtTrans, Geom.Trn.Lamda, TransRowSums );
+		if ( BSDFInput.VisFrtTransSparse.Compressed ) {
+			BSDFRowSums( BSDFInput.VisFrtTransSparse, Geom.Trn.Lamda, VisTransRowSums );
+		} else {
+			BSDFRowSums( BSDFInput.VisFrtTrans, Geom.Trn.Lamda, VisTransRowSums );
+		}
+		BSDFColumnSums( BSDFInput.SolFrtTrans, Geom.Trn.Lamda, State.DirHemiTrans );
+		BSDFColumnSums( BSDFInput.SolFrtTrans, Ones, TransColSums );
+		if ( BSDFInput.SolBkReflSparse.Compressed ) {
+			BSDFColumnSums( BSDFInput.SolBkReflSparse, Geom.Trn.Lamda, State.DirHemiBkRefl );
+			BSDFColumnSums( BSDFInput.SolBkReflSparse, Geom.Inc.Lamda, ReflIncSums );
+			BSDFColumnSums( BSDFInput.SolBkReflSparse, Ones, ReflColSums );
+		} else {
+			BSDFColumnSums( BSDFInput.SolBkRefl, Geom.Trn.Lamda, State.DirHemiBkRefl );
+			BSDFColumnSums( BSDFInput.SolBkRefl, Geom.Inc.Lamda, ReflIncSums );
+			BSDFColumnSums( BSDFInput.SolBkRefl, Ones, ReflColSums );
+		}
+		if ( BSDFInput.VisBkReflSparse.Compressed ) {
+			BSDFColumnSums( BSDFInput.VisBkReflSparse, Geom.Trn.Lamda, VisReflSums );
+		} else {
+			BSDFColumnSums( BSDFInput.VisBkRefl, Geom.Trn.Lamda, VisReflSums );
+		}
+
 		//Calculate the hemispherical-hemispherical transmittance
 
 		Sum1 = 0.0;
 		Sum2 = 0.0;
 		for ( J = 1; J <= Geom.Inc.NBasis; ++J ) { //Incident ray loop
 			Sum2 += Geom.Inc.Lamda( J );
-			for ( M = 1; M <= Geom.Trn.NBasis; ++M ) { //Outgoing ray loop
-				Sum1 += Geom.Inc.Lamda( J ) * Geom.Trn.Lamda( M ) * Construct( IConst ).BSDFInput.SolFrtTrans( J, M );
-			} //Outgoing ray loop
+			Sum1 += Geom.Inc.Lamda( J ) * TransRowSums( J );
 		} //Incident ray loop
 		if ( Sum2 > 0 ) {
 			State.WinDiffTrans = Sum1 / Sum2;
@@ -2079,9 +2127,7 @@ namespace WindowComplexManager {
 		Sum2 = 0.0;
 		for ( J = 1; J <= Geom.Inc.NBasis; ++J ) { //Incident ray loop
 			Sum2 += Geom.Inc.Lamda( J );
-			for ( M = 1; M <= Geom.Trn.NBasis; ++M ) { //Outgoing ray loop
-				Sum1 += Geom.Inc.Lamda( J ) * Geom.Trn.Lamda( M ) * Construct( IConst ).BSDFInput.VisFrtTrans( J, M );
-			} //Outgoing ray loop
+			Sum1 += Geom.Inc.Lamda( J ) * VisTransRowSums( J );
 		} //Incident ray loop
 		if ( Sum2 > 0.0 ) {
 			State.WinDiffVisTrans = Sum1 / Sum2;
@@ -2098,10 +2144,8 @@ namespace WindowComplexManager {
 		Sum2 = 0.0;
 		Sum3 = 0.0;
 		for ( JJ = 1; JJ <= Geom.NSky; ++JJ ) {
-			for ( M = 1; M <= Geom.Trn.NBasis; ++M ) {
-				J = Geom.SkyIndex( JJ );
-				Sum1 += Geom.SolSkyWt( JJ ) * Construct( IConst ).BSDFInput.SolFrtTrans( J, M ) * Geom.Inc.Lamda( J ) * Geom.Trn.Lamda( M );
-			}
+			J = Geom.SkyIndex( JJ );
+			Sum1 += Geom.SolSkyWt( JJ ) * TransRowSums( J ) * Geom.Inc.Lamda( J );
 		}
 		for ( JJ = 1; JJ <= Geom.NSky; ++JJ ) {
 			J = Geom.SkyIndex( JJ );
@@ -2141,10 +2185,8 @@ namespace WindowComplexManager {
 		Sum3 = 0.0;
 
 		for ( JJ = 1; JJ <= Geom.NGnd; ++JJ ) {
-			for ( M = 1; M <= Geom.Trn.NBasis; ++M ) {
-				J = Geom.GndIndex( JJ );
-				Sum1 += Geom.SolSkyGndWt( JJ ) * Construct( IConst ).BSDFInput.SolFrtTrans( J, M ) * Geom.Inc.Lamda( J ) * Geom.Trn.Lamda( M );
-			}
+			J = Geom.GndIndex( JJ );
+			Sum1 += Geom.SolSkyGndWt( JJ ) * TransRowSums( J ) * Geom.Inc.Lamda( J );
 		}
 
 		for ( JJ = 1; JJ <= Geom.NGnd; ++JJ ) {
@@ -2179,10 +2221,8 @@ namespace WindowComplexManager {
 		Sum3 = 0.0;
 		//Note this again assumes the equivalence Inc basis = transmission basis for back incidence and
 		// Trn basis = incident basis for back incidence
-		for ( J = 1; J <= Geom.Trn.NBasis; ++J ) {
-			for ( M = 1; M <= Geom.Inc.NBasis; ++M ) {
-				Sum1 += Construct( IConst ).BSDFInput.SolBkRefl( J, M ) * Geom.Trn.Lamda( J ) * Geom.Inc.Lamda( M );
-			}
+		for ( M = 1; M <= Geom.Inc.NBasis; ++M ) {
+			Sum1 += State.DirHemiBkRefl( M ) * Geom.Inc.Lamda( M );
 		}
 		for ( J = 1; J <= Geom.Trn.NBasis; ++J ) {
 			Sum2 += Geom.Trn.Lamda( J );
@@ -2240,10 +2280,8 @@ namespace WindowComplexManager {
 		Sum2 = 0.0;
 		//Note this again assumes the equivalence Inc basis = transmission basis for back incidence and
 		// Trn basis = incident basis for back incidence
-		for ( J = 1; J <= Geom.Trn.NBasis; ++J ) {
-			for ( M = 1; M <= Geom.Inc.NBasis; ++M ) {
-				Sum1 += Construct( IConst ).BSDFInput.VisBkRefl( J, M ) * Geom.Trn.Lamda( J ) * Geom.Inc.Lamda( M );
-			}
+		for ( M = 1; M <= Geom.Inc.NBasis; ++M ) {
+			Sum1 += VisReflSums( M ) * Geom.Inc.Lamda( M );
 		}
 		for ( J = 1; J <= Geom.Trn.NBasis; ++J ) {
 			Sum2 += Geom.Trn.Lamda( J );
@@ -2290,9 +2328,7 @@ namespace WindowComplexManager {
 			Sum2 = 0.0;
 			for ( J = 1; J <= Geom.NSurfInt( KBkSurf ); ++J ) { //Inc Ray loop
 				Sum2 += Geom.Trn.Lamda( Geom.SurfInt( KBkSurf, J ) );
-				for ( M = 1; M <= Geom.Inc.NBasis; ++M ) { //Outgoing Ray loop
-					Sum1 += Geom.Trn.Lamda( Geom.SurfInt( KBkSurf, J ) ) * Geom.Inc.Lamda( M ) * Construct( IConst ).BSDFInput.SolBkRefl( M, Geom.SurfInt( KBkSurf, J ) );
-				} //Outgoing Ray loop
+				Sum1 += Geom.Trn.Lamda( Geom.SurfInt( KBkSurf, J ) ) * ReflIncSums( Geom.SurfInt( KBkSurf, J ) );
 			} //Inc Ray loop
 			if ( Sum2 > 0.0 ) {
 				Hold = Sum1 / Sum2;
@@ -2352,11 +2388,7 @@ namespace WindowComplexManager {
 		// Integrating front transmittance
 		if ( ! allocated( State.IntegratedFtTrans ) ) State.IntegratedFtTrans.allocate( Geom.Inc.NBasis );
 		for ( J = 1; J <= Geom.Inc.NBasis; ++J ) { // Incident ray loop
-			Sum1 = 0.0;
-			for ( M = 1; M <= Geom.Trn.NBasis; ++M ) { // Outgoing ray loop
-				Sum1 += Geom.Trn.Lamda( J ) * Construct( IConst ).BSDFInput.SolFrtTrans( M, J );
-			} // Outgoing ray loop
-			State.IntegratedFtTrans( J ) = Sum1;
+			State.IntegratedFtTrans( J ) = Geom.Trn.Lamda( J ) * TransColSums( J );
 		} // Incident ray loop
 
 		if ( ! allocated( State.IntegratedFtRefl ) ) State.IntegratedFtRefl.allocate( Geom.Inc.NBasis );
@@ -2382,11 +2414,7 @@ namespace WindowComplexManager {
 		// Integrating back reflectance
 		if ( ! allocated( State.IntegratedBkRefl ) ) State.IntegratedBkRefl.allocate( Geom.Trn.NBasis );
 		for ( J = 1; J <= Geom.Trn.NBasis; ++J ) { // Outgoing ray loop
-			Sum1 = 0.0;
-			for ( M = 1; M <= Geom.Inc.NBasis; ++M ) { // Incident ray loop
-				Sum1 += Geom.Inc.Lamda( J ) * Construct( IConst ).BSDFInput.SolBkRefl( M, J );
-			} //Incident ray loop
-			State.IntegratedBkRefl( J ) = Sum1;
+			State.IntegratedBkRefl( J ) = Geom.Inc.Lamda( J ) * ReflColSums( J );
 		} //Outgoing ray loop
 
 		if ( ! allocated( State.IntegratedBkTrans ) ) State.IntegratedBkTrans.allocate( Geom.Trn.NBasis );
@@ -2397,6 +2425,268 @@ namespace WindowComplexManager {
 
 	}
 
+	void
+	CompressBSDFMatrix(
+		FArray2D< Real64 > & Mat, // Dense matrix, deallocated if it is compressed
+		BSDFSparseMatrix & Sparse // Compressed matrix
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Stores a BSDF matrix in compressed column form, and releases the dense matrix, if the fraction
+		// of its elements that are nonzero does not exceed BSDFSparseDensityLimit.
+
+		// METHODOLOGY EMPLOYED:
+		// Measured BSDFs of fabrics and blinds, and the diagonal matrices of axisymmetric bases, are mostly
+		// zero. The back reflectances are only used in weighted sums, and the front visible transmittance in
+		// weighted sums and daylighting lookups, so these are compressed. The front solar transmittance, whose
+		// elements are looked up throughout the solar distribution, stays dense.
+
+		// REFERENCES:
+		// na
+
+		// Locals
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int I; // Row index
+		int J; // Column index
+		int NNonZero; // Number of nonzero elements
+		int K; // Position of the element in the compressed matrix
+
+		Sparse.Compressed = false;
+		if ( ! allocated( Mat ) ) return;
+
+		NNonZero = 0;
+		for ( J = 1; J <= Mat.u2(); ++J ) {
+			for ( I = 1; I <= Mat.u1(); ++I ) {
+				if ( Mat( I, J ) != 0.0 ) ++NNonZero;
+			}
+		}
+		if ( NNonZero > BSDFSparseDensityLimit * Mat.size() ) return;
+
+		Sparse.Compressed = true;
+		Sparse.NRows = Mat.u1();
+		Sparse.NCols = Mat.u2();
+		Sparse.ColStart.allocate( Sparse.NCols + 1 );
+		Sparse.RowIndex.allocate( NNonZero );
+		Sparse.Value.allocate( NNonZero );
+		K = 0;
+		for ( J = 1; J <= Sparse.NCols; ++J ) {
+			Sparse.ColStart( J ) = K + 1;
+			for ( I = 1; I <= Sparse.NRows; ++I ) {
+				if ( Mat( I, J ) == 0.0 ) continue;
+				++K;
+				Sparse.RowIndex( K ) = I;
+				Sparse.Value( K ) = Mat( I, J );
+			}
+		}
+		Sparse.ColStart( Sparse.NCols + 1 ) = K + 1;
+		Mat.deallocate();
+
+	}
+
+	void
+	BSDFColumnSums(
+		FArray2D< Real64 > const & Mat, // Dense matrix
+		FArray1< Real64 > const & Weights, // Weight of each row
+		FArray1< Real64 > & Sums // Weighted sum of each column
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Sums(J) = sum over I of Weights(I) * Mat(I,J)
+
+		// METHODOLOGY EMPLOYED:
+		// The matrix is stored by columns, so each sum runs over contiguous elements.
+
+		// REFERENCES:
+		// na
+
+		// Locals
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int I; // Row index
+		int J; // Column index
+		Real64 Sum; // Sum of the current column
+
+		for ( J = 1; J <= Mat.u2(); ++J ) {
+			Sum = 0.0;
+			for ( I = 1; I <= Mat.u1(); ++I ) {
+				Sum += Weights( I ) * Mat( I, J );
+			}
+			Sums( J ) = Sum;
+		}
+
+	}
+
+	void
+	BSDFColumnSums(
+		BSDFSparseMatrix const & Mat, // Compressed matrix
+		FArray1< Real64 > const & Weights, // Weight of each row
+		FArray1< Real64 > & Sums // Weighted sum of each column
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Sums(J) = sum over I of Weights(I) * Mat(I,J), visiting only the nonzero elements
+
+		// METHODOLOGY EMPLOYED:
+		// na
+
+		// REFERENCES:
+		// na
+
+		// Locals
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int J; // Column index
+		int K; // Position of the element in the compressed matrix
+		Real64 Sum; // Sum of the current column
+
+		for ( J = 1; J <= Mat.NCols; ++J ) {
+			Sum = 0.0;
+			for ( K = Mat.ColStart( J ); K < Mat.ColStart( J + 1 ); ++K ) {
+				Sum += Weights( Mat.RowIndex( K ) ) * Mat.Value( K );
+			}
+			Sums( J ) = Sum;
+		}
+
+	}
+
+	void
+	BSDFRowSums(
+		FArray2D< Real64 > const & Mat, // Dense matrix
+		FArray1< Real64 > const & Weights, // Weight of each column
+		FArray1< Real64 > & Sums // Weighted sum of each row
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Sums(I) = sum over J of Weights(J) * Mat(I,J)
+
+		// METHODOLOGY EMPLOYED:
+		// The sums are accumulated a column at a time so the matrix is read in storage order.
+
+		// REFERENCES:
+		// na
+
+		// Locals
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int I; // Row index
+		int J; // Column index
+
+		for ( I = 1; I <= Mat.u1(); ++I ) {
+			Sums( I ) = 0.0;
+		}
+		for ( J = 1; J <= Mat.u2(); ++J ) {
+			if ( Weights( J ) == 0.0 ) continue;
+			for ( I = 1; I <= Mat.u1(); ++I ) {
+				Sums( I ) += Weights( J ) * Mat( I, J );
+			}
+		}
+
+	}
+
+	void
+	BSDFRowSums(
+		BSDFSparseMatrix const & Mat, // Compressed matrix
+		FArray1< Real64 > const & Weights, // Weight of each column
+		FArray1< Real64 > & Sums // Weighted sum of each row
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Sums(I) = sum over J of Weights(J) * Mat(I,J), visiting only the nonzero elements
+
+		// METHODOLOGY EMPLOYED:
+		// na
+
+		// REFERENCES:
+		// na
+
+		// Locals
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int I; // Row index
+		int J; // Column index
+		int K; // Position of the element in the compressed matrix
+
+		for ( I = 1; I <= Mat.NRows; ++I ) {
+			Sums( I ) = 0.0;
+		}
+		for ( J = 1; J <= Mat.NCols; ++J ) {
+			for ( K = Mat.ColStart( J ); K < Mat.ColStart( J + 1 ); ++K ) {
+				Sums( Mat.RowIndex( K ) ) += Weights( J ) * Mat.Value( K );
+			}
+		}
+
+	}
+
+	Real64
+	BSDFMatrixElement(
+		BSDFSparseMatrix const & Mat, // Compressed matrix
+		int const I, // Row index
+		int const J // Column index
+	)
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns the element (I,J) of a compressed BSDF matrix.
+
+		// METHODOLOGY EMPLOYED:
+		// The row indices within a column are ascending, so the row is found by bisection.
+
+		// REFERENCES:
+		// na
+
+		// Locals
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		int Lo; // Lower end of the search interval
+		int Hi; // One past the upper end of the search interval
+		int Mid; // Midpoint of the search interval
+
+		Lo = Mat.ColStart( J );
+		Hi = Mat.ColStart( J + 1 );
+		while ( Lo < Hi ) {
+			Mid = ( Lo + Hi ) / 2;
+			if ( Mat.RowIndex( Mid ) < I ) {
+				Lo = Mid + 1;
+			} else {
+				Hi = Mid;
+			}
+		}
+		if ( Lo < Mat.ColStart( J + 1 ) && Mat.RowIndex( Lo ) == I ) return Mat.Value( Lo );
+		return 0.0;
+
+	}
+
+	int
+	BSDFMatrixMemory( int const ConstrNum ) // Construction number
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns the memory [bytes] held by the BSDF property matrices of a complex fenestration construction.
+
+		// METHODOLOGY EMPLOYED:
+		// na
+
+		// REFERENCES:
+		// na
+
+		// Locals
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		int Memory; // Memory of the matrices [bytes]
+		int Lay; // Layer number
+
+		auto const & BSDFInput( Construct( ConstrNum ).BSDFInput );
+		Memory = sizeof( Real64 ) * ( BSDFInput.SolFrtTrans.size() + BSDFInput.SolBkRefl.size() + BSDFInput.VisFrtTrans.size() + BSDFInput.VisBkRefl.size() );
+		Memory += sizeof( int ) * ( BSDFInput.SolBkReflSparse.ColStart.size() + BSDFInput.SolBkReflSparse.RowIndex.size() ) + sizeof( Real64 ) * BSDFInput.SolBkReflSparse.Value.size();
+		Memory += sizeof( int ) * ( BSDFInput.VisFrtTransSparse.ColStart.size() + BSDFInput.VisFrtTransSparse.RowIndex.size() ) + sizeof( Real64 ) * BSDFInput.VisFrtTransSparse.Value.size();
+		Memory += sizeof( int ) * ( BSDFInput.VisBkReflSparse.ColStart.size() + BSDFInput.VisBkReflSparse.RowIndex.size() ) + sizeof( Real64 ) * BSDFInput.VisBkReflSparse.Value.size();
+		for ( Lay = 1; Lay <= isize( BSDFInput.Layer ); ++Lay ) {
+			Memory += sizeof( Real64 ) * ( BSDFInput.Layer( Lay ).FrtAbs.size() + BSDFInput.Layer( Lay ).BkAbs.size() );
+		}
+
+		return Memory;
+
+	}
+
 	Real64
 	SkyWeight( Vector const & DirVec ) // Direction of the element to be weighted
 	{
@@ -20,6 +20,7 @@ namespace WindowComplexManager {
 	using DataBSDFWindow::BSDFGeomDescr;
 	using DataBSDFWindow::BSDFStateDescr;
 	using DataBSDFWindow::BSDFWindowGeomDescr;
+	using DataBSDFWindow::BSDFSparseMatrix;
 	using DataBSDFWindow::BSDFWindowInputStruct;
 	using DataBSDFWindow::BasisElemDescr;
 	using DataBSDFWindow::BasisStruct;
@@ -43,11 +44,14 @@ namespace WindowComplexManager {
 	extern int const Back_Transmitted;
 	extern int const Back_Reflected;
 
+	extern Real64 const BSDFSparseDensityLimit; // Largest fraction of nonzero elements for which a BSDF matrix is compressed
+
 	// DERIVED TYPE DEFINITIONS:
 
 	// MODULE VARIABLE DECLARATIONS:
 
 	extern int NumComplexWind; // Total number of complex windows
+	extern bool InitComplexWindowsOnce; // TRUE until the complex window geometry and static properties are set up
 	//Debug
 	extern FArray2D_int DbgIBm;
 	extern FArray2D< Real64 > DbgTheta;
@@ -128,6 +132,9 @@ namespace WindowComplexManager {
 
 	// Functions
 
+	void
+	clear_state();
+
 	void
 	InitBSDFWindows();
 
@@ -222,6 +229,50 @@ namespace WindowComplexManager {
 		BSDFStateDescr & State // State Description
 	);
 
+	void
+	CompressBSDFMatrix(
+		FArray2D< Real64 > & Mat, // Dense matrix, deallocated if it is compressed
+		BSDFSparseMatrix & Sparse // Compressed matrix
+	);
+
+	void
+	BSDFColumnSums(
+		FArray2D< Real64 > const & Mat, // Dense matrix
+		FArray1< Real64 > const & Weights, // Weight of each row
+		FArray1< Real64 > & Sums // Weighted sum of each column
+	);
+
+	void
+	BSDFColumnSums(
+		BSDFSparseMatrix const & Mat, // Compressed matrix
+		FArray1< Real64 > const & Weights, // Weight of each row
+		FArray1< Real64 > & Sums // Weighted sum of each column
+	);
+
+	void
+	BSDFRowSums(
+		FArray2D< Real64 > const & Mat, // Dense matrix
+		FArray1< Real64 > const & Weights, // Weight of each column
+		FArray1< Real64 > & Sums // Weighted sum of each row
+	);
+
+	void
+	BSDFRowSums(
+		BSDFSparseMatrix const & Mat, // Compressed matrix
+		FArray1< Real64 > const & Weights, // Weight of each column
+		FArray1< Real64 > & Sums // Weighted sum of each row
+	);
+
+	Real64
+	BSDFMatrixElement(
+		BSDFSparseMatrix const & Mat, // Compressed matrix
+		int const I, // Row index
+		int const J // Column index
+	);
+
+	int
+	BSDFMatrixMemory( int const ConstrNum ); // Construction number
+
 	Real64
 	SkyWeight( Vector const & DirVec ); // Direction of the element to be weighted
 
@@ -22,6 +22,7 @@
 #include <DataLoopNode.hh>
 #include <DataPrecisionGlobals.hh>
 #include <DataSurfaces.hh>
+#include <DataSystemVariables.hh>
 #include <DataZoneEquipment.hh>
 #include <General.hh>
 #include <InputProcessor.hh>
@@ -86,6 +87,9 @@ namespace WindowManager {
 	Real64 const TKelvin( KelvinConv ); // conversion from Kelvin to Celsius
 	int const nume( 107 ); // Number of wavelength values in solar spectrum
 	int const numt3( 81 ); // Number of wavelength values in the photopic response
+	Real64 const GasTableTempMin( 200.0 ); // Lowest temperature in the gas mixture property tables (K)
+	Real64 const GasTableTempStep( 1.0 ); // Temperature step in the gas mixture property tables (K)
+	int const GasTableNumTemps( 201 ); // Number of temperatures in the gas mixture property tables
 
 	//               Dens  dDens/dT  Con    dCon/dT   Vis    dVis/dT Prandtl dPrandtl/dT
 	FArray1D< Real64 > const AirProps( 8, { 1.29, -0.4e-2, 2.41e-2, 7.6e-5, 1.73e-5, 1.0e-7, 0.72, 1.8e-3 } );
@@ -93,17 +97,21 @@ namespace WindowManager {
 	// on a 37 degree tilted surface; corresponds
 	// to wavelengths (microns) in following data block (ISO 9845-1 and ASTM E 892;
 	// derived from Optics5 data file ISO-9845GlobalNorm.std, 10-14-99)
-	FArray1D< Real64 > wle( nume, { 0.3000, 0.3050, 0.3100, 0.3150, 0.3200, 0.3250, 0.3300, 0.3350, 0.3400, 0.3450, 0.3500, 0.3600, 0.3700, 0.3800, 0.3900, 0.4000, 0.4100, 0.4200, 0.4300, 0.4400, 0.4500, 0.4600, 0.4700, 0.4800, 0.4900, 0.5000, 0.5100, 0.5200, 0.5300, 0.5400, 0.5500, 0.5700, 0.5900, 0.6100, 0.6300, 0.6500, 0.6700, 0.6900, 0.7100, 0.7180, 0.7244, 0.7400, 0.7525, 0.7575, 0.7625, 0.7675, 0.7800, 0.8000, 0.8160, 0.8237, 0.8315, 0.8400, 0.8600, 0.8800, 0.9050, 0.9150, 0.9250, 0.9300, 0.9370, 0.9480, 0.9650, 0.9800, 0.9935, 1.0400, 1.0700, 1.1000, 1.1200, 1.1300, 1.1370, 1.1610, 1.1800, 1.2000, 1.2350, 1.2900, 1.3200, 1.3500, 1.3950, 1.4425, 1.4625, 1.4770, 1.4970, 1.5200, 1.5390, 1.5580, 1.5780, 1.5920, 1.6100, 1.6300, 1.6460, 1.6780, 1.7400, 1.8000, 1.8600, 1.9200, 1.9600, 1.9850, 2.0050, 2.0350, 2.0650, 2.1000, 2.1480, 2.1980, 2.2700, 2.3600, 2.4500, 2.4940, 2.5370 } ); // Solar spectrum wavelength values (microns)
+	FArray1D< Real64 > const wleDefault( nume, { 0.3000, 0.3050, 0.3100, 0.3150, 0.3200, 0.3250, 0.3300, 0.3350, 0.3400, 0.3450, 0.3500, 0.3600, 0.3700, 0.3800, 0.3900, 0.4000, 0.4100, 0.4200, 0.4300, 0.4400, 0.4500, 0.4600, 0.4700, 0.4800, 0.4900, 0.5000, 0.5100, 0.5200, 0.5300, 0.5400, 0.5500, 0.5700, 0.5900, 0.6100, 0.6300, 0.6500, 0.6700, 0.6900, 0.7100, 0.7180, 0.7244, 0.7400, 0.7525, 0.7575, 0.7625, 0.7675, 0.7800, 0.8000, 0.8160, 0.8237, 0.8315, 0.8400, 0.8600, 0.8800, 0.9050, 0.9150, 0.9250, 0.9300, 0.9370, 0.9480, 0.9650, 0.9800, 0.9935, 1.0400, 1.0700, 1.1000, 1.1200, 1.1300, 1.1370, 1.1610, 1.1800, 1.2000, 1.2350, 1.2900, 1.3200, 1.3500, 1.3950, 1.4425, 1.4625, 1.4770, 1.4970, 1.5200, 1.5390, 1.5580, 1.5780, 1.5920, 1.6100, 1.6300, 1.6460, 1.6780, 1.7400, 1.8000, 1.8600, 1.9200, 1.9600, 1.9850, 2.0050, 2.0350, 2.0650, 2.1000, 2.1480, 2.1980, 2.2700, 2.3600, 2.4500, 2.4940, 2.5370 } ); // Default solar spectrum wavelength values (microns)
+	FArray1D< Real64 > wle( wleDefault ); // Solar spectrum wavelength values (microns) (may be replaced by Site:SpectrumData)
 
-	FArray1D< Real64 > e( nume, { 0.0, 9.5, 42.3, 107.8, 181.0, 246.0, 395.3, 390.1, 435.3, 438.9, 483.7, 520.3, 666.2, 712.5, 720.7, 1013.1, 1158.2, 1184.0, 1071.9, 1302.0, 1526.0, 1599.6, 1581.0, 1628.3, 1539.2, 1548.7, 1586.5, 1484.9, 1572.4, 1550.7, 1561.5, 1501.5, 1395.5, 1485.3, 1434.1, 1419.9, 1392.3, 1130.0, 1316.7, 1010.3, 1043.2, 1211.2, 1193.9, 1175.5, 643.1, 1030.7, 1131.1, 1081.6, 849.2, 785.0, 916.4, 959.9, 978.9, 933.2, 748.5, 667.5, 690.3, 403.6, 258.3, 313.6, 526.8, 646.4, 746.8, 690.5, 637.5, 412.6, 108.9, 189.1, 132.2, 339.0, 460.0, 423.6, 480.5, 413.1, 250.2, 32.5, 1.6, 55.7, 105.1, 105.5, 182.1, 262.2, 274.2, 275.0, 244.6, 247.4, 228.7, 244.5, 234.8, 220.5, 171.5, 30.7, 2.0, 1.2, 21.2, 91.1, 26.8, 99.5, 60.4, 89.1, 82.2, 71.5, 70.2, 62.0, 21.2, 18.5, 3.2 } ); // Solar spectrum values corresponding to wle
+	FArray1D< Real64 > const eDefault( nume, { 0.0, 9.5, 42.3, 107.8, 181.0, 246.0, 395.3, 390.1, 435.3, 438.9, 483.7, 520.3, 666.2, 712.5, 720.7, 1013.1, 1158.2, 1184.0, 1071.9, 1302.0, 1526.0, 1599.6, 1581.0, 1628.3, 1539.2, 1548.7, 1586.5, 1484.9, 1572.4, 1550.7, 1561.5, 1501.5, 1395.5, 1485.3, 1434.1, 1419.9, 1392.3, 1130.0, 1316.7, 1010.3, 1043.2, 1211.2, 1193.9, 1175.5, 643.1, 1030.7, 1131.1, 1081.6, 849.2, 785.0, 916.4, 959.9, 978.9, 933.2, 748.5, 667.5, 690.3, 403.6, 258.3, 313.6, 526.8, 646.4, 746.8, 690.5, 637.5, 412.6, 108.9, 189.1, 132.2, 339.0, 460.0, 423.6, 480.5, 413.1, 250.2, 32.5, 1.6, 55.7, 105.1, 105.5, 182.1, 262.2, 274.2, 275.0, 244.6, 247.4, 228.7, 244.5, 234.8, 220.5, 171.5, 30.7, 2.0, 1.2, 21.2, 91.1, 26.8, 99.5, 60.4, 89.1, 82.2, 71.5, 70.2, 62.0, 21.2, 18.5, 3.2 } ); // Default solar spectrum values corresponding to wle
+	FArray1D< Real64 > e( eDefault ); // Solar spectrum values corresponding to wle (may be replaced by Site:SpectrumData)
 
 	// Phototopic response function and corresponding wavelengths (microns)
 	// (CIE 1931 observer; ISO/CIE 10527, CIE Standard Calorimetric Observers;
 	// derived from Optics5 data file "CIE 1931 Color Match from E308.txt", which is
 	// the same as WINDOW4 file Cie31t.dat)
-	FArray1D< Real64 > wlt3( numt3, { 0.380, 0.385, 0.390, 0.395, 0.400, 0.405, 0.410, 0.415, 0.420, 0.425, 0.430, 0.435, 0.440, 0.445, 0.450, 0.455, 0.460, 0.465, 0.470, 0.475, 0.480, 0.485, 0.490, 0.495, 0.500, 0.505, 0.510, 0.515, 0.520, 0.525, 0.530, 0.535, 0.540, 0.545, 0.550, 0.555, 0.560, 0.565, 0.570, 0.575, 0.580, 0.585, 0.590, 0.595, 0.600, 0.605, 0.610, 0.615, 0.620, 0.625, 0.630, 0.635, 0.640, 0.645, 0.650, 0.655, 0.660, 0.665, 0.670, 0.675, 0.680, 0.685, 0.690, 0.695, 0.700, 0.705, 0.710, 0.715, 0.720, 0.725, 0.730, 0.735, 0.740, 0.745, 0.750, 0.755, 0.760, 0.765, 0.770, 0.775, 0.780 } ); // Wavelength values for photopic response
+	FArray1D< Real64 > const wlt3Default( numt3, { 0.380, 0.385, 0.390, 0.395, 0.400, 0.405, 0.410, 0.415, 0.420, 0.425, 0.430, 0.435, 0.440, 0.445, 0.450, 0.455, 0.460, 0.465, 0.470, 0.475, 0.480, 0.485, 0.490, 0.495, 0.500, 0.505, 0.510, 0.515, 0.520, 0.525, 0.530, 0.535, 0.540, 0.545, 0.550, 0.555, 0.560, 0.565, 0.570, 0.575, 0.580, 0.585, 0.590, 0.595, 0.600, 0.605, 0.610, 0.615, 0.620, 0.625, 0.630, 0.635, 0.640, 0.645, 0.650, 0.655, 0.660, 0.665, 0.670, 0.675, 0.680, 0.685, 0.690, 0.695, 0.700, 0.705, 0.710, 0.715, 0.720, 0.725, 0.730, 0.735, 0.740, 0.745, 0.750, 0.755, 0.760, 0.765, 0.770, 0.775, 0.780 } ); // Default wavelength values for photopic response
+	FArray1D< Real64 > wlt3( wlt3Default ); // Wavelength values for photopic response (may be replaced by Site:SpectrumData)
 
-	FArray1D< Real64 > y30( numt3, { 0.0000, 0.0001, 0.0001, 0.0002, 0.0004, 0.0006, 0.0012, 0.0022, 0.0040, 0.0073, 0.0116, 0.0168, 0.0230, 0.0298, 0.0380, 0.0480, 0.0600, 0.0739, 0.0910, 0.1126, 0.1390, 0.1693, 0.2080, 0.2586, 0.3230, 0.4073, 0.5030, 0.6082, 0.7100, 0.7932, 0.8620, 0.9149, 0.9540, 0.9803, 0.9950, 1.0000, 0.9950, 0.9786, 0.9520, 0.9154, 0.8700, 0.8163, 0.7570, 0.6949, 0.6310, 0.5668, 0.5030, 0.4412, 0.3810, 0.3210, 0.2650, 0.2170, 0.1750, 0.1382, 0.1070, 0.0816, 0.0610, 0.0446, 0.0320, 0.0232, 0.0170, 0.0119, 0.0082, 0.0158, 0.0041, 0.0029, 0.0021, 0.0015, 0.0010, 0.0007, 0.0005, 0.0004, 0.0002, 0.0002, 0.0001, 0.0001, 0.0001, 0.0000, 0.0000, 0.0000, 0.0000 } ); // Photopic response corresponding to wavelengths in wlt3
+	FArray1D< Real64 > const y30Default( numt3, { 0.0000, 0.0001, 0.0001, 0.0002, 0.0004, 0.0006, 0.0012, 0.0022, 0.0040, 0.0073, 0.0116, 0.0168, 0.0230, 0.0298, 0.0380, 0.0480, 0.0600, 0.0739, 0.0910, 0.1126, 0.1390, 0.1693, 0.2080, 0.2586, 0.3230, 0.4073, 0.5030, 0.6082, 0.7100, 0.7932, 0.8620, 0.9149, 0.9540, 0.9803, 0.9950, 1.0000, 0.9950, 0.9786, 0.9520, 0.9154, 0.8700, 0.8163, 0.7570, 0.6949, 0.6310, 0.5668, 0.5030, 0.4412, 0.3810, 0.3210, 0.2650, 0.2170, 0.1750, 0.1382, 0.1070, 0.0816, 0.0610, 0.0446, 0.0320, 0.0232, 0.0170, 0.0119, 0.0082, 0.0158, 0.0041, 0.0029, 0.0021, 0.0015, 0.0010, 0.0007, 0.0005, 0.0004, 0.0002, 0.0002, 0.0001, 0.0001, 0.0001, 0.0000, 0.0000, 0.0000, 0.0000 } ); // Default photopic response corresponding to wavelengths in wlt3
+	FArray1D< Real64 > y30( y30Default ); // Photopic response corresponding to wavelengths in wlt3 (may be replaced by Site:SpectrumData)
 
 	// MODULE VARIABLE DECLARATIONS:
 
@@ -127,6 +135,10 @@ namespace WindowManager {
 	FArray2D< Real64 > gfract( 5, 5, 0.0 ); // Gas fractions for each gap
 	FArray1D_int gnmix( 5, 0 ); // Number of gases in gap
 	FArray1D< Real64 > gap( 5, 0.0 ); // Gap width (m)
+	FArray1D_int gmat( 5, 0 ); // Gas material of each gap (0 if not taken from a gas material)
+	FArray1D_int GasTableNum; // Gas property table of each gas mixture material (0 if none)
+	FArray3D< Real64 > GasTable; // Tabulated conductivity, viscosity and specific heat of each gas mixture
+	FArray1D< Real64 > GasTableMolWght; // Molecular weight of each tabulated gas mixture
 	FArray1D< Real64 > thick( 5, 0.0 ); // Glass layer thickness (m)
 	FArray1D< Real64 > scon( 5, 0.0 ); // Glass layer conductance--conductivity/thickness (W/m2-K)
 	FArray1D< Real64 > tir( 10, 0.0 ); // Front and back IR transmittance for each glass layer
@@ -202,6 +214,7 @@ namespace WindowManager {
 	FArray1D< Real64 > rfvisPhi( 10, 0.0 ); // Glazing system visible front reflectance for each angle of incidence
 	FArray1D< Real64 > rbvisPhi( 10, 0.0 ); // Glazing system visible back reflectance for each angle of incidence
 	FArray1D< Real64 > CosPhiIndepVar( 10, 0.0 ); // Cos of incidence angles at 10-deg increments for curve fits
+	bool CustomSpectrumDataRead( false ); // True once the Site:SolarAndVisibleSpectrum input has been processed
 
 	// SUBROUTINE SPECIFICATIONS FOR MODULE WindowManager:
 	//   Optical Calculation Routines
@@ -211,6 +224,108 @@ namespace WindowManager {
 
 	// Functions
 
+	// Clears the global data in WindowManager.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state()
+	{
+		ngllayer = 0;
+		nglface = 0;
+		nglfacep = 0;
+		tout = 0.0;
+		tin = 0.0;
+		tilt = 0.0;
+		tiltr = 0.0;
+		hcin = 0.0;
+		hcout = 0.0;
+		Ebout = 0.0;
+		Outir = 0.0;
+		Rmir = 0.0;
+		Rtot = 0.0;
+		gcon = 0.0;
+		gvis = 0.0;
+		gcp = 0.0;
+		gwght = 0.0;
+		gfract = 0.0;
+		gnmix = 0;
+		gap = 0.0;
+		gmat = 0;
+		GasTableNum.deallocate();
+		GasTable.deallocate();
+		GasTableMolWght.deallocate();
+		thick = 0.0;
+		scon = 0.0;
+		tir = 0.0;
+		emis = 0.0;
+		rir = 0.0;
+		AbsRadGlassFace = 0.0;
+		thetas = 0.0;
+		thetasPrev = 0.0;
+		fvec = 0.0;
+		fjac = 0.0;
+		dtheta = 0.0;
+		zir = 0.0;
+		ziri = 0.0;
+		ddeldt = 0.0;
+		dtddel = 0.0;
+		qf = 0.0;
+		hf = 0.0;
+		der = 0.0;
+		dhf = 0.0;
+		sour = 0.0;
+		delta = 0.0;
+		hcgap = 0.0;
+		hrgap = 0.0;
+		rgap = 0.0;
+		rs = 0.0;
+		arhs = 0.0;
+		A23P = 0.0;
+		A32P = 0.0;
+		A45P = 0.0;
+		A54P = 0.0;
+		A67P = 0.0;
+		A76P = 0.0;
+		A23 = 0.0;
+		A45 = 0.0;
+		A67 = 0.0;
+		wlt = 0.0;
+		t = 0.0;
+		rff = 0.0;
+		rbb = 0.0;
+		tPhi = 0.0;
+		rfPhi = 0.0;
+		rbPhi = 0.0;
+		tadjPhi = 0.0;
+		rfadjPhi = 0.0;
+		rbadjPhi = 0.0;
+		numpt = 0;
+		stPhi = 0.0;
+		srfPhi = 0.0;
+		srbPhi = 0.0;
+		saPhi = 0.0;
+		top = 0.0;
+		rfop = 0.0;
+		rbop = 0.0;
+		IndepVarCurveFit = 0.0;
+		DepVarCurveFit = 0.0;
+		CoeffsCurveFit = 0.0;
+		tsolPhi = 0.0;
+		rfsolPhi = 0.0;
+		rbsolPhi = 0.0;
+		solabsPhi = 0.0;
+		solabsBackPhi = 0.0;
+		solabsShadePhi = 0.0;
+		tvisPhi = 0.0;
+		rfvisPhi = 0.0;
+		rbvisPhi = 0.0;
+		CosPhiIndepVar = 0.0;
+		wle = wleDefault;
+		e = eDefault;
+		wlt3 = wlt3Default;
+		y30 = y30Default;
+		CustomSpectrumDataRead = false;
+	}
+
 	void
 	InitGlassOpticalCalculations()
 	{
@@ -2021,6 +2136,7 @@ namespace WindowManager {
 		using InputProcessor::SameString;
 		using WindowComplexManager::CalcComplexWindowThermal;
 		using WindowEquivalentLayer::EQLWindowSurfaceHeatBalance;
+		using DataSystemVariables::WindowGasPropertyTables;
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -2186,6 +2302,8 @@ namespace WindowManager {
 			}
 			// end new TC code
 
+			if ( WindowGasPropertyTables && ! allocated( GasTableNum ) ) SetupGasMixtureTables();
+
 			ZoneNum = surface.Zone;
 			TotLay = Construct( ConstrNum ).TotLayers;
 			TotGlassLay = Construct( ConstrNum ).TotGlassLayers;
@@ -2374,6 +2492,7 @@ namespace WindowManager {
 				if ( Material( LayPtr ).Group == WindowGas || Material( LayPtr ).Group == WindowGasMixture ) {
 					++IGap;
 					gap( IGap ) = Material( LayPtr ).Thickness;
+					gmat( IGap ) = LayPtr;
 					gnmix( IGap ) = Material( LayPtr ).NumberOfGasesInMixture;
 					for ( IMix = 1; IMix <= gnmix( IGap ); ++IMix ) {
 						gwght( IGap, IMix ) = Material( LayPtr ).GasWght( IMix );
@@ -2397,6 +2516,7 @@ namespace WindowManager {
 				} else { // Interior or exterior blind
 					gap( IGap ) = Blind( window.BlindNumber ).BlindToGlassDist;
 				}
+				gmat( IGap ) = 0;
 				gnmix( IGap ) = 1;
 				gwght( IGap, 1 ) = GasWght( 1 );
 				for ( ICoeff = 1; ICoeff <= 3; ++ICoeff ) {
@@ -4468,6 +4588,12 @@ namespace WindowManager {
 		Real64 const tmean( 0.5 * ( tleft + tright ) ); // Average gap gas temperature (K)
 		Real64 const tmean_2( pow_2( tmean ) );
 
+		if ( GasMixtureTableLookup( IGap, tmean, con, visc, cp, dens ) ) {
+			pr = cp * visc / con;
+			gr = 9.807 * pow_3( gap( IGap ) ) * std::abs( tleft - tright ) * pow_2( dens ) / ( tmean * pow_2( visc ) );
+			return;
+		}
+
 		fcon( 1 ) = gcon( IGap, 1, 1 ) + gcon( IGap, 1, 2 ) * tmean + gcon( IGap, 1, 3 ) * tmean_2;
 		fvis( 1 ) = gvis( IGap, 1, 1 ) + gvis( IGap, 1, 2 ) * tmean + gvis( IGap, 1, 3 ) * tmean_2;
 		fcp( 1 ) = gcp( IGap, 1, 1 ) + gcp( IGap, 1, 2 ) * tmean + gcp( IGap, 1, 3 ) * tmean_2;
@@ -4616,6 +4742,10 @@ namespace WindowManager {
 			frct( IMix ) = gfract( IGap, IMix );
 		}
 
+		Real64 cp; // Specific heat of mixture at tmean (J/m3-K)
+		Real64 con; // Conductivity of mixture at tmean (W/m-K)
+		if ( GasMixtureTableLookup( IGap, tmean, con, visc, cp, dens ) ) return;
+
 		Real64 const tmean_2( pow_2( tmean ) );
 		fvis( 1 ) = gvis( IGap, 1, 1 ) + gvis( IGap, 1, 2 ) * tmean + gvis( IGap, 1, 3 ) * tmean_2;
 		fdens( 1 ) = pres * gwght( IGap, 1 ) / ( gaslaw * tmean ); // Density using ideal gas law:
@@ -4663,6 +4793,137 @@ namespace WindowManager {
 
 	//********************************************************************************
 
+	void
+	SetupGasMixtureTables()
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Tabulates the conductivity, viscosity and specific heat of each window gas
+		// mixture material against temperature, for use by WindowGasConductance and
+		// WindowGasPropertiesAtTemp when the WindowGasPropertyTables option is set.
+
+		// METHODOLOGY EMPLOYED:
+		// Each mixture is loaded into gap 1 and its properties are found at each table
+		// temperature by the full mixture calculation. Single gases are not tabulated since
+		// their properties are direct quadratics in temperature. Must be called before the
+		// gap data of a window are set up, since gap 1 is overwritten.
+
+		// REFERENCES:
+		// na
+
+		// USE STATEMENTS:
+		// na
+
+		// Locals
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int MatNum; // Material number
+		int NumTables; // Number of gas mixture tables
+		int TableNum; // Gas mixture table number
+		int TempNum; // Table temperature index
+		int IMix; // Counter of gases in a mixture
+		int ICoeff; // Gas property coefficient index
+		Real64 tmean; // Table temperature (K)
+		Real64 con; // Gas mixture conductivity (W/m-K)
+		Real64 pr; // Gas mixture Prandtl number
+		Real64 gr; // Gas mixture Grashof number (zero here)
+		Real64 dens; // Gas mixture density (kg/m3)
+		Real64 visc; // Gas mixture dynamic viscosity (g/m-s)
+
+		GasTableNum.dimension( TotMaterials, 0 );
+		NumTables = 0;
+		for ( MatNum = 1; MatNum <= TotMaterials; ++MatNum ) {
+			if ( Material( MatNum ).Group != WindowGasMixture || Material( MatNum ).NumberOfGasesInMixture <= 1 ) continue;
+			++NumTables;
+			GasTableNum( MatNum ) = NumTables;
+		}
+		GasTable.dimension( 3, GasTableNumTemps, NumTables, 0.0 );
+		GasTableMolWght.dimension( NumTables, 0.0 );
+
+		for ( MatNum = 1; MatNum <= TotMaterials; ++MatNum ) {
+			TableNum = GasTableNum( MatNum );
+			if ( TableNum == 0 ) continue;
+			gap( 1 ) = Material( MatNum ).Thickness;
+			gmat( 1 ) = 0;
+			gnmix( 1 ) = Material( MatNum ).NumberOfGasesInMixture;
+			for ( IMix = 1; IMix <= gnmix( 1 ); ++IMix ) {
+				gwght( 1, IMix ) = Material( MatNum ).GasWght( IMix );
+				gfract( 1, IMix ) = Material( MatNum ).GasFract( IMix );
+				GasTableMolWght( TableNum ) += gfract( 1, IMix ) * gwght( 1, IMix );
+				for ( ICoeff = 1; ICoeff <= 3; ++ICoeff ) {
+					gcon( 1, IMix, ICoeff ) = Material( MatNum ).GasCon( IMix, ICoeff );
+					gvis( 1, IMix, ICoeff ) = Material( MatNum ).GasVis( IMix, ICoeff );
+					gcp( 1, IMix, ICoeff ) = Material( MatNum ).GasCp( IMix, ICoeff );
+				}
+			}
+			for ( TempNum = 1; TempNum <= GasTableNumTemps; ++TempNum ) {
+				tmean = GasTableTempMin + ( TempNum - 1 ) * GasTableTempStep;
+				WindowGasConductance( tmean, tmean, 1, con, pr, gr );
+				WindowGasPropertiesAtTemp( tmean, 1, dens, visc );
+				GasTable( 1, TempNum, TableNum ) = con;
+				GasTable( 2, TempNum, TableNum ) = visc;
+				GasTable( 3, TempNum, TableNum ) = pr * con / visc;
+			}
+		}
+
+	}
+
+	//********************************************************************************
+
+	bool
+	GasMixtureTableLookup(
+		int const IGap, // Gap number
+		Real64 const tmean, // Temperature of gas in gap (K)
+		Real64 & con, // Gap gas conductivity at tmean (W/m-K)
+		Real64 & visc, // Gap gas dynamic viscosity at tmean (g/m-s)
+		Real64 & cp, // Gap gas specific heat at tmean (J/m3-K)
+		Real64 & dens // Gap gas density at tmean (kg/m3)
+	)
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns true, with the gas properties interpolated from the gas mixture tables,
+		// if the WindowGasPropertyTables option is set, the gap holds a tabulated gas
+		// mixture and tmean is within the table; otherwise returns false.
+
+		// METHODOLOGY EMPLOYED:
+		// Linear interpolation in temperature. The density is found from the ideal gas law
+		// with the mixture molecular weight, as in WindowGasConductance.
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		using DataSystemVariables::WindowGasPropertyTables;
+
+		// Locals
+		// FUNCTION PARAMETER DEFINITIONS:
+		Real64 const pres( 1.0e5 ); // Gap gas pressure (Pa)
+		Real64 const gaslaw( 8314.51 ); // Molar gas constant (J/kMol-K)
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		int TableNum; // Gas mixture table number
+		int TempNum; // Table temperature index at or below tmean
+		Real64 TablePos; // Position of tmean in the table, in temperature steps
+		Real64 Frac; // Fraction of the temperature step above TempNum
+
+		if ( ! WindowGasPropertyTables || gmat( IGap ) == 0 || ! allocated( GasTableNum ) ) return false;
+		TableNum = GasTableNum( gmat( IGap ) );
+		if ( TableNum == 0 ) return false;
+		TablePos = ( tmean - GasTableTempMin ) / GasTableTempStep;
+		if ( TablePos < 0.0 || TablePos >= GasTableNumTemps - 1 ) return false;
+
+		TempNum = int( TablePos ) + 1;
+		Frac = TablePos - ( TempNum - 1 );
+		con = GasTable( 1, TempNum, TableNum ) + Frac * ( GasTable( 1, TempNum + 1, TableNum ) - GasTable( 1, TempNum, TableNum ) );
+		visc = GasTable( 2, TempNum, TableNum ) + Frac * ( GasTable( 2, TempNum + 1, TableNum ) - GasTable( 2, TempNum, TableNum ) );
+		cp = GasTable( 3, TempNum, TableNum ) + Frac * ( GasTable( 3, TempNum + 1, TableNum ) - GasTable( 3, TempNum, TableNum ) );
+		dens = pres * GasTableMolWght( TableNum ) / ( gaslaw * tmean );
+		return true;
+
+	}
+
+	//********************************************************************************
+
 	void
 	StartingWindowTemps(
 		int const SurfNum, // Surface number
@@ -6593,6 +6854,7 @@ namespace WindowManager {
 					LayPtr = Material( LayPtr ).GasPointer;
 				}
 				gap( IGap ) = Material( LayPtr ).Thickness;
+				gmat( IGap ) = 0;
 				gnmix( IGap ) = Material( LayPtr ).NumberOfGasesInMixture;
 				for ( IMix = 1; IMix <= gnmix( IGap ); ++IMix ) {
 					gwght( IGap, IMix ) = Material( LayPtr ).GasWght( IMix );
@@ -7086,6 +7348,7 @@ namespace WindowManager {
 		// InterpBlind ! Blind profile angle interpolation function
 		using WindowComplexManager::CalcComplexWindowThermal;
 		using WindowComplexManager::UpdateComplexWindows;
+		using WindowComplexManager::BSDFMatrixMemory;
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -7104,9 +7367,9 @@ namespace WindowManager {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		static bool DoReport( false );
-		static bool HasWindows( false );
-		static bool HasComplexWindows( false );
-		static bool HasEQLWindows( false ); // equivalent layer window defined
+		bool HasWindows( false );
+		bool HasComplexWindows( false );
+		bool HasEQLWindows( false ); // equivalent layer window defined
 		static int SurfConstr( 0 );
 		static Real64 TempVar( 0.0 ); // just temporary usage for complex fenestration
 
@@ -7153,6 +7416,7 @@ namespace WindowManager {
 		static gio::Fmt Format_713( "(' WindowMaterial:Gap:EquivalentLayer',4(',',A))" );
 		static gio::Fmt Format_799( "(' Construction:WindowEquivalentLayer',6(',',A))" );
 		static gio::Fmt Format_800( "(' WindowConstruction:Complex',5(',',A))" );
+		static gio::Fmt Format_801( "(' WindowConstruction:Complex:Matrices',6(',',A))" );
 
 		ScanForReports( "Constructions", DoReport, "Constructions" );
 
@@ -7187,6 +7451,7 @@ namespace WindowManager {
 			if ( TotBlinds > 0 ) gio::write( OutputFileInits, fmtA ) << "! <WindowMaterial:Blind>,Material Name,Slat Width {m},Slat Separation {m},Slat Thickness {m},Slat Angle {deg},Slat Beam Solar Transmittance,Slat Beam Solar Front Reflectance,Blind To Glass Distance {m}";
 
 			if ( HasComplexWindows ) gio::write( OutputFileInits, fmtA ) << "! <WindowConstruction:Complex>,Construction Name,Index,#Layers,U-factor {W/m2-K},SHGC";
+			if ( HasComplexWindows && DisplayAdvancedReportVariables ) gio::write( OutputFileInits, fmtA ) << "! <WindowConstruction:Complex:Matrices>,Construction Name,Index,Back Solar Reflectance Storage,Front Visible Transmittance Storage,Back Visible Reflectance Storage,BSDF Matrix Memory {bytes}";
 
 			if ( HasEQLWindows ) gio::write( OutputFileInits, fmtA ) << "! <Construction:WindowEquivalentLayer>,Construction Name,Index,#Layers,U-factor {W/m2-K},SHGC, Solar Transmittance at Normal Incidence";
 			if ( W5GlsMatEQL > 0 ) gio::write( OutputFileInits, fmtA ) << "! <WindowMaterial:Glazing:EquivalentLayer>, Material Name, Optical Data Type, Spectral Data Set Name, Front Side Beam-Beam Solar Transmittance, Back Side Beam-Beam Solar Transmittance, Front Side Beam-Beam Solar Reflectance, Back Side Beam-Beam Solar Reflectance, Front Side Beam-Diffuse Solar Transmittance, Back Side Beam-Diffuse Solar Transmittance, , Front Side Beam-Diffuse Solar Reflectance, Back Side Beam-Diffuse Solar Reflectance, Diffuse-Diffuse Solar Transmittance, Front Side Diffuse-Diffuse Solar Reflectance, Back Side Diffuse-Diffuse Solar Reflectance, Infrared Transmittance, Front Side Infrared Emissivity, Back Side Infrared Emissivity";
@@ -7207,6 +7472,7 @@ namespace WindowManager {
 					CalcComplexWindowThermal( 0, i, TempVar, TempVar, TempVar, TempVar, summerCondition );
 
 					gio::write( OutputFileInits, Format_800 ) << Construct( ThisNum ).Name << RoundSigDigits( ThisNum ) << RoundSigDigits( Construct( ThisNum ).TotSolidLayers ) << RoundSigDigits( NominalU( ThisNum ), 3 ) << RoundSigDigits( Construct( ThisNum ).SummerSHGC, 3 );
+					if ( DisplayAdvancedReportVariables ) gio::write( OutputFileInits, Format_801 ) << Construct( ThisNum ).Name << RoundSigDigits( ThisNum ) << ( Construct( ThisNum ).BSDFInput.SolBkReflSparse.Compressed ? "Sparse" : "Dense" ) << ( Construct( ThisNum ).BSDFInput.VisFrtTransSparse.Compressed ? "Sparse" : "Dense" ) << ( Construct( ThisNum ).BSDFInput.VisBkReflSparse.Compressed ? "Sparse" : "Dense" ) << RoundSigDigits( BSDFMatrixMemory( ThisNum ) );
 
 				} else if ( Construct( ThisNum ).TypeIsWindow ) {
 					// Calculate for ASHRAE winter and summer conditions:
@@ -8752,7 +9018,6 @@ Label99999: ;
 		FArray1D_string cAlphaArgs; // Alpha input items for object
 		FArray1D< Real64 > rNumericArgs; // Numeric input items for object
 
-		static bool RunMeOnceFlag( false ); // This subroutine only needs to be run once
 		std::string cCurrentModuleObject;
 		std::string cSolarSpectrum;
 		std::string cVisibleSpectrum;
@@ -8762,7 +9027,7 @@ Label99999: ;
 		int Loop;
 		int iTmp;
 
-		if ( RunMeOnceFlag ) return;
+		if ( CustomSpectrumDataRead ) return;
 
 		// Step 1 - check whether there is custom solar or visible spectrum
 		cCurrentModuleObject = "Site:SolarAndVisibleSpectrum";
@@ -8770,7 +9035,7 @@ Label99999: ;
 
 		// no custom spectrum data, done!
 		if ( NumSiteSpectrum == 0 ) {
-			RunMeOnceFlag = true;
+			CustomSpectrumDataRead = true;
 			return;
 		}
 
@@ -8789,7 +9054,7 @@ Label99999: ;
 
 			// use default spectrum data, done!
 			if ( SameString( cAlphaArgs( 2 ), "Default" ) ) {
-				RunMeOnceFlag = true;
+				CustomSpectrumDataRead = true;
 				return;
 			}
 
@@ -8865,7 +9130,7 @@ Label99999: ;
 			ShowFatalError( "Errors found in processing input for user-defined solar/visible spectrum" );
 		}
 
-		RunMeOnceFlag = true;
+		CustomSpectrumDataRead = true;
 
 	}
 
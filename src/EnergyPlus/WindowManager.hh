@@ -20,6 +20,9 @@ namespace WindowManager {
 	extern Real64 const TKelvin; // conversion from Kelvin to Celsius
 	extern int const nume; // Number of wavelength values in solar spectrum
 	extern int const numt3; // Number of wavelength values in the photopic response
+	extern Real64 const GasTableTempMin; // Lowest temperature in the gas mixture property tables (K)
+	extern Real64 const GasTableTempStep; // Temperature step in the gas mixture property tables (K)
+	extern int const GasTableNumTemps; // Number of temperatures in the gas mixture property tables
 
 	//               Dens  dDens/dT  Con    dCon/dT   Vis    dVis/dT Prandtl dPrandtl/dT
 	extern FArray1D< Real64 > const AirProps;
@@ -27,17 +30,21 @@ namespace WindowManager {
 	// on a 37 degree tilted surface; corresponds
 	// to wavelengths (microns) in following data block (ISO 9845-1 and ASTM E 892;
 	// derived from Optics5 data file ISO-9845GlobalNorm.std, 10-14-99)
-	extern FArray1D< Real64 > wle; // Solar spectrum wavelength values (microns)
+	extern FArray1D< Real64 > const wleDefault; // Default solar spectrum wavelength values (microns)
+	extern FArray1D< Real64 > wle; // Solar spectrum wavelength values (microns) (may be replaced by Site:SpectrumData)
 
-	extern FArray1D< Real64 > e; // Solar spectrum values corresponding to wle
+	extern FArray1D< Real64 > const eDefault; // Default solar spectrum values corresponding to wle
+	extern FArray1D< Real64 > e; // Solar spectrum values corresponding to wle (may be replaced by Site:SpectrumData)
 
 	// Phototopic response function and corresponding wavelengths (microns)
 	// (CIE 1931 observer; ISO/CIE 10527, CIE Standard Calorimetric Observers;
 	// derived from Optics5 data file "CIE 1931 Color Match from E308.txt", which is
 	// the same as WINDOW4 file Cie31t.dat)
-	extern FArray1D< Real64 > wlt3; // Wavelength values for photopic response
+	extern FArray1D< Real64 > const wlt3Default; // Default wavelength values for photopic response
+	extern FArray1D< Real64 > wlt3; // Wavelength values for photopic response (may be replaced by Site:SpectrumData)
 
-	extern FArray1D< Real64 > y30; // Photopic response corresponding to wavelengths in wlt3
+	extern FArray1D< Real64 > const y30Default; // Default photopic response corresponding to wavelengths in wlt3
+	extern FArray1D< Real64 > y30; // Photopic response corresponding to wavelengths in wlt3 (may be replaced by Site:SpectrumData)
 
 	// MODULE VARIABLE DECLARATIONS:
 
@@ -61,6 +68,10 @@ namespace WindowManager {
 	extern FArray2D< Real64 > gfract; // Gas fractions for each gap
 	extern FArray1D_int gnmix; // Number of gases in gap
 	extern FArray1D< Real64 > gap; // Gap width (m)
+	extern FArray1D_int gmat; // Gas material of each gap (0 if not taken from a gas material)
+	extern FArray1D_int GasTableNum; // Gas property table of each gas mixture material (0 if none)
+	extern FArray3D< Real64 > GasTable; // Tabulated conductivity, viscosity and specific heat of each gas mixture
+	extern FArray1D< Real64 > GasTableMolWght; // Molecular weight of each tabulated gas mixture
 	extern FArray1D< Real64 > thick; // Glass layer thickness (m)
 	extern FArray1D< Real64 > scon; // Glass layer conductance--conductivity/thickness (W/m2-K)
 	extern FArray1D< Real64 > tir; // Front and back IR transmittance for each glass layer
@@ -136,6 +147,7 @@ namespace WindowManager {
 	extern FArray1D< Real64 > rfvisPhi; // Glazing system visible front reflectance for each angle of incidence
 	extern FArray1D< Real64 > rbvisPhi; // Glazing system visible back reflectance for each angle of incidence
 	extern FArray1D< Real64 > CosPhiIndepVar; // Cos of incidence angles at 10-deg increments for curve fits
+	extern bool CustomSpectrumDataRead; // True once the Site:SolarAndVisibleSpectrum input has been processed
 
 	// SUBROUTINE SPECIFICATIONS FOR MODULE WindowManager:
 	//   Optical Calculation Routines
@@ -143,6 +155,11 @@ namespace WindowManager {
 
 	// Functions
 
+	// Clears the global data in WindowManager.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state();
+
 	void
 	InitGlassOpticalCalculations();
 
@@ -317,6 +334,23 @@ namespace WindowManager {
 
 	//********************************************************************************
 
+	void
+	SetupGasMixtureTables();
+
+	//********************************************************************************
+
+	bool
+	GasMixtureTableLookup(
+		int const IGap, // Gap number
+		Real64 const tmean, // Temperature of gas in gap (K)
+		Real64 & con, // Gap gas conductivity at tmean (W/m-K)
+		Real64 & visc, // Gap gas dynamic viscosity at tmean (g/m-s)
+		Real64 & cp, // Gap gas specific heat at tmean (J/m3-K)
+		Real64 & dens // Gap gas density at tmean (kg/m3)
+	);
+
+	//********************************************************************************
+
 	void
 	StartingWindowTemps(
 		int const SurfNum, // Surface number
@@ -26,6 +26,7 @@
 #include <DataRoomAirModel.hh>
 #include <DataSizing.hh>
 #include <DataSurfaces.hh>
+#include <DataTimings.hh>
 #include <DataZoneEnergyDemands.hh>
 #include <DataZoneEquipment.hh>
 #include <DirectAirManager.hh>
@@ -1925,65 +1926,11 @@ namespace ZoneEquipmentManager {
 					CalcZoneSizing( CtrlZoneNum, CurOverallSimDay ).DesCoolCoilInTemp = OAFrac * DesDayWeath( CurOverallSimDay ).Temp( TimeStepAtPeak ) + ( 1.0 - OAFrac ) * CalcZoneSizing( CtrlZoneNum, CurOverallSimDay ).ZoneTempAtCoolPeak;
 					CalcZoneSizing( CtrlZoneNum, CurOverallSimDay ).DesCoolCoilInHumRat = OAFrac * DesDayWeath( CurOverallSimDay ).HumRat( TimeStepAtPeak ) + ( 1.0 - OAFrac ) * CalcZoneSizing( CtrlZoneNum, CurOverallSimDay ).ZoneHumRatAtCoolPeak;
 				}
-				if ( CalcZoneSizing( CtrlZoneNum, CurOverallSimDay ).DesHeatVolFlow > CalcFinalZoneSizing( CtrlZoneNum ).DesHeatVolFlow ) {
-					CalcFinalZoneSizing( CtrlZoneNum ).DesHeatVolFlow = CalcZoneSizing( CtrlZoneNum, CurOverallSimDay ).DesHeatVolFlow;
-					CalcFinalZoneSizing( CtrlZoneNum ).DesHeatLoad = CalcZoneSizing( CtrlZoneNum, CurOverallSimDay ).DesHeatLoad;
-					CalcFinalZoneSizing( CtrlZoneNum ).DesHeatMassFlow = CalcZoneSizing( CtrlZoneNum, CurOverallSimDay ).DesHeatMassFlow;
-					CalcFinalZoneSizing( CtrlZoneNum ).HeatDesDay = CalcZoneSizing( CtrlZoneNum, CurOverallSimDay ).HeatDesDay;
-					CalcFinalZoneSizing( CtrlZoneNum ).DesHeatDens = CalcZoneSizing( CtrlZoneNum, CurOverallSimDay ).DesHeatDens;
-					CalcFinalZoneSizing( CtrlZoneNum ).HeatFlowSeq = CalcZoneSizing( CtrlZoneNum, CurOverallSimDay ).HeatFlowSeq;
-					CalcFinalZoneSizing( CtrlZoneNum ).HeatLoadSeq = CalcZoneSizing( CtrlZoneNum, CurOverallSimDay ).HeatLoadSeq;
-					CalcFinalZoneSizing( CtrlZoneNum ).HeatZoneTempSeq = CalcZoneSizing( CtrlZoneNum, CurOverallSimDay ).HeatZoneTempSeq;
-					CalcFinalZoneSizing( CtrlZoneNum ).HeatOutTempSeq = CalcZoneSizing( CtrlZoneNum, CurOverallSimDay ).HeatOutTempSeq;
-					CalcFinalZoneSizing( CtrlZoneNum ).HeatZoneRetTempSeq = CalcZoneSizing( CtrlZoneNum, CurOverallSimDay ).HeatZoneRetTempSeq;
-					CalcFinalZoneSizing( CtrlZoneNum ).HeatTstatTempSeq = CalcZoneSizing( CtrlZoneNum, CurOverallSimDay ).HeatTstatTempSeq;
-					CalcFinalZoneSizing( CtrlZoneNum ).HeatTstatTemp = CalcZoneSizing( CtrlZoneNum, CurOverallSimDay ).HeatTstatTemp;
-					CalcFinalZoneSizing( CtrlZoneNum ).HeatZoneHumRatSeq = CalcZoneSizing( CtrlZoneNum, CurOverallSimDay ).HeatZoneHumRatSeq;
-					CalcFinalZoneSizing( CtrlZoneNum ).HeatOutHumRatSeq = CalcZoneSizing( CtrlZoneNum, CurOverallSimDay ).HeatOutHumRatSeq;
-					CalcFinalZoneSizing( CtrlZoneNum ).ZoneTempAtHeatPeak = CalcZoneSizing( CtrlZoneNum, CurOverallSimDay ).ZoneTempAtHeatPeak;
-					CalcFinalZoneSizing( CtrlZoneNum ).OutTempAtHeatPeak = CalcZoneSizing( CtrlZoneNum, CurOverallSimDay ).OutTempAtHeatPeak;
-					CalcFinalZoneSizing( CtrlZoneNum ).ZoneRetTempAtHeatPeak = CalcZoneSizing( CtrlZoneNum, CurOverallSimDay ).ZoneRetTempAtHeatPeak;
-					CalcFinalZoneSizing( CtrlZoneNum ).ZoneHumRatAtHeatPeak = CalcZoneSizing( CtrlZoneNum, CurOverallSimDay ).ZoneHumRatAtHeatPeak;
-					CalcFinalZoneSizing( CtrlZoneNum ).OutHumRatAtHeatPeak = CalcZoneSizing( CtrlZoneNum, CurOverallSimDay ).OutHumRatAtHeatPeak;
-					CalcFinalZoneSizing( CtrlZoneNum ).HeatDDNum = CalcZoneSizing( CtrlZoneNum, CurOverallSimDay ).HeatDDNum;
-					CalcFinalZoneSizing( CtrlZoneNum ).cHeatDDDate = DesDayWeath( CurOverallSimDay ).DateString;
-					CalcFinalZoneSizing( CtrlZoneNum ).TimeStepNumAtHeatMax = CalcZoneSizing( CtrlZoneNum, CurOverallSimDay ).TimeStepNumAtHeatMax;
-					CalcFinalZoneSizing( CtrlZoneNum ).DesHeatCoilInTemp = CalcZoneSizing( CtrlZoneNum, CurOverallSimDay ).DesHeatCoilInTemp;
-					CalcFinalZoneSizing( CtrlZoneNum ).DesHeatCoilInHumRat = CalcZoneSizing( CtrlZoneNum, CurOverallSimDay ).DesHeatCoilInHumRat;
-				} else {
-					CalcFinalZoneSizing( CtrlZoneNum ).DesHeatDens = StdRhoAir;
-				}
-				if ( CalcZoneSizing( CtrlZoneNum, CurOverallSimDay ).DesCoolVolFlow > CalcFinalZoneSizing( CtrlZoneNum ).DesCoolVolFlow ) {
-					CalcFinalZoneSizing( CtrlZoneNum ).DesCoolVolFlow = CalcZoneSizing( CtrlZoneNum, CurOverallSimDay ).DesCoolVolFlow;
-					CalcFinalZoneSizing( CtrlZoneNum ).DesCoolLoad = CalcZoneSizing( CtrlZoneNum, CurOverallSimDay ).DesCoolLoad;
-					CalcFinalZoneSizing( CtrlZoneNum ).DesCoolMassFlow = CalcZoneSizing( CtrlZoneNum, CurOverallSimDay ).DesCoolMassFlow;
-					CalcFinalZoneSizing( CtrlZoneNum ).CoolDesDay = CalcZoneSizing( CtrlZoneNum, CurOverallSimDay ).CoolDesDay;
-					CalcFinalZoneSizing( CtrlZoneNum ).DesCoolDens = CalcZoneSizing( CtrlZoneNum, CurOverallSimDay ).DesCoolDens;
-					CalcFinalZoneSizing( CtrlZoneNum ).CoolFlowSeq = CalcZoneSizing( CtrlZoneNum, CurOverallSimDay ).CoolFlowSeq;
-					CalcFinalZoneSizing( CtrlZoneNum ).CoolLoadSeq = CalcZoneSizing( CtrlZoneNum, CurOverallSimDay ).CoolLoadSeq;
-					CalcFinalZoneSizing( CtrlZoneNum ).CoolZoneTempSeq = CalcZoneSizing( CtrlZoneNum, CurOverallSimDay ).CoolZoneTempSeq;
-					CalcFinalZoneSizing( CtrlZoneNum ).CoolOutTempSeq = CalcZoneSizing( CtrlZoneNum, CurOverallSimDay ).CoolOutTempSeq;
-					CalcFinalZoneSizing( CtrlZoneNum ).CoolZoneRetTempSeq = CalcZoneSizing( CtrlZoneNum, CurOverallSimDay ).CoolZoneRetTempSeq;
-					CalcFinalZoneSizing( CtrlZoneNum ).CoolTstatTempSeq = CalcZoneSizing( CtrlZoneNum, CurOverallSimDay ).CoolTstatTempSeq;
-					CalcFinalZoneSizing( CtrlZoneNum ).CoolTstatTemp = CalcZoneSizing( CtrlZoneNum, CurOverallSimDay ).CoolTstatTemp;
-					CalcFinalZoneSizing( CtrlZoneNum ).CoolZoneHumRatSeq = CalcZoneSizing( CtrlZoneNum, CurOverallSimDay ).CoolZoneHumRatSeq;
-					CalcFinalZoneSizing( CtrlZoneNum ).CoolOutHumRatSeq = CalcZoneSizing( CtrlZoneNum, CurOverallSimDay ).CoolOutHumRatSeq;
-					CalcFinalZoneSizing( CtrlZoneNum ).ZoneTempAtCoolPeak = CalcZoneSizing( CtrlZoneNum, CurOverallSimDay ).ZoneTempAtCoolPeak;
-					CalcFinalZoneSizing( CtrlZoneNum ).OutTempAtCoolPeak = CalcZoneSizing( CtrlZoneNum, CurOverallSimDay ).OutTempAtCoolPeak;
-					CalcFinalZoneSizing( CtrlZoneNum ).ZoneRetTempAtCoolPeak = CalcZoneSizing( CtrlZoneNum, CurOverallSimDay ).ZoneRetTempAtCoolPeak;
-					CalcFinalZoneSizing( CtrlZoneNum ).ZoneHumRatAtCoolPeak = CalcZoneSizing( CtrlZoneNum, CurOverallSimDay ).ZoneHumRatAtCoolPeak;
-					CalcFinalZoneSizing( CtrlZoneNum ).OutHumRatAtCoolPeak = CalcZoneSizing( CtrlZoneNum, CurOverallSimDay ).OutHumRatAtCoolPeak;
-					CalcFinalZoneSizing( CtrlZoneNum ).CoolDDNum = CalcZoneSizing( CtrlZoneNum, CurOverallSimDay ).CoolDDNum;
-					CalcFinalZoneSizing( CtrlZoneNum ).cCoolDDDate = DesDayWeath( CurOverallSimDay ).DateString;
-					CalcFinalZoneSizing( CtrlZoneNum ).TimeStepNumAtCoolMax = CalcZoneSizing( CtrlZoneNum, CurOverallSimDay ).TimeStepNumAtCoolMax;
-					CalcFinalZoneSizing( CtrlZoneNum ).DesCoolCoilInTemp = CalcZoneSizing( CtrlZoneNum, CurOverallSimDay ).DesCoolCoilInTemp;
-					CalcFinalZoneSizing( CtrlZoneNum ).DesCoolCoilInHumRat = CalcZoneSizing( CtrlZoneNum, CurOverallSimDay ).DesCoolCoilInHumRat;
-				} else {
-					CalcFinalZoneSizing( CtrlZoneNum ).DesCoolDens = StdRhoAir;
-				}
 
 			}
 
+			if ( ! DeferFinalZoneSizing ) UpdateFinalZoneSizing( CurOverallSimDay );
+
 		} else if ( SELECT_CASE_var == EndZoneSizingCalc ) {
 
 			// candidate EMS calling point to customize CalcFinalZoneSizing
@@ -2525,6 +2472,99 @@ namespace ZoneEquipmentManager {
 
 	}
 
+	void
+	UpdateFinalZoneSizing( int const DesDayNum ) // design day (sizing period day) just completed
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         Fred Buhl
+		//       DATE WRITTEN   December 2000
+		//       MODIFIED       moved from UpdateZoneSizing (EndDay) so that days simulated by
+		//                      design day sizing workers can be merged in day order
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Carry the peaks of one sizing period day into CalcFinalZoneSizing when they exceed
+		// the peaks of the days merged so far.
+
+		// METHODOLOGY EMPLOYED:
+		// na
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		using DataEnvironment::StdRhoAir;
+
+		// Locals
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int CtrlZoneNum; // controlled zone index
+
+		for ( CtrlZoneNum = 1; CtrlZoneNum <= NumOfZones; ++CtrlZoneNum ) {
+
+			if ( ! ZoneEquipConfig( CtrlZoneNum ).IsControlled ) continue;
+
+			if ( CalcZoneSizing( CtrlZoneNum, DesDayNum ).DesHeatVolFlow > CalcFinalZoneSizing( CtrlZoneNum ).DesHeatVolFlow ) {
+				CalcFinalZoneSizing( CtrlZoneNum ).DesHeatVolFlow = CalcZoneSizing( CtrlZoneNum, DesDayNum ).DesHeatVolFlow;
+				CalcFinalZoneSizing( CtrlZoneNum ).DesHeatLoad = CalcZoneSizing( CtrlZoneNum, DesDayNum ).DesHeatLoad;
+				CalcFinalZoneSizing( CtrlZoneNum ).DesHeatMassFlow = CalcZoneSizing( CtrlZoneNum, DesDayNum ).DesHeatMassFlow;
+				CalcFinalZoneSizing( CtrlZoneNum ).HeatDesDay = CalcZoneSizing( CtrlZoneNum, DesDayNum ).HeatDesDay;
+				CalcFinalZoneSizing( CtrlZoneNum ).DesHeatDens = CalcZoneSizing( CtrlZoneNum, DesDayNum ).DesHeatDens;
+				CalcFinalZoneSizing( CtrlZoneNum ).HeatFlowSeq = CalcZoneSizing( CtrlZoneNum, DesDayNum ).HeatFlowSeq;
+				CalcFinalZoneSizing( CtrlZoneNum ).HeatLoadSeq = CalcZoneSizing( CtrlZoneNum, DesDayNum ).HeatLoadSeq;
+				CalcFinalZoneSizing( CtrlZoneNum ).HeatZoneTempSeq = CalcZoneSizing( CtrlZoneNum, DesDayNum ).HeatZoneTempSeq;
+				CalcFinalZoneSizing( CtrlZoneNum ).HeatOutTempSeq = CalcZoneSizing( CtrlZoneNum, DesDayNum ).HeatOutTempSeq;
+				CalcFinalZoneSizing( CtrlZoneNum ).HeatZoneRetTempSeq = CalcZoneSizing( CtrlZoneNum, DesDayNum ).HeatZoneRetTempSeq;
+				CalcFinalZoneSizing( CtrlZoneNum ).HeatTstatTempSeq = CalcZoneSizing( CtrlZoneNum, DesDayNum ).HeatTstatTempSeq;
+				CalcFinalZoneSizing( CtrlZoneNum ).HeatTstatTemp = CalcZoneSizing( CtrlZoneNum, DesDayNum ).HeatTstatTemp;
+				CalcFinalZoneSizing( CtrlZoneNum ).HeatZoneHumRatSeq = CalcZoneSizing( CtrlZoneNum, DesDayNum ).HeatZoneHumRatSeq;
+				CalcFinalZoneSizing( CtrlZoneNum ).HeatOutHumRatSeq = CalcZoneSizing( CtrlZoneNum, DesDayNum ).HeatOutHumRatSeq;
+				CalcFinalZoneSizing( CtrlZoneNum ).ZoneTempAtHeatPeak = CalcZoneSizing( CtrlZoneNum, DesDayNum ).ZoneTempAtHeatPeak;
+				CalcFinalZoneSizing( CtrlZoneNum ).OutTempAtHeatPeak = CalcZoneSizing( CtrlZoneNum, DesDayNum ).OutTempAtHeatPeak;
+				CalcFinalZoneSizing( CtrlZoneNum ).ZoneRetTempAtHeatPeak = CalcZoneSizing( CtrlZoneNum, DesDayNum ).ZoneRetTempAtHeatPeak;
+				CalcFinalZoneSizing( CtrlZoneNum ).ZoneHumRatAtHeatPeak = CalcZoneSizing( CtrlZoneNum, DesDayNum ).ZoneHumRatAtHeatPeak;
+				CalcFinalZoneSizing( CtrlZoneNum ).OutHumRatAtHeatPeak = CalcZoneSizing( CtrlZoneNum, DesDayNum ).OutHumRatAtHeatPeak;
+				CalcFinalZoneSizing( CtrlZoneNum ).HeatDDNum = CalcZoneSizing( CtrlZoneNum, DesDayNum ).HeatDDNum;
+				CalcFinalZoneSizing( CtrlZoneNum ).cHeatDDDate = DesDayWeath( DesDayNum ).DateString;
+				CalcFinalZoneSizing( CtrlZoneNum ).TimeStepNumAtHeatMax = CalcZoneSizing( CtrlZoneNum, DesDayNum ).TimeStepNumAtHeatMax;
+				CalcFinalZoneSizing( CtrlZoneNum ).DesHeatCoilInTemp = CalcZoneSizing( CtrlZoneNum, DesDayNum ).DesHeatCoilInTemp;
+				CalcFinalZoneSizing( CtrlZoneNum ).DesHeatCoilInHumRat = CalcZoneSizing( CtrlZoneNum, DesDayNum ).DesHeatCoilInHumRat;
+			} else {
+				CalcFinalZoneSizing( CtrlZoneNum ).DesHeatDens = StdRhoAir;
+			}
+			if ( CalcZoneSizing( CtrlZoneNum, DesDayNum ).DesCoolVolFlow > CalcFinalZoneSizing( CtrlZoneNum ).DesCoolVolFlow ) {
+				CalcFinalZoneSizing( CtrlZoneNum ).DesCoolVolFlow = CalcZoneSizing( CtrlZoneNum, DesDayNum ).DesCoolVolFlow;
+				CalcFinalZoneSizing( CtrlZoneNum ).DesCoolLoad = CalcZoneSizing( CtrlZoneNum, DesDayNum ).DesCoolLoad;
+				CalcFinalZoneSizing( CtrlZoneNum ).DesCoolMassFlow = CalcZoneSizing( CtrlZoneNum, DesDayNum ).DesCoolMassFlow;
+				CalcFinalZoneSizing( CtrlZoneNum ).CoolDesDay = CalcZoneSizing( CtrlZoneNum, DesDayNum ).CoolDesDay;
+				CalcFinalZoneSizing( CtrlZoneNum ).DesCoolDens = CalcZoneSizing( CtrlZoneNum, DesDayNum ).DesCoolDens;
+				CalcFinalZoneSizing( CtrlZoneNum ).CoolFlowSeq = CalcZoneSizing( CtrlZoneNum, DesDayNum ).CoolFlowSeq;
+				CalcFinalZoneSizing( CtrlZoneNum ).CoolLoadSeq = CalcZoneSizing( CtrlZoneNum, DesDayNum ).CoolLoadSeq;
+				CalcFinalZoneSizing( CtrlZoneNum ).CoolZoneTempSeq = CalcZoneSizing( CtrlZoneNum, DesDayNum ).CoolZoneTempSeq;
+				CalcFinalZoneSizing( CtrlZoneNum ).CoolOutTempSeq = CalcZoneSizing( CtrlZoneNum, DesDayNum ).CoolOutTempSeq;
+				CalcFinalZoneSizing( CtrlZoneNum ).CoolZoneRetTempSeq = CalcZoneSizing( CtrlZoneNum, DesDayNum ).CoolZoneRetTempSeq;
+				CalcFinalZoneSizing( CtrlZoneNum ).CoolTstatTempSeq = CalcZoneSizing( CtrlZoneNum, DesDayNum ).CoolTstatTempSeq;
+				CalcFinalZoneSizing( CtrlZoneNum ).CoolTstatTemp = CalcZoneSizing( CtrlZoneNum, DesDayNum ).CoolTstatTemp;
+				CalcFinalZoneSizing( CtrlZoneNum ).CoolZoneHumRatSeq = CalcZoneSizing( CtrlZoneNum, DesDayNum ).CoolZoneHumRatSeq;
+				CalcFinalZoneSizing( CtrlZoneNum ).CoolOutHumRatSeq = CalcZoneSizing( CtrlZoneNum, DesDayNum ).CoolOutHumRatSeq;
+				CalcFinalZoneSizing( CtrlZoneNum ).ZoneTempAtCoolPeak = CalcZoneSizing( CtrlZoneNum, DesDayNum ).ZoneTempAtCoolPeak;
+				CalcFinalZoneSizing( CtrlZoneNum ).OutTempAtCoolPeak = CalcZoneSizing( CtrlZoneNum, DesDayNum ).OutTempAtCoolPeak;
+				CalcFinalZoneSizing( CtrlZoneNum ).ZoneRetTempAtCoolPeak = CalcZoneSizing( CtrlZoneNum, DesDayNum ).ZoneRetTempAtCoolPeak;
+				CalcFinalZoneSizing( CtrlZoneNum ).ZoneHumRatAtCoolPeak = CalcZoneSizing( CtrlZoneNum, DesDayNum ).ZoneHumRatAtCoolPeak;
+				CalcFinalZoneSizing( CtrlZoneNum ).OutHumRatAtCoolPeak = CalcZoneSizing( CtrlZoneNum, DesDayNum ).OutHumRatAtCoolPeak;
+				CalcFinalZoneSizing( CtrlZoneNum ).CoolDDNum = CalcZoneSizing( CtrlZoneNum, DesDayNum ).CoolDDNum;
+				CalcFinalZoneSizing( CtrlZoneNum ).cCoolDDDate = DesDayWeath( DesDayNum ).DateString;
+				CalcFinalZoneSizing( CtrlZoneNum ).TimeStepNumAtCoolMax = CalcZoneSizing( CtrlZoneNum, DesDayNum ).TimeStepNumAtCoolMax;
+				CalcFinalZoneSizing( CtrlZoneNum ).DesCoolCoilInTemp = CalcZoneSizing( CtrlZoneNum, DesDayNum ).DesCoolCoilInTemp;
+				CalcFinalZoneSizing( CtrlZoneNum ).DesCoolCoilInHumRat = CalcZoneSizing( CtrlZoneNum, DesDayNum ).DesCoolCoilInHumRat;
+			} else {
+				CalcFinalZoneSizing( CtrlZoneNum ).DesCoolDens = StdRhoAir;
+			}
+
+		}
+
+	}
+
 	void
 	SimZoneEquipment(
 		bool const FirstHVACIteration,
@@ -2607,6 +2647,8 @@ namespace ZoneEquipmentManager {
 		using DataHeatBalance::Mixing;
 		using DataHeatBalance::ZoneAirMassFlow;
 		using SwimmingPool::SimSwimmingPool;
+		using DataTimings::epStartHVACProfile;
+		using DataTimings::epStopHVACProfile;
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -2776,6 +2818,7 @@ namespace ZoneEquipmentManager {
 					ZoneCompTurnFansOff = TurnFansOff;
 				}
 
+				epStartHVACProfile( PrioritySimOrder( EquipTypeNum ).EquipName );
 				{ auto const SELECT_CASE_var( ZoneEquipTypeNum );
 
 				if ( SELECT_CASE_var == AirDistUnit_Num ) { // 'ZoneHVAC:AirDistributionUnit'
@@ -2922,6 +2965,7 @@ namespace ZoneEquipmentManager {
 				} else {
 
 				}}
+				epStopHVACProfile();
 
 				ZoneEquipConfig( ControlledZoneNum ).ZoneExh += UnbalExhMassFlow;
 				ZoneEquipConfig( ControlledZoneNum ).ZoneExhBalanced += BalancedExhMassFlow;
@@ -98,6 +98,9 @@ namespace ZoneEquipmentManager {
 	void
 	UpdateZoneSizing( int const CallIndicator );
 
+	void
+	UpdateFinalZoneSizing( int const DesDayNum ); // design day (sizing period day) just completed
+
 	void
 	SimZoneEquipment(
 		bool const FirstHVACIteration,
@@ -33,6 +33,7 @@
 #include <ScheduleManager.hh>
 #include <ThermalComfort.hh>
 #include <UtilityRoutines.hh>
+#include <WarmupSnapshot.hh>
 #include <ZonePlenum.hh>
 
 namespace EnergyPlus {
@@ -160,12 +161,21 @@ namespace ZoneTempPredictorCorrector {
 	FArray1D< Real64 > ZoneSetPointLast;
 	FArray1D< Real64 > TempIndZnLd;
 	FArray1D< Real64 > TempDepZnLd;
+	FArray1D< Real64 > ZTPredicted; // Zone air temperature of the predict step, with the system heat of the last system timestep
 	FArray1D< Real64 > ZoneAirRelHum; // Zone relative humidity in percent
 
 	// Zone temperature history - used only for oscillation test
 	FArray2D< Real64 > ZoneTempHist;
 	FArray1D< Real64 > ZoneTempOscillate;
 	Real64 AnyZoneTempOscillate;
+	Real64 ZoneTempLocalError( 0.0 ); // Largest zone air temperature local error estimate of the last correct step
+
+	// Zone air heat balance lookups - see SetupZoneAirSumsLookup
+	FArray1D_int ZoneRetPlenumIndex; // ZoneRetPlenCond index of each zone (0 if not a return plenum)
+	FArray1D_int ZoneSupPlenumIndex; // ZoneSupPlenCond index of each zone (0 if not a supply plenum)
+	FArray1D_int ZoneHTSurfaceStart; // Start of each zone's surfaces in ZoneHTSurfaceList (NumOfZones + 1)
+	FArray1D_int ZoneHTSurfaceList; // Heat transfer surface numbers, grouped by zone
+	int ZoneAirSumsNumPlenums( -1 ); // Plenum count the plenum lookups were built for (-1 before setup)
 
 	// SUBROUTINE SPECIFICATIONS:
 
@@ -1938,6 +1948,7 @@ namespace ZoneTempPredictorCorrector {
 		// Using/Aliasing
 		using DataZoneEquipment::ZoneEquipInputsFilled;
 		using DataSurfaces::Surface;
+		using WarmupSnapshot::RestoreZoneAirHistories;
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -2003,6 +2014,7 @@ namespace ZoneTempPredictorCorrector {
 			WZoneTimeMinusP.dimension( NumOfZones, 0.0 );
 			TempIndZnLd.dimension( NumOfZones, 0.0 );
 			TempDepZnLd.dimension( NumOfZones, 0.0 );
+			ZTPredicted.dimension( NumOfZones, 0.0 );
 			NonAirSystemResponse.dimension( NumOfZones, 0.0 );
 			SysDepZoneLoads.dimension( NumOfZones, 0.0 );
 			SysDepZoneLoadsLagged.dimension( NumOfZones, 0.0 );
@@ -2161,6 +2173,7 @@ namespace ZoneTempPredictorCorrector {
 			MoisturePredictedRate = 0.0;
 			TempIndZnLd = 0.0;
 			TempDepZnLd = 0.0;
+			ZTPredicted = 0.0;
 			NonAirSystemResponse = 0.0;
 			SysDepZoneLoads = 0.0;
 			SysDepZoneLoadsLagged = 0.0;
@@ -2170,6 +2183,7 @@ namespace ZoneTempPredictorCorrector {
 			ZoneW1 = OutHumRat;
 			ZoneWMX = OutHumRat;
 			ZoneWM2 = OutHumRat;
+			RestoreZoneAirHistories(); // Replace the histories with a saved warmup state, if one applies
 
 			MyEnvrnFlag = false;
 		}
@@ -2565,13 +2579,7 @@ namespace ZoneTempPredictorCorrector {
 			}
 		}
 
-		//Tuned Precompute controlled equip zone numbers for performance
-		std::vector< int > controlledZoneEquipConfigNums;
-		for ( int ZoneEquipConfigNum = 1; ZoneEquipConfigNum <= NumOfZones; ++ZoneEquipConfigNum ) {
-			if ( Zone( ZoneEquipConfigNum ).IsControlled ) {
-				controlledZoneEquipConfigNums.push_back( ZoneEquipConfigNum );
-			}
-		}
+		SetupZoneAirSumsLookup();
 
 		// Update zone temperatures
 		for ( ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum ) {
@@ -2640,7 +2648,7 @@ namespace ZoneTempPredictorCorrector {
 			// Calculate the various heat balance sums
 
 			// NOTE: SumSysMCp and SumSysMCpT are not used in the predict step
-			CalcZoneSums( ZoneNum, SumIntGain, SumHA, SumHATsurf, SumHATref, SumMCp, SumMCpT, SumSysMCp, SumSysMCpT, controlledZoneEquipConfigNums );
+			CalcZoneSums( ZoneNum, SumIntGain, SumHA, SumHATsurf, SumHATref, SumMCp, SumMCpT, SumSysMCp, SumSysMCpT );
 
 			TempDepCoef = SumHA + SumMCp;
 			TempIndCoef = SumIntGain + SumHATsurf - SumHATref + SumMCpT + SysDepZoneLoadsLagged( ZoneNum );
@@ -3185,6 +3193,26 @@ namespace ZoneTempPredictorCorrector {
 
 		ZoneSetPointLast( ZoneNum ) = ZoneSetPoint;
 
+		// Zone air temperature the predictor expects if the system keeps delivering the convective heat of the last
+		// system timestep. CorrectZoneAirTemp compares it with the corrected temperature to estimate the local error
+		// for the adaptive system timestep; the difference is small while the loads and the system response are
+		// steady, whether or not the zone is conditioned, and shrinks with the timestep while they change.
+		{
+			Real64 const SysLoad( ( ZnAirRpt( ZoneNum ).SumMCpDTsystem + ZnAirRpt( ZoneNum ).SumNonAirSystem ) / ( Zone( ZoneNum ).Multiplier * Zone( ZoneNum ).ListMultiplier ) + TempIndZnLd( ZoneNum ) );
+			if ( ZoneAirSolutionAlgo == Use3rdOrder ) {
+				ZTPredicted( ZoneNum ) = ( TempDepZnLd( ZoneNum ) != 0.0 ) ? SysLoad / TempDepZnLd( ZoneNum ) : ZT( ZoneNum );
+			} else if ( ZoneAirSolutionAlgo == UseAnalyticalSolution ) {
+				if ( TempDepZnLd( ZoneNum ) == 0.0 ) { // B=0
+					ZTPredicted( ZoneNum ) = ZoneT1( ZoneNum ) + SysLoad / AIRRAT( ZoneNum );
+				} else {
+					Real64 const exp_700_TA( std::exp( min( 700.0, - TempDepZnLd( ZoneNum ) / AIRRAT( ZoneNum ) ) ) );
+					ZTPredicted( ZoneNum ) = SysLoad * ( 1.0 - exp_700_TA ) / TempDepZnLd( ZoneNum ) + ZoneT1( ZoneNum ) * exp_700_TA;
+				}
+			} else if ( ZoneAirSolutionAlgo == UseEulerMethod ) {
+				ZTPredicted( ZoneNum ) = ( SysLoad + AIRRAT( ZoneNum ) * ZoneT1( ZoneNum ) ) / ( AIRRAT( ZoneNum ) + TempDepZnLd( ZoneNum ) );
+			}
+		}
+
 		// Save the unmultiplied zone load to a report variable
 		SNLoadPredictedRate( ZoneNum ) = ZoneSysEnergyDemand( ZoneNum ).TotalOutputRequired * LoadCorrectionFactor( ZoneNum );
 		SNLoadPredictedHSPRate( ZoneNum ) = LoadToHeatingSetPoint * LoadCorrectionFactor( ZoneNum );
@@ -3511,14 +3539,9 @@ namespace ZoneTempPredictorCorrector {
 		// FLOW:
 		// Initializations
 		ZoneTempChange = constant_zero;
+		ZoneTempLocalError = 0.0;
 
-		//Tuned Precompute controlled equip zone numbers for performance
-		std::vector< int > controlledZoneEquipConfigNums;
-		for ( int ZoneEquipConfigNum = 1; ZoneEquipConfigNum <= NumOfZones; ++ZoneEquipConfigNum ) {
-			if ( Zone( ZoneEquipConfigNum ).IsControlled ) {
-				controlledZoneEquipConfigNums.push_back( ZoneEquipConfigNum );
-			}
-		}
+		SetupZoneAirSumsLookup();
 
 		// Update zone temperatures
 		for ( ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum ) {
@@ -3568,7 +3591,7 @@ namespace ZoneTempPredictorCorrector {
 			ManageAirModel( ZoneNum );
 
 			// Calculate the various heat balance sums
-			CalcZoneSums( ZoneNum, SumIntGain, SumHA, SumHATsurf, SumHATref, SumMCp, SumMCpT, SumSysMCp, SumSysMCpT, controlledZoneEquipConfigNums );
+			CalcZoneSums( ZoneNum, SumIntGain, SumHA, SumHATsurf, SumHATref, SumMCp, SumMCpT, SumSysMCp, SumSysMCpT );
 			//    ZoneTempHistoryTerm = (3.0D0 * ZTM1(ZoneNum) - (3.0D0/2.0D0) * ZTM2(ZoneNum) + (1.0D0/3.0D0) * ZTM3(ZoneNum))
 			ZoneNodeNum = Zone( ZoneNum ).SystemZoneNodeNumber;
 
@@ -3587,19 +3610,7 @@ namespace ZoneTempPredictorCorrector {
 				//    TempDepZnLd(ZoneNum) = (11.0/6.0) * AirCap + TempDepCoef
 				//    TempIndZnLd(ZoneNum) = TempHistoryTerm + TempIndCoef
 				// Solve for zone air temperature
-				{ auto const SELECT_CASE_var( ZoneAirSolutionAlgo );
-				if ( SELECT_CASE_var == Use3rdOrder ) {
-					ZT( ZoneNum ) = ( TempIndCoef + AirCap * ( 3.0 * ZTM1( ZoneNum ) - ( 3.0 / 2.0 ) * ZTM2( ZoneNum ) + ( 1.0 / 3.0 ) * ZTM3( ZoneNum ) ) ) / ( ( 11.0 / 6.0 ) * AirCap + TempDepCoef );
-					// Exact solution
-				} else if ( SELECT_CASE_var == UseAnalyticalSolution ) {
-					if ( TempDepCoef == 0.0 ) { // B=0
-						ZT( ZoneNum ) = ZoneT1( ZoneNum ) + TempIndCoef / AirCap;
-					} else {
-						ZT( ZoneNum ) = ( ZoneT1( ZoneNum ) - TempIndCoef / TempDepCoef ) * std::exp( min( 700.0, -TempDepCoef / AirCap ) ) + TempIndCoef / TempDepCoef;
-					}
-				} else if ( SELECT_CASE_var == UseEulerMethod ) {
-					ZT( ZoneNum ) = ( AirCap * ZoneT1( ZoneNum ) + TempIndCoef ) / ( AirCap + TempDepCoef );
-				}}
+				ZT( ZoneNum ) = SolveZoneAirTemp( ZoneNum, AirCap, TempDepCoef, TempIndCoef );
 				// Update zone node temperature and thermostat temperature unless already updated in Room Air Model,
 				// calculate load correction factor
 				if ( ( AirModel( ZoneNum ).AirModelType == RoomAirModel_Mixing ) || ( ! AirModel( ZoneNum ).SimAirModel ) ) {
@@ -3668,19 +3679,7 @@ namespace ZoneTempPredictorCorrector {
 				//      TempIndZnLd(ZoneNum) = TempHistoryTerm + TempIndCoef
 
 				// Solve for zone air temperature
-				{ auto const SELECT_CASE_var( ZoneAirSolutionAlgo );
-				if ( SELECT_CASE_var == Use3rdOrder ) {
-					ZT( ZoneNum ) = ( TempIndCoef + AirCap * ( 3.0 * ZTM1( ZoneNum ) - ( 3.0 / 2.0 ) * ZTM2( ZoneNum ) + ( 1.0 / 3.0 ) * ZTM3( ZoneNum ) ) ) / ( ( 11.0 / 6.0 ) * AirCap + TempDepCoef );
-					// Exact solution
-				} else if ( SELECT_CASE_var == UseAnalyticalSolution ) {
-					if ( TempDepCoef == 0.0 ) { // B=0
-						ZT( ZoneNum ) = ZoneT1( ZoneNum ) + TempIndCoef / AirCap;
-					} else {
-						ZT( ZoneNum ) = ( ZoneT1( ZoneNum ) - TempIndCoef / TempDepCoef ) * std::exp( min( 700.0, -TempDepCoef / AirCap ) ) + TempIndCoef / TempDepCoef;
-					}
-				} else if ( SELECT_CASE_var == UseEulerMethod ) {
-					ZT( ZoneNum ) = ( AirCap * ZoneT1( ZoneNum ) + TempIndCoef ) / ( AirCap + TempDepCoef );
-				}}
+				ZT( ZoneNum ) = SolveZoneAirTemp( ZoneNum, AirCap, TempDepCoef, TempIndCoef );
 
 				// No sensible load
 				SNLoad = 0.0;
@@ -3695,7 +3694,7 @@ namespace ZoneTempPredictorCorrector {
 			SNLoadCoolEnergy( ZoneNum ) = std::abs( min( SNLoad, 0.0 ) * TimeStepSys * SecInHour );
 
 			// Final humidity calcs
-			CorrectZoneHumRat( ZoneNum, controlledZoneEquipConfigNums );
+			CorrectZoneHumRat( ZoneNum );
 
 			ZoneAirHumRat( ZoneNum ) = ZoneAirHumRatTemp( ZoneNum );
 			ZoneAirRelHum( ZoneNum ) = 100.0 * PsyRhFnTdbWPb( ZT( ZoneNum ), ZoneAirHumRat( ZoneNum ), OutBaroPress, RoutineName );
@@ -3736,7 +3735,12 @@ namespace ZoneTempPredictorCorrector {
 				}
 			}}
 
-			CalcZoneComponentLoadSums( ZoneNum, TempDepCoef, TempIndCoef, ZnAirRpt( ZoneNum ).SumIntGains, ZnAirRpt( ZoneNum ).SumHADTsurfs, ZnAirRpt( ZoneNum ).SumMCpDTzones, ZnAirRpt( ZoneNum ).SumMCpDtInfil, ZnAirRpt( ZoneNum ).SumMCpDTsystem, ZnAirRpt( ZoneNum ).SumNonAirSystem, ZnAirRpt( ZoneNum ).CzdTdt, ZnAirRpt( ZoneNum ).imBalance, controlledZoneEquipConfigNums ); // convection part of internal gains | surface convection heat transfer | interzone mixing | OA of various kinds except via system | air system | non air system | air mass energy storage term | measure of imbalance in zone air heat balance
+			// ZoneTempLocalError is used by HVACManager to size the system timestep when AdaptiveSystemTimestep is on.
+			// It is the predictor/corrector difference: how far the corrected temperature moved from the temperature
+			// PredictSystemLoads expected, because the loads or the system response changed over the timestep.
+			ZoneTempLocalError = max( ZoneTempLocalError, std::abs( ZT( ZoneNum ) - ZTPredicted( ZoneNum ) ) );
+
+			CalcZoneComponentLoadSums( ZoneNum, TempDepCoef, TempIndCoef, ZnAirRpt( ZoneNum ).SumIntGains, ZnAirRpt( ZoneNum ).SumHADTsurfs, ZnAirRpt( ZoneNum ).SumMCpDTzones, ZnAirRpt( ZoneNum ).SumMCpDtInfil, ZnAirRpt( ZoneNum ).SumMCpDTsystem, ZnAirRpt( ZoneNum ).SumNonAirSystem, ZnAirRpt( ZoneNum ).CzdTdt, ZnAirRpt( ZoneNum ).imBalance ); // convection part of internal gains | surface convection heat transfer | interzone mixing | OA of various kinds except via system | air system | non air system | air mass energy storage term | measure of imbalance in zone air heat balance
 
 		} // ZoneNum
 
@@ -3999,10 +4003,112 @@ namespace ZoneTempPredictorCorrector {
 	}
 
 	void
-	CorrectZoneHumRat(
-		int const ZoneNum,
-		std::vector< int > const & controlledZoneEquipConfigNums // Precomputed controlled equip nums
+	SetupZoneAirSumsLookup()
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Build the per-zone lookups used by CalcZoneSums, CalcZoneComponentLoadSums and
+		// CorrectZoneHumRat so that each zone's heat balance sums no longer search the plenum
+		// lists or step over non-heat transfer surfaces on every call.
+
+		// METHODOLOGY EMPLOYED:
+		// The heat transfer surfaces of all zones are gathered once into one contiguous list,
+		// zone by zone and in surface order (compressed row storage), so the surface sums are
+		// accumulated in exactly the same order as before.  The plenum lookups are rebuilt
+		// whenever the number of plenums changes, since the plenum input is read on the first
+		// air loop simulation, after the zone air heat balance has already been called.
+
+		// Using/Aliasing
+		using DataSurfaces::Surface;
+		using ZonePlenum::ZoneRetPlenCond;
+		using ZonePlenum::ZoneSupPlenCond;
+		using ZonePlenum::NumZoneReturnPlenums;
+		using ZonePlenum::NumZoneSupplyPlenums;
+
+		// Locals
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int ZoneNum;
+		int SurfNum;
+		int PlenumNum;
+		int NumHTSurfaces;
+
+		// FLOW:
+		if ( ! allocated( ZoneHTSurfaceStart ) ) {
+			ZoneHTSurfaceStart.allocate( NumOfZones + 1 );
+			NumHTSurfaces = 0;
+			for ( ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum ) {
+				for ( SurfNum = Zone( ZoneNum ).SurfaceFirst; SurfNum <= Zone( ZoneNum ).SurfaceLast; ++SurfNum ) {
+					if ( Surface( SurfNum ).HeatTransSurf ) ++NumHTSurfaces;
+				}
+			}
+			ZoneHTSurfaceList.allocate( NumHTSurfaces );
+			NumHTSurfaces = 0;
+			for ( ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum ) {
+				ZoneHTSurfaceStart( ZoneNum ) = NumHTSurfaces + 1;
+				for ( SurfNum = Zone( ZoneNum ).SurfaceFirst; SurfNum <= Zone( ZoneNum ).SurfaceLast; ++SurfNum ) {
+					if ( ! Surface( SurfNum ).HeatTransSurf ) continue;
+					++NumHTSurfaces;
+					ZoneHTSurfaceList( NumHTSurfaces ) = SurfNum;
+				}
+			}
+			ZoneHTSurfaceStart( NumOfZones + 1 ) = NumHTSurfaces + 1;
+		}
+
+		if ( ZoneAirSumsNumPlenums != NumZoneReturnPlenums + NumZoneSupplyPlenums ) {
+			ZoneRetPlenumIndex.dimension( NumOfZones, 0 );
+			ZoneSupPlenumIndex.dimension( NumOfZones, 0 );
+			// Keep the first plenum found for a zone, as the former searches did
+			for ( PlenumNum = 1; PlenumNum <= NumZoneReturnPlenums; ++PlenumNum ) {
+				ZoneNum = ZoneRetPlenCond( PlenumNum ).ActualZoneNum;
+				if ( ZoneNum > 0 && ZoneRetPlenumIndex( ZoneNum ) == 0 ) ZoneRetPlenumIndex( ZoneNum ) = PlenumNum;
+			}
+			for ( PlenumNum = 1; PlenumNum <= NumZoneSupplyPlenums; ++PlenumNum ) {
+				ZoneNum = ZoneSupPlenCond( PlenumNum ).ActualZoneNum;
+				if ( ZoneNum > 0 && ZoneSupPlenumIndex( ZoneNum ) == 0 ) ZoneSupPlenumIndex( ZoneNum ) = PlenumNum;
+			}
+			ZoneAirSumsNumPlenums = NumZoneReturnPlenums + NumZoneSupplyPlenums;
+		}
+
+	}
+
+	Real64
+	SolveZoneAirTemp(
+		int const ZoneNum, // Zone number
+		Real64 const AirCap, // Zone air heat capacity per system timestep
+		Real64 const TempDepCoef, // Dependent coefficient
+		Real64 const TempIndCoef // Independent coefficient
 	)
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Solve the zone air heat balance for the new zone air temperature with the
+		// selected solution algorithm (third order backward difference, analytical or Euler).
+
+		// METHODOLOGY EMPLOYED:
+		// The heat balance reduces to AirCap * dT/dt = TempIndCoef - TempDepCoef * T.
+		// Formerly repeated for controlled and uncontrolled zones in CorrectZoneAirTemp.
+
+		// FLOW:
+		{ auto const SELECT_CASE_var( ZoneAirSolutionAlgo );
+		if ( SELECT_CASE_var == Use3rdOrder ) {
+			return ( TempIndCoef + AirCap * ( 3.0 * ZTM1( ZoneNum ) - ( 3.0 / 2.0 ) * ZTM2( ZoneNum ) + ( 1.0 / 3.0 ) * ZTM3( ZoneNum ) ) ) / ( ( 11.0 / 6.0 ) * AirCap + TempDepCoef );
+			// Exact solution
+		} else if ( SELECT_CASE_var == UseAnalyticalSolution ) {
+			if ( TempDepCoef == 0.0 ) { // B=0
+				return ZoneT1( ZoneNum ) + TempIndCoef / AirCap;
+			} else {
+				return ( ZoneT1( ZoneNum ) - TempIndCoef / TempDepCoef ) * std::exp( min( 700.0, -TempDepCoef / AirCap ) ) + TempIndCoef / TempDepCoef;
+			}
+		} else if ( SELECT_CASE_var == UseEulerMethod ) {
+			return ( AirCap * ZoneT1( ZoneNum ) + TempIndCoef ) / ( AirCap + TempDepCoef );
+		}}
+
+		return ZT( ZoneNum );
+
+	}
+
+	void
+	CorrectZoneHumRat( int const ZoneNum )
 	{
 
 		// SUBROUTINE INFORMATION:
@@ -4026,8 +4132,6 @@ namespace ZoneTempPredictorCorrector {
 		using DataZoneEquipment::ZoneEquipConfig;
 		using ZonePlenum::ZoneRetPlenCond;
 		using ZonePlenum::ZoneSupPlenCond;
-		using ZonePlenum::NumZoneReturnPlenums;
-		using ZonePlenum::NumZoneSupplyPlenums;
 		using DataDefineEquip::AirDistUnit;
 		using DataDefineEquip::NumAirDistUnits;
 		using DataSurfaces::Surface;
@@ -4081,29 +4185,16 @@ namespace ZoneTempPredictorCorrector {
 		ZoneMult = Zone( ZoneNum ).Multiplier * Zone( ZoneNum ).ListMultiplier;
 
 		// Check to see if this is a controlled zone
+		// ZoneEquipConfig is indexed by the number of the zone it controls
 		ZoneEquipConfigNum = 0;
-		ControlledZoneAirFlag = false;
-		for ( std::vector< int >::size_type i = 0, e = controlledZoneEquipConfigNums.size(); i < e; ++i ) {
-			if ( ZoneEquipConfig( controlledZoneEquipConfigNums[ i ] ).ActualZoneNum == ZoneNum ) {
-				ZoneEquipConfigNum = controlledZoneEquipConfigNums[ i ];
-				ControlledZoneAirFlag = true;
-				break;
-			}
-		}
+		ControlledZoneAirFlag = Zone( ZoneNum ).IsControlled;
+		if ( ControlledZoneAirFlag ) ZoneEquipConfigNum = ZoneNum;
 
 		// Check to see if this is a plenum zone
-		ZoneRetPlenumAirFlag = false;
-		for ( ZoneRetPlenumNum = 1; ZoneRetPlenumNum <= NumZoneReturnPlenums; ++ZoneRetPlenumNum ) {
-			if ( ZoneRetPlenCond( ZoneRetPlenumNum ).ActualZoneNum != ZoneNum ) continue;
-			ZoneRetPlenumAirFlag = true;
-			break;
-		} // ZoneRetPlenumNum
-		ZoneSupPlenumAirFlag = false;
-		for ( ZoneSupPlenumNum = 1; ZoneSupPlenumNum <= NumZoneSupplyPlenums; ++ZoneSupPlenumNum ) {
-			if ( ZoneSupPlenCond( ZoneSupPlenumNum ).ActualZoneNum != ZoneNum ) continue;
-			ZoneSupPlenumAirFlag = true;
-			break;
-		} // ZoneSupPlenumNum
+		ZoneRetPlenumNum = ZoneRetPlenumIndex( ZoneNum );
+		ZoneRetPlenumAirFlag = ( ZoneRetPlenumNum > 0 );
+		ZoneSupPlenumNum = ZoneSupPlenumIndex( ZoneNum );
+		ZoneSupPlenumAirFlag = ( ZoneSupPlenumNum > 0 );
 
 		if ( ControlledZoneAirFlag ) { // If there is system flow then calculate the flow rates
 
@@ -4350,8 +4441,7 @@ namespace ZoneTempPredictorCorrector {
 		Real64 & SumMCp, // Zone sum of MassFlowRate*Cp
 		Real64 & SumMCpT, // Zone sum of MassFlowRate*Cp*T
 		Real64 & SumSysMCp, // Zone sum of air system MassFlowRate*Cp
-		Real64 & SumSysMCpT, // Zone sum of air system MassFlowRate*Cp*T
-		std::vector< int > const & controlledZoneEquipConfigNums // Precomputed controlled equip nums
+		Real64 & SumSysMCpT // Zone sum of air system MassFlowRate*Cp*T
 	)
 	{
 
@@ -4390,8 +4480,6 @@ namespace ZoneTempPredictorCorrector {
 		using DataZoneEquipment::ZoneEquipConfig;
 		using ZonePlenum::ZoneRetPlenCond;
 		using ZonePlenum::ZoneSupPlenCond;
-		using ZonePlenum::NumZoneReturnPlenums;
-		using ZonePlenum::NumZoneSupplyPlenums;
 		using DataDefineEquip::AirDistUnit;
 		using DataDefineEquip::NumAirDistUnits;
 		using InternalHeatGains::SumAllInternalConvectionGains;
@@ -4456,30 +4544,16 @@ namespace ZoneTempPredictorCorrector {
 		// Sum all system air flow: SumSysMCp, SumSysMCpT
 		// Check to see if this is a controlled zone
 
+		// ZoneEquipConfig is indexed by the number of the zone it controls
 		ZoneEquipConfigNum = 0;
-		ControlledZoneAirFlag = false;
-		for ( std::vector< int >::size_type i = 0, e = controlledZoneEquipConfigNums.size(); i < e; ++i ) {
-			if ( ZoneEquipConfig( controlledZoneEquipConfigNums[ i ] ).ActualZoneNum == ZoneNum ) {
-				ZoneEquipConfigNum = controlledZoneEquipConfigNums[ i ];
-				ControlledZoneAirFlag = true;
-				break;
-			}
-		}
+		ControlledZoneAirFlag = Zone( ZoneNum ).IsControlled;
+		if ( ControlledZoneAirFlag ) ZoneEquipConfigNum = ZoneNum;
 
 		// Check to see if this is a plenum zone
-		// BG feb 2008 repeating this do loop every time seems crazy, store ControlledZoneAirFlag in Zone structure?
-		ZoneRetPlenumAirFlag = false;
-		for ( ZoneRetPlenumNum = 1; ZoneRetPlenumNum <= NumZoneReturnPlenums; ++ZoneRetPlenumNum ) {
-			if ( ZoneRetPlenCond( ZoneRetPlenumNum ).ActualZoneNum != ZoneNum ) continue;
-			ZoneRetPlenumAirFlag = true;
-			break;
-		} // ZoneRetPlenumNum
-		ZoneSupPlenumAirFlag = false;
-		for ( ZoneSupPlenumNum = 1; ZoneSupPlenumNum <= NumZoneSupplyPlenums; ++ZoneSupPlenumNum ) {
-			if ( ZoneSupPlenCond( ZoneSupPlenumNum ).ActualZoneNum != ZoneNum ) continue;
-			ZoneSupPlenumAirFlag = true;
-			break;
-		} // ZoneSupPlenumNum
+		ZoneRetPlenumNum = ZoneRetPlenumIndex( ZoneNum );
+		ZoneRetPlenumAirFlag = ( ZoneRetPlenumNum > 0 );
+		ZoneSupPlenumNum = ZoneSupPlenumIndex( ZoneNum );
+		ZoneSupPlenumAirFlag = ( ZoneSupPlenumNum > 0 );
 
 		// Plenum and controlled zones have a different set of inlet nodes which must be calculated.
 		if ( ControlledZoneAirFlag ) {
@@ -4552,9 +4626,8 @@ namespace ZoneTempPredictorCorrector {
 		SumSysMCpT /= ZoneMult;
 
 		// Sum all surface convection: SumHA, SumHATsurf, SumHATref (and additional contributions to SumIntGain)
-		for ( SurfNum = Zone( ZoneNum ).SurfaceFirst; SurfNum <= Zone( ZoneNum ).SurfaceLast; ++SurfNum ) {
-
-			if ( ! Surface( SurfNum ).HeatTransSurf ) continue; // Skip non-heat transfer surfaces
+		for ( int SurfLoop = ZoneHTSurfaceStart( ZoneNum ), SurfLoop_end = ZoneHTSurfaceStart( ZoneNum + 1 ) - 1; SurfLoop <= SurfLoop_end; ++SurfLoop ) {
+			SurfNum = ZoneHTSurfaceList( SurfLoop ); // Heat transfer surfaces only
 
 			HA = 0.0;
 			Area = Surface( SurfNum ).Area; // For windows, this is the glazing area
@@ -4660,8 +4733,7 @@ namespace ZoneTempPredictorCorrector {
 		Real64 & SumMCpDTsystem, // Zone sum of air system MassFlowRate*Cp*(Tsup - Tz)
 		Real64 & SumNonAirSystem, // Zone sum of non air system convective heat gains
 		Real64 & CzdTdt, // Zone air energy storage term.
-		Real64 & imBalance, // put all terms in eq. 5 on RHS , should be zero
-		std::vector< int > const & controlledZoneEquipConfigNums // Precomputed controlled equip nums
+		Real64 & imBalance // put all terms in eq. 5 on RHS , should be zero
 	)
 	{
 
@@ -4698,8 +4770,6 @@ namespace ZoneTempPredictorCorrector {
 		using DataZoneEquipment::ZoneEquipConfig;
 		using ZonePlenum::ZoneRetPlenCond;
 		using ZonePlenum::ZoneSupPlenCond;
-		using ZonePlenum::NumZoneReturnPlenums;
-		using ZonePlenum::NumZoneSupplyPlenums;
 		using DataDefineEquip::AirDistUnit;
 		using DataDefineEquip::NumAirDistUnits;
 		using General::RoundSigDigits;
@@ -4776,29 +4846,16 @@ namespace ZoneTempPredictorCorrector {
 		// Check to see if this is a controlled zone
 
 		// CR 7384 continuation needed below.  eliminate do loop for speed and clarity
+		// ZoneEquipConfig is indexed by the number of the zone it controls
 		ZoneEquipConfigNum = 0;
-		ControlledZoneAirFlag = false;
-		for ( std::vector< int >::size_type i = 0, e = controlledZoneEquipConfigNums.size(); i < e; ++i ) {
-			if ( ZoneEquipConfig( controlledZoneEquipConfigNums[ i ] ).ActualZoneNum == ZoneNum ) {
-				ZoneEquipConfigNum = controlledZoneEquipConfigNums[ i ];
-				ControlledZoneAirFlag = true;
-				break;
-			}
-		}
+		ControlledZoneAirFlag = Zone( ZoneNum ).IsControlled;
+		if ( ControlledZoneAirFlag ) ZoneEquipConfigNum = ZoneNum;
 
 		// Check to see if this is a plenum zone
-		ZoneRetPlenumAirFlag = false;
-		for ( ZoneRetPlenumNum = 1; ZoneRetPlenumNum <= NumZoneReturnPlenums; ++ZoneRetPlenumNum ) {
-			if ( ZoneRetPlenCond( ZoneRetPlenumNum ).ActualZoneNum != ZoneNum ) continue;
-			ZoneRetPlenumAirFlag = true;
-			break;
-		} // ZoneRetPlenumNum
-		ZoneSupPlenumAirFlag = false;
-		for ( ZoneSupPlenumNum = 1; ZoneSupPlenumNum <= NumZoneSupplyPlenums; ++ZoneSupPlenumNum ) {
-			if ( ZoneSupPlenCond( ZoneSupPlenumNum ).ActualZoneNum != ZoneNum ) continue;
-			ZoneSupPlenumAirFlag = true;
-			break;
-		} // ZoneSupPlenumNum
+		ZoneRetPlenumNum = ZoneRetPlenumIndex( ZoneNum );
+		ZoneRetPlenumAirFlag = ( ZoneRetPlenumNum > 0 );
+		ZoneSupPlenumNum = ZoneSupPlenumIndex( ZoneNum );
+		ZoneSupPlenumAirFlag = ( ZoneSupPlenumNum > 0 );
 
 		// Plenum and controlled zones have a different set of inlet nodes which must be calculated.
 		if ( ControlledZoneAirFlag ) {
@@ -4855,9 +4912,8 @@ namespace ZoneTempPredictorCorrector {
 		SumNonAirSystem = NonAirSystemResponse( ZoneNum ) + SumConvHTRadSys( ZoneNum ) + SumConvPool( ZoneNum );
 
 		// Sum all surface convection: SumHA, SumHATsurf, SumHATref (and additional contributions to SumIntGain)
-		for ( SurfNum = Zone( ZoneNum ).SurfaceFirst; SurfNum <= Zone( ZoneNum ).SurfaceLast; ++SurfNum ) {
-
-			if ( ! Surface( SurfNum ).HeatTransSurf ) continue; // Skip non-heat transfer surfaces
+		for ( int SurfLoop = ZoneHTSurfaceStart( ZoneNum ), SurfLoop_end = ZoneHTSurfaceStart( ZoneNum + 1 ) - 1; SurfLoop <= SurfLoop_end; ++SurfLoop ) {
+			SurfNum = ZoneHTSurfaceList( SurfLoop ); // Heat transfer surfaces only
 
 			Area = Surface( SurfNum ).Area; // For windows, this is the glazing area
 			// determine reference air temperature for this surface's convective heat transfer model
@@ -1,9 +1,6 @@
 #ifndef ZoneTempPredictorCorrector_hh_INCLUDED
 #define ZoneTempPredictorCorrector_hh_INCLUDED
 
-// C++ Headers
-#include <vector>
-
 // ObjexxFCL Headers
 #include <ObjexxFCL/FArray1D.hh>
 #include <ObjexxFCL/FArray2D.hh>
@@ -89,12 +86,21 @@ namespace ZoneTempPredictorCorrector {
 	extern FArray1D< Real64 > ZoneSetPointLast;
 	extern FArray1D< Real64 > TempIndZnLd;
 	extern FArray1D< Real64 > TempDepZnLd;
+	extern FArray1D< Real64 > ZTPredicted; // Zone air temperature of the predict step, with the system heat of the last system timestep
 	extern FArray1D< Real64 > ZoneAirRelHum; // Zone relative humidity in percent
 
 	// Zone temperature history - used only for oscillation test
 	extern FArray2D< Real64 > ZoneTempHist;
 	extern FArray1D< Real64 > ZoneTempOscillate;
 	extern Real64 AnyZoneTempOscillate;
+	extern Real64 ZoneTempLocalError; // Largest zone air temperature local error estimate of the last correct step
+
+	// Zone air heat balance lookups - see SetupZoneAirSumsLookup
+	extern FArray1D_int ZoneRetPlenumIndex; // ZoneRetPlenCond index of each zone (0 if not a return plenum)
+	extern FArray1D_int ZoneSupPlenumIndex; // ZoneSupPlenCond index of each zone (0 if not a supply plenum)
+	extern FArray1D_int ZoneHTSurfaceStart; // Start of each zone's surfaces in ZoneHTSurfaceList (NumOfZones + 1)
+	extern FArray1D_int ZoneHTSurfaceList; // Heat transfer surface numbers, grouped by zone
+	extern int ZoneAirSumsNumPlenums; // Plenum count the plenum lookups were built for (-1 before setup)
 
 	// SUBROUTINE SPECIFICATIONS:
 
@@ -239,11 +245,19 @@ namespace ZoneTempPredictorCorrector {
 	RevertZoneTimestepHistories();
 
 	void
-	CorrectZoneHumRat(
-		int const ZoneNum,
-		std::vector< int > const & controlledZoneEquipConfigNums // Precomputed controlled equip nums
+	SetupZoneAirSumsLookup();
+
+	Real64
+	SolveZoneAirTemp(
+		int const ZoneNum, // Zone number
+		Real64 const AirCap, // Zone air heat capacity per system timestep
+		Real64 const TempDepCoef, // Dependent coefficient
+		Real64 const TempIndCoef // Independent coefficient
 	);
 
+	void
+	CorrectZoneHumRat( int const ZoneNum );
+
 	void
 	DownInterpolate4HistoryValues(
 		Real64 const OldTimeStep,
@@ -270,8 +284,7 @@ namespace ZoneTempPredictorCorrector {
 		Real64 & SumMCp, // Zone sum of MassFlowRate*Cp
 		Real64 & SumMCpT, // Zone sum of MassFlowRate*Cp*T
 		Real64 & SumSysMCp, // Zone sum of air system MassFlowRate*Cp
-		Real64 & SumSysMCpT, // Zone sum of air system MassFlowRate*Cp*T
-		std::vector< int > const & controlledZoneEquipConfigNums // Precomputed controlled equip nums
+		Real64 & SumSysMCpT // Zone sum of air system MassFlowRate*Cp*T
 	);
 
 	void
@@ -286,8 +299,7 @@ namespace ZoneTempPredictorCorrector {
 		Real64 & SumMCpDTsystem, // Zone sum of air system MassFlowRate*Cp*(Tsup - Tz)
 		Real64 & SumNonAirSystem, // Zone sum of non air system convective heat gains
 		Real64 & CzdTdt, // Zone air energy storage term.
-		Real64 & imBalance, // put all terms in eq. 5 on RHS , should be zero
-		std::vector< int > const & controlledZoneEquipConfigNums // Precomputed controlled equip nums
+		Real64 & imBalance // put all terms in eq. 5 on RHS , should be zero
 	);
 
 	bool
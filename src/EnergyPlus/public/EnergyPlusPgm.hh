@@ -14,6 +14,10 @@
 	void ENERGYPLUSLIB_API
 	EnergyPlusPgm( std::string const & filepath = std::string() );
 
+	// Run again in this process; throws std::runtime_error while some modules cannot clear their state
+	void ENERGYPLUSLIB_API
+	EnergyPlusPgmRunAgain( std::string const & filepath = std::string() );
+
 	void ENERGYPLUSLIB_API
 	StoreProgressCallback( void ( *f )( int const ) );
 
@@ -0,0 +1,122 @@
+// EnergyPlus::CommandLineInterface Unit Tests
+
+// C++ Headers
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/CommandLineInterface.hh>
+#include <EnergyPlus/DataGlobals.hh>
+#include <EnergyPlus/DataStringGlobals.hh>
+#include <EnergyPlus/FileSystem.hh>
+
+#ifndef _WIN32
+#include <unistd.h>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::CommandLineInterface;
+using namespace EnergyPlus::FileSystem;
+
+TEST( CommandLineInterfaceTest, ReadBatchManifest )
+{
+	makeDirectory( "batchtest" );
+	std::ofstream( "batchtest/a.idf" ) << "!\n";
+	std::ofstream( "batchtest/b.idf" ) << "!\n";
+	std::ofstream( "batchtest/w.epw" ) << "!\n";
+	std::string const savedWeatherFileName( DataStringGlobals::inputWeatherFileName );
+	DataStringGlobals::inputWeatherFileName = "batchtest/missing.epw";
+	DataGlobals::DDOnlySimulation = false;
+
+	// blank and comment lines are skipped; paths are relative to the working directory
+	{
+		std::ofstream manifest( "batchtest/jobs.txt" );
+		manifest << "# batch test\n\n";
+		manifest << "batchtest/a.idf ! default weather and output directory\n";
+		manifest << "   \n";
+		manifest << "batchtest/b.idf, \"batchtest/w.epw\", batchtest/out_b\n";
+	}
+	batchJobs.clear();
+	ReadBatchManifest( "batchtest/jobs.txt", "batchtest/", false );
+	ASSERT_EQ( 2u, batchJobs.size() );
+	EXPECT_EQ( 3, batchJobs[ 0 ].manifestLine );
+	EXPECT_EQ( getAbsolutePath( "batchtest/a.idf" ), batchJobs[ 0 ].inputFileName );
+	EXPECT_EQ( getAbsolutePath( "batchtest/missing.epw" ), batchJobs[ 0 ].weatherFileName );
+	EXPECT_EQ( getAbsolutePath( "batchtest/a" ) + DataStringGlobals::pathChar, batchJobs[ 0 ].outputDirectory );
+	EXPECT_TRUE( directoryExists( "batchtest/a" ) );
+	EXPECT_EQ( 5, batchJobs[ 1 ].manifestLine );
+	EXPECT_EQ( getAbsolutePath( "batchtest/w.epw" ), batchJobs[ 1 ].weatherFileName );
+	EXPECT_EQ( getAbsolutePath( "batchtest/out_b" ) + DataStringGlobals::pathChar, batchJobs[ 1 ].outputDirectory );
+
+	// a missing default weather file is an error only when it was given with -w
+	batchJobs.clear();
+	EXPECT_EXIT( ReadBatchManifest( "batchtest/jobs.txt", "batchtest/", true ), ::testing::ExitedWithCode( EXIT_FAILURE ), "" );
+	// a missing weather file named in the manifest is always an error
+	std::ofstream( "batchtest/jobs.txt" ) << "batchtest/a.idf, batchtest/missing.epw\n";
+	EXPECT_EXIT( ReadBatchManifest( "batchtest/jobs.txt", "batchtest/", false ), ::testing::ExitedWithCode( EXIT_FAILURE ), "" );
+	// ... unless only the design days are simulated
+	DataGlobals::DDOnlySimulation = true;
+	ReadBatchManifest( "batchtest/jobs.txt", "batchtest/", false );
+	EXPECT_EQ( 1u, batchJobs.size() );
+	// a manifest without jobs
+	batchJobs.clear();
+	std::ofstream( "batchtest/jobs.txt" ) << "! nothing to do\n";
+	EXPECT_EXIT( ReadBatchManifest( "batchtest/jobs.txt", "batchtest/", false ), ::testing::ExitedWithCode( EXIT_FAILURE ), "" );
+
+	batchJobs.clear();
+	DataGlobals::DDOnlySimulation = false;
+	DataStringGlobals::inputWeatherFileName = savedWeatherFileName;
+	for ( auto const & fileName : { "a.idf", "b.idf", "w.epw", "jobs.txt" } ) std::remove( ( std::string( "batchtest/" ) + fileName ).c_str() );
+	rmdir( "batchtest/a" );
+	rmdir( "batchtest/out_b" );
+	rmdir( "batchtest" );
+}
+
+TEST( CommandLineInterfaceTest, FinishBatchJob )
+{
+	EXPECT_EQ( 3, EndFileCount( "EnergyPlus Completed Successfully-- 3 Warning; 0 Severe Errors; Elapsed Time=00hr 00min 10.20sec", " Warning;" ) );
+	EXPECT_EQ( 12, EndFileCount( "EnergyPlus Terminated--Fatal Error Detected. 0 Warning; 12 Severe Errors; Elapsed Time=00hr 00min  1.00sec", " Severe Errors;" ) );
+	EXPECT_EQ( 0, EndFileCount( "", " Warning;" ) );
+
+	// summary fields are quoted with embedded quotes doubled
+	EXPECT_EQ( "\"/runs/a,b/in.idf\"", CSVField( "/runs/a,b/in.idf" ) );
+	EXPECT_EQ( "\"Severe: \"\"ZONE 1\"\" not found\"", CSVField( "Severe: \"ZONE 1\" not found" ) );
+	EXPECT_EQ( "\"\"", CSVField( "" ) );
+
+	// exit status values as returned by waitpid
+	int const exitSuccess = EXIT_SUCCESS << 8;
+	int const exitFailure = EXIT_FAILURE << 8;
+	int const killedBySignal = 9;
+	std::string const endFileName( "batchtest.end" );
+	BatchJob job;
+
+	std::ofstream( endFileName ) << "EnergyPlus Completed Successfully-- 3 Warning; 0 Severe Errors; Elapsed Time=00hr 00min 10.20sec\n";
+	FinishBatchJob( job, endFileName, exitSuccess );
+	EXPECT_TRUE( job.succeeded );
+	EXPECT_EQ( 3, job.numWarnings );
+	EXPECT_EQ( 0, job.numSevere );
+
+	// a failing exit status fails the job, whatever the end file says
+	FinishBatchJob( job, endFileName, exitFailure );
+	EXPECT_FALSE( job.succeeded );
+
+	std::ofstream( endFileName ) << "EnergyPlus Terminated--Fatal Error Detected. 1 Warning; 2 Severe Errors; Elapsed Time=00hr 00min  1.00sec\n";
+	FinishBatchJob( job, endFileName, exitFailure );
+	EXPECT_FALSE( job.succeeded );
+	EXPECT_EQ( 1, job.numWarnings );
+	EXPECT_EQ( 2, job.numSevere );
+
+	// without an end file the message says how the process ended
+	std::remove( endFileName.c_str() );
+	FinishBatchJob( job, endFileName, killedBySignal );
+	EXPECT_FALSE( job.succeeded );
+	EXPECT_EQ( "Terminated by signal 9.", job.message );
+	FinishBatchJob( job, endFileName, exitFailure );
+	EXPECT_EQ( "Ended with exit status 1 without an end file.", job.message );
+	EXPECT_EQ( 0, job.numWarnings );
+}
+
+#endif
@@ -0,0 +1,84 @@
+// EnergyPlus::ConductionTransferFunctionCalc Unit Tests
+
+// C++ Headers
+#include <cstdio>
+#include <fstream>
+#ifdef _WIN32
+#include <process.h>
+#define getpid _getpid
+#else
+#include <unistd.h>
+#endif
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/ConductionTransferFunctionCalc.hh>
+#include <EnergyPlus/DataHeatBalance.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::ConductionTransferFunctionCalc;
+using namespace EnergyPlus::DataHeatBalance;
+using namespace ObjexxFCL;
+
+TEST( ConductionTransferFunctionCalcTest, CTFCache )
+{
+	TotConstructs = 2;
+	Construct.allocate( TotConstructs );
+	Construct( 1 ).NumCTFTerms = 2;
+	Construct( 1 ).NumHistories = 1;
+	Construct( 1 ).CTFTimeStep = 0.25;
+	s.allocate( 3, 4, 3 );
+	e.allocate( 3 );
+	for ( int i = 1; i <= 4; ++i ) {
+		for ( int j = 1; j <= 3; ++j ) {
+			s0( i, j ) = 10.0 * i + j;
+			for ( int HistTerm = 1; HistTerm <= 2; ++HistTerm ) s( HistTerm, i, j ) = 100.0 * HistTerm + 10.0 * i + j;
+		}
+	}
+	e( 1 ) = 0.5;
+	e( 2 ) = 0.25;
+
+	CTFCacheRecord Record;
+	SaveCTFCacheRecord( Record, 1 );
+	EXPECT_EQ( 2, Record.NumCTFTerms );
+	EXPECT_EQ( 12u * 3u + 2u, Record.Coefficients.size() );
+
+	// write the cache, read it back and restore the CTFs into a second construction
+	std::string const FileName( "eplusout.ctfcache.tmp" );
+	CTFCacheRecords[ "key" ] = Record;
+	EXPECT_TRUE( WriteCTFCacheFile( FileName ) );
+	CTFCacheRecords.clear();
+	EXPECT_TRUE( ReadCTFCacheFile( FileName ) );
+
+	// rewriting replaces the existing file through a temporary file that does not remain
+	CTFCacheRecords[ "key2" ] = Record;
+	EXPECT_TRUE( WriteCTFCacheFile( FileName ) );
+	EXPECT_FALSE( std::ifstream( FileName + '.' + std::to_string( getpid() ) + ".tmp" ) );
+	CTFCacheRecords.clear();
+	EXPECT_TRUE( ReadCTFCacheFile( FileName ) );
+	EXPECT_EQ( 2u, CTFCacheRecords.size() );
+	std::remove( FileName.c_str() );
+	ASSERT_EQ( 1u, CTFCacheRecords.count( "key" ) );
+	s = 0.0;
+	s0 = 0.0;
+	e = 0.0;
+	RestoreCTFCacheRecord( CTFCacheRecords[ "key" ], 2 );
+	EXPECT_EQ( 2, Construct( 2 ).NumCTFTerms );
+	EXPECT_EQ( 1, Construct( 2 ).NumHistories );
+	EXPECT_DOUBLE_EQ( 0.25, Construct( 2 ).CTFTimeStep );
+	EXPECT_DOUBLE_EQ( 43.0, s0( 4, 3 ) );
+	EXPECT_DOUBLE_EQ( 221.0, s( 2, 2, 1 ) );
+	EXPECT_DOUBLE_EQ( 0.25, e( 2 ) );
+	EXPECT_TRUE( SameCTFCacheRecord( Record, CTFCacheRecords[ "key" ] ) );
+
+	// a missing file is an empty cache; a changed coefficient is a mismatch
+	EXPECT_TRUE( ReadCTFCacheFile( FileName ) );
+	CTFCacheRecords[ "key" ].Coefficients[ 5 ] += 1.0e-3;
+	EXPECT_FALSE( SameCTFCacheRecord( Record, CTFCacheRecords[ "key" ] ) );
+
+	ConductionTransferFunctionCalc::clear_state();
+	Construct.deallocate();
+	TotConstructs = 0;
+}
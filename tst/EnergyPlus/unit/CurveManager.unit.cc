@@ -0,0 +1,70 @@
+// EnergyPlus::CurveManager Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/CurveManager.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::CurveManager;
+using namespace ObjexxFCL;
+
+TEST( CurveManagerTest, FindTableLowPtrMatchesLinearScan )
+{
+	// Ascending axis with a repeated value, as can occur in user tables
+	FArray1D< Real64 > X( { 0.0, 0.5, 1.0, 1.0, 2.0, 3.5, 7.0, 10.0 } );
+	int const NumPts( X.isize() );
+	int LowPtrHint( 1 );
+
+	for ( Real64 V = 0.01; V < 10.0; V += 0.037 ) {
+		int LinearPtr( 0 );
+		for ( int i = 1; i <= NumPts; ++i ) {
+			if ( V >= X( i ) ) LinearPtr = i;
+		}
+		EXPECT_EQ( LinearPtr, FindTableLowPtr( V, X, true, LowPtrHint ) );
+		EXPECT_EQ( LinearPtr, FindTableLowPtr( V, X, false, LowPtrHint ) );
+	}
+	// Exact axis values and a stale hint from the other end of the table
+	LowPtrHint = NumPts - 1;
+	EXPECT_EQ( 4, FindTableLowPtr( 1.0, X, true, LowPtrHint ) );
+	EXPECT_EQ( 4, LowPtrHint );
+	EXPECT_EQ( 5, FindTableLowPtr( 2.0, X, true, LowPtrHint ) );
+	EXPECT_EQ( 5, LowPtrHint );
+}
+
+TEST( CurveManagerTest, CurveValueBatchMatchesCurveValue )
+{
+	NumCurves = 1;
+	PerfCurve.allocate( 1 );
+	TableLookup.allocate( 1 );
+	PerfCurveTableData.allocate( 1 );
+
+	PerfCurve( 1 ).Name = "TABLE1";
+	PerfCurve( 1 ).InterpolationType = LinearInterpolationOfTable;
+	PerfCurve( 1 ).TableIndex = 1;
+	PerfCurve( 1 ).Var1Min = 0.0;
+	PerfCurve( 1 ).Var1Max = 4.0;
+	TableLookup( 1 ).NumIndependentVars = 1;
+	PerfCurveTableData( 1 ).X1 = FArray1D< Real64 >( { 0.0, 1.0, 2.0, 4.0 } );
+	PerfCurveTableData( 1 ).Y.allocate( 4, 1 );
+	PerfCurveTableData( 1 ).Y( _, 1 ) = FArray1D< Real64 >( { 1.0, 3.0, 2.0, 6.0 } );
+	SetupTableLookupAxes();
+	EXPECT_TRUE( PerfCurveTableData( 1 ).X1Ascending );
+	EXPECT_DOUBLE_EQ( 4.0, PerfCurveTableData( 1 ).X1High );
+
+	FArray1D< Real64 > Var1( { -1.0, 0.5, 1.0, 1.5, 3.0, 3.0, 0.25, 5.0 } );
+	FArray1D< Real64 > Result( Var1.isize() );
+	CurveValueBatch( 1, Var1, Result );
+	for ( int i = 1; i <= Var1.isize(); ++i ) {
+		EXPECT_DOUBLE_EQ( CurveValue( 1, Var1( i ) ), Result( i ) );
+	}
+	EXPECT_DOUBLE_EQ( 2.0, Result( 2 ) );
+	EXPECT_DOUBLE_EQ( 4.0, Result( 5 ) );
+	EXPECT_DOUBLE_EQ( 6.0, PerfCurve( 1 ).CurveOutput );
+
+	clear_state();
+	EXPECT_EQ( 0, NumCurves );
+	EXPECT_TRUE( GetCurvesInputFlag );
+	EXPECT_EQ( 0u, PerfCurve.size() );
+}
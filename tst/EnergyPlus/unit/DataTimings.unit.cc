@@ -0,0 +1,58 @@
+// EnergyPlus::DataTimings Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/DataSystemVariables.hh>
+#include <EnergyPlus/DataTimings.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::DataTimings;
+using namespace ObjexxFCL;
+
+TEST( DataTimingsTest, HVACProfileTree )
+{
+	// Nothing is recorded unless profiling is requested
+	DataSystemVariables::HVACProfiling = false;
+	epStartHVACProfile( "SimHVAC" );
+	epStopHVACProfile( 1 );
+	EXPECT_EQ( 0, NumHVACProfileNodes );
+
+	DataSystemVariables::HVACProfiling = true;
+	for ( int Iter = 1; Iter <= 3; ++Iter ) {
+		epStartHVACProfile( "SimHVAC" );
+		epStartHVACProfile( "AIR LOOP 1" );
+		epStartHVACProfile( "COOLING COIL" );
+		epStopHVACProfile();
+		epStopHVACProfile( Iter );
+		epStartHVACProfile( "COOLING COIL" );
+		epStopHVACProfile();
+		epStopHVACProfile( 2 * Iter );
+	}
+
+	// Root, SimHVAC, the air loop and the coil under each of its two callers
+	EXPECT_EQ( 5, NumHVACProfileNodes );
+	EXPECT_EQ( 1, CurHVACProfileNode );
+	EXPECT_EQ( "SimHVAC", HVACProfile( 2 ).Name );
+	EXPECT_EQ( 1, HVACProfile( 2 ).Parent );
+	EXPECT_EQ( 3, HVACProfile( 2 ).Calls );
+	EXPECT_EQ( 12, HVACProfile( 2 ).Iterations );
+	EXPECT_EQ( 6, HVACProfile( 2 ).MaxIterations );
+	EXPECT_EQ( "AIR LOOP 1", HVACProfile( 3 ).Name );
+	EXPECT_EQ( 2, HVACProfile( 3 ).Parent );
+	EXPECT_EQ( 6, HVACProfile( 3 ).Iterations );
+	EXPECT_EQ( 3, HVACProfile( 3 ).MaxIterations );
+	EXPECT_EQ( 3, HVACProfile( 4 ).Parent );
+	EXPECT_EQ( 2, HVACProfile( 5 ).Parent );
+	EXPECT_EQ( 3, HVACProfile( 5 ).Calls );
+	EXPECT_EQ( 0, HVACProfile( 5 ).Iterations );
+	EXPECT_GE( HVACProfile( 2 ).TimeSum, HVACProfile( 3 ).TimeSum + HVACProfile( 5 ).TimeSum );
+
+	// An unmatched stop at the root is ignored
+	epStopHVACProfile();
+	EXPECT_EQ( 1, CurHVACProfileNode );
+
+	DataSystemVariables::HVACProfiling = false;
+	DataTimings::clear_state();
+}
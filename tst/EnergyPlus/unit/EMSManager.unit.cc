@@ -0,0 +1,75 @@
+// EnergyPlus::EMSManager Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/DataGlobals.hh>
+#include <EnergyPlus/DataRuntimeLanguage.hh>
+#include <EnergyPlus/EMSManager.hh>
+#include <EnergyPlus/RuntimeLanguageProcessor.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::DataGlobals;
+using namespace EnergyPlus::DataRuntimeLanguage;
+using namespace EnergyPlus::EMSManager;
+using namespace EnergyPlus::RuntimeLanguageProcessor;
+using namespace ObjexxFCL;
+
+TEST( EMSManagerTest, CallingPointDispatchTable )
+{
+	NumSensors = 3;
+	Sensor.allocate( NumSensors );
+	Sensor( 1 ).VariableNum = NewEMSVariable( "S1", 0 );
+	Sensor( 2 ).VariableNum = NewEMSVariable( "S2", 0 );
+	Sensor( 3 ).VariableNum = NewEMSVariable( "S3", 0 );
+
+	NumErlStacks = 2;
+	ErlStack.allocate( NumErlStacks );
+	ErlStack( 1 ).Name = "MAINPROGRAM";
+	ErlStack( 1 ).Line = FArray1D_string( { "SET A = S1 + 1", "RUN SUBPROGRAM" } );
+	ErlStack( 1 ).NumLines = ErlStack( 1 ).Line.isize();
+	ErlStack( 2 ).Name = "SUBPROGRAM";
+	ErlStack( 2 ).Line = FArray1D_string( { "IF S2 > 0", "SET S3 = 1", "RUN MAINPROGRAM", "ENDIF" } );
+	ErlStack( 2 ).NumLines = ErlStack( 2 ).Line.isize();
+	ParseStack( 1 );
+	ParseStack( 2 );
+	ASSERT_EQ( 0, ErlStack( 1 ).NumErrors );
+	ASSERT_EQ( 0, ErlStack( 2 ).NumErrors );
+
+	NumProgramCallManagers = 1;
+	EMSProgramCallManager.allocate( NumProgramCallManagers );
+	EMSProgramCallManager( 1 ).CallingPoint = emsCallFromBeginTimestepBeforePredictor;
+	EMSProgramCallManager( 1 ).NumErlPrograms = 1;
+	EMSProgramCallManager( 1 ).ErlProgramARR = FArray1D_int( 1, 1 );
+
+	SetupEMSCallingPoints();
+
+	// the program and its subroutine read S1 and S2; S3 is only written
+	EXPECT_EQ( 1, EMSCallingPoint( emsCallFromBeginTimestepBeforePredictor ).NumErlPrograms );
+	EXPECT_EQ( 1, EMSCallingPoint( emsCallFromBeginTimestepBeforePredictor ).ErlProgramARR( 1 ) );
+	ASSERT_EQ( 2, EMSCallingPoint( emsCallFromBeginTimestepBeforePredictor ).NumSensors );
+	EXPECT_EQ( 1, EMSCallingPoint( emsCallFromBeginTimestepBeforePredictor ).SensorARR( 1 ) );
+	EXPECT_EQ( 2, EMSCallingPoint( emsCallFromBeginTimestepBeforePredictor ).SensorARR( 2 ) );
+	EXPECT_FALSE( EMSCallingPoint( emsCallFromBeginTimestepBeforePredictor ).SkipCall );
+
+	// empty calling points are skipped, except those whose calls also set up or refresh EMS data
+	EXPECT_EQ( 0, EMSCallingPoint( emsCallFromHVACIterationLoop ).NumErlPrograms );
+	EXPECT_EQ( 0, EMSCallingPoint( emsCallFromHVACIterationLoop ).NumSensors );
+	EXPECT_TRUE( EMSCallingPoint( emsCallFromHVACIterationLoop ).SkipCall );
+	EXPECT_FALSE( EMSCallingPoint( emsCallFromZoneSizing ).SkipCall );
+	EXPECT_FALSE( EMSCallingPoint( emsCallFromBeginNewEvironment ).SkipCall );
+	EXPECT_FALSE( EMSCallingPoint( emsCallFromUserDefinedComponentModel ).SkipCall );
+
+	EMSCallingPoint.deallocate();
+	EMSProgramCallManager.deallocate();
+	Sensor.deallocate();
+	ErlStack.deallocate();
+	ErlVariable.deallocate();
+	ErlExpression.deallocate();
+	NumProgramCallManagers = 0;
+	NumSensors = 0;
+	NumErlStacks = 0;
+	NumErlVariables = 0;
+	NumExpressions = 0;
+}
@@ -0,0 +1,62 @@
+// EnergyPlus::FluidProperties Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/FluidProperties.hh>
+#include <EnergyPlus/DataSystemVariables.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::FluidProperties;
+using namespace ObjexxFCL;
+
+TEST( FluidPropertiesTest, IndexGridMatchesBinarySearch )
+{
+	// Non-uniform ascending table like the refrigerant saturation temperatures
+	FArray1D< Real64 > Temps( { -70.0, -60.0, -50.0, -45.0, -40.0, -38.0, -36.5, -35.0, -20.0, 0.0, 0.5, 1.0, 15.0, 30.0, 60.0, 100.0 } );
+	int const NumPts( Temps.isize() );
+
+	for ( int LowBound = 1; LowBound <= 3; ++LowBound ) {
+		for ( int UpperBound = NumPts - 2; UpperBound <= NumPts; ++UpperBound ) {
+			FluidPropsIndexGrid Grid;
+			InitializeIndexGrid( Grid, Temps, LowBound, UpperBound );
+			EXPECT_EQ( LowBound, Grid.LowBound );
+			EXPECT_EQ( UpperBound, Grid.UpperBound );
+			EXPECT_FALSE( Grid.CellLoIndex.empty() );
+
+			// Every table point, points just either side and a fine sweep including out of range values
+			for ( int i = 1; i <= NumPts; ++i ) {
+				for ( Real64 const Offset : { -1.0e-9, 0.0, 1.0e-9 } ) {
+					Real64 const Value( Temps( i ) + Offset );
+					EXPECT_EQ( FindArrayIndex( Value, Temps, LowBound, UpperBound ), FindArrayIndex( Value, Temps, Grid ) );
+				}
+			}
+			for ( Real64 Value = -80.0; Value <= 110.0; Value += 0.0173 ) {
+				EXPECT_EQ( FindArrayIndex( Value, Temps, LowBound, UpperBound ), FindArrayIndex( Value, Temps, Grid ) );
+			}
+		}
+	}
+}
+
+TEST( FluidPropertiesTest, IndexGridFallsBackToBinarySearch )
+{
+	FArray1D< Real64 > Temps( { 0.0, 10.0, 10.0, 20.0 } ); // Not strictly ascending
+	FluidPropsIndexGrid Grid;
+	InitializeIndexGrid( Grid, Temps, 1, 4 );
+	EXPECT_TRUE( Grid.CellLoIndex.empty() );
+	EXPECT_EQ( FindArrayIndex( 15.0, Temps, 1, 4 ), FindArrayIndex( 15.0, Temps, Grid ) );
+
+	FArray1D< Real64 > Ascending( { 0.0, 10.0, 20.0, 30.0 } );
+	InitializeIndexGrid( Grid, Ascending, 2, 2 ); // Single valid point
+	EXPECT_TRUE( Grid.CellLoIndex.empty() );
+	EXPECT_EQ( 2, FindArrayIndex( 10.0, Ascending, Grid ) );
+
+	DataSystemVariables::FluidPropertyBinarySearch = true;
+	InitializeIndexGrid( Grid, Ascending, 1, 4 );
+	DataSystemVariables::FluidPropertyBinarySearch = false;
+	EXPECT_TRUE( Grid.CellLoIndex.empty() );
+	EXPECT_EQ( 2, FindArrayIndex( 15.0, Ascending, Grid ) );
+	EXPECT_EQ( 0, FindArrayIndex( -1.0, Ascending, Grid ) );
+	EXPECT_EQ( 4, FindArrayIndex( 31.0, Ascending, Grid ) );
+}
@@ -0,0 +1,84 @@
+// EnergyPlus::GroundHeatExchangers Unit Tests
+
+// C++ Headers
+#include <cmath>
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/GroundHeatExchangers.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::GroundHeatExchangers;
+using namespace ObjexxFCL;
+
+TEST( GroundHeatExchangersTest, GFunctionTableAndAggregation )
+{
+	NumVerticalGlhes = 1;
+	VerticalGlhe.allocate( NumVerticalGlhes );
+	VerticalGlhe( 1 ).NPairs = 4;
+	VerticalGlhe( 1 ).LNTTS.dimension( 4, 0.0 );
+	VerticalGlhe( 1 ).GFNC.dimension( 4, 0.0 );
+	VerticalGlhe( 1 ).LNTTS( 1 ) = -4.0;
+	VerticalGlhe( 1 ).LNTTS( 2 ) = -2.0;
+	VerticalGlhe( 1 ).LNTTS( 3 ) = 0.0;
+	VerticalGlhe( 1 ).LNTTS( 4 ) = 2.0;
+	VerticalGlhe( 1 ).GFNC( 1 ) = 1.0;
+	VerticalGlhe( 1 ).GFNC( 2 ) = 3.0;
+	VerticalGlhe( 1 ).GFNC( 3 ) = 4.0;
+	VerticalGlhe( 1 ).GFNC( 4 ) = 4.5;
+	VerticalGlhe( 1 ).BoreholeRadius = 0.05;
+	VerticalGlhe( 1 ).BoreholeLength = 100.0;
+	VerticalGlhe( 1 ).gReferenceRatio = 0.05 / 100.0;
+	SetupGFunctionTable( 1 );
+	EXPECT_DOUBLE_EQ( 0.0, VerticalGlhe( 1 ).GFNCCorrection );
+
+	// interpolation, table points and extrapolation at both ends
+	Real64 GfuncVal;
+	INTERP( 1, -3.0, GfuncVal );
+	EXPECT_DOUBLE_EQ( 2.0, GfuncVal );
+	INTERP( 1, 0.0, GfuncVal );
+	EXPECT_DOUBLE_EQ( 4.0, GfuncVal );
+	INTERP( 1, 1.0, GfuncVal );
+	EXPECT_DOUBLE_EQ( 4.25, GfuncVal );
+	INTERP( 1, 2.0, GfuncVal );
+	EXPECT_DOUBLE_EQ( 4.5, GfuncVal );
+	INTERP( 1, 3.0, GfuncVal );
+	EXPECT_DOUBLE_EQ( 4.75, GfuncVal );
+	INTERP( 1, -5.0, GfuncVal );
+	EXPECT_DOUBLE_EQ( 0.0, GfuncVal );
+
+	// a borehole off the reference ratio shifts the g-function
+	VerticalGlhe( 1 ).BoreholeRadius = 0.1;
+	SetupGFunctionTable( 1 );
+	INTERP( 1, -3.0, GfuncVal );
+	EXPECT_NEAR( 2.0 - std::log( 2.0 ), GfuncVal, 1.0e-12 );
+	VerticalGlhe( 1 ).BoreholeRadius = 0.05;
+	SetupGFunctionTable( 1 );
+
+	// superposition of a short history is exact; a constant load is exact at any length
+	Real64 const TimeSS_Factor( 10.0 );
+	FArray1D< Real64 > Qn( 40, 1.0 );
+	Qn( 1 ) = 2.0;
+	Qn( 2 ) = 1.0;
+	Qn( 3 ) = 3.0;
+	FArray1D< Real64 > QnSum( {0,40}, 0.0 );
+	for ( int J = 1; J <= 40; ++J ) QnSum( J ) = QnSum( J - 1 ) + Qn( J );
+	Real64 Expected( 0.0 );
+	for ( int J = 1; J <= 3; ++J ) {
+		INTERP( 1, std::log( ( 0.5 + J ) / TimeSS_Factor ), GfuncVal );
+		Expected += ( Qn( J ) - ( J < 3 ? Qn( J + 1 ) : 0.5 ) ) * GfuncVal;
+	}
+	EXPECT_NEAR( Expected, SumAggregatedLoads( 1, QnSum, 1, 3, 0.5, 0.5, 1.0, TimeSS_Factor ), 1.0e-12 );
+
+	Qn( 1 ) = 1.0;
+	Qn( 3 ) = 1.0;
+	for ( int J = 1; J <= 40; ++J ) QnSum( J ) = QnSum( J - 1 ) + Qn( J );
+	INTERP( 1, std::log( 40.5 / TimeSS_Factor ), GfuncVal );
+	EXPECT_NEAR( 0.5 * GfuncVal, SumAggregatedLoads( 1, QnSum, 1, 40, 0.5, 0.5, 1.0, TimeSS_Factor ), 1.0e-12 );
+	EXPECT_DOUBLE_EQ( 0.0, SumAggregatedLoads( 1, QnSum, 5, 4, 0.5, 0.5, 1.0, TimeSS_Factor ) );
+
+	VerticalGlhe.deallocate();
+	NumVerticalGlhes = 0;
+}
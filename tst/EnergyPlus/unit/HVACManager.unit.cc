@@ -0,0 +1,44 @@
+// EnergyPlus::HVACManager Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/DataConvergParams.hh>
+#include <EnergyPlus/HVACManager.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::DataConvergParams;
+using namespace EnergyPlus::HVACManager;
+using namespace ObjexxFCL;
+
+TEST( HVACManagerTest, AdaptiveNumOfSysTimeSteps )
+{
+	Real64 const TimeStepZone( 0.25 );
+	int const LimitNumSysSteps( int( TimeStepZone / MinTimeStepSys ) );
+	ASSERT_EQ( 15, LimitNumSysSteps );
+
+	// Within tolerance the full zone timestep is kept
+	EXPECT_EQ( 1, AdaptiveNumOfSysTimeSteps( 0.0, MaxZoneTempLocalError, LimitNumSysSteps ) );
+	EXPECT_EQ( 1, AdaptiveNumOfSysTimeSteps( 0.5 * MaxZoneTempLocalError, MaxZoneTempLocalError, LimitNumSysSteps ) );
+	EXPECT_EQ( 1, AdaptiveNumOfSysTimeSteps( MaxZoneTempLocalError, MaxZoneTempLocalError, LimitNumSysSteps ) );
+
+	// A large error shortens the timestep in proportion to the error
+	EXPECT_EQ( 2, AdaptiveNumOfSysTimeSteps( 1.5 * MaxZoneTempLocalError, MaxZoneTempLocalError, LimitNumSysSteps ) );
+	EXPECT_EQ( 4, AdaptiveNumOfSysTimeSteps( 3.5 * MaxZoneTempLocalError, MaxZoneTempLocalError, LimitNumSysSteps ) );
+
+	// The timestep grows back as the error shrinks
+	int LastNumSteps( LimitNumSysSteps );
+	for ( Real64 LocalError = 20.0 * MaxZoneTempLocalError; LocalError > 0.0; LocalError -= 0.25 * MaxZoneTempLocalError ) {
+		int const NumSteps( AdaptiveNumOfSysTimeSteps( LocalError, MaxZoneTempLocalError, LimitNumSysSteps ) );
+		EXPECT_LE( NumSteps, LastNumSteps );
+		LastNumSteps = NumSteps;
+	}
+	EXPECT_EQ( 1, LastNumSteps );
+
+	// Never more steps than allowed, so the system timestep never drops below MinTimeStepSys
+	EXPECT_EQ( LimitNumSysSteps, AdaptiveNumOfSysTimeSteps( 100.0 * MaxZoneTempLocalError, MaxZoneTempLocalError, LimitNumSysSteps ) );
+	EXPECT_EQ( LimitNumSysSteps, AdaptiveNumOfSysTimeSteps( 1.0e30, MaxZoneTempLocalError, LimitNumSysSteps ) );
+	EXPECT_GE( TimeStepZone / AdaptiveNumOfSysTimeSteps( 1.0e30, MaxZoneTempLocalError, LimitNumSysSteps ), MinTimeStepSys - MinTimeStepTol );
+	EXPECT_EQ( 1, AdaptiveNumOfSysTimeSteps( 100.0 * MaxZoneTempLocalError, MaxZoneTempLocalError, 1 ) );
+}
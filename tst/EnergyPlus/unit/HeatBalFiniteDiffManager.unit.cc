@@ -0,0 +1,141 @@
+// EnergyPlus::HeatBalFiniteDiffManager Unit Tests
+
+// C++ Headers
+#include <algorithm>
+#include <cmath>
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/DataEnvironment.hh>
+#include <EnergyPlus/DataHeatBalance.hh>
+#include <EnergyPlus/DataHeatBalFanSys.hh>
+#include <EnergyPlus/DataHeatBalSurface.hh>
+#include <EnergyPlus/DataMoistureBalance.hh>
+#include <EnergyPlus/DataSurfaces.hh>
+#include <EnergyPlus/HeatBalFiniteDiffManager.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::DataHeatBalance;
+using namespace EnergyPlus::DataHeatBalFanSys;
+using namespace EnergyPlus::DataHeatBalSurface;
+using namespace EnergyPlus::DataMoistureBalance;
+using namespace EnergyPlus::DataSurfaces;
+using namespace EnergyPlus::HeatBalFiniteDiffManager;
+using namespace ObjexxFCL;
+
+TEST( HeatBalFiniteDiffManagerTest, SolveTridiagonal )
+{
+	// 2*X(i) - X(i-1) - X(i+1) = D(i) with the solution X = { 1, 2, 3, 4 }
+	FArray1D< Real64 > A( 4, -1.0 );
+	FArray1D< Real64 > B( 4, 2.0 );
+	FArray1D< Real64 > C( 4, -1.0 );
+	FArray1D< Real64 > D( 4 );
+	D( 1 ) = 0.0;
+	D( 2 ) = 0.0;
+	D( 3 ) = 0.0;
+	D( 4 ) = 5.0;
+	SolveTridiagonal( 4, A, B, C, D );
+	EXPECT_NEAR( 1.0, D( 1 ), 1.0e-12 );
+	EXPECT_NEAR( 2.0, D( 2 ), 1.0e-12 );
+	EXPECT_NEAR( 3.0, D( 3 ), 1.0e-12 );
+	EXPECT_NEAR( 4.0, D( 4 ), 1.0e-12 );
+
+	// a fixed temperature node decouples the rest of the system
+	A = 0.0;
+	B = 1.0;
+	C = 0.0;
+	B( 2 ) = 3.0;
+	A( 2 ) = -1.0;
+	D( 1 ) = 10.0;
+	D( 2 ) = 20.0;
+	D( 3 ) = -4.0;
+	SolveTridiagonal( 3, A, B, C, D );
+	EXPECT_DOUBLE_EQ( 10.0, D( 1 ) );
+	EXPECT_DOUBLE_EQ( 10.0, D( 2 ) );
+	EXPECT_DOUBLE_EQ( -4.0, D( 3 ) );
+}
+
+TEST( HeatBalFiniteDiffManagerTest, DirectSolveMatchesGaussSeidel )
+{
+	// One exterior wall of a single 0.1 m layer with a temperature dependent conductivity
+	int const TotNodes( 5 );
+	int const Delt( 60 );
+	TotSurfaces = 1;
+	Surface.allocate( 1 );
+	Surface( 1 ).Construction = 1;
+	Surface( 1 ).Zone = 1;
+	Surface( 1 ).ExtBoundCond = ExternalEnvironment;
+	Surface( 1 ).HeatTransferAlgorithm = HeatTransferModel_CondFD;
+	Surface( 1 ).Area = 1.0;
+	Construct.allocate( 1 );
+	Construct( 1 ).TotLayers = 1;
+	Construct( 1 ).LayerPoint( 1 ) = 1;
+	Material.allocate( 1 );
+	Material( 1 ).Conductivity = 1.0;
+	Material( 1 ).Density = 2000.0;
+	Material( 1 ).SpecHeat = 900.0;
+	Material( 1 ).Thickness = 0.1;
+	MaterialFD.allocate( 1 );
+	MaterialFD( 1 ).tk1 = 0.02;
+	MaterialFD( 1 ).TempEnth.dimension( 3, 2, -100.0 );
+	MaterialFD( 1 ).TempCond.dimension( 3, 2, -100.0 );
+	ConstructFD.allocate( 1 );
+	ConstructFD( 1 ).TotNodes = TotNodes;
+	ConstructFD( 1 ).DeltaTime = Delt;
+	ConstructFD( 1 ).NodeNumPoint.dimension( 1, TotNodes );
+	ConstructFD( 1 ).DelX.dimension( 1, 0.1 / TotNodes );
+	SurfaceFD.allocate( 1 );
+	auto & surfaceFD( SurfaceFD( 1 ) );
+	for ( auto * a : { &surfaceFD.T, &surfaceFD.TT, &surfaceFD.Rhov, &surfaceFD.RhoT, &surfaceFD.TD, &surfaceFD.TDT, &surfaceFD.TDreport, &surfaceFD.RH, &surfaceFD.EnthOld, &surfaceFD.EnthNew } ) {
+		a->dimension( TotNodes + 1, 10.0 );
+	}
+
+	// Cold outside, warm zone air
+	for ( auto * a : { &QRadSWOutAbs, &QRadSWOutMvIns, &NetLWRadToSurf, &QRadSWInAbs, &QRadThermInAbs, &QHTRadSysSurf, &QHWBaseboardSurf, &QSteamBaseboardSurf, &QElecBaseboardSurf, &HConvExtFD, &HAirFD, &HSkyFD, &HGrndFD, &TempOutsideAirFD, &RhoVaporAirOut, &HConvInFD, &HMassConvInFD, &RhoVaporAirIn, &MAT, &QHeatOutFlux, &OpaqSurfOutsideFaceConductionFlux, &OpaqSurfOutsideFaceConduction, &OpaqSurfInsFaceConductionFlux, &OpaqSurfInsFaceConduction, &QdotRadOutRepPerArea, &QdotRadOutRep, &QRadOutReport } ) {
+		a->dimension( 1, 0.0 );
+	}
+	HConvExtFD( 1 ) = 20.0;
+	TempOutsideAirFD( 1 ) = -5.0;
+	QRadSWOutAbs( 1 ) = 100.0;
+	HConvInFD( 1 ) = 3.0;
+	MAT( 1 ) = 22.0;
+	DataEnvironment::SkyTemp = -5.0;
+	DataEnvironment::IsRain = false;
+	CondFDSchemeType = FullyImplicitFirstOrder;
+	ASSERT_TRUE( DirectSolveApplies( 1, 0.0 ) );
+
+	// Gauss-Seidel sweeps to convergence
+	for ( int Sweep = 1; Sweep <= 10000; ++Sweep ) {
+		surfaceFD.TDTLast = surfaceFD.TDT;
+		CalcNodeHeatBalances( Delt, 1, Sweep, 0.0 );
+		Real64 MaxDelTemp( 0.0 );
+		for ( int i = 1; i <= TotNodes + 1; ++i ) MaxDelTemp = std::max( MaxDelTemp, std::abs( surfaceFD.TDT( i ) - surfaceFD.TDTLast( i ) ) );
+		if ( MaxDelTemp < 1.0e-12 ) break;
+	}
+	FArray1D< Real64 > const TDTGaussSeidel( surfaceFD.TDT );
+
+	// Tridiagonal solve from the same starting temperatures
+	surfaceFD.TDT = surfaceFD.TD;
+	int const NumSolves( CalcNodeTempsDirect( Delt, 1 ) );
+	EXPECT_GT( NumSolves, 1 ); // the conductivity depends on temperature
+	EXPECT_LT( NumSolves, MaxGSiter );
+	for ( int i = 1; i <= TotNodes + 1; ++i ) {
+		EXPECT_NEAR( TDTGaussSeidel( i ), surfaceFD.TDT( i ), 1.0e-3 );
+	}
+	EXPECT_LT( surfaceFD.TDT( 1 ), 10.0 ); // outside face cools
+	EXPECT_GT( surfaceFD.TDT( TotNodes + 1 ), 10.0 ); // inside face warms
+	EXPECT_EQ( 0, surfaceFD.GSloopErrorCount );
+
+	TotSurfaces = 0;
+	Surface.deallocate();
+	Construct.deallocate();
+	Material.deallocate();
+	MaterialFD.deallocate();
+	ConstructFD.deallocate();
+	SurfaceFD.deallocate();
+	for ( auto * a : { &QRadSWOutAbs, &QRadSWOutMvIns, &NetLWRadToSurf, &QRadSWInAbs, &QRadThermInAbs, &QHTRadSysSurf, &QHWBaseboardSurf, &QSteamBaseboardSurf, &QElecBaseboardSurf, &HConvExtFD, &HAirFD, &HSkyFD, &HGrndFD, &TempOutsideAirFD, &RhoVaporAirOut, &HConvInFD, &HMassConvInFD, &RhoVaporAirIn, &MAT, &QHeatOutFlux, &OpaqSurfOutsideFaceConductionFlux, &OpaqSurfOutsideFaceConduction, &OpaqSurfInsFaceConductionFlux, &OpaqSurfInsFaceConduction, &QdotRadOutRepPerArea, &QdotRadOutRep, &QRadOutReport } ) {
+		a->deallocate();
+	}
+}
@@ -0,0 +1,61 @@
+// EnergyPlus::HeatBalanceSurfaceManager Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/DataGlobals.hh>
+#include <EnergyPlus/DataHeatBalance.hh>
+#include <EnergyPlus/DataSurfaces.hh>
+#include <EnergyPlus/HeatBalanceSurfaceManager.hh>
+#include <EnergyPlus/UtilityRoutines.hh>
+#include <ObjexxFCL/gio.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::DataGlobals;
+using namespace EnergyPlus::DataHeatBalance;
+using namespace EnergyPlus::DataSurfaces;
+using namespace EnergyPlus::HeatBalanceSurfaceManager;
+using namespace ObjexxFCL;
+
+TEST( HeatBalanceSurfaceManagerTest, SetupZoneCouplingGroups )
+{
+	OutputFileInits = GetNewUnitNumber();
+	{ IOFlags flags; flags.ACTION( "write" ); flags.STATUS( "UNKNOWN" ); gio::open( OutputFileInits, "eplusout.eio", flags ); }
+
+	// Zones 1 and 3 share an interzone wall; zone 2 has a partition to itself; zone 4 has an interzone pair within the zone
+	NumOfZones = 4;
+	Zone.allocate( NumOfZones );
+	Zone( 1 ).Name = "ZONE ONE";
+	Zone( 2 ).Name = "ZONE TWO";
+	Zone( 3 ).Name = "ZONE THREE";
+	Zone( 4 ).Name = "ZONE FOUR";
+	TotSurfaces = 6;
+	Surface.allocate( TotSurfaces );
+	for ( int SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) Surface( SurfNum ).HeatTransSurf = true;
+	Surface( 1 ).Zone = 1;
+	Surface( 1 ).ExtBoundCond = 4;
+	Surface( 2 ).Zone = 2;
+	Surface( 2 ).ExtBoundCond = 0;
+	Surface( 3 ).Zone = 2;
+	Surface( 3 ).ExtBoundCond = 3;
+	Surface( 4 ).Zone = 3;
+	Surface( 4 ).ExtBoundCond = 1;
+	Surface( 5 ).Zone = 4;
+	Surface( 5 ).ExtBoundCond = 6;
+	Surface( 6 ).Zone = 4;
+	Surface( 6 ).ExtBoundCond = 5;
+
+	SetupZoneCouplingGroups();
+
+	EXPECT_EQ( 3, NumZoneCouplingGroups );
+	EXPECT_EQ( 1, ZoneCouplingGroupNum( 1 ) );
+	EXPECT_EQ( 2, ZoneCouplingGroupNum( 2 ) );
+	EXPECT_EQ( 1, ZoneCouplingGroupNum( 3 ) );
+	EXPECT_EQ( 3, ZoneCouplingGroupNum( 4 ) );
+
+	{ IOFlags flags; flags.DISPOSE( "DELETE" ); gio::close( OutputFileInits, flags ); }
+	DataHeatBalance::clear_state();
+	DataSurfaces::clear_state();
+	NumOfZones = 0;
+}
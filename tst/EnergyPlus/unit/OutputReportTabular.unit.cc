@@ -5,10 +5,19 @@
 // ObjexxFCL Headers
 #include <ObjexxFCL/FArray1D.hh>
 // EnergyPlus Headers
+#include <EnergyPlus/DataEnvironment.hh>
+#include <EnergyPlus/DataGlobals.hh>
+#include <EnergyPlus/DataHeatBalance.hh>
+#include <EnergyPlus/DataHeatBalSurface.hh>
+#include <EnergyPlus/DataSizing.hh>
+#include <EnergyPlus/DataSurfaces.hh>
+#include <EnergyPlus/DataViewFactorInformation.hh>
+#include <EnergyPlus/DataZoneEquipment.hh>
 #include <EnergyPlus/OutputReportTabular.hh>
 
 using namespace EnergyPlus;
 using namespace EnergyPlus::OutputReportTabular;
+using namespace EnergyPlus::DataGlobals;
 using namespace ObjexxFCL;
 
 TEST( OutputReportTabularTest, ConfirmSetUnitsStyleFromString )
@@ -27,3 +36,133 @@ TEST( OutputReportTabularTest, Basic )
 	EXPECT_TRUE( warningAboutKeyNotFound( 0, 1, "moduleName" ) );
 	EXPECT_FALSE( warningAboutKeyNotFound( 100, 1, "moduleName") );
 }
+
+TEST( OutputReportTabularTest, MonthlyAggregationPlan )
+{
+	// table 1 can be planned and reads variable 7 twice; table 2 has a value when maximum column
+	MonthlyTablesCount = 2;
+	MonthlyTables.allocate( MonthlyTablesCount );
+	MonthlyTables( 1 ).firstColumn = 1;
+	MonthlyTables( 1 ).numColumns = 3;
+	MonthlyTables( 2 ).firstColumn = 4;
+	MonthlyTables( 2 ).numColumns = 2;
+	MonthlyColumnsCount = 5;
+	MonthlyColumns.allocate( MonthlyColumnsCount );
+	for ( int iCol = 1; iCol <= MonthlyColumnsCount; ++iCol ) {
+		MonthlyColumns( iCol ).typeOfVar = 2;
+		MonthlyColumns( iCol ).varNum = 7;
+		MonthlyColumns( iCol ).stepType = stepTypeZone;
+		MonthlyColumns( iCol ).avgSum = isSum;
+	}
+	MonthlyColumns( 1 ).aggType = aggTypeSumOrAvg;
+	MonthlyColumns( 2 ).aggType = aggTypeMaximum;
+	MonthlyColumns( 3 ).aggType = aggTypeHoursNonPositive;
+	MonthlyColumns( 3 ).varNum = 8;
+	MonthlyColumns( 4 ).aggType = aggTypeMaximum;
+	MonthlyColumns( 5 ).aggType = aggTypeValueWhenMaxMin;
+
+	SetupTabularAggregationPlan();
+	EXPECT_TRUE( MonthlyTablePlanned( 1 ) );
+	EXPECT_FALSE( MonthlyTablePlanned( 2 ) );
+	EXPECT_EQ( 2, NumAggSources );
+	EXPECT_EQ( 1, AggSourceStart( stepTypeZone ) );
+	EXPECT_EQ( 3, AggSourceStart( stepTypeHVAC ) );
+	EXPECT_EQ( 3, NumMonthlyAggKernels );
+	EXPECT_EQ( MonthlyAggSource( 1 ), MonthlyAggSource( 2 ) );
+
+	// gather a zone time step
+	DataEnvironment::Month = 2;
+	DataGlobals::TimeStepZoneSec = 900.0;
+	AggSourceValue( 1 ) = 1800.0;
+	AggSourceValue( 2 ) = 0.0;
+	MonthlyColumns( 2 ).reslt( 2 ) = 1.0;
+	GatherMonthlyAggregationPlan( ZoneTSReporting, 0.25, 1234 );
+	EXPECT_DOUBLE_EQ( 1800.0, MonthlyColumns( 1 ).reslt( 2 ) );
+	EXPECT_DOUBLE_EQ( 0.25, MonthlyColumns( 1 ).duration( 2 ) );
+	EXPECT_DOUBLE_EQ( 2.0, MonthlyColumns( 2 ).reslt( 2 ) );
+	EXPECT_EQ( 1234, MonthlyColumns( 2 ).timeStamp( 2 ) );
+	EXPECT_DOUBLE_EQ( 0.25, MonthlyColumns( 3 ).reslt( 2 ) );
+	EXPECT_DOUBLE_EQ( 0.0, MonthlyColumns( 4 ).reslt( 2 ) );
+
+	// a HVAC time step leaves the zone step columns alone
+	GatherMonthlyAggregationPlan( HVACTSReporting, 0.1, 1235 );
+	EXPECT_DOUBLE_EQ( 1800.0, MonthlyColumns( 1 ).reslt( 2 ) );
+
+	MonthlyTables.deallocate();
+	MonthlyColumns.deallocate();
+	MonthlyTablesCount = 0;
+	MonthlyColumnsCount = 0;
+	SetupTabularAggregationPlan();
+	EXPECT_EQ( 0, NumAggSources );
+	OutputReportTabular::clear_state();
+	DataEnvironment::Month = 0;
+}
+
+TEST( OutputReportTabularTest, LoadComponentDecayFromCTF )
+{
+	// one zone with two surfaces of the same construction exchanging radiation
+	NumOfTimeStepInHour = 1;
+	NumOfZones = 1;
+	DataZoneEquipment::ZoneEquipConfig.allocate( NumOfZones );
+	DataZoneEquipment::ZoneEquipConfig( 1 ).IsControlled = true;
+	DataSizing::CalcFinalZoneSizing.allocate( NumOfZones );
+	DataSizing::CalcFinalZoneSizing( 1 ).CoolDDNum = 2;
+	DataSizing::CalcFinalZoneSizing( 1 ).HeatDDNum = 0;
+	DataHeatBalance::TotConstructs = 1;
+	DataHeatBalance::Construct.allocate( DataHeatBalance::TotConstructs );
+	DataHeatBalance::Construct( 1 ).NumCTFTerms = 1;
+	DataHeatBalance::Construct( 1 ).NumHistories = 1;
+	DataHeatBalance::Construct( 1 ).CTFInside( 0 ) = 2.0;
+	DataHeatBalance::Construct( 1 ).CTFInside( 1 ) = 1.0;
+	DataHeatBalance::Construct( 1 ).CTFFlux( 1 ) = 0.5;
+	DataSurfaces::TotSurfaces = 2;
+	DataSurfaces::Surface.allocate( DataSurfaces::TotSurfaces );
+	// the conditions at the end of sizing differ from those of the cooling design day at the pulse
+	DataHeatBalance::HConvIn.dimension( DataSurfaces::TotSurfaces, 8.0 );
+	DataHeatBalSurface::TempSurfIn.dimension( DataSurfaces::TotSurfaces, 20.0 );
+	HConvInAtPulse.dimension( DataSurfaces::TotSurfaces, 2, 8.0 );
+	TempSurfInAtPulse.dimension( DataSurfaces::TotSurfaces, 2, 20.0 );
+	for ( int SurfNum = 1; SurfNum <= DataSurfaces::TotSurfaces; ++SurfNum ) {
+		HConvInAtPulse( SurfNum, 2 ) = 3.0;
+		TempSurfInAtPulse( SurfNum, 2 ) = 10.0 - KelvinConv;
+	}
+	DataViewFactorInformation::ZoneInfo.allocate( NumOfZones );
+	DataViewFactorInformation::ZoneInfo( 1 ).NumOfSurfaces = 2;
+	DataViewFactorInformation::ZoneInfo( 1 ).SurfacePtr.allocate( 2 );
+	DataViewFactorInformation::ZoneInfo( 1 ).ScriptF.dimension( 2, 2, 0.0 );
+	for ( int SurfNum = 1; SurfNum <= DataSurfaces::TotSurfaces; ++SurfNum ) {
+		DataSurfaces::Surface( SurfNum ).Zone = 1;
+		DataSurfaces::Surface( SurfNum ).Construction = 1;
+		DataSurfaces::Surface( SurfNum ).ExtBoundCond = 0;
+		DataViewFactorInformation::ZoneInfo( 1 ).SurfacePtr( SurfNum ) = SurfNum;
+	}
+	// a linearized radiant exchange coefficient of 1 W/m2-K at 10 K
+	DataViewFactorInformation::ZoneInfo( 1 ).ScriptF( 1, 2 ) = 0.00025;
+	DataViewFactorInformation::ZoneInfo( 1 ).ScriptF( 2, 1 ) = 0.00025;
+	// only the first surface absorbs radiation at 10am
+	ITABSFseq.dimension( DataSurfaces::TotSurfaces, 24, 2, 0.0 );
+	ITABSFseq( 1, 10, 2 ) = 0.8;
+	decayCurveCool.dimension( DataSurfaces::TotSurfaces, 24, 0.0 );
+	decayCurveHeat.dimension( DataSurfaces::TotSurfaces, 24, 0.0 );
+
+	ComputeLoadComponentDecayCurveFromCTF();
+
+	// during the pulse the balances are 6 T1 - T2 = 0.8 and 6 T2 - T1 = 0
+	EXPECT_NEAR( 3.0 * 6.0 / 35.0, decayCurveCool( 1, 1 ), 1.0e-6 );
+	// after the pulse only the CTF histories drive the balances
+	EXPECT_NEAR( 3.0 * ( 6.0 * ( -12.0 / 35.0 ) - 2.0 / 35.0 ) / 35.0, decayCurveCool( 1, 2 ), 1.0e-6 );
+	EXPECT_DOUBLE_EQ( 0.0, decayCurveCool( 2, 1 ) );
+	EXPECT_DOUBLE_EQ( 0.0, decayCurveHeat( 1, 1 ) );
+
+	OutputReportTabular::clear_state();
+	DataViewFactorInformation::ZoneInfo.deallocate();
+	DataHeatBalSurface::TempSurfIn.deallocate();
+	DataHeatBalance::HConvIn.deallocate();
+	DataSurfaces::Surface.deallocate();
+	DataSurfaces::TotSurfaces = 0;
+	DataHeatBalance::Construct.deallocate();
+	DataHeatBalance::TotConstructs = 0;
+	DataSizing::CalcFinalZoneSizing.deallocate();
+	DataZoneEquipment::ZoneEquipConfig.deallocate();
+	NumOfZones = 0;
+}
@@ -0,0 +1,40 @@
+// EnergyPlus::PlantManager Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/DataPlant.hh>
+#include <EnergyPlus/PlantManager.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::DataPlant;
+using namespace EnergyPlus::PlantManager;
+using namespace ObjexxFCL;
+
+TEST( PlantManagerTest, SetupPlantLoopGroups )
+{
+	// Loops 1 and 4 are joined by a chiller, loops 4 and 5 by a heat exchanger; loops 2 and 3 stand alone
+	TotNumLoops = 5;
+	PlantLoop.allocate( TotNumLoops );
+	for ( int l = 1; l <= TotNumLoops; ++l ) {
+		PlantLoop( l ).LoopSide.allocate( 2 );
+	}
+	PlantLoop( 1 ).LoopSide( SupplySide ).Connected.allocate( 1 );
+	PlantLoop( 1 ).LoopSide( SupplySide ).Connected( 1 ).LoopNum = 4;
+	PlantLoop( 1 ).LoopSide( SupplySide ).Connected( 1 ).LoopSideNum = DemandSide;
+	PlantLoop( 5 ).LoopSide( DemandSide ).Connected.allocate( 1 );
+	PlantLoop( 5 ).LoopSide( DemandSide ).Connected( 1 ).LoopNum = 4;
+	PlantLoop( 5 ).LoopSide( DemandSide ).Connected( 1 ).LoopSideNum = SupplySide;
+
+	SetupPlantLoopGroups();
+
+	EXPECT_EQ( 3, NumPlantLoopGroups );
+	EXPECT_EQ( 1, PlantLoopGroupNum( 1 ) );
+	EXPECT_EQ( 2, PlantLoopGroupNum( 2 ) );
+	EXPECT_EQ( 3, PlantLoopGroupNum( 3 ) );
+	EXPECT_EQ( 1, PlantLoopGroupNum( 4 ) );
+	EXPECT_EQ( 1, PlantLoopGroupNum( 5 ) );
+
+	DataPlant::clear_state();
+}
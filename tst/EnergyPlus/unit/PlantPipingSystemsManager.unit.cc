@@ -0,0 +1,132 @@
+// EnergyPlus::PlantPipingSystemsManager Unit Tests
+
+// C++ Headers
+#include <algorithm>
+#include <cmath>
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/DataPlantPipingSystems.hh>
+#include <EnergyPlus/PlantPipingSystemsManager.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::DataPlantPipingSystems;
+using namespace EnergyPlus::PlantPipingSystemsManager;
+using namespace ObjexxFCL;
+
+TEST( PlantPipingSystemsManagerTest, SolveFieldCellOperator )
+{
+	// three field cells in a row along X, unit conductances and unit Beta, with the solution { 1, 2, 3 }
+	FieldCellOperator Op;
+	Op.NumCells = 3;
+	Op.Neighbor.dimension( 6, 3, 0 );
+	Op.Conductance.dimension( 6, 3, 0.0 );
+	Op.Neighbor( -Direction_PositiveX, 1 ) = 2;
+	Op.Neighbor( -Direction_NegativeX, 2 ) = 1;
+	Op.Neighbor( -Direction_PositiveX, 2 ) = 3;
+	Op.Neighbor( -Direction_NegativeX, 3 ) = 2;
+	Op.Conductance( -Direction_PositiveX, 1 ) = 1.0;
+	Op.Conductance( -Direction_NegativeX, 2 ) = 1.0;
+	Op.Conductance( -Direction_PositiveX, 2 ) = 1.0;
+	Op.Conductance( -Direction_NegativeX, 3 ) = 1.0;
+	Op.Diagonal.dimension( 3 );
+	Op.Diagonal = { 2.0, 3.0, 2.0 };
+	Op.RHS.dimension( 3 );
+	Op.RHS = { 0.0, 2.0, 4.0 };
+	Op.Temperature.dimension( 3, 0.0 );
+	Op.Residual.dimension( 3 );
+	Op.Search.dimension( 3 );
+	Op.Product.dimension( 3 );
+	Op.Preconditioned.dimension( 3 );
+
+	int const Iterations( SolveFieldCellOperator( Op, 1.0e-10, 10 ) );
+	EXPECT_LE( Iterations, 3 );
+	EXPECT_NEAR( 1.0, Op.Temperature( 1 ), 1.0e-9 );
+	EXPECT_NEAR( 2.0, Op.Temperature( 2 ), 1.0e-9 );
+	EXPECT_NEAR( 3.0, Op.Temperature( 3 ), 1.0e-9 );
+
+	// starting from the solution takes no iterations
+	EXPECT_EQ( 0, SolveFieldCellOperator( Op, 1.0e-6, 10 ) );
+}
+
+TEST( PlantPipingSystemsManagerTest, SetupFieldCellOperator )
+{
+	// A 5x5x5 domain with uneven cell widths along X and a different conductivity in each cell;
+	// the outer layer of cells are far field boundary cells, the inner 3x3x3 cells are field cells
+	int const N( 5 );
+	Real64 const Width[ N ] = { 0.5, 1.0, 1.5, 1.0, 0.5 };
+	PipingSystemDomains.allocate( 1 );
+	auto & Domain( PipingSystemDomains( 1 ) );
+	Domain.Cells.allocate( {0,N-1}, {0,N-1}, {0,N-1} );
+	for ( int X = 0; X < N; ++X ) {
+		for ( int Y = 0; Y < N; ++Y ) {
+			for ( int Z = 0; Z < N; ++Z ) {
+				auto & cell( Domain.Cells( X, Y, Z ) );
+				cell.X_index = X;
+				cell.Y_index = Y;
+				cell.Z_index = Z;
+				cell.X_min = ( X == 0 ) ? 0.0 : Domain.Cells( X - 1, Y, Z ).X_max;
+				cell.X_max = cell.X_min + Width[ X ];
+				cell.Y_min = Y;
+				cell.Y_max = Y + 1.0;
+				cell.Z_min = Z;
+				cell.Z_max = Z + 1.0;
+				cell.Centroid.X = ( cell.X_min + cell.X_max ) / 2.0;
+				cell.Centroid.Y = Y + 0.5;
+				cell.Centroid.Z = Z + 0.5;
+				bool const Boundary( X == 0 || Y == 0 || Z == 0 || X == N - 1 || Y == N - 1 || Z == N - 1 );
+				cell.CellType = Boundary ? CellType_FarfieldBoundary : CellType_GeneralField;
+				cell.PipeIndex = 0;
+				cell.MyBase.Properties.Conductivity = 1.0 + 0.1 * X + 0.2 * Y + 0.3 * Z;
+				cell.MyBase.Beta = 0.5;
+				cell.MyBase.Temperature_PrevTimeStep = 15.0;
+				cell.MyBase.Temperature = Boundary ? 10.0 + X - Z : 15.0;
+			}
+		}
+	}
+	SetupCellNeighbors( 1 );
+
+	SetupFieldCellOperator( 1 );
+	auto const & Op( Domain.FieldCells );
+	ASSERT_EQ( 27, Op.NumCells );
+
+	// The operator is symmetric: each coupling between two field cells appears in both cells with the same conductance
+	for ( int FieldCellNum = 1; FieldCellNum <= Op.NumCells; ++FieldCellNum ) {
+		for ( int DirectionCounter = 1; DirectionCounter <= 6; ++DirectionCounter ) {
+			int const Neighbor( Op.Neighbor( DirectionCounter, FieldCellNum ) );
+			if ( Neighbor == 0 ) continue;
+			int const Opposite( ( DirectionCounter % 2 == 1 ) ? DirectionCounter + 1 : DirectionCounter - 1 );
+			EXPECT_EQ( FieldCellNum, Op.Neighbor( Opposite, Neighbor ) );
+			EXPECT_GT( Op.Conductance( DirectionCounter, FieldCellNum ), 0.0 );
+			EXPECT_NEAR( Op.Conductance( DirectionCounter, FieldCellNum ), Op.Conductance( Opposite, Neighbor ), 1.0e-12 );
+		}
+	}
+
+	// Point iteration of the field cells to convergence, as without PipingSystemsPCGSolve
+	for ( int Sweep = 1; Sweep <= 10000; ++Sweep ) {
+		Real64 MaxChange( 0.0 );
+		for ( int FieldCellNum = 1; FieldCellNum <= Op.NumCells; ++FieldCellNum ) {
+			auto & cell( Domain.Cells[ Op.Cell( FieldCellNum ) ] );
+			Real64 const Temperature( EvaluateFieldCellTemperature( 1, cell ) );
+			MaxChange = std::max( MaxChange, std::abs( Temperature - cell.MyBase.Temperature ) );
+			cell.MyBase.Temperature = Temperature;
+		}
+		if ( MaxChange < 1.0e-12 ) break;
+	}
+	FArray1D< Real64 > GaussSeidel( Op.NumCells );
+	for ( int FieldCellNum = 1; FieldCellNum <= Op.NumCells; ++FieldCellNum ) {
+		GaussSeidel( FieldCellNum ) = Domain.Cells[ Op.Cell( FieldCellNum ) ].MyBase.Temperature;
+		Domain.Cells[ Op.Cell( FieldCellNum ) ].MyBase.Temperature = 15.0;
+	}
+
+	// Conjugate gradient solve of the same field cells
+	Domain.SimControls.Convergence_CurrentToPrevIteration = 1.0e-6;
+	SolveFieldCellTemperatures( 1 );
+	for ( int FieldCellNum = 1; FieldCellNum <= Op.NumCells; ++FieldCellNum ) {
+		EXPECT_NEAR( GaussSeidel( FieldCellNum ), Domain.Cells[ Op.Cell( FieldCellNum ) ].MyBase.Temperature, 1.0e-6 );
+	}
+
+	PipingSystemDomains.deallocate();
+}
@@ -0,0 +1,84 @@
+// EnergyPlus::RuntimeLanguageProcessor Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/DataRuntimeLanguage.hh>
+#include <EnergyPlus/RuntimeLanguageProcessor.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::DataRuntimeLanguage;
+using namespace EnergyPlus::RuntimeLanguageProcessor;
+using namespace ObjexxFCL;
+
+TEST( RuntimeLanguageProcessorTest, CompiledStackMatchesInterpreter )
+{
+	True = SetErlValueNumber( 1.0 );
+	False = SetErlValueNumber( 0.0 );
+
+	NumErlStacks = 1;
+	ErlStack.allocate( NumErlStacks );
+	ErlStack( 1 ).Name = "TESTPROGRAM";
+	ErlStack( 1 ).Line = FArray1D_string( {
+		"SET X = 0",
+		"SET N = 0",
+		"WHILE N < 10",
+		"SET N = N + 1",
+		"IF N == 3",
+		"SET X = X + N * 2",
+		"ELSEIF N > 7",
+		"SET X = X - ( N / 2 ) ^ 2",
+		"ELSE",
+		"SET X = @MAX X ( @MOD N 3 )",
+		"ENDIF",
+		"ENDWHILE",
+		"SET Y = 1 / ( N - N )",
+		"SET Z = ( X < 0 ) || ( X >= 5 )",
+		"SET W = Y",
+		"SET V = @ABS ( @RANDOMUNIFORM 2 2 )",
+		"RETURN X"
+	} );
+	ErlStack( 1 ).NumLines = ErlStack( 1 ).Line.isize();
+
+	ParseStack( 1 );
+	ASSERT_EQ( 0, ErlStack( 1 ).NumErrors );
+	CompileStack( 1 );
+	ASSERT_TRUE( ErlStack( 1 ).Compiled );
+
+	// Run the interpreter first, then the compiled stack from the same starting values
+	FArray1D< ErlValueType > Initial( NumErlVariables );
+	FArray1D< ErlValueType > Expected( NumErlVariables );
+	for ( int v = 1; v <= NumErlVariables; ++v ) Initial( v ) = ErlVariable( v ).Value;
+	ErlStack( 1 ).Compiled = false;
+	ErlValueType const Interpreted( EvaluateStack( 1 ) );
+	for ( int v = 1; v <= NumErlVariables; ++v ) {
+		Expected( v ) = ErlVariable( v ).Value;
+		ErlVariable( v ).Value = Initial( v );
+	}
+	ErlStack( 1 ).Compiled = true;
+	ErlValueType const Compiled( EvaluateStack( 1 ) );
+
+	for ( int v = 1; v <= NumErlVariables; ++v ) {
+		EXPECT_EQ( Expected( v ).Type, ErlVariable( v ).Value.Type ) << ErlVariable( v ).Name;
+		EXPECT_DOUBLE_EQ( Expected( v ).Number, ErlVariable( v ).Value.Number ) << ErlVariable( v ).Name;
+		EXPECT_EQ( Expected( v ).Error, ErlVariable( v ).Value.Error ) << ErlVariable( v ).Name;
+	}
+	EXPECT_EQ( Interpreted.Type, Compiled.Type );
+	EXPECT_DOUBLE_EQ( Interpreted.Number, Compiled.Number );
+
+	// Erl applies ^ to the whole of X - ( N / 2 ), so X ends at ( ( ( 8 - 4 ) ^ 2 - 4.5 ) ^ 2 - 5 ) ^ 2
+	EXPECT_DOUBLE_EQ( 16192.5625, ErlVariable( FindEMSVariable( "X", 1 ) ).Value.Number );
+	EXPECT_DOUBLE_EQ( 1.0, ErlVariable( FindEMSVariable( "Z", 1 ) ).Value.Number );
+	EXPECT_DOUBLE_EQ( 2.0, ErlVariable( FindEMSVariable( "V", 1 ) ).Value.Number );
+	EXPECT_EQ( ValueError, ErlVariable( FindEMSVariable( "W", 1 ) ).Value.Type );
+	EXPECT_EQ( "Divide by zero!", ErlVariable( FindEMSVariable( "W", 1 ) ).Value.Error );
+	EXPECT_DOUBLE_EQ( 16192.5625, Compiled.Number );
+
+	ErlStack.deallocate();
+	ErlVariable.deallocate();
+	ErlExpression.deallocate();
+	NumErlStacks = 0;
+	NumErlVariables = 0;
+	NumExpressions = 0;
+}
@@ -0,0 +1,48 @@
+// EnergyPlus::SimAirServingZones Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/DataHVACGlobals.hh>
+#include <EnergyPlus/SimAirServingZones.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::DataHVACGlobals;
+using namespace EnergyPlus::SimAirServingZones;
+using namespace ObjexxFCL;
+
+TEST( SimAirServingZonesTest, MergeAirLoopSimStatistics )
+{
+	NumPrimaryAirSys = 3;
+	AirLoopSimIterMax.dimension( NumPrimaryAirSys, 0 );
+	AirLoopSimIterTot.dimension( NumPrimaryAirSys, 0 );
+	AirLoopSimNumCalls.dimension( NumPrimaryAirSys, 0 );
+	AirLoopSimIterTotSum.dimension( NumPrimaryAirSys, 0 );
+
+	// Statistics left by one HVAC iteration, filled in the reverse of air loop order
+	for ( int AirLoopNum = NumPrimaryAirSys; AirLoopNum >= 1; --AirLoopNum ) {
+		AirLoopSimIterMax( AirLoopNum ) = 2 * AirLoopNum;
+		AirLoopSimIterTot( AirLoopNum ) = 5 * AirLoopNum;
+		AirLoopSimNumCalls( AirLoopNum ) = AirLoopNum + 1;
+	}
+	AirLoopSimIterTotSum( 2 ) = 4; // carried over from an earlier iteration in the same HVAC step
+
+	int IterMax( 1 );
+	int IterTot( 7 );
+	int NumCallsTot( 3 );
+	MergeAirLoopSimStatistics( IterMax, IterTot, NumCallsTot );
+
+	EXPECT_EQ( 6, IterMax );
+	EXPECT_EQ( 7 + 5 + 10 + 15, IterTot );
+	EXPECT_EQ( 3 + 2 + 3 + 4, NumCallsTot );
+	EXPECT_EQ( 5, AirLoopSimIterTotSum( 1 ) );
+	EXPECT_EQ( 14, AirLoopSimIterTotSum( 2 ) );
+	EXPECT_EQ( 15, AirLoopSimIterTotSum( 3 ) );
+
+	NumPrimaryAirSys = 0;
+	AirLoopSimIterMax.deallocate();
+	AirLoopSimIterTot.deallocate();
+	AirLoopSimNumCalls.deallocate();
+	AirLoopSimIterTotSum.deallocate();
+}
@@ -5,7 +5,9 @@
 
 // EnergyPlus Headers
 #include <EnergyPlus/SizingManager.hh>
+#include <EnergyPlus/DataGlobals.hh>
 #include <EnergyPlus/DataSizing.hh>
+#include <EnergyPlus/DataZoneEquipment.hh>
 
 using namespace EnergyPlus;
 using namespace EnergyPlus::SizingManager;
@@ -158,3 +160,80 @@ TEST( GetOARequirementsTest, DSOA1 )
 	EXPECT_EQ( 0.4, OARequirements( OAIndex ).OAFlowACH );
 
 }
+
+TEST( SizingManagerTest, TransferZoneSizingResults )
+{
+	// Day 1 was simulated before the workers started; the worker simulated day 2
+	DataGlobals::NumOfZones = 1;
+	DataZoneEquipment::ZoneEquipConfig.allocate( 1 );
+	DataZoneEquipment::ZoneEquipConfig( 1 ).IsControlled = true;
+	CalcZoneSizing.allocate( 1, 2 );
+	ZoneSizing.allocate( 1, 2 );
+	DesDayWeath.allocate( 2 );
+	for ( int Day = 1; Day <= 2; ++Day ) {
+		DesDayWeath( Day ).Temp.dimension( 4, 0.0 );
+		CalcZoneSizing( 1, Day ).HeatLoadSeq.dimension( 4, 0.0 );
+		ZoneSizing( 1, Day ).DesCoolSetPtSeq.dimension( 4, 0.0 );
+	}
+	ZoneSizThermSetPtHi.dimension( 1, 24.0 );
+	ZoneSizThermSetPtLo.dimension( 1, 21.0 );
+	FirstWorkerSimDay = 2;
+	CurOverallSimDay = 2;
+
+	DesDayWeath( 2 ).DateString = "7/21";
+	DesDayWeath( 2 ).Temp( 3 ) = 33.0;
+	CalcZoneSizing( 1, 2 ).CoolDesDay = "SUMMER DESIGN DAY";
+	CalcZoneSizing( 1, 2 ).CoolDDNum = 2;
+	CalcZoneSizing( 1, 2 ).DesCoolLoad = 1500.0;
+	CalcZoneSizing( 1, 2 ).HeatLoadSeq( 4 ) = 250.0;
+	ZoneSizing( 1, 2 ).DesCoolSetPtSeq( 1 ) = 26.0;
+	ZoneSizThermSetPtHi( 1 ) = 26.0;
+	ZoneSizThermSetPtLo( 1 ) = 22.0;
+
+	ZoneSizingResultBuffer Buf;
+	int LastPeriod( 3 );
+	int LastMonth( 7 );
+	int LastDayOfMonth( 21 );
+	TransferZoneSizingResults( Buf, LastPeriod, LastMonth, LastDayOfMonth );
+
+	// Main process: day 2 not simulated, its own set point extremes
+	DesDayWeath( 2 ).DateString.clear();
+	DesDayWeath( 2 ).Temp = 0.0;
+	CalcZoneSizing( 1, 2 ).CoolDesDay.clear();
+	CalcZoneSizing( 1, 2 ).CoolDDNum = 0;
+	CalcZoneSizing( 1, 2 ).DesCoolLoad = 0.0;
+	CalcZoneSizing( 1, 2 ).HeatLoadSeq = 0.0;
+	ZoneSizing( 1, 2 ).DesCoolSetPtSeq = 0.0;
+	ZoneSizThermSetPtHi( 1 ) = 24.0;
+	ZoneSizThermSetPtLo( 1 ) = 21.0;
+	LastPeriod = LastMonth = LastDayOfMonth = 0;
+
+	Buf.Pack = false;
+	TransferZoneSizingResults( Buf, LastPeriod, LastMonth, LastDayOfMonth );
+	EXPECT_TRUE( Buf.Ok );
+	EXPECT_EQ( Buf.Data.size(), Buf.Pos );
+	EXPECT_EQ( 3, LastPeriod );
+	EXPECT_EQ( 7, LastMonth );
+	EXPECT_EQ( 21, LastDayOfMonth );
+	EXPECT_EQ( "7/21", DesDayWeath( 2 ).DateString );
+	EXPECT_DOUBLE_EQ( 33.0, DesDayWeath( 2 ).Temp( 3 ) );
+	EXPECT_EQ( "SUMMER DESIGN DAY", CalcZoneSizing( 1, 2 ).CoolDesDay );
+	EXPECT_EQ( 2, CalcZoneSizing( 1, 2 ).CoolDDNum );
+	EXPECT_DOUBLE_EQ( 1500.0, CalcZoneSizing( 1, 2 ).DesCoolLoad );
+	EXPECT_DOUBLE_EQ( 250.0, CalcZoneSizing( 1, 2 ).HeatLoadSeq( 4 ) );
+	EXPECT_DOUBLE_EQ( 26.0, ZoneSizing( 1, 2 ).DesCoolSetPtSeq( 1 ) );
+	EXPECT_DOUBLE_EQ( 26.0, ZoneSizThermSetPtHi( 1 ) );
+	EXPECT_DOUBLE_EQ( 21.0, ZoneSizThermSetPtLo( 1 ) );
+
+	// A truncated result is detected
+	ZoneSizingResultBuffer Short;
+	Short.Pack = false;
+	Short.Data = Buf.Data.substr( 0, Buf.Data.size() / 2 );
+	TransferZoneSizingResults( Short, LastPeriod, LastMonth, LastDayOfMonth );
+	EXPECT_FALSE( Short.Ok );
+
+	FirstWorkerSimDay = 0;
+	DataSizing::clear_state();
+	DataZoneEquipment::clear_state();
+	DataGlobals::NumOfZones = 0;
+}
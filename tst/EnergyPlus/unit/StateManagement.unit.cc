@@ -0,0 +1,42 @@
+// EnergyPlus::StateManagement Unit Tests
+
+// C++ Headers
+#include <stdexcept>
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/OutputReportTabular.hh>
+#include <EnergyPlus/StateManagement.hh>
+#include <EnergyPlus/public/EnergyPlusPgm.hh>
+
+using namespace EnergyPlus;
+using namespace ObjexxFCL;
+
+TEST( StateManagementTest, ClearAllStates )
+{
+	// The tabular report input flags and saved monthly columns are restored
+	OutputReportTabular::UpdateTabularReportsGetInput = false;
+	OutputReportTabular::GatherMonthlyResultsForTimestepRunOnce = false;
+	OutputReportTabular::MonthlyColumnsVarNum.dimension( 3, 7 );
+	OutputReportTabular::ErrCount1 = 2;
+
+	clearAllStates();
+
+	EXPECT_TRUE( OutputReportTabular::UpdateTabularReportsGetInput );
+	EXPECT_TRUE( OutputReportTabular::GatherMonthlyResultsForTimestepRunOnce );
+	EXPECT_FALSE( OutputReportTabular::MonthlyColumnsVarNum.allocated() );
+	EXPECT_EQ( 0, OutputReportTabular::ErrCount1 );
+}
+
+TEST( StateManagementTest, RunAgainRefusesWhileModulesAreNotCleared )
+{
+	// The modules cleared by clearAllStates are not listed
+	std::string const NotCleared( modulesNotCleared() );
+	ASSERT_FALSE( NotCleared.empty() );
+	EXPECT_EQ( std::string::npos, NotCleared.find( "OutputReportTabular" ) );
+	EXPECT_NE( std::string::npos, NotCleared.find( "HeatBalanceManager" ) );
+
+	EXPECT_THROW( EnergyPlusPgmRunAgain(), std::runtime_error );
+}
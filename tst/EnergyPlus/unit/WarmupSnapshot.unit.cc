@@ -0,0 +1,91 @@
+// EnergyPlus::WarmupSnapshot Unit Tests
+
+// C++ Headers
+#include <cstdio>
+#include <fstream>
+#ifdef _WIN32
+#include <process.h>
+#define getpid _getpid
+#else
+#include <unistd.h>
+#endif
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/HeatBalanceManager.hh>
+#include <EnergyPlus/WarmupSnapshot.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::WarmupSnapshot;
+using namespace ObjexxFCL;
+
+TEST( WarmupSnapshotTest, FileRoundTrip )
+{
+	std::string const FileName( "eplusout_warmup_test.bin" );
+
+	SnapshotRecord & Record( SnapshotRecords[ "CHICAGO WINTER|1|Sizing" ] );
+	Record.Signature = 1234567890123ull;
+	Record.Arrays[ "TH" ] = std::vector< Real64 >( { 23.0, 24.5, -3.25 } );
+	Record.Arrays[ "Empty" ];
+	SnapshotRecords[ "RUN PERIOD 1|3" ].Signature = 7;
+
+	ASSERT_TRUE( WriteSnapshotFile( FileName ) );
+	// rewriting replaces the existing file through a temporary file that does not remain
+	ASSERT_TRUE( WriteSnapshotFile( FileName ) );
+	EXPECT_FALSE( std::ifstream( FileName + '.' + std::to_string( getpid() ) + ".tmp" ) );
+	clear_state();
+	ASSERT_TRUE( ReadSnapshotFile( FileName ) );
+	std::remove( FileName.c_str() );
+
+	EXPECT_EQ( 2u, SnapshotRecords.size() );
+	SnapshotRecord const & Read( SnapshotRecords[ "CHICAGO WINTER|1|Sizing" ] );
+	EXPECT_EQ( 1234567890123ull, Read.Signature );
+	ASSERT_EQ( 2u, Read.Arrays.size() );
+	ASSERT_EQ( 3u, Read.Arrays.at( "TH" ).size() );
+	EXPECT_DOUBLE_EQ( -3.25, Read.Arrays.at( "TH" )[ 2 ] );
+	EXPECT_TRUE( Read.Arrays.at( "Empty" ).empty() );
+	EXPECT_EQ( 7u, SnapshotRecords[ "RUN PERIOD 1|3" ].Signature );
+
+	// A missing file leaves the records alone
+	EXPECT_FALSE( ReadSnapshotFile( FileName ) );
+	EXPECT_EQ( 2u, SnapshotRecords.size() );
+
+	clear_state();
+}
+
+TEST( WarmupSnapshotTest, TransferConvergenceHistories )
+{
+	using namespace HeatBalanceManager;
+
+	MaxTempPrevDay.dimension( 2, 0.0 );
+	MinTempPrevDay.dimension( 2, 0.0 );
+	MaxHeatLoadPrevDay.dimension( 2, 0.0 );
+	MaxCoolLoadPrevDay.dimension( 2, 0.0 );
+	MaxTempPrevDay( 1 ) = 26.5;
+	MinTempPrevDay( 2 ) = 18.25;
+	MaxCoolLoadPrevDay( 2 ) = 1500.0;
+
+	SnapshotRecord Record;
+	TransferConvergenceHistories( Record, false );
+	EXPECT_EQ( 4u, Record.Arrays.size() );
+
+	MaxTempPrevDay = 0.0;
+	MinTempPrevDay = 0.0;
+	MaxCoolLoadPrevDay = 0.0;
+	TransferConvergenceHistories( Record, true );
+	EXPECT_DOUBLE_EQ( 26.5, MaxTempPrevDay( 1 ) );
+	EXPECT_DOUBLE_EQ( 18.25, MinTempPrevDay( 2 ) );
+	EXPECT_DOUBLE_EQ( 1500.0, MaxCoolLoadPrevDay( 2 ) );
+
+	// Arrays whose size no longer matches are not restored
+	MaxTempPrevDay.dimension( 3, 0.0 );
+	TransferConvergenceHistories( Record, true );
+	EXPECT_DOUBLE_EQ( 0.0, MaxTempPrevDay( 1 ) );
+
+	MaxTempPrevDay.deallocate();
+	MinTempPrevDay.deallocate();
+	MaxHeatLoadPrevDay.deallocate();
+	MaxCoolLoadPrevDay.deallocate();
+}
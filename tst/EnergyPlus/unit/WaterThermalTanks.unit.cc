@@ -1,5 +1,8 @@
 // EnergyPlus::WaterThermalTank Unit Tests
 
+// C++ Headers
+#include <cmath>
+
 // Google Test Headers
 #include <gtest/gtest.h>
 
@@ -55,3 +58,63 @@ TEST( HeatPumpWaterHeaterTests, TestQsourceCalcs )
 	EXPECT_DOUBLE_EQ(Qsource, SourceMassFlowRate * Cp * DeltaT);
 	
 }
+
+TEST( WaterThermalTankTests, StratifiedTankImplicitSolve )
+{
+	using WaterThermalTanks::WaterThermalTank;
+
+	Real64 const Cp = 4180.0;
+	WaterThermalTank.allocate( 1 );
+	WaterThermalTanks::WaterThermalTankData & Tank( WaterThermalTank( 1 ) );
+	Tank.Nodes = 3;
+	Tank.Node.allocate( 3 );
+	Tank.UseEffectiveness = 1.0;
+	Tank.SourceEffectiveness = 1.0;
+	Tank.UseInletTemp = 10.0;
+	Tank.AmbientTemp = 20.0;
+	Tank.HeaterNode1 = 1;
+	Tank.HeaterOn1 = true;
+	for ( int NodeNum = 1; NodeNum <= 3; ++NodeNum ) {
+		Tank.Node( NodeNum ).Mass = 100.0;
+		Tank.Node( NodeNum ).Temp = 60.0 - 5.0 * NodeNum;
+		Tank.Node( NodeNum ).OnCycLossCoeff = 1.0;
+		if ( NodeNum > 1 ) Tank.Node( NodeNum ).CondCoeffUp = 10.0;
+		if ( NodeNum < 3 ) Tank.Node( NodeNum ).CondCoeffDn = 10.0;
+	}
+	// use flow enters at the bottom and rises to the outlet at the top
+	Tank.Node( 3 ).UseMassFlowRate = 0.05;
+	Tank.Node( 1 ).MassFlowFromLower = 0.05;
+	Tank.Node( 2 ).MassFlowFromLower = 0.05;
+
+	// a long step is stable and conserves energy at the end of step temperatures
+	Real64 const dt = 600.0;
+	WaterThermalTanks::SolveStratifiedTankNodes( 1, dt, Cp, 0.0, 4500.0, 0.0 );
+	Real64 EnergyChange = 0.0;
+	Real64 Qloss = 0.0;
+	for ( int NodeNum = 1; NodeNum <= 3; ++NodeNum ) {
+		EnergyChange += Tank.Node( NodeNum ).Mass * Cp * ( Tank.Node( NodeNum ).NewTemp - Tank.Node( NodeNum ).Temp );
+		Qloss += Tank.Node( NodeNum ).OnCycLossCoeff * ( Tank.AmbientTemp - Tank.Node( NodeNum ).NewTemp );
+		EXPECT_GT( Tank.Node( NodeNum ).NewTemp, Tank.UseInletTemp );
+		EXPECT_LT( Tank.Node( NodeNum ).NewTemp, 60.0 );
+	}
+	Real64 const Quse = 0.05 * Cp * ( Tank.UseInletTemp - Tank.Node( 1 ).NewTemp );
+	EXPECT_NEAR( ( Quse + Qloss + 4500.0 ) * dt, EnergyChange, 1.0e-6 * std::abs( EnergyChange ) );
+
+	// inverted nodes are mixed until the temperatures decrease downwards
+	Tank.Node( 1 ).NewTemp = 50.0;
+	Tank.Node( 2 ).NewTemp = 40.0;
+	Tank.Node( 3 ).NewTemp = 60.0;
+	WaterThermalTanks::MixStratifiedTankNodes( 1 );
+	EXPECT_DOUBLE_EQ( 50.0, Tank.Node( 1 ).NewTemp );
+	EXPECT_DOUBLE_EQ( 50.0, Tank.Node( 2 ).NewTemp );
+	EXPECT_DOUBLE_EQ( 50.0, Tank.Node( 3 ).NewTemp );
+	Tank.Node( 1 ).NewTemp = 60.0;
+	Tank.Node( 2 ).NewTemp = 40.0;
+	Tank.Node( 3 ).NewTemp = 50.0;
+	WaterThermalTanks::MixStratifiedTankNodes( 1 );
+	EXPECT_DOUBLE_EQ( 60.0, Tank.Node( 1 ).NewTemp );
+	EXPECT_DOUBLE_EQ( 45.0, Tank.Node( 2 ).NewTemp );
+	EXPECT_DOUBLE_EQ( 45.0, Tank.Node( 3 ).NewTemp );
+
+	WaterThermalTank.deallocate();
+}
@@ -0,0 +1,59 @@
+// EnergyPlus::WindowComplexManager Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/WindowComplexManager.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::WindowComplexManager;
+using namespace ObjexxFCL;
+
+TEST( WindowComplexManagerTest, SparseBSDFMatrix )
+{
+	// a mostly diagonal matrix is compressed, and its column sums match the dense ones
+	FArray2D< Real64 > Mat( 4, 4, 0.0 );
+	for ( int I = 1; I <= 4; ++I ) Mat( I, I ) = 0.1 * I;
+	Mat( 1, 3 ) = 0.5;
+	FArray1D< Real64 > Weights( 4 );
+	for ( int I = 1; I <= 4; ++I ) Weights( I ) = 1.0 + I;
+	FArray1D< Real64 > DenseSums( 4 );
+	FArray1D< Real64 > SparseSums( 4 );
+	FArray1D< Real64 > DenseRowSums( 4 );
+	FArray1D< Real64 > SparseRowSums( 4 );
+	FArray2D< Real64 > const Dense( Mat );
+	BSDFRowSums( Mat, Weights, DenseRowSums );
+	BSDFColumnSums( Mat, Weights, DenseSums );
+	EXPECT_DOUBLE_EQ( 2.0 * 0.5 + 4.0 * 0.3, DenseSums( 3 ) );
+
+	BSDFSparseMatrix Sparse;
+	CompressBSDFMatrix( Mat, Sparse );
+	ASSERT_TRUE( Sparse.Compressed );
+	EXPECT_FALSE( Mat.allocated() );
+	EXPECT_EQ( 5, Sparse.Value.isize() );
+	EXPECT_EQ( 6, Sparse.ColStart( 5 ) );
+	BSDFColumnSums( Sparse, Weights, SparseSums );
+	for ( int J = 1; J <= 4; ++J ) EXPECT_DOUBLE_EQ( DenseSums( J ), SparseSums( J ) );
+	BSDFRowSums( Sparse, Weights, SparseRowSums );
+	for ( int I = 1; I <= 4; ++I ) EXPECT_DOUBLE_EQ( DenseRowSums( I ), SparseRowSums( I ) );
+
+	// elements are looked up in the compressed matrix, including the zeros
+	for ( int I = 1; I <= 4; ++I ) {
+		for ( int J = 1; J <= 4; ++J ) {
+			EXPECT_DOUBLE_EQ( Dense( I, J ), BSDFMatrixElement( Sparse, I, J ) );
+		}
+	}
+
+	// a dense matrix stays dense
+	FArray2D< Real64 > Full( 2, 2, 1.0 );
+	Full( 2, 1 ) = 2.0;
+	BSDFSparseMatrix FullSparse;
+	CompressBSDFMatrix( Full, FullSparse );
+	EXPECT_FALSE( FullSparse.Compressed );
+	EXPECT_TRUE( Full.allocated() );
+	FArray1D< Real64 > RowSums( 2 );
+	BSDFRowSums( Full, Weights, RowSums );
+	EXPECT_DOUBLE_EQ( 2.0 + 3.0, RowSums( 1 ) );
+	EXPECT_DOUBLE_EQ( 4.0 + 3.0, RowSums( 2 ) );
+}
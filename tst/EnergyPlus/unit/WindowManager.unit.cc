@@ -0,0 +1,105 @@
+// EnergyPlus::WindowManager Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/DataHeatBalance.hh>
+#include <EnergyPlus/DataSystemVariables.hh>
+#include <EnergyPlus/WindowManager.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::DataHeatBalance;
+using namespace EnergyPlus::WindowManager;
+using namespace ObjexxFCL;
+
+TEST( WindowManagerTest, GasMixtureTables )
+{
+	// an air/argon mixture and a single gas, which is not tabulated
+	TotMaterials = 2;
+	Material.allocate( TotMaterials );
+	Material( 1 ).Group = WindowGasMixture;
+	Material( 1 ).Thickness = 0.0127;
+	Material( 1 ).NumberOfGasesInMixture = 2;
+	Material( 1 ).GasFract( 1 ) = 0.1;
+	Material( 1 ).GasFract( 2 ) = 0.9;
+	for ( int IMix = 1; IMix <= 2; ++IMix ) {
+		Material( 1 ).GasWght( IMix ) = GasWght( IMix );
+		for ( int ICoeff = 1; ICoeff <= 3; ++ICoeff ) {
+			Material( 1 ).GasCon( IMix, ICoeff ) = GasCoeffsCon( IMix, ICoeff );
+			Material( 1 ).GasVis( IMix, ICoeff ) = GasCoeffsVis( IMix, ICoeff );
+			Material( 1 ).GasCp( IMix, ICoeff ) = GasCoeffsCp( IMix, ICoeff );
+		}
+	}
+	Material( 2 ).Group = WindowGas;
+	Material( 2 ).NumberOfGasesInMixture = 1;
+
+	DataSystemVariables::WindowGasPropertyTables = true;
+	SetupGasMixtureTables();
+	EXPECT_EQ( 1, GasTableNum( 1 ) );
+	EXPECT_EQ( 0, GasTableNum( 2 ) );
+
+	// gap 2 holds the mixture; compare the tables with the full calculation between table points
+	gap( 2 ) = Material( 1 ).Thickness;
+	gnmix( 2 ) = 2;
+	for ( int IMix = 1; IMix <= 2; ++IMix ) {
+		gwght( 2, IMix ) = Material( 1 ).GasWght( IMix );
+		gfract( 2, IMix ) = Material( 1 ).GasFract( IMix );
+		for ( int ICoeff = 1; ICoeff <= 3; ++ICoeff ) {
+			gcon( 2, IMix, ICoeff ) = Material( 1 ).GasCon( IMix, ICoeff );
+			gvis( 2, IMix, ICoeff ) = Material( 1 ).GasVis( IMix, ICoeff );
+			gcp( 2, IMix, ICoeff ) = Material( 1 ).GasCp( IMix, ICoeff );
+		}
+	}
+	Real64 con;
+	Real64 pr;
+	Real64 gr;
+	Real64 dens;
+	Real64 visc;
+	gmat( 2 ) = 0;
+	WindowGasConductance( 285.3, 290.1, 2, con, pr, gr );
+	WindowGasPropertiesAtTemp( 287.7, 2, dens, visc );
+	Real64 conTable;
+	Real64 prTable;
+	Real64 grTable;
+	Real64 densTable;
+	Real64 viscTable;
+	gmat( 2 ) = 1;
+	WindowGasConductance( 285.3, 290.1, 2, conTable, prTable, grTable );
+	WindowGasPropertiesAtTemp( 287.7, 2, densTable, viscTable );
+	EXPECT_NEAR( con, conTable, 1.0e-5 * con );
+	EXPECT_NEAR( pr, prTable, 1.0e-5 * pr );
+	EXPECT_NEAR( gr, grTable, 1.0e-4 * gr );
+	EXPECT_NEAR( dens, densTable, 1.0e-12 * dens );
+	EXPECT_NEAR( visc, viscTable, 1.0e-5 * visc );
+
+	// outside the tables the full calculation is used
+	Real64 cp;
+	EXPECT_FALSE( GasMixtureTableLookup( 2, GasTableTempMin - 1.0, con, visc, cp, dens ) );
+	EXPECT_TRUE( GasMixtureTableLookup( 2, GasTableTempMin, con, visc, cp, dens ) );
+
+	DataSystemVariables::WindowGasPropertyTables = false;
+	WindowManager::clear_state();
+	EXPECT_FALSE( GasTableNum.allocated() );
+	EXPECT_EQ( 0, gmat( 2 ) );
+	Material.deallocate();
+	TotMaterials = 0;
+}
+
+TEST( WindowManagerTest, ClearStateRestoresSpectrum )
+{
+	// a user-defined solar spectrum replaces the default one until the state is cleared
+	wle = 0.0;
+	e( 1 ) = 1.0;
+	CustomSpectrumDataRead = true;
+
+	WindowManager::clear_state();
+
+	EXPECT_FALSE( CustomSpectrumDataRead );
+	EXPECT_DOUBLE_EQ( 0.3, wle( 1 ) );
+	EXPECT_DOUBLE_EQ( 2.537, wle( nume ) );
+	EXPECT_DOUBLE_EQ( 0.0, e( 1 ) );
+	EXPECT_DOUBLE_EQ( 9.5, e( 2 ) );
+	EXPECT_DOUBLE_EQ( 0.380, wlt3( 1 ) );
+	EXPECT_DOUBLE_EQ( 0.0001, y30( 2 ) );
+}
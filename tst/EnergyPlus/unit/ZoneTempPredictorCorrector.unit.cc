@@ -0,0 +1,88 @@
+// EnergyPlus::ZoneTempPredictorCorrector Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/DataGlobals.hh>
+#include <EnergyPlus/DataHeatBalance.hh>
+#include <EnergyPlus/DataHeatBalFanSys.hh>
+#include <EnergyPlus/DataSurfaces.hh>
+#include <EnergyPlus/ZonePlenum.hh>
+#include <EnergyPlus/ZoneTempPredictorCorrector.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::DataGlobals;
+using namespace EnergyPlus::DataHeatBalance;
+using namespace EnergyPlus::DataHeatBalFanSys;
+using namespace EnergyPlus::DataSurfaces;
+using namespace EnergyPlus::ZonePlenum;
+using namespace EnergyPlus::ZoneTempPredictorCorrector;
+using namespace ObjexxFCL;
+
+TEST( ZoneTempPredictorCorrectorTest, ZoneAirSumsLookup )
+{
+	NumOfZones = 2;
+	Zone.allocate( NumOfZones );
+	Zone( 1 ).SurfaceFirst = 1;
+	Zone( 1 ).SurfaceLast = 3;
+	Zone( 2 ).SurfaceFirst = 4;
+	Zone( 2 ).SurfaceLast = 5;
+	TotSurfaces = 5;
+	Surface.allocate( TotSurfaces );
+	for ( int SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) Surface( SurfNum ).HeatTransSurf = ( SurfNum != 2 );
+
+	SetupZoneAirSumsLookup();
+
+	// surface 2 is skipped, the others stay in zone and surface order
+	ASSERT_EQ( 4, ZoneHTSurfaceList.isize() );
+	EXPECT_EQ( 1, ZoneHTSurfaceStart( 1 ) );
+	EXPECT_EQ( 3, ZoneHTSurfaceStart( 2 ) );
+	EXPECT_EQ( 5, ZoneHTSurfaceStart( 3 ) );
+	EXPECT_EQ( 1, ZoneHTSurfaceList( 1 ) );
+	EXPECT_EQ( 3, ZoneHTSurfaceList( 2 ) );
+	EXPECT_EQ( 4, ZoneHTSurfaceList( 3 ) );
+	EXPECT_EQ( 5, ZoneHTSurfaceList( 4 ) );
+	EXPECT_EQ( 0, ZoneRetPlenumIndex( 2 ) );
+
+	// the plenum lookups are rebuilt once the plenum input has been read
+	NumZoneReturnPlenums = 1;
+	ZoneRetPlenCond.allocate( NumZoneReturnPlenums );
+	ZoneRetPlenCond( 1 ).ActualZoneNum = 2;
+	SetupZoneAirSumsLookup();
+	EXPECT_EQ( 0, ZoneRetPlenumIndex( 1 ) );
+	EXPECT_EQ( 1, ZoneRetPlenumIndex( 2 ) );
+	EXPECT_EQ( 0, ZoneSupPlenumIndex( 2 ) );
+
+	// solve the zone air heat balance with each algorithm
+	ZTM1.dimension( NumOfZones, 20.0 );
+	ZTM2.dimension( NumOfZones, 20.0 );
+	ZTM3.dimension( NumOfZones, 20.0 );
+	ZoneT1.dimension( NumOfZones, 20.0 );
+	ZT.dimension( NumOfZones, 20.0 );
+	ZoneAirSolutionAlgo = Use3rdOrder;
+	EXPECT_DOUBLE_EQ( ( 50.0 + 100.0 * 20.0 * 11.0 / 6.0 ) / ( 100.0 * 11.0 / 6.0 + 2.0 ), SolveZoneAirTemp( 1, 100.0, 2.0, 50.0 ) );
+	ZoneAirSolutionAlgo = UseEulerMethod;
+	EXPECT_DOUBLE_EQ( ( 100.0 * 20.0 + 50.0 ) / ( 100.0 + 2.0 ), SolveZoneAirTemp( 1, 100.0, 2.0, 50.0 ) );
+	ZoneAirSolutionAlgo = UseAnalyticalSolution;
+	EXPECT_DOUBLE_EQ( 20.5, SolveZoneAirTemp( 1, 100.0, 0.0, 50.0 ) );
+	EXPECT_DOUBLE_EQ( ( 20.0 - 25.0 ) * std::exp( -0.02 ) + 25.0, SolveZoneAirTemp( 1, 100.0, 2.0, 50.0 ) );
+	ZoneAirSolutionAlgo = Use3rdOrder;
+
+	ZTM1.deallocate();
+	ZTM2.deallocate();
+	ZTM3.deallocate();
+	ZoneT1.deallocate();
+	ZT.deallocate();
+	ZoneRetPlenCond.deallocate();
+	ZoneRetPlenumIndex.deallocate();
+	ZoneSupPlenumIndex.deallocate();
+	ZoneHTSurfaceStart.deallocate();
+	ZoneHTSurfaceList.deallocate();
+	ZoneAirSumsNumPlenums = -1;
+	NumZoneReturnPlenums = 0;
+	Surface.deallocate();
+	Zone.deallocate();
+	TotSurfaces = 0;
+	NumOfZones = 0;
+}